@@ -0,0 +1,771 @@
+/** @file check.cpp Defines a stand-alone program to check the sieve.
+ *
+ * This program compares the counts reported by the `primedist` engine
+ * against a plain sieve of Eratosthenes, over ranges chosen to probe the
+ * edges of segments, buckets, and base prime reservations, and under a
+ * variety of engine options.  Each check uses a fresh engine, so that no
+ * base primes reserved by an earlier check can hide a missing reservation.
+ * It then compares the lookups of `pi_table.hpp` against the engine, around
+ * the edges and midpoints of table blocks, and walks `prime_iterator` (and,
+ * when compiled as C++20, `primes`) up and down across segment edges.
+ * Finally, it reads cache sizes from fixture sysfs trees and round-trips
+ * options through a profile, both in a temporary directory.  Any
+ * disagreement is reported as an internal error.
+ */
+
+// PREPROCESSOR {{{
+
+#include "autotune.hpp"
+#include "pi_table.hpp"
+#include "prime_iterator.hpp"
+#include "primedist.hpp"
+
+#include <sys/stat.h>
+
+#if defined(CHECK_COROUTINES) && !defined(__cpp_lib_coroutine)
+#error "CHECK_COROUTINES is defined, but <coroutine> is not available"
+#endif
+
+// }}}
+
+// USINGS {{{
+
+using primedist::cache_info;
+using primedist::constellation;
+using primedist::engine;
+using primedist::options;
+using primedist::pi_data::blocks;
+using primedist::pi_data::limit;
+using primedist::pi_data::stride;
+using primedist::prime_iterator;
+using std::logic_error;
+using std::runtime_error;
+using std::size_t;
+using std::string;
+using std::to_string;
+using std::uint32_t;
+using std::uint64_t;
+using std::vector;
+
+// }}}
+
+// PRIVATE FUNCTIONS {{{
+
+namespace {
+
+/** The plain sieve covers every value any check of the engine may look at.
+  */
+uint64_t const plain_limit = 1 << 20;
+
+/** Returns a plain sieve of the values below `plain_limit`. */
+vector<bool> const& plain()
+{
+    static vector<bool> const is_prime = [] {
+        vector<bool> r(plain_limit, true);
+        r[0] = r[1] = false;
+        for (uint64_t i = 2; i * i < plain_limit; ++i) {
+            if (r[i]) {
+                for (uint64_t j = i * i; j < plain_limit; j += i)
+                    r[j] = false;
+            }
+        }
+        return r;
+    }();
+    return is_prime;
+}
+
+/** The offsets of each series counted by `check_patterns`, beyond 0. */
+vector<vector<unsigned>> const series = {
+    {}, {2}, {4}, {6}, {2, 6}, {2, 6, 8}
+};
+
+/** Returns whether `v` begins a match of the `k`th series. */
+bool begins(uint64_t v, size_t k)
+{
+    if (!plain()[v])
+        return false;
+    for (auto d : series[k]) {
+        if (!plain()[v + d])
+            return false;
+    }
+    return true;
+}
+
+/** Returns the number of values in `[lo, hi)` beginning a match of the
+  * `k`th series, from running totals of matches below each value.
+  */
+uint64_t count(size_t k, uint64_t lo, uint64_t hi)
+{
+    static vector<vector<uint32_t>> const totals = [] {
+        vector<vector<uint32_t>> r(series.size());
+        for (size_t j = 0; j < r.size(); ++j) {
+            r[j].resize(plain_limit - 7);
+            for (uint64_t v = 0; v + 1 < r[j].size(); ++v)
+                r[j][v + 1] = r[j][v] + begins(v, j);
+        }
+        return r;
+    }();
+    return totals[k][hi] - totals[k][lo];
+}
+
+/** Throws `logic_error` describing a mismatch of `what`. */
+void mismatch(
+        string const&  what,
+        options const& opts,
+        uint64_t       lo,
+        uint64_t       weight,
+        size_t         i,
+        uint64_t       expected,
+        uint64_t       actual)
+{
+    throw logic_error(
+            what + " differs in bucket " + to_string(i)
+            + " of [" + to_string(lo) + ", +" + to_string(weight)
+            + "...) with segment_words " + to_string(opts.segment_words)
+            + ", presieve " + to_string(opts.presieve)
+            + ", threads " + to_string(opts.threads) + ": "
+            + to_string(expected) + " != " + to_string(actual));
+}
+
+/** Checks `fill_patterns` over `w` buckets of `weight` values from `lo`. */
+void check_patterns(
+        options const& opts,
+        uint64_t       lo,
+        uint64_t       weight,
+        size_t         w)
+{
+    auto k = series.size();
+    vector<size_t> result(w * k);
+    engine(opts).fill_patterns<
+            constellation<>,
+            constellation<2>,
+            constellation<4>,
+            constellation<6>,
+            constellation<2, 6>,
+            constellation<2, 6, 8>>(result, lo, weight);
+    for (size_t j = 0; j < k; ++j) {
+        for (size_t i = 0; i < w; ++i) {
+            auto n = count(j, lo + i * weight, lo + (i + 1) * weight);
+            if (result[j * w + i] != n)
+                mismatch("series " + to_string(j), opts, lo, weight, i,
+                         n, result[j * w + i]);
+        }
+    }
+}
+
+/** Checks `fill_patterns` over `w` buckets of `weight` values from `lo`,
+  * beyond the reach of the plain sieve, against an engine with default
+  * options.  Tiny segments there leave most base primes out of the cursor.
+  */
+void check_far_patterns(
+        options const& opts,
+        uint64_t       lo,
+        uint64_t       weight,
+        size_t         w)
+{
+    auto k = series.size();
+    vector<size_t> expected(w * k), actual(w * k);
+    auto fill = [=](options const& o, vector<size_t>& result) {
+        engine(o).fill_patterns<
+                constellation<>,
+                constellation<2>,
+                constellation<4>,
+                constellation<6>,
+                constellation<2, 6>,
+                constellation<2, 6, 8>>(result, lo, weight);
+    };
+    fill(primedist::default_options(), expected);
+    fill(opts, actual);
+    for (size_t i = 0; i < w * k; ++i) {
+        if (expected[i] != actual[i])
+            mismatch("far series " + to_string(i / w), opts, lo, weight,
+                     i % w, expected[i], actual[i]);
+    }
+}
+
+/** Checks `fill_residues`, and residue matrices filled alongside
+  * `fill_patterns`, over `w` buckets of `weight` values from `lo`, for
+  * moduli whose masks have one or several phases, and moduli too large for
+  * masks.
+  */
+void check_residues(
+        options const& opts,
+        uint64_t       lo,
+        uint64_t       weight,
+        size_t         w)
+{
+    unsigned const moduli[] = {1, 3, 4, 10, 30, 64, 65, 100};
+    vector<primedist::residues> classes;
+    vector<vector<size_t>> expected, swept, fused;
+    vector<primedist::residue_matrix> matrices;
+    classes.reserve(std::end(moduli) - std::begin(moduli));
+    for (auto k : moduli) {
+        classes.emplace_back(k);
+        expected.emplace_back(k * w);
+        swept.emplace_back(k * w);
+        fused.emplace_back(k * w);
+        engine(opts).fill_residues(swept.back(), lo, weight, classes.back());
+    }
+    for (size_t j = 0; j < classes.size(); ++j)
+        matrices.push_back({&classes[j], fused[j]});
+    vector<size_t> counts(w * 2);
+    engine(opts).fill_patterns<constellation<>, constellation<2>>(
+            counts, lo, weight, nullptr, matrices);
+    for (auto v = lo; v < lo + w * weight; ++v) {
+        if (!plain()[v])
+            continue;
+        for (size_t j = 0; j < classes.size(); ++j)
+            ++expected[j][v % moduli[j] * w + (v - lo) / weight];
+    }
+    for (size_t j = 0; j < classes.size(); ++j) {
+        for (size_t c = 0; c < moduli[j] * w; ++c) {
+            auto what = "residue " + to_string(c / w)
+                      + " mod " + to_string(moduli[j]);
+            if (expected[j][c] != swept[j][c])
+                mismatch(what, opts, lo, weight, c % w,
+                         expected[j][c], swept[j][c]);
+            if (expected[j][c] != fused[j][c])
+                mismatch("fused " + what, opts, lo, weight, c % w,
+                         expected[j][c], fused[j][c]);
+        }
+    }
+    for (size_t i = 0; i < w; ++i) {
+        auto n = count(0, lo + i * weight, lo + (i + 1) * weight);
+        if (counts[i] != n)
+            mismatch("series 0 with residues", opts, lo, weight, i,
+                     n, counts[i]);
+    }
+}
+
+/** Checks a `gap_collector` of `bins` histogram bins over `w` buckets of
+  * `weight` values from `lo`, filled alongside `fill_patterns` if `fused`
+  * is true, and alongside `fill_buckets` otherwise.
+  */
+void check_gaps(
+        options const& opts,
+        uint64_t       lo,
+        uint64_t       weight,
+        size_t         w,
+        size_t         bins,
+        bool           fused)
+{
+    vector<primedist::gap_stats> stats(w), plain_stats(w);
+    vector<size_t> counts(w * 2);
+    vector<size_t> histogram(w * bins), plain_histogram(w * bins);
+    primedist::gap_collector gaps(stats, histogram);
+    if (fused) {
+        engine(opts).fill_patterns<constellation<>, constellation<2>>(
+                counts, lo, weight, &gaps);
+    } else {
+        engine(opts).fill_buckets({counts.data(), w}, lo, weight, &gaps);
+    }
+    uint64_t last = 0;
+    for (auto v = lo; v < lo + w * weight; ++v) {
+        if (!plain()[v])
+            continue;
+        auto i = (v - lo) / weight;
+        if (last) {
+            auto& s = plain_stats[i];
+            auto  g = v - last;
+            ++s.count;
+            s.sum += g;
+            s.max = std::max(s.max, g);
+            if (bins)
+                ++plain_histogram[
+                        i * bins + std::min<uint64_t>(g / 2, bins - 1)];
+        }
+        last = v;
+    }
+    string what = fused ? "fused gap " : "gap ";
+    for (size_t i = 0; i < w; ++i) {
+        auto const& e = plain_stats[i];
+        auto const& a = stats[i];
+        if (e.count != a.count)
+            mismatch(what + "count", opts, lo, weight, i, e.count, a.count);
+        if (e.sum != a.sum)
+            mismatch(what + "sum", opts, lo, weight, i, e.sum, a.sum);
+        if (e.max != a.max)
+            mismatch(what + "max", opts, lo, weight, i, e.max, a.max);
+        for (size_t j = 0; j < bins; ++j) {
+            auto k = i * bins + j;
+            if (plain_histogram[k] != histogram[k])
+                mismatch(what + "bin " + to_string(j), opts, lo, weight, i,
+                         plain_histogram[k], histogram[k]);
+        }
+    }
+}
+
+/** Throws `logic_error` describing a mismatch of the table's `what`. */
+void mismatch(string const& what, uint64_t expected, uint64_t actual)
+{
+    throw logic_error(
+            "table " + what + ": "
+            + to_string(expected) + " != " + to_string(actual));
+}
+
+/** Checks `pi`, `count`, and `fill_buckets` from `pi_table.hpp` against
+  * the engine, near the start and end of the table.
+  */
+void check_table()
+{
+    engine sieve, table;
+
+    // The table sieves up to half a block either way from a lookup, so
+    // probe both sides of each block's midpoint.
+
+    uint64_t const edges[] = {0, 1, 2, 12345, blocks - 2, blocks - 1};
+    uint64_t const offsets[] = {0, 1, 2, 3, 499, 500, 501, 502, 997, 999};
+    auto last = limit - 2 * stride;
+    auto below = sieve.count(0, last);
+    for (auto b : edges) {
+        auto base = b * stride;
+        auto n = base < last
+               ? sieve.count(0, base)
+               : below + sieve.count(last, base);
+        for (auto r : offsets) {
+            auto x = base + r;
+            auto expected = n + sieve.count(base, x);
+            auto actual = primedist::pi(&table, x);
+            if (expected != actual)
+                mismatch("pi(" + to_string(x) + ")", expected, actual);
+        }
+    }
+    auto expected = below + sieve.count(last, limit);
+    auto actual = primedist::pi(&table, limit);
+    if (expected != actual)
+        mismatch("pi at the limit", expected, actual);
+
+    // Ranges within, straddling, and beyond the end of the table.
+
+    for (auto const& r : vector<std::pair<uint64_t, uint64_t>>{
+            {0, 0}, {5, 3}, {0, 1}, {2, 3}, {499, 1501}, {500, 2500},
+            {501, 12499}, {limit - 1501, limit}, {limit - 499, limit + 1},
+            {limit, limit + 777}, {limit + 1, limit + 5000}}) {
+        expected = r.first < r.second ? sieve.count(r.first, r.second) : 0;
+        actual = primedist::count(&table, r.first, r.second);
+        if (expected != actual)
+            mismatch("count[" + to_string(r.first) + ", "
+                     + to_string(r.second) + ")", expected, actual);
+    }
+
+    // Buckets aligned and unaligned to blocks, too narrow for the table,
+    // and running past its end.
+
+    for (auto const& b : vector<std::pair<uint64_t, uint64_t>>{
+            {0, 1000}, {0, 1234}, {777, 1000}, {501, 2500}, {0, 999},
+            {limit - 20000, 1000}, {limit - 19999, 2001},
+            {limit - 10000, 999}, {limit - 15000, 1000}}) {
+        size_t const w = 20;
+        vector<size_t> swept(w), looked_up(w);
+        sieve.fill_buckets(swept, b.first, b.second);
+        primedist::fill_buckets(&table, looked_up, b.first, b.second);
+        for (size_t i = 0; i < w; ++i) {
+            if (swept[i] != looked_up[i])
+                mismatch("bucket " + to_string(i) + " of ["
+                         + to_string(b.first) + ", +"
+                         + to_string(b.second) + "...)",
+                         swept[i], looked_up[i]);
+        }
+    }
+}
+
+/** Returns the least prime not less than `v`, per the plain sieve. */
+uint64_t plain_next(uint64_t v)
+{
+    while (!plain()[v])
+        ++v;
+    return v;
+}
+
+/** Returns the greatest prime less than `v` per the plain sieve, or zero if
+  * there is none.
+  */
+uint64_t plain_prev(uint64_t v)
+{
+    while (v > 0) {
+        if (plain()[--v])
+            return v;
+    }
+    return 0;
+}
+
+/** Throws `logic_error` describing a mismatch of the `i`th prime returned by
+  * an iterator.
+  */
+void mismatch(
+        string const&  what,
+        options const& opts,
+        uint64_t       start,
+        size_t         i,
+        uint64_t       expected,
+        uint64_t       actual)
+{
+    throw logic_error(
+            what + " " + to_string(i) + " from " + to_string(start)
+            + " with segment_words " + to_string(opts.segment_words)
+            + ", presieve " + to_string(opts.presieve) + ": "
+            + to_string(expected) + " != " + to_string(actual));
+}
+
+/** Checks `prime_iterator`, with and without prefetching, against the plain
+  * sieve: `n` calls to `next` from `start`, then `2 * n` calls to `prev`,
+  * then `n` calls to `next` again.
+  */
+void check_iterator(options const& opts, uint64_t start, size_t n)
+{
+    for (bool prefetch : {false, true}) {
+        prime_iterator it(start, opts, prefetch);
+        uint64_t up = start, down = start;
+        for (size_t i = 0; i < n * 4; ++i) {
+            bool next = i < n || i >= n * 3;
+            auto expected = next ? plain_next(up) : plain_prev(down);
+            auto actual   = next ? it.next() : it.prev();
+            if (expected != actual)
+                mismatch(next ? "next" : "prev", opts, start, i,
+                         expected, actual);
+            if (expected) {
+                up   = expected + 1;
+                down = expected;
+            }
+        }
+    }
+}
+
+/** Checks that `prime_iterator`, far beyond the plain sieve, returns from
+  * `start` the primes the engine counts, and the same primes in reverse.
+  */
+void check_far_iterator(uint64_t start, size_t n)
+{
+    auto opts = primedist::default_options();
+    prime_iterator up(start, opts);
+    vector<uint64_t> found(n);
+    for (auto& p : found)
+        p = up.next();
+    auto expected = engine(opts).count(start, found.back() + 1);
+    if (expected != n)
+        mismatch("count", opts, start, 0, expected, n);
+    prime_iterator down(found.back() + 1, opts);
+    for (size_t i = n; i-- > 0;) {
+        auto actual = down.prev();
+        if (found[i] != actual)
+            mismatch("prev", opts, start, i, found[i], actual);
+    }
+}
+
+#ifdef __cpp_lib_coroutine
+
+/** Checks that `primes` yields the primes in `[lo, hi)`, per the plain
+  * sieve.
+  */
+void check_primes(options const& opts, uint64_t lo, uint64_t hi)
+{
+    size_t i = 0;
+    auto v = lo;
+    for (auto p : primedist::primes(lo, hi, opts)) {
+        auto expected = plain_next(v);
+        if (expected != p)
+            mismatch("yield", opts, lo, i, expected, p);
+        v = p + 1;
+        ++i;
+    }
+    if (plain_next(v) < hi)
+        mismatch("yield", opts, lo, i, plain_next(v), hi);
+}
+
+#endif
+
+/** A temporary directory, removed with everything made in it. */
+class scratch {
+
+    string          m_path;
+    vector<string>  m_made;     // files and directories, in creation order
+
+  public:
+
+    /** Creates an empty directory under `$TMPDIR`, or `/tmp`. */
+    scratch()
+    {
+        auto tmp = std::getenv("TMPDIR");
+        auto name = string(tmp && *tmp ? tmp : "/tmp") + "/check.XXXXXX";
+        vector<char> buffer(name.begin(), name.end());
+        buffer.push_back('\0');
+        if (!mkdtemp(buffer.data()))
+            throw runtime_error("can't create directory " + name);
+        m_path = buffer.data();
+    }
+
+    scratch(scratch const&) = delete;
+
+    scratch& operator=(scratch const&) = delete;
+
+    ~scratch()
+    {
+        for (auto i = m_made.rbegin(); i != m_made.rend(); ++i)
+            std::remove(i->c_str());
+        std::remove(m_path.c_str());
+    }
+
+    /** Returns the path of this directory. */
+    string const& path() const { return m_path; }
+
+    /** Returns the path of `name` within this directory, creating any
+      * directories it names, and marking it for removal.
+      */
+    string file(string const& name)
+    {
+        for (auto i = name.find('/'); i != string::npos;
+                i = name.find('/', i + 1)) {
+            auto dir = m_path + '/' + name.substr(0, i);
+            if (std::find(m_made.begin(), m_made.end(), dir) != m_made.end())
+                continue;
+            if (mkdir(dir.c_str(), 0700) != 0)
+                throw runtime_error("can't create directory " + dir);
+            m_made.push_back(dir);
+        }
+        m_made.push_back(m_path + '/' + name);
+        return m_made.back();
+    }
+
+    /** Writes `text` to the file `name` within this directory. */
+    void write(string const& name, string const& text)
+    {
+        auto path = file(name);
+        std::ofstream out(path);
+        if (!(out << text).flush())
+            throw runtime_error("can't write " + path);
+    }
+};
+
+/** Throws `logic_error` describing a mismatch of the tuning's `what`. */
+void mismatch(string const& what, string const& expected, string const& actual)
+{
+    throw logic_error(
+            "autotune " + what + ": " + expected + " != " + actual);
+}
+
+/** Returns a description of `caches` for `mismatch`. */
+string describe(cache_info const& caches)
+{
+    return "{" + to_string(caches.l1d) + ", " + to_string(caches.l2) + ", "
+         + to_string(caches.l3) + "}";
+}
+
+/** Returns a description of `opts` for `mismatch`. */
+string describe(options const& opts)
+{
+    return "{" + to_string(opts.segment_words) + ", "
+         + to_string(opts.presieve) + ", " + to_string(opts.threads) + "}";
+}
+
+/** Checks `parse_size`, `read_cache_info` of fixture sysfs trees,
+  * `detect_options`, and the round trip of options through a profile.
+  */
+void check_autotune()
+{
+    for (auto const& c : vector<std::pair<string, size_t>>{
+            {"32K", 32 << 10}, {"1M", 1 << 20}, {"2G", size_t(2) << 30},
+            {"512", 512}, {" 48K ", 48 << 10}, {"", 0}, {"garbage", 0},
+            {"K", 0}, {"12X", 0}, {"32K 1M", 0}}) {
+        auto actual = primedist::parse_size(c.first);
+        if (actual != c.second)
+            mismatch("parse_size(\"" + c.first + "\")",
+                     to_string(c.second), to_string(actual));
+    }
+
+    // The first tree lists an instruction cache, which is skipped, and an
+    // L3 of garbage size.  The second lacks a level for index1, which ends
+    // the listing; the L3 beyond it is never read.
+
+    scratch dir;
+    vector<vector<string>> const indices[] = {
+        {{"1", "Data", "32K"}, {"1", "Instruction", "64K"},
+         {"2", "Unified", "1M"}, {"3", "Unified", "garbage"}},
+        {{"1", "Data", "48K"}, {"", "Unified", "2M"},
+         {"3", "Unified", "8M"}}
+    };
+    cache_info const expected[] = {
+        {32 << 10, 1 << 20, 0},
+        {48 << 10, 0, 0},
+        {0, 0, 0}
+    };
+    for (size_t t = 0; t < 3; ++t) {
+        auto tree = "tree" + to_string(t);
+        for (size_t i = 0; t < 2 && i < indices[t].size(); ++i) {
+            auto index = tree + "/index" + to_string(i) + '/';
+            char const* const files[] = {"level", "type", "size"};
+            for (size_t f = 0; f < 3; ++f) {
+                if (!indices[t][i][f].empty())
+                    dir.write(index + files[f], indices[t][i][f] + '\n');
+            }
+        }
+        auto actual = primedist::read_cache_info(dir.path() + '/' + tree);
+        if (describe(actual) != describe(expected[t]))
+            mismatch("read_cache_info of " + tree,
+                     describe(expected[t]), describe(actual));
+    }
+
+    // Segments fill half the L2, or else the L1, but no more than each
+    // thread's share of the L3.  A roomy L2 earns the largest pattern.
+
+    auto threads = std::max(1u, std::thread::hardware_concurrency());
+    for (auto const& c : vector<std::pair<cache_info, options>>{
+            {{32 << 10, 1 << 20, 0},       {65536, 13, threads}},
+            {{32 << 10, 256 << 10, 0},     {16384, 11, threads}},
+            {{32 << 10, 0, 0},             {4096, 11, threads}},
+            {{0, 0, 0},                    {4096, 11, threads}},
+            {{32 << 10, 1 << 20, 1 << 10}, {512, 13, threads}}}) {
+        auto actual = primedist::detect_options(c.first);
+        if (describe(actual) != describe(c.second))
+            mismatch("detect_options" + describe(c.first),
+                     describe(c.second), describe(actual));
+    }
+
+    // Saved options load back unchanged; a profile that is missing, lacks
+    // a key, or holds a bad value loads nothing.
+
+    options const saved = {12345, 13, 7};
+    auto profile = dir.file("profile");
+    if (!primedist::save_options(saved, profile))
+        throw runtime_error("can't save options to " + profile);
+    auto loaded = primedist::default_options();
+    if (!primedist::load_options(&loaded, profile)
+            || describe(loaded) != describe(saved))
+        mismatch("options loaded from " + profile,
+                 describe(saved), describe(loaded));
+    if (primedist::save_options(saved, dir.path() + "/none/profile"))
+        mismatch("save_options to a missing directory", "false", "true");
+
+    string const bad[] = {
+        "segment_words 4096\npresieve 11\n",
+        "segment_words 4096\npresieve eleven\nthreads 2\n",
+        "segment_words 0\npresieve 11\nthreads 2\n",
+        "segment_words 4096\npresieve 11\nthreads 2\ncolour blue\n"
+    };
+    for (size_t i = 0; i < 4; ++i) {
+        auto name = "bad" + to_string(i);
+        dir.write(name, bad[i]);
+        loaded = saved;
+        if (primedist::load_options(&loaded, dir.path() + '/' + name)
+                || describe(loaded) != describe(saved))
+            mismatch("options loaded from " + name,
+                     describe(saved), describe(loaded));
+    }
+    if (primedist::load_options(&loaded, dir.path() + "/none"))
+        mismatch("options loaded from a missing profile", "false", "true");
+}
+
+/** Returns the engine options to check, from tiny segments to the default.
+  * The largest pre-sieve pattern takes milliseconds to build for each new
+  * engine, so it is checked only with the default segment size.
+  */
+vector<options> variants()
+{
+    vector<options> r;
+    auto opts = primedist::default_options();
+    opts.presieve = 13;
+    r.push_back(opts);
+    for (unsigned words : {1u, 2u, 7u, 4096u}) {
+        for (unsigned presieve : {2u, 5u, 11u}) {
+            for (unsigned threads : {1u, 3u}) {
+                auto opts = primedist::default_options();
+                opts.segment_words = words;
+                opts.presieve = presieve;
+                opts.threads = threads;
+                r.push_back(opts);
+            }
+        }
+    }
+    return r;
+}
+
+}  // close unnamed namespace
+
+// }}}
+
+// MAIN {{{
+
+int main() try
+{
+    for (auto const& opts : variants()) {
+
+        // Constellations straddling the end of a range need base primes
+        // beyond the range's square root: `sexy` at 283 must see 17^2.
+
+        check_patterns(opts, 0, 2, 142);
+        check_iterator(opts, 0, 1000);
+#ifdef __cpp_lib_coroutine
+        check_primes(opts, 0, 8000);
+#endif
+        for (uint64_t p = 17; p < 1000; p += 2) {
+            if (plain()[p])
+                check_patterns(opts, p * p - 200, 1, 194);
+        }
+
+        // Buckets aligned to words take the field and block kernels, which
+        // rely on workers and segments never splitting a word or, for
+        // weights dividing 64, a bucket.
+
+        uint64_t const aligned[] = {
+            1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096,
+            192, 640, 1000000 / 64 * 64
+        };
+        for (auto weight : aligned) {
+            for (uint64_t lo : {0, 64 * 37}) {
+                auto w = std::min<uint64_t>({
+                        40,
+                        std::max<uint64_t>(40000 / weight, 1),
+                        (plain_limit - 64 - lo) / weight});
+                check_patterns(opts, lo, weight, w);
+                check_gaps(opts, lo, weight, w, 0, true);
+            }
+        }
+
+        // Ragged buckets, unaligned to words or segments.
+
+        uint64_t x = 12345;
+        for (int i = 0; i < 20; ++i) {
+            x = x * 6364136223846793005 + 1442695040888963407;
+            auto lo = x >> 45;
+            auto weight = (x >> 20) % 300 + 1;
+            auto w = (x >> 10) % 40 + 1;
+            check_patterns(opts, lo, weight, w);
+            check_gaps(opts, lo, weight, w, i % 3 * 8, i % 2);
+            check_residues(opts, lo, weight, w);
+            check_iterator(opts, lo, w * 8);
+#ifdef __cpp_lib_coroutine
+            check_primes(opts, lo, lo + weight * w);
+#endif
+        }
+    }
+
+    // Far from zero, the largest base primes are sieved without a cursor.
+
+    for (unsigned words : {1u, 7u}) {
+        auto opts = primedist::default_options();
+        opts.segment_words = words;
+        check_far_patterns(opts, 100000000, 1001, 97);
+        check_far_patterns(opts, (std::uint64_t(1) << 40) - 5000, 997, 11);
+    }
+
+    // Iterators starting far from zero sieve larger segments.
+
+    check_far_iterator(1000000000000, 100000);
+    check_far_iterator(std::uint64_t(1) << 40, 1000);
+    check_table();
+    check_autotune();
+} catch (logic_error const& error) {
+    std::cerr << "Internal Error: " << error.what() << '\n';
+    return -1;
+} catch (runtime_error const& error) {
+    std::cerr << "Error: " << error.what() << '\n';
+    return -2;
+}
+
+// }}}
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// vim:foldmethod=marker
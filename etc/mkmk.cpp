@@ -13,26 +13,41 @@
 // PREPROCESSOR {{{
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <iostream>
 #include <fstream>
 #include <limits>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 // }}}
 
 // USINGS {{{
 
+using std::atomic;
 using std::equal;
+using std::exception_ptr;
 using std::find;
 using std::ifstream;
+using std::int64_t;
 using std::logic_error;
 using std::ostringstream;
 using std::ostream;
@@ -41,6 +56,8 @@ using std::numeric_limits;
 using std::runtime_error;
 using std::size_t;
 using std::string;
+using std::thread;
+using std::uint64_t;
 using std::unordered_map;
 using std::unordered_set;
 using std::vector;
@@ -49,13 +66,13 @@ using std::vector;
 
 // DECLARATIONS {{{
 
-// LEVEL 1: category, configuration, name_map {{{
+// LEVEL 1: category, configuration, mapped_file, name_map, tasks {{{
 
 // category {{{
 
 /** Identifies kinds of files appearing in `make` rules.
  *
- * @todo Complex targets: archive, library.
+ * @todo Complex targets: shared library.
  */
 enum class category {
 
@@ -64,14 +81,30 @@ enum class category {
     header, ///< source interface file; e.g., foo.hpp
 
     // targets
-    folder, ///< directory
-    linked, ///< executable program file; e.g., foo.exe
-    object  ///< object file; e.g., foo.obj
+    archive,        ///< static library; e.g., libfoo.a
+    folder,         ///< directory
+    linked,         ///< executable program file; e.g., foo.exe
+    object,         ///< object file; e.g., foo.obj
+    precompiled     ///< precompiled header; e.g., foo.h.gch
 };
 
 // }}}
 // configuration {{{
 
+/** An alternative build, such as an optimized one, run as a phony target. */
+struct build_variant {
+    string          name;       ///< phony target; e.g., "release"
+    vector<string>  commands;   ///< shell commands, run in order
+};
+
+/** A static library bundling the objects of some components, and of every
+ * component they depend on, for use by programs outside the project.
+ */
+struct library {
+    string          name;       ///< archive name; e.g., "libfoo"
+    vector<string>  roots;      ///< components bundled; e.g., "foo/bar"
+};
+
 /** Static data that may vary from project to project.
  *
  * @todo Read from environment, to support per-developer config.
@@ -86,12 +119,46 @@ struct configuration {
     string header_ext;      ///< extension of header source files; e.g., ".h"
     string object_ext;      ///< extension of object files; e.g., ".obj"
     string linked_ext;      ///< extension of executables; e.g., ".exe"
+    string archive_ext;     ///< extension of static libraries; e.g., ".lib"
+    string precompiled_ext; ///< appended to header names; e.g., ".gch"
 
     string compile_command; ///< shell command to build object from sources
+    string depend_command;  ///< as above, also writing a depfile of headers
     string link_command;    ///< shell command to build program from objects
+    string archive_command; ///< shell command to build library from objects
+    string precompile_command;  ///< shell command to precompile a header, or
+                                ///< empty not to precompile headers
+    string copy_command;    ///< shell command to copy a header to be
+                            ///< precompiled into the object folder
 
     string source_prefix;   ///< prepended to source dependency names
     string object_prefix;   ///< prepended to target names
+
+    vector<build_variant> variants; ///< printed after the default rules
+    vector<library> libraries;      ///< built by default, beside programs
+};
+
+// }}}
+// mapped_file {{{
+
+/** A read-only memory mapping of an entire file. */
+class mapped_file {
+    char const* m_data;
+    size_t      m_size;
+  public:
+
+    /** Throws `runtime_error` if the file at `path` cannot be read. */
+    explicit mapped_file(string const& path);
+
+    mapped_file(mapped_file const&) = delete;
+
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    ~mapped_file();
+
+    char const* begin() const { return m_data; }
+
+    char const* end() const { return m_data + m_size; }
 };
 
 // }}}
@@ -110,6 +177,19 @@ class name_map {
     key_type insert(string const& name);
 };
 
+// }}}
+// tasks {{{
+
+namespace tasks {
+
+    /** Calls `f(i)` for each `i` in `[0, n)`, concurrently on up to one
+     * thread per hardware thread, in no particular order.  `f` must not
+     * throw.
+     */
+    template<typename F>
+    void parallel_for(size_t n, F f);
+}
+
 // }}}
 
 // }}}
@@ -193,71 +273,234 @@ namespace strings {
 
 // }}}
 
-// LEVEL 3: dependency_map, printer, reader {{{
+// LEVEL 3: dependency_cache, dependency_map, printers, reader {{{
+
+// dependency_cache {{{
+
+/** Persistent record of the files each source file directly includes, so
+ * that files unchanged since a previous run need not be read again.  A file
+ * is presumed unchanged if its modification time and size match its record;
+ * otherwise, it is read and hashed, and rescanned only if its contents have
+ * changed.
+ */
+class dependency_cache {
+  public:
+
+    /** What is known about one source file. */
+    struct record {
+        int64_t         mtime;      ///< modification time, in nanoseconds
+        uint64_t        size;       ///< size in bytes
+        uint64_t        hash;       ///< see `dependency_cache::hash`
+        bool            is_main;    ///< whether the file defines `main`
+        vector<string>  includes;   ///< files named by `#include` lines
+    };
+
+  private:
+    unordered_map<string, record> m_records;
+
+  public:
+
+    /** Returns the FNV-1a hash of the bytes in `[beg, end)`. */
+    static uint64_t hash(char const* beg, char const* end);
+
+    /** Sets the `mtime` and `size` of `*result` from the file at `path`. */
+    static void stamp(record* result, string const& path);
 
+    /** Returns the record of `file`, or null if there is none. */
+    record const* find(string const& file) const;
+
+    /** Adds or replaces the record of `file`. */
+    void insert(string const& file, record const& rec);
+
+    /** Replaces all records with those saved at `path`.  Returns `false`,
+     * and leaves no records, if there is no cache at `path` or it is
+     * malformed.
+     */
+    bool load(string const& path);
+
+    /** Saves all records to `path`, replacing any previous cache. */
+    void save(string const& path) const;
+};
+
+// }}}
 // dependency_map {{{
 
-/** Maps entities to their dependencies. */
+/** Maps entities to their dependencies.  Entities are numbered densely in
+ * order of insertion, and dependencies are stored as one sorted, contiguous
+ * array of numbers, indexed by a second array of offsets per entity.
+ * Dependencies added by `add` are visible only after a call to `compact`.
+ */
 class dependency_map {
+  public:
 
-    typedef unordered_map<entity, unordered_set<entity>> map_t;
+    typedef uint32_t key_type;
 
-    map_t m_map;
+    /** The dependencies of one entity. */
+    class row {
+        key_type const* m_begin;
+        key_type const* m_end;
+      public:
+        row(key_type const* b, key_type const* e): m_begin(b), m_end(e) { }
+        key_type const* begin() const { return m_begin; }
+        key_type const* end() const { return m_end; }
+    };
 
-    template<typename F>
-    void preorder(entity const& root, F visit) const;
+  private:
+    vector<entity>                      m_nodes;    ///< indexed by key
+    unordered_map<entity, key_type>     m_keys;     ///< into `m_nodes`
+    vector<size_t>                      m_offsets;  ///< into `m_targets`
+    vector<key_type>                    m_targets;  ///< dependencies
+    vector<std::pair<key_type, key_type>> m_added;  ///< not yet compacted
 
   public:
 
-    typedef map_t::const_iterator const_iterator;
-    typedef map_t::size_type      size_type;
-    typedef unordered_set<entity> mapped_type;
-
     // ACCESSORS
 
-    const_iterator begin() const { return m_map.begin(); }
+    size_t count(entity const& e) const { return m_keys.count(e); }
+
+    /** Returns the dependencies of the entity having the specified `key`. */
+    row dependencies(key_type key) const;
 
-    size_type count(entity const& e) const { return m_map.count(e); }
+    /** Returns the key of `e`, which must have been inserted. */
+    key_type key(entity const& e) const;
 
-    const_iterator end() const { return m_map.end(); }
+    entity const& node(key_type key) const { return m_nodes[key]; }
 
-    /** Adds to `result` all recursive dependencies implied by this map. */
-    void extrapolated(dependency_map* result) const;
+    key_type size() const { return key_type(m_nodes.size()); }
 
     // MANIPULATORS
 
-    mapped_type& operator[](entity const& key) { return m_map[key]; }
+    /** Records that `from` depends on `to`. */
+    void add(key_type from, key_type to);
+
+    /** Makes dependencies recorded by `add` visible. */
+    void compact();
 
     /** Makes implicit (transitive) relationships explicit. */
     void extrapolate();
+
+    /** Adds `e` if it is not already present.  Returns its key, and whether
+     * it was added.
+     */
+    std::pair<key_type, bool> insert(entity const& e);
 };
 
 // }}}
 // printer {{{
 
-/** Prints makefile contents. */
+/** Prints build rules.  Derived classes implement particular formats.  If
+ * `depfiles` is true, the compiler is expected to write the headers that
+ * each object depends on, so `compile` ignores its list of headers.
+ */
 class printer {
+  protected:
     configuration const&    m_config;
     ostream&                m_out;
     string const            m_indent;
+    bool const              m_depfiles;
 
     void path(entity const&);
 
+    /** Prints the path of the copy of `header` in the object folder, beside
+     * its precompiled form.  The compiler falls back to the copy if it
+     * rejects the precompiled form; e.g., because the flags differ.
+     */
+    void copy_path(entity const& header);
+
+  public:
+
+    printer(ostream& out, configuration const* config, bool depfiles);
+
+    virtual ~printer() { }
+
+    virtual void all(vector<entity> const& entities) = 0;
+
+    virtual void archive(
+            entity const&           target,
+            vector<entity> const&   objects) = 0;
+
+    virtual void clean() = 0;
+
+    /** If `precompiled` is not null, the object is compiled using the
+     * precompiled form of that header, which `precompile` builds.
+     */
+    virtual void compile(
+            entity const&           source,
+            vector<entity> const&   headers,
+            entity const*           precompiled) = 0;
+
+    virtual void link(entity const& target, vector<entity> const& objects) = 0;
+
+    virtual void mkdir(entity const& target) = 0;
+
+    virtual void precompile(entity const& header) = 0;
+
+    virtual void preamble() = 0;
+
+    virtual void variant(build_variant const& v) = 0;
+};
+
+/** Prints makefile contents. */
+class make_printer: public printer {
+  public:
+
+    make_printer(ostream& out, configuration const* config, bool depfiles);
+
+    void all(vector<entity> const& entities) override;
+
+    void archive(
+            entity const&           target,
+            vector<entity> const&   objects) override;
+
+    void clean() override;
+
+    void compile(
+            entity const&           source,
+            vector<entity> const&   headers,
+            entity const*           precompiled) override;
+
+    void link(entity const& target, vector<entity> const& objects) override;
+
+    void mkdir(entity const& target) override;
+
+    void precompile(entity const& header) override;
+
+    void preamble() override;
+
+    void variant(build_variant const& v) override;
+};
+
+/** Prints `build.ninja` contents.  Ninja creates output folders itself, so
+ * `mkdir` prints nothing.  Variants work by re-running the build with other
+ * variables, which Ninja does not support, so `variant` prints nothing.
+ */
+class ninja_printer: public printer {
   public:
 
-    printer(ostream& out, configuration const* config);
+    ninja_printer(ostream& out, configuration const* config, bool depfiles);
+
+    void all(vector<entity> const& entities) override;
+
+    void archive(
+            entity const&           target,
+            vector<entity> const&   objects) override;
+
+    void clean() override;
 
-    void all(vector<entity> const& entities);
+    void compile(
+            entity const&           source,
+            vector<entity> const&   headers,
+            entity const*           precompiled) override;
 
-    void clean();
+    void link(entity const& target, vector<entity> const& objects) override;
 
-    void compile(entity const& source, unordered_set<entity> const& headers);
+    void mkdir(entity const& target) override;
 
-    void link(entity const& target, unordered_set<entity> const& objects);
+    void precompile(entity const& header) override;
 
-    void mkdir(entity const& target);
+    void preamble() override;
 
-    void preamble();
+    void variant(build_variant const& v) override;
 };
 
 // }}}
@@ -270,10 +513,20 @@ class reader {
 
     reader(): m_include_prefix("#include \""), m_main_prefix("int main(") { }
 
-    bool get_include(string* result, string const& line);
+    /** If the line `[beg, end)` has prefix `#include "`, assigns the quoted
+     * file name to `result` and returns `true`.
+     */
+    bool get_include(string* result, char const* beg, char const* end) const;
+
+    /** Returns `true` if the line `[beg, end)` has prefix "int main(". */
+    bool is_main(char const* beg, char const* end) const;
 
-    /** Returns `true` if `line` has prefix "int main(". */
-    bool is_main(string const& line);
+    /** Appends to `includes` the file named by each `#include` line in
+     * `[beg, end)`, and returns `true` if any line declares `main`.  Lines
+     * are found with `memchr`, and only lines whose first character begins
+     * a prefix are compared further.
+     */
+    bool scan(vector<string>* includes, char const* beg, char const* end) const;
 };
 
 // }}}
@@ -290,6 +543,7 @@ class generator {
     entity_map              m_entities; ///< stores entity names
     dependency_map          m_includes; ///< {{ source, {headers} }}
     dependency_map          m_linkages; ///< {{ linked, {objects} }}
+    dependency_map          m_precompiled;  ///< {{ corpus, {header} }}
     unordered_set<entity>   m_mains;    ///< files defining `main` functions
 
     template<typename F>
@@ -306,14 +560,17 @@ class generator {
 
     generator(configuration const* config);
 
-    /** Call this first. */
-    void read_files(char** beg, char** end);
+    /** Call this first.  If `cache` is not null, reuses its records of
+     * unchanged files, and replaces its contents with records of every file
+     * read.
+     */
+    void read_files(char** beg, char** end, dependency_cache* cache = nullptr);
 
     /** Call this after `read`. */
     void evaluate();
 
     /** Call this last. */
-    void print(ostream& out) const;
+    void print(printer* out) const;
 };
 
 // }}}
@@ -326,6 +583,38 @@ class generator {
 
 // LEVEL 1 {{{
 
+// mapped_file {{{
+
+mapped_file::mapped_file(string const& path):
+    m_data(nullptr),
+    m_size(0)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        if (fd >= 0) close(fd);
+        throw runtime_error("cannot read file: " + path);
+    }
+    m_size = info.st_size;
+    if (m_size) {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            throw runtime_error("cannot read file: " + path);
+        }
+        m_data = static_cast<char const*>(data);
+    }
+    close(fd);
+}
+
+mapped_file::~mapped_file()
+{
+    if (m_size) {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+}
+
+// }}}
 // name_map {{{
 
 string const& name_map::operator[](key_type index) const
@@ -345,6 +634,30 @@ name_map::key_type name_map::insert(string const& name)
     return key_type(index);
 }
 
+// }}}
+// tasks {{{
+
+template<typename F>
+void tasks::parallel_for(size_t n, F f)
+{
+    size_t count = std::max(1u, thread::hardware_concurrency());
+    count = std::min(count, n);
+    atomic<size_t> next(0);
+    auto work = [&] {
+        for (size_t i; (i = next++) < n;) {
+            f(i);
+        }
+    };
+    vector<thread> pool;
+    for (size_t i = 1; i < count; ++i) {
+        pool.emplace_back(work);
+    }
+    work();
+    for (auto& t : pool) {
+        t.join();
+    }
+}
+
 // }}}
 
 // }}}
@@ -427,52 +740,239 @@ bool strings::drop_suffix(
 
 // LEVEL 3 {{{
 
-// dependency_map {{{
+// dependency_cache {{{
 
-template<typename F>
-void dependency_map::preorder(entity const& root, F visit) const
+uint64_t dependency_cache::hash(char const* beg, char const* end)
 {
-    vector<entity> path;
-    vector<vector<entity>> lifo{{root}};
-    while (!lifo.empty()) {
-        vector<entity>& batch = lifo.back();
-        if (batch.empty()) {
-            lifo.pop_back();
-            if (!path.empty()) {
-                path.pop_back();
+    uint64_t result = 14695981039346656037ull;
+    for (; beg != end; ++beg) {
+        result = (result ^ static_cast<unsigned char>(*beg)) * 1099511628211ull;
+    }
+    return result;
+}
+
+void dependency_cache::stamp(record* result, string const& path)
+{
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) {
+        throw runtime_error("cannot read file: " + path);
+    }
+#ifdef __APPLE__
+    auto const& time = info.st_mtimespec;
+#else
+    auto const& time = info.st_mtim;
+#endif
+    result->mtime = int64_t(time.tv_sec) * 1000000000 + time.tv_nsec;
+    result->size  = info.st_size;
+}
+
+dependency_cache::record const* dependency_cache::find(
+        string const& file) const
+{
+    auto pos = m_records.find(file);
+    return pos == m_records.end() ? nullptr : &pos->second;
+}
+
+void dependency_cache::insert(string const& file, record const& rec)
+{
+    m_records[file] = rec;
+}
+
+bool dependency_cache::load(string const& path)
+{
+    // Format: a version line, then for each file, its name on one line, a
+    // line of "mtime size hash is_main count", and `count` include lines.
+    // Any malformed record, or any failure to read one, discards the whole
+    // cache, so that it is rebuilt from scratch.
+
+    m_records.clear();
+    try {
+        ifstream in(path);
+        string line;
+        if (!getline(in, line) || line != "mkmk-cache 1") {
+            return false;
+        }
+        for (string file; getline(in, file);) {
+            record rec;
+            size_t count;
+            if (!getline(in, line)) {
+                throw runtime_error("missing fields");
             }
-        } else {
-            entity node = move(batch.back());
-            batch.pop_back();
-            if (find(path.begin(), path.end(), node) != path.end()) {
-                throw runtime_error("circular dependency");
+            std::istringstream fields(line);
+            if (!(fields >> rec.mtime >> rec.size >> rec.hash >> rec.is_main
+                         >> count) || !(fields >> std::ws).eof()) {
+                throw runtime_error("bad fields");
             }
-            if (visit(node)) {
-                path.push_back(node);
-                auto const& kids = m_map.find(node)->second;
-                lifo.emplace_back(kids.begin(), kids.end());
+            for (size_t i = 0; i < count; ++i) {
+                if (!getline(in, line)) {
+                    throw runtime_error("missing include");
+                }
+                rec.includes.push_back(line);
             }
+            m_records.emplace(move(file), move(rec));
+        }
+        if (!in.eof()) {
+            throw runtime_error("read error");
         }
+    } catch (std::exception const&) {
+        m_records.clear();
+        return false;
     }
+    return true;
 }
 
-void dependency_map::extrapolated(dependency_map* result) const
+void dependency_cache::save(string const& path) const
 {
-    for (auto const& item : m_map) {
-        auto const& root = item.first;
-        auto& seen = (*result)[root];
-        auto visit = [&](entity const& node) {
-            return node == root || seen.insert(node).second;
-        };
-        preorder(root, visit);
+    // Write a temporary file and rename it, so that an interrupted run never
+    // leaves a truncated cache.  Sort by name to keep the output stable.
+
+    vector<string> files;
+    for (auto const& entry : m_records) {
+        files.push_back(entry.first);
+    }
+    std::sort(files.begin(), files.end());
+    string temp = path + ".tmp";
+    {
+        std::ofstream out(temp);
+        out << "mkmk-cache 1\n";
+        for (string const& file : files) {
+            record const& rec = m_records.find(file)->second;
+            out << file << '\n'
+                << rec.mtime << ' ' << rec.size << ' ' << rec.hash << ' '
+                << rec.is_main << ' ' << rec.includes.size() << '\n';
+            for (string const& inc : rec.includes) {
+                out << inc << '\n';
+            }
+        }
+        if (!out.flush()) {
+            throw runtime_error("cannot write file: " + temp);
+        }
     }
+    if (std::rename(temp.c_str(), path.c_str()) != 0) {
+        throw runtime_error("cannot write file: " + path);
+    }
+}
+
+// }}}
+// dependency_map {{{
+
+dependency_map::row dependency_map::dependencies(key_type key) const
+{
+    assert(m_added.empty() && key + size_t(1) < m_offsets.size());
+    auto data = m_targets.data();
+    return row(data + m_offsets[key], data + m_offsets[key + 1]);
+}
+
+dependency_map::key_type dependency_map::key(entity const& e) const
+{
+    auto pos = m_keys.find(e);
+    assert(pos != m_keys.end());
+    return pos->second;
+}
+
+void dependency_map::add(key_type from, key_type to)
+{
+    assert(from < m_nodes.size() && to < m_nodes.size());
+    m_added.emplace_back(from, to);
+}
+
+void dependency_map::compact()
+{
+    // Merge the new dependencies with the old, then count them per entity to
+    // find the offsets.
+
+    if (m_added.empty() && m_offsets.size() == m_nodes.size() + 1) {
+        return;
+    }
+    for (size_t from = 0; from + 1 < m_offsets.size(); ++from) {
+        for (size_t i = m_offsets[from]; i != m_offsets[from + 1]; ++i) {
+            m_added.emplace_back(key_type(from), m_targets[i]);
+        }
+    }
+    std::sort(m_added.begin(), m_added.end());
+    m_added.erase(std::unique(m_added.begin(), m_added.end()), m_added.end());
+    m_offsets.assign(m_nodes.size() + 1, 0);
+    m_targets.clear();
+    m_targets.reserve(m_added.size());
+    for (auto const& edge : m_added) {
+        ++m_offsets[edge.first + 1];
+        m_targets.push_back(edge.second);
+    }
+    std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+    m_added.clear();
 }
 
 void dependency_map::extrapolate()
 {
-    dependency_map result;
-    extrapolated(&result);
-    m_map.swap(result.m_map);
+    // Dependencies must not be circular, so each strongly connected component
+    // is a single entity, and a depth-first traversal finishes each entity
+    // after everything it depends on.  On finishing, OR the bit sets of its
+    // dependencies into its own.
+
+    compact();
+    size_t const n = m_nodes.size();
+    size_t const words = (n + 63) / 64;
+    vector<uint64_t> bits(n * words);
+    enum : char { unvisited, active, finished };
+    vector<char> state(n, unvisited);
+    vector<std::pair<key_type, size_t>> lifo;   // entity, next dependency
+    for (key_type root = 0; root != n; ++root) {
+        if (state[root] != unvisited) {
+            continue;
+        }
+        state[root] = active;
+        lifo.emplace_back(root, m_offsets[root]);
+        while (!lifo.empty()) {
+            key_type node = lifo.back().first;
+            size_t& next = lifo.back().second;
+            if (next != m_offsets[node + 1]) {
+                key_type kid = m_targets[next++];
+                if (state[kid] == active) {
+                    throw runtime_error("circular dependency");
+                }
+                if (state[kid] == unvisited) {
+                    state[kid] = active;
+                    lifo.emplace_back(kid, m_offsets[kid]);
+                }
+                continue;
+            }
+            uint64_t* set = &bits[node * words];
+            for (size_t i = m_offsets[node]; i != m_offsets[node + 1]; ++i) {
+                key_type kid = m_targets[i];
+                uint64_t const* sub = &bits[kid * words];
+                for (size_t w = 0; w != words; ++w) {
+                    set[w] |= sub[w];
+                }
+                set[kid / 64] |= uint64_t(1) << kid % 64;
+            }
+            state[node] = finished;
+            lifo.pop_back();
+        }
+    }
+
+    // Unpack the bit sets, in key order.
+
+    m_targets.clear();
+    for (size_t node = 0; node != n; ++node) {
+        m_offsets[node] = m_targets.size();
+        uint64_t const* set = &bits[node * words];
+        for (size_t w = 0; w != words; ++w) {
+            for (uint64_t b = set[w]; b; b &= b - 1) {
+                m_targets.push_back(key_type(w * 64 + __builtin_ctzll(b)));
+            }
+        }
+    }
+    m_offsets[n] = m_targets.size();
+}
+
+std::pair<dependency_map::key_type, bool> dependency_map::insert(
+        entity const& e)
+{
+    auto result = m_keys.emplace(e, key_type(m_nodes.size()));
+    if (result.second) {
+        m_nodes.push_back(e);
+    }
+    return std::make_pair(result.first->second, result.second);
 }
 
 // }}}
@@ -487,6 +987,9 @@ void printer::path(entity const& ent)
       case category::header:
         m_out << m_config.source_prefix << ent.name() << m_config.header_ext;
         break;
+      case category::archive:
+        m_out << m_config.object_prefix << ent.name() << m_config.archive_ext;
+        break;
       case category::folder:
         m_out << m_config.object_prefix << ent.name();
         break;
@@ -496,16 +999,33 @@ void printer::path(entity const& ent)
       case category::object:
         m_out << m_config.object_prefix << ent.name() << m_config.object_ext;
         break;
+      case category::precompiled:
+        m_out << m_config.object_prefix << ent.name() << m_config.header_ext
+              << m_config.precompiled_ext;
+        break;
     }
 }
 
-printer::printer(ostream& out, configuration const* config):
+void printer::copy_path(entity const& header)
+{
+    m_out << m_config.object_prefix << header.name() << m_config.header_ext;
+}
+
+printer::printer(ostream& out, configuration const* config, bool depfiles):
     m_config(*config),
     m_out(out),
-    m_indent(config->indent_width, ' ')
+    m_indent(config->indent_width, ' '),
+    m_depfiles(depfiles)
 { }
 
-void printer::all(vector<entity> const& entities)
+make_printer::make_printer(
+        ostream&                out,
+        configuration const*    config,
+        bool                    depfiles):
+    printer(out, config, depfiles)
+{ }
+
+void make_printer::all(vector<entity> const& entities)
 {
     m_out << ".PHONY: all\nall:";
     for (entity const& dep : entities) {
@@ -516,31 +1036,68 @@ void printer::all(vector<entity> const& entities)
 
 }
 
-void printer::clean()
+void make_printer::archive(
+        entity const&           target,
+        vector<entity> const&   objects)
+{
+    m_out << '\n';
+    path(target);
+    m_out << ':';
+    for (entity const& dep : objects) {
+        m_out << " \\\n" << m_indent;
+        path(dep);
+    }
+    m_out << "\n\t" << m_config.archive_command << '\n';
+}
+
+void make_printer::clean()
 {
     m_out << "\n.PHONY: clean\nclean:\n\t$(RMDIR) $(OBJDIR)\n";
 }
 
-void printer::compile(
-        entity const&                source,
-        unordered_set<entity> const& headers)
+void make_printer::compile(
+        entity const&           source,
+        vector<entity> const&   headers,
+        entity const*           precompiled)
 {
+    // With depfiles, the compiler writes `foo.d` beside `foo.o`, and `-MP`
+    // gives each header an empty rule, so that removing one is harmless.
+    // Given `-include foo.h`, the compiler reads `foo.h.gch` if it exists.
+
     entity target = source.to(category::object);
     m_out << '\n';
+    if (precompiled) {
+        path(target);
+        m_out << ": PCHFLAGS = -include ";
+        copy_path(*precompiled);
+        m_out << '\n';
+    }
     path(target);
     m_out << ':';
     m_out << " \\\n" << m_indent;
     path(source);
-    for (entity const& dep : headers) {
+    if (!m_depfiles) {
+        for (entity const& dep : headers) {
+            m_out << " \\\n" << m_indent;
+            path(dep);
+        }
+    }
+    if (precompiled) {
         m_out << " \\\n" << m_indent;
-        path(dep);
+        path(precompiled->to(category::precompiled));
     }
     m_out << "  \\\n" << m_indent << "| ";  // | means "dependency only"
     path(target.parent());
-    m_out << "\n\t" << m_config.compile_command << '\n';
+    if (m_depfiles) {
+        m_out << "\n\t" << m_config.depend_command << '\n';
+        m_out << "-include " << m_config.object_prefix << target.name()
+              << ".d\n";
+    } else {
+        m_out << "\n\t" << m_config.compile_command << '\n';
+    }
 }
 
-void printer::link(entity const& target, unordered_set<entity> const& objects)
+void make_printer::link(entity const& target, vector<entity> const& objects)
 {
     m_out << '\n';
     path(target);
@@ -552,48 +1109,218 @@ void printer::link(entity const& target, unordered_set<entity> const& objects)
     m_out << "\n\t" << m_config.link_command << '\n';
 }
 
-void printer::mkdir(entity const& target)
+void make_printer::mkdir(entity const& target)
 {
     m_out << '\n';
     path(target);
     m_out << ":\n\t$(MKDIR) $@\n";
 }
 
-void printer::preamble()
+void make_printer::precompile(entity const& header)
+{
+    // The header is precompiled from its copy, so the copy is always there.
+
+    entity target = header.to(category::precompiled);
+    m_out << '\n';
+    copy_path(header);
+    m_out << ": \\\n" << m_indent;
+    path(header);
+    m_out << "  \\\n" << m_indent << "| ";
+    path(target.parent());
+    m_out << "\n\t" << m_config.copy_command << "\n\n";
+    path(target);
+    m_out << ": \\\n" << m_indent;
+    copy_path(header);
+    m_out << "\n\t" << m_config.precompile_command << '\n';
+}
+
+void make_printer::preamble()
 {
     m_out << m_config.preamble << '\n';
 }
 
+void make_printer::variant(build_variant const& v)
+{
+    m_out << "\n.PHONY: " << v.name << '\n' << v.name << ":\n";
+    for (string const& command : v.commands) {
+        m_out << '\t' << command << '\n';
+    }
+}
+
+ninja_printer::ninja_printer(
+        ostream&                out,
+        configuration const*    config,
+        bool                    depfiles):
+    printer(out, config, depfiles)
+{ }
+
+void ninja_printer::all(vector<entity> const& entities)
+{
+    m_out << "build all: phony";
+    for (entity const& dep : entities) {
+        m_out << " $\n" << m_indent;
+        path(dep);
+    }
+    m_out << "\ndefault all\n";
+}
+
+void ninja_printer::archive(
+        entity const&           target,
+        vector<entity> const&   objects)
+{
+    m_out << "\nbuild ";
+    path(target);
+    m_out << ": archive";
+    for (entity const& dep : objects) {
+        m_out << " $\n" << m_indent;
+        path(dep);
+    }
+    m_out << '\n';
+}
+
+void ninja_printer::clean()
+{
+    m_out << "\nrule rmdir\n" << m_indent << "command = $rmdir $objdir\n"
+          << "build clean: rmdir\n";
+}
+
+void ninja_printer::compile(
+        entity const&           source,
+        vector<entity> const&   headers,
+        entity const*           precompiled)
+{
+    // Headers are implicit dependencies, listed after `|`, so that they
+    // don't appear in `$in`.
+
+    m_out << "\nbuild ";
+    path(source.to(category::object));
+    m_out << ": compile ";
+    path(source);
+    if ((!m_depfiles && !headers.empty()) || precompiled) {
+        m_out << " |";
+    }
+    if (!m_depfiles) {
+        for (entity const& dep : headers) {
+            m_out << " $\n" << m_indent;
+            path(dep);
+        }
+    }
+    if (precompiled) {
+        m_out << " $\n" << m_indent;
+        path(precompiled->to(category::precompiled));
+        m_out << '\n' << m_indent << "pchflags = -include ";
+        copy_path(*precompiled);
+    }
+    m_out << '\n';
+}
+
+void ninja_printer::link(entity const& target, vector<entity> const& objects)
+{
+    m_out << "\nbuild ";
+    path(target);
+    m_out << ": link";
+    for (entity const& dep : objects) {
+        m_out << " $\n" << m_indent;
+        path(dep);
+    }
+    m_out << '\n';
+}
+
+void ninja_printer::mkdir(entity const&)
+{
+}
+
+void ninja_printer::precompile(entity const& header)
+{
+    m_out << "\nbuild ";
+    copy_path(header);
+    m_out << ": copy ";
+    path(header);
+    m_out << "\nbuild ";
+    path(header.to(category::precompiled));
+    m_out << ": precompile ";
+    copy_path(header);
+    m_out << '\n';
+}
+
+void ninja_printer::variant(build_variant const&)
+{
+}
+
+void ninja_printer::preamble()
+{
+    // Ninja moves each depfile into its own log as soon as the compiler
+    // finishes, so depfiles need not outlive the build.
+
+    m_out << m_config.preamble << "\nrule compile\n" << m_indent
+          << "command = ";
+    if (m_depfiles) {
+        m_out << m_config.depend_command << '\n'
+              << m_indent << "depfile = $out.d\n"
+              << m_indent << "deps = gcc\n";
+    } else {
+        m_out << m_config.compile_command << '\n';
+    }
+    m_out << "\nrule link\n"
+          << m_indent << "command = " << m_config.link_command << '\n'
+          << "\nrule archive\n"
+          << m_indent << "command = " << m_config.archive_command << '\n';
+    if (!m_config.precompile_command.empty()) {
+        m_out << "\nrule copy\n" << m_indent << "command = "
+              << m_config.copy_command << '\n'
+              << "\nrule precompile\n" << m_indent << "command = "
+              << m_config.precompile_command << '\n';
+    }
+    m_out << '\n';
+}
+
 // }}}
 // reader {{{
 
-bool reader::get_include(string* result, string const& line)
+bool reader::get_include(
+        string*     result,
+        char const* beg,
+        char const* end) const
 {
-    auto m = m_include_prefix.size(), n = line.size();
-    if (n <= m) {
+    auto m = m_include_prefix.size();
+    auto n = static_cast<size_t>(end - beg);
+    if (n <= m || !equal(beg, beg + m, m_include_prefix.begin())) {
         return false;
     }
-    auto i = 0;
-    for (; i != m; ++i) {
-        if (line[i] != m_include_prefix[i]) {
-            return false;
-        }
-    }
-    for (; i != n; ++i) {
-        if (line[i] == '"') {
-            result->assign(line.substr(m, i - m));
-            return true;
-        }
+    if (auto quote = static_cast<char const*>(memchr(beg + m, '"', n - m))) {
+        result->assign(beg + m, quote);
+        return true;
     }
-    throw runtime_error("bad #include: " + line);
+    throw runtime_error("bad #include: " + string(beg, end));
 }
 
-bool reader::is_main(string const& line)
+bool reader::is_main(char const* beg, char const* end) const
 {
-    auto m = m_main_prefix.size(), n = line.size();
-    return n < m ? false : equal(
-            line.begin(), line.begin() + m,
-            m_main_prefix.begin(), m_main_prefix.end());
+    auto m = m_main_prefix.size();
+    return static_cast<size_t>(end - beg) >= m
+        && equal(beg, beg + m, m_main_prefix.begin());
+}
+
+bool reader::scan(
+        vector<string>* includes,
+        char const*     beg,
+        char const*     end) const
+{
+    bool result = false;
+    string header;
+    while (beg != end) {
+        auto eol = static_cast<char const*>(memchr(beg, '\n', end - beg));
+        if (!eol) {
+            eol = end;
+        }
+        if (*beg == m_include_prefix[0] && get_include(&header, beg, eol)) {
+            includes->push_back(header);
+        } else if (*beg == m_main_prefix[0] && is_main(beg, eol)) {
+            result = true;
+        }
+        beg = eol == end ? end : eol + 1;
+    }
+    return result;
 }
 
 // }}}
@@ -637,8 +1364,10 @@ void generator::read(entity const& source, F visit)
             }
             if (visit(node)) {
                 path.push_back(node);
-                auto const& incs = m_includes[node];
-                lifo.emplace_back(incs.begin(), incs.end());
+                lifo.emplace_back();
+                for (auto inc : m_includes.dependencies(m_includes.key(node))) {
+                    lifo.back().push_back(m_includes.node(inc));
+                }
             }
         }
     }
@@ -691,34 +1420,99 @@ generator::generator(configuration const* config):
     }
 }
 
-void generator::read_files(char** beg, char** end)
+void generator::read_files(char** beg, char** end, dependency_cache* cache)
 {
-    reader r;
-    auto visit = [this, &r](entity const& node) {
-        if (m_includes.count(node)) {
-            return false;
-        }
-        auto& incs = m_includes[node];
-        string file;
-        ifstream in(entity_to_source(&file, node));
-        if (!in) {
-            throw runtime_error("cannot read file: " + file);
-        }
-        for (string line, header; getline(in, line);) {
-            if (r.get_include(&header, line)) {
-                incs.insert(source_to_entity(header));
-            } else if (r.is_main(line)) {
-                m_mains.insert(node);
-            }
-        }
-        return true;
+    // Scan the include graph breadth first, one wave of newly discovered
+    // files at a time.  Files within a wave are scanned concurrently, but
+    // their results are recorded in wave order, so that entity names are
+    // created (and the makefile printed) in the same order no matter how
+    // threads are scheduled.
+
+    typedef dependency_cache::record record;
+
+    struct scan {
+        record          rec;
+        exception_ptr   error;
     };
+
+    dependency_cache updated;
+    reader const r;
+    vector<entity> roots, wave;
     for (; beg != end; ++beg) {
         char const* src = *beg;
         if (src[0] == '.' && src[1] == m_config.path_separator) {
             src += 2;
         }
-        read(source_to_entity(src), visit);
+        roots.push_back(source_to_entity(src));
+        if (m_includes.insert(roots.back()).second) {
+            wave.push_back(roots.back());
+        }
+    }
+    while (!wave.empty()) {
+        vector<string> files(wave.size());
+        for (size_t i = 0; i != wave.size(); ++i) {
+            entity_to_source(&files[i], wave[i]);
+        }
+        vector<scan> scans(wave.size());
+        tasks::parallel_for(wave.size(), [&](size_t i) {
+            try {
+                record& rec = scans[i].rec;
+                record const* old = nullptr;
+                if (cache) {
+                    dependency_cache::stamp(&rec, files[i]);
+                    old = cache->find(files[i]);
+                    if (old && old->mtime == rec.mtime
+                            && old->size == rec.size) {
+                        rec = *old;
+                        return;
+                    }
+                }
+                mapped_file in(files[i]);
+                rec.hash = dependency_cache::hash(in.begin(), in.end());
+                if (old && old->hash == rec.hash && old->size == rec.size) {
+                    rec.is_main  = old->is_main;
+                    rec.includes = old->includes;
+                } else {
+                    rec.is_main = r.scan(&rec.includes, in.begin(), in.end());
+                }
+            } catch (...) {
+                scans[i].error = std::current_exception();
+            }
+        });
+        vector<entity> next;
+        for (size_t i = 0; i != wave.size(); ++i) {
+            if (scans[i].error) {
+                std::rethrow_exception(scans[i].error);
+            }
+            record const& rec = scans[i].rec;
+            updated.insert(files[i], rec);
+            auto from = m_includes.key(wave[i]);
+            for (string const& header : rec.includes) {
+                entity inc = source_to_entity(header);
+                auto to = m_includes.insert(inc);
+                m_includes.add(from, to.first);
+                if (to.second) {
+                    next.push_back(inc);
+                }
+            }
+            if (rec.is_main) {
+                m_mains.insert(wave[i]);
+            }
+        }
+        wave.swap(next);
+    }
+    if (cache) {
+        *cache = move(updated);
+    }
+    m_includes.compact();
+
+    // Report any cyclic include as a depth-first traversal finds it.
+
+    unordered_set<entity> seen;
+    for (entity const& root : roots) {
+        read(root, [&](entity const& node) {
+            return seen.insert(node).second;
+        });
     }
 }
 
@@ -727,13 +1521,13 @@ void generator::evaluate()
     // Find transitive component dependencies.
 
     dependency_map objects;
-    for (auto const& entry : m_includes) {
-        auto key = entry.first.to(category::object);
-        auto& deps = objects[key];
-        for (auto const& inc : entry.second) {
-            auto obj = inc.to(category::object);
-            if (obj != key) {
-                deps.insert(inc.to(category::object));
+    for (dependency_map::key_type src = 0; src != m_includes.size(); ++src) {
+        auto key = objects.insert(m_includes.node(src).to(category::object));
+        for (auto inc : m_includes.dependencies(src)) {
+            auto obj = objects.insert(
+                    m_includes.node(inc).to(category::object));
+            if (obj.first != key.first) {
+                objects.add(key.first, obj.first);
             }
         }
     }
@@ -743,46 +1537,153 @@ void generator::evaluate()
     // Map `main` targets to transitive dependencies having corpus files.
 
     for (entity const& src : m_mains) {
-        auto exe = src.to(category::linked);
+        auto exe = m_linkages.insert(src.to(category::linked)).first;
         auto obj = src.to(category::object);
-        auto& deps = m_linkages[exe] = {obj};
-        for (entity const& dep : objects[obj]) {
-            if (has_corpus(dep)) {
-                deps.insert(dep);
+        m_linkages.add(exe, m_linkages.insert(obj).first);
+        for (auto dep : objects.dependencies(objects.key(obj))) {
+            if (has_corpus(objects.node(dep))) {
+                m_linkages.add(exe, m_linkages.insert(objects.node(dep)).first);
+            }
+        }
+    }
+
+    // Map each library to the same dependencies of its roots, skipping any
+    // root not among the sources read.
+
+    for (library const& lib : m_config.libraries) {
+        auto ar = m_entities.get(lib.name, category::archive);
+        for (string const& root : lib.roots) {
+            auto obj = m_entities.get(root, category::object);
+            if (!has_corpus(obj)) {
+                continue;
+            }
+            auto key = m_linkages.insert(ar).first;
+            m_linkages.add(key, m_linkages.insert(obj).first);
+            for (auto dep : objects.dependencies(objects.key(obj))) {
+                if (has_corpus(objects.node(dep))) {
+                    m_linkages.add(
+                            key, m_linkages.insert(objects.node(dep)).first);
+                }
             }
         }
     }
 
+    m_linkages.compact();
     m_includes.extrapolate();
+
+    // Precompile umbrella headers: those that include only system headers,
+    // which are costly to parse but rarely change, and that at least half
+    // of all corpus files include.  A corpus file can use only one
+    // precompiled header, so each uses the most widely included umbrella.
+
+    if (m_config.precompile_command.empty()) {
+        return;
+    }
+    typedef dependency_map::key_type key_type;
+    vector<size_t> includers(m_includes.size());
+    size_t corpora = 0;
+    for (key_type src = 0; src != m_includes.size(); ++src) {
+        if (m_includes.node(src).cat() == category::corpus) {
+            ++corpora;
+            for (auto inc : m_includes.dependencies(src)) {
+                ++includers[inc];
+            }
+        }
+    }
+    auto is_umbrella = [&](key_type inc) {
+        auto deps = m_includes.dependencies(inc);
+        return m_includes.node(inc).cat() == category::header
+            && deps.begin() == deps.end()
+            && includers[inc] >= 2
+            && includers[inc] * 2 >= corpora;
+    };
+    for (key_type src = 0; src != m_includes.size(); ++src) {
+        if (m_includes.node(src).cat() != category::corpus) {
+            continue;
+        }
+        key_type best = m_includes.size();
+        for (auto inc : m_includes.dependencies(src)) {
+            if (is_umbrella(inc) && (best == m_includes.size()
+                        || includers[inc] > includers[best])) {
+                best = inc;
+            }
+        }
+        if (best != m_includes.size()) {
+            m_precompiled.add(
+                    m_precompiled.insert(m_includes.node(src)).first,
+                    m_precompiled.insert(m_includes.node(best)).first);
+        }
+    }
+    m_precompiled.compact();
 }
 
-void generator::print(ostream& out) const
+void generator::print(printer* out) const
 {
-    printer print(out, &m_config);
+    printer& print = *out;
     print.preamble();
 
     vector<entity> targets;
     for (auto const& entry : m_mains) {
         targets.push_back(entry.to(category::linked));
     }
-    for (auto const& entry : m_includes) {
-        if (entry.first.cat() == category::corpus) {
-            targets.push_back(entry.first.to(category::object));
+    for (dependency_map::key_type k = 0; k != m_linkages.size(); ++k) {
+        if (m_linkages.node(k).cat() == category::archive) {
+            targets.push_back(m_linkages.node(k));
+        }
+    }
+    for (dependency_map::key_type k = 0; k != m_includes.size(); ++k) {
+        if (m_includes.node(k).cat() == category::corpus) {
+            targets.push_back(m_includes.node(k).to(category::object));
         }
     }
     print.all(targets);
     print.clean();
+    for (auto const& v : m_config.variants) {
+        print.variant(v);
+    }
+
+    // Print each rule from a scratch list of its prerequisites.
 
     unordered_set<entity> folders;
-    for (auto const& entry : m_includes) {
-        if (entry.first.cat() == category::corpus) {
-            print.compile(entry.first, entry.second);
-            folders.insert(entry.first.parent());
+    for (dependency_map::key_type k = 0; k != m_precompiled.size(); ++k) {
+        entity const& header = m_precompiled.node(k);
+        if (header.cat() == category::header) {
+            print.precompile(header);
+            folders.insert(header.parent());
+        }
+    }
+    vector<entity> deps;
+    for (dependency_map::key_type k = 0; k != m_includes.size(); ++k) {
+        entity const& src = m_includes.node(k);
+        if (src.cat() == category::corpus) {
+            deps.clear();
+            for (auto inc : m_includes.dependencies(k)) {
+                deps.push_back(m_includes.node(inc));
+            }
+            entity const* precompiled = nullptr;
+            if (m_precompiled.count(src)) {
+                auto key = m_precompiled.key(src);
+                auto row = m_precompiled.dependencies(key);
+                precompiled = &m_precompiled.node(*row.begin());
+            }
+            print.compile(src, deps, precompiled);
+            folders.insert(src.parent());
         }
     }
-    for (auto const& entry : m_linkages) {
-        print.link(entry.first, entry.second);
-        folders.insert(entry.first.parent());
+    for (dependency_map::key_type k = 0; k != m_linkages.size(); ++k) {
+        entity const& exe = m_linkages.node(k);
+        if (exe.cat() == category::linked || exe.cat() == category::archive) {
+            deps.clear();
+            for (auto obj : m_linkages.dependencies(k)) {
+                deps.push_back(m_linkages.node(obj));
+            }
+            if (exe.cat() == category::linked) {
+                print.link(exe, deps);
+            } else {
+                print.archive(exe, deps);
+            }
+            folders.insert(exe.parent());
+        }
     }
     for (auto const& item : folders) {
         print.mkdir(item);
@@ -797,7 +1698,20 @@ void generator::print(ostream& out) const
 
 int main(int argc, char** argv) try
 {
-    configuration const config = {
+    // The sieve, with its C interface, prime iterator, prime count table,
+    // and tuning, for programs outside this project.
+
+    vector<library> const libraries = {
+        { "libprimedist", {
+            "autotune",
+            "pi_data",
+            "pi_table",
+            "prime_iterator",
+            "primedist",
+            "primedist_c" } },
+    };
+
+    configuration const make_config = {
 
         '/',            // path_separator
 
@@ -808,27 +1722,169 @@ int main(int argc, char** argv) try
         "CXX = clang++\n"
         "CPPFLAGS = -I$(SRCDIR)\n"
         "CXXFLAGS = -std=c++1y -pedantic -Wall -stdlib=libc++\n"
-        "LDFLAGS = -lc++\n"
+        "OPTFLAGS =\n"
+        "NATIVE =\n"
+        "RELEASE = -O3 -DNDEBUG $(NATIVE)\n"
+        "LTO = -flto=thin\n"
+        "LDFLAGS = -lc++ -pthread\n"
+        "PROFDATA = llvm-profdata\n"
+        "TRAINING = 1000000 80 22 prime twin quadruplet mod30 stack6 maxgap\n"
+        "AR = ar\n"
         "MKDIR = mkdir -p\n"
-        "RMDIR = rm -rf\n",
+        "RMDIR = rm -rf\n"
+        "SELF = $(firstword $(MAKEFILE_LIST))\n",
 
         4,              // indent_width
         ".cpp",         // corpus_ext
         ".hpp",         // header_ext
         ".o",           // object_ext
         "",             // linked_ext
+        ".a",           // archive_ext
+        ".gch",         // precompiled_ext; read by both GCC and Clang
+
+        // compile_command
+        "$(CXX) -o $@ $(CPPFLAGS) $(CXXFLAGS) $(OPTFLAGS) $(PCHFLAGS) -c $<",
+
+        // depend_command
+        "$(CXX) -o $@ -MMD -MP"
+                " $(CPPFLAGS) $(CXXFLAGS) $(OPTFLAGS) $(PCHFLAGS) -c $<",
+
+        // link_command
+        "$(CXX) -o $@ $(OPTFLAGS) $^ $(LDFLAGS)",
+
+        // archive_command; `ar` would keep members no longer listed
+        "rm -f $@ && $(AR) rcs $@ $^",
 
-        "$(CXX) -o $@ $(CPPFLAGS) $(CXXFLAGS) -c $<",   // compile_command
-        "$(CXX) -o $@ $^ $(LDFLAGS)",                   // link_command
+        // precompile_command
+        "$(CXX) -o $@ -x c++-header $(CPPFLAGS) $(CXXFLAGS) $(OPTFLAGS) $<",
+
+        "cp $< $@",     // copy_command
 
         "$(SRCDIR)/",   // source_prefix
         "$(OBJDIR)/",   // object_prefix
+
+        // variants, each building into its own folder by re-running `make`;
+        // `pgo` trains an instrumented build on `$(TRAINING)`, then rebuilds
+        // everything (`-B`) with the resulting profile
+        {
+            { "debug", {
+                "$(MAKE) -f $(SELF) OBJDIR=$(PREFIX)/var/debug"
+                        " OPTFLAGS='-O0 -g'" } },
+            { "release", {
+                "$(MAKE) -f $(SELF) OBJDIR=$(PREFIX)/var/release"
+                        " OPTFLAGS='$(RELEASE)'" } },
+            { "lto", {
+                "$(MAKE) -f $(SELF) OBJDIR=$(PREFIX)/var/lto"
+                        " OPTFLAGS='$(RELEASE) $(LTO)'" } },
+            { "pgo", {
+                "$(MAKE) -f $(SELF) OBJDIR=$(PREFIX)/var/pgo-gen"
+                        " OPTFLAGS='$(RELEASE) -fprofile-instr-generate'",
+                "rm -f $(PREFIX)/var/pgo-gen/*.profraw",
+                "env -u PRIMEDIST_PROFILE"
+                        " LLVM_PROFILE_FILE=$(PREFIX)/var/pgo-gen/%p.profraw"
+                        " $(PREFIX)/var/pgo-gen/main $(TRAINING) > /dev/null",
+                "$(PROFDATA) merge -o $(PREFIX)/var/pgo.profdata"
+                        " $(PREFIX)/var/pgo-gen/*.profraw",
+                "$(MAKE) -f $(SELF) -B OBJDIR=$(PREFIX)/var/pgo"
+                        " OPTFLAGS='$(RELEASE) $(LTO)"
+                        " -fprofile-instr-use=$(PREFIX)/var/pgo.profdata'"
+            } },
+        },
+
+        libraries,
     };
 
+    // Ninja has no shell functions, so paths are relative to the directory
+    // of the `build.ninja` file; i.e., the source directory.
+
+    configuration const ninja_config = {
+
+        '/',            // path_separator
+
+        // preamble, printed at top of build.ninja
+        "srcdir = .\n"
+        "objdir = ../var/obj\n"
+        "cxx = clang++\n"
+        "cppflags = -I$srcdir\n"
+        "cxxflags = -std=c++1y -pedantic -Wall -stdlib=libc++\n"
+        "ldflags = -lc++ -pthread\n"
+        "ar = ar\n"
+        "rmdir = rm -rf\n",
+
+        4,              // indent_width
+        ".cpp",         // corpus_ext
+        ".hpp",         // header_ext
+        ".o",           // object_ext
+        "",             // linked_ext
+        ".a",           // archive_ext
+        ".gch",         // precompiled_ext
+
+        // compile_command
+        "$cxx -o $out $cppflags $cxxflags $pchflags -c $in",
+
+        // depend_command
+        "$cxx -o $out -MMD -MF $out.d $cppflags $cxxflags $pchflags -c $in",
+
+        // link_command
+        "$cxx -o $out $in $ldflags",
+
+        // archive_command
+        "rm -f $out && $ar rcs $out $in",
+
+        // precompile_command
+        "$cxx -o $out -x c++-header $cppflags $cxxflags $in",
+
+        "cp $in $out",  // copy_command
+
+        "$srcdir/",     // source_prefix
+        "$objdir/",     // object_prefix
+
+        {},             // variants
+
+        libraries,
+    };
+
+    // Options precede file names:
+    //  --cache <path>  remember the includes of each file between runs
+    //  --ninja         print build.ninja, rather than makefile, contents
+    //  --depfiles      have the compiler track headers, rather than `mkmk`
+
+    char** files = &argv[1];
+    char** files_end = &argv[argc];
+    string cache_path;
+    bool ninja = false;
+    bool depfiles = false;
+    for (; files != files_end && files[0][0] == '-'; ++files) {
+        string option = files[0];
+        if (option == "--cache" && files_end - files >= 2) {
+            cache_path = *++files;
+        } else if (option == "--ninja") {
+            ninja = true;
+        } else if (option == "--depfiles") {
+            depfiles = true;
+        } else {
+            throw runtime_error("unrecognized option: " + option);
+        }
+    }
+
+    configuration const& config = ninja ? ninja_config : make_config;
     generator gen(&config);
-    gen.read_files(&argv[1], &argv[argc]);
+    if (cache_path.empty()) {
+        gen.read_files(files, files_end);
+    } else {
+        dependency_cache cache;
+        cache.load(cache_path);
+        gen.read_files(files, files_end, &cache);
+        cache.save(cache_path);
+    }
     gen.evaluate();
-    gen.print(std::cout);
+    if (ninja) {
+        ninja_printer out(std::cout, &config, depfiles);
+        gen.print(&out);
+    } else {
+        make_printer out(std::cout, &config, depfiles);
+        gen.print(&out);
+    }
 } catch (logic_error const& error) {
     std::cerr << "Internal Error: " << error.what() << '\n';
     return -1;
@@ -1,14 +1,86 @@
-# @file mkmk.mk Builds the `mkmk` makefile generator.
+# @file mkmk.mk Builds the `mkmk` makefile generator and `mkpi` table generator,
+# and regenerates the table whenever `mkpi` changes.  The `check` target runs
+# the `check` program whenever the sieve, tuning, or table changes.  It is
+# built twice: once as C++14, like the rest of the tree, and once as C++20, to
+# check the coroutine `primes`.
 
 PREFIX = $(shell git rev-parse --show-toplevel)
 CXX = clang++
 CPPFLAGS =
 CXXFLAGS = -std=c++1y -pedantic -Wall -stdlib=libc++
-LDFLAGS = -stdlib=libc++
+LDFLAGS = -stdlib=libc++ -pthread
 OUTDIR = $(PREFIX)/var/libexec
+SRCDIR = $(PREFIX)/src
+CXX20FLAGS = -std=c++2a -DCHECK_COROUTINES
 
-$(OUTDIR)/mkmk: $(PREFIX)/etc/mkmk.cpp $(OUTDIR)
+# The C++20 build is checked only if the compiler and its library both
+# support coroutines, which is probed only when checks are requested.
+
+ifneq ($(filter check,$(MAKECMDGOALS)),)
+HASH := \#
+HAVE_COROUTINES := $(shell \
+    printf '%s\n' '$(HASH)include <coroutine>' \
+        '$(HASH)ifndef __cpp_lib_coroutine' '$(HASH)error' '$(HASH)endif' \
+    | $(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CXX20FLAGS) -fsyntax-only -x c++ - \
+        2>/dev/null && echo yes)
+endif
+
+.PHONY: all check
+all: $(OUTDIR)/mkmk $(OUTDIR)/pi_data.ok
+
+check: $(OUTDIR)/check.ok $(if $(HAVE_COROUTINES),$(OUTDIR)/check20.ok)
+
+# The table is replaced only if its contents change, so as not to trigger
+# needless rebuilds, and is regenerated regardless if it is missing.
+
+PI_DATA_FORCE = $(if $(wildcard $(SRCDIR)/pi_data.cpp),,FORCE)
+
+.PHONY: FORCE
+FORCE:
+
+$(OUTDIR)/mkmk: $(PREFIX)/etc/mkmk.cpp | $(OUTDIR)
 	$(CXX) -o $@ $(CPPFLAGS) $(CXXFLAGS) $< $(LDFLAGS)
 
+$(OUTDIR)/mkpi: \
+    $(PREFIX)/etc/mkpi.cpp \
+    $(SRCDIR)/pi_data.hpp \
+    $(SRCDIR)/primedist.cpp \
+    $(SRCDIR)/primedist.hpp \
+    $(SRCDIR)/std.hpp \
+    | $(OUTDIR)
+	$(CXX) -o $@ -I$(SRCDIR) $(CPPFLAGS) $(CXXFLAGS) -O2 \
+	    $(filter %.cpp,$^) $(LDFLAGS)
+
+$(OUTDIR)/pi_data.ok: $(OUTDIR)/mkpi $(PI_DATA_FORCE)
+	$< > $(OUTDIR)/pi_data.cpp
+	cmp -s $(OUTDIR)/pi_data.cpp $(SRCDIR)/pi_data.cpp \
+	    || mv $(OUTDIR)/pi_data.cpp $(SRCDIR)/pi_data.cpp
+	touch $@
+
+CHECK_SOURCES = \
+    $(PREFIX)/etc/check.cpp \
+    $(OUTDIR)/pi_data.ok \
+    $(SRCDIR)/autotune.cpp \
+    $(SRCDIR)/autotune.hpp \
+    $(SRCDIR)/pi_data.hpp \
+    $(SRCDIR)/pi_table.cpp \
+    $(SRCDIR)/pi_table.hpp \
+    $(SRCDIR)/prime_iterator.cpp \
+    $(SRCDIR)/prime_iterator.hpp \
+    $(SRCDIR)/primedist.cpp \
+    $(SRCDIR)/primedist.hpp \
+    $(SRCDIR)/std.hpp
+
+$(OUTDIR)/check: $(CHECK_SOURCES) | $(OUTDIR)
+	$(CXX) -o $@ -I$(SRCDIR) $(CPPFLAGS) $(CXXFLAGS) -O2 \
+	    $(filter %.cpp,$^) $(SRCDIR)/pi_data.cpp $(LDFLAGS)
+
+$(OUTDIR)/check20: $(CHECK_SOURCES) | $(OUTDIR)
+	$(CXX) -o $@ -I$(SRCDIR) $(CPPFLAGS) $(CXXFLAGS) $(CXX20FLAGS) -O2 \
+	    $(filter %.cpp,$^) $(SRCDIR)/pi_data.cpp $(LDFLAGS)
+
+$(OUTDIR)/%.ok: $(OUTDIR)/%
+	$< && touch $@
+
 $(OUTDIR):
 	mkdir -p $@
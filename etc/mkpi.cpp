@@ -0,0 +1,100 @@
+/** @file mkpi.cpp Defines a stand-alone program to generate prime tables.
+ *
+ * This program prints a C++ source file defining the arrays declared in
+ * `src/pi_data.hpp`.  Each block count is computed by a plain sieve of
+ * Eratosthenes, independent of the `primedist` engine, and is then checked
+ * against the engine's own bucket counts; any disagreement is an error, so
+ * a table that doesn't match the runtime sieve can never be built.
+ */
+
+// PREPROCESSOR {{{
+
+#include "pi_data.hpp"
+#include "primedist.hpp"
+
+// }}}
+
+// USINGS {{{
+
+using primedist::pi_data::blocks;
+using primedist::pi_data::group;
+using primedist::pi_data::limit;
+using primedist::pi_data::stride;
+using std::logic_error;
+using std::runtime_error;
+using std::size_t;
+using std::uint64_t;
+using std::vector;
+
+// }}}
+
+// MAIN {{{
+
+int main() try
+{
+    // Count primes per block with a plain sieve.
+
+    vector<bool> composite(limit);
+    composite[0] = composite[1] = true;
+    for (uint64_t i = 2; i * i < limit; ++i) {
+        if (!composite[i]) {
+            for (uint64_t j = i * i; j < limit; j += i)
+                composite[j] = true;
+        }
+    }
+    vector<size_t> counts(blocks);
+    for (uint64_t v = 0; v < limit; ++v) {
+        if (!composite[v])
+            ++counts[v / stride];
+    }
+
+    // Check them against the runtime sieve.
+
+    vector<size_t> check(blocks);
+    primedist::engine().fill_buckets(check, 0, stride);
+    for (uint64_t b = 0; b < blocks; ++b) {
+        if (counts[b] != check[b]) {
+            throw logic_error(
+                    "sieves disagree on block " + std::to_string(b) + ": "
+                    + std::to_string(counts[b]) + " != "
+                    + std::to_string(check[b]));
+        }
+        if (counts[b] > std::numeric_limits<std::uint8_t>::max())
+            throw logic_error("block count overflows a byte");
+    }
+
+    std::cout <<
+        "// Generated by etc/mkpi.cpp; do not edit.\n"
+        "\n"
+        "#include \"pi_data.hpp\"\n"
+        "\n"
+        "std::uint8_t const primedist::pi_data::counts[] = {";
+    for (uint64_t b = 0; b < blocks; ++b)
+        std::cout << (b % 16 ? " " : "\n    ") << counts[b] << ',';
+    std::cout <<
+        "\n};\n"
+        "\n"
+        "std::uint32_t const primedist::pi_data::totals[] = {";
+    uint64_t total = 0;
+    for (uint64_t b = 0; b < blocks; ++b) {
+        if (b % group == 0)
+            std::cout << (b / group % 8 ? " " : "\n    ") << total << ',';
+        total += counts[b];
+    }
+    std::cout << "\n};\n";
+} catch (logic_error const& error) {
+    std::cerr << "Internal Error: " << error.what() << '\n';
+    return -1;
+} catch (runtime_error const& error) {
+    std::cerr << "Error: " << error.what() << '\n';
+    return -2;
+}
+
+// }}}
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// vim:foldmethod=marker
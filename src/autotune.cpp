@@ -0,0 +1,179 @@
+/** @file autotune.cpp Implements host-specific tuning of engine options. */
+
+#include "autotune.hpp"
+
+namespace primedist {
+
+namespace {
+
+/** Returns the first line of the file at `path`, or an empty string. */
+std::string read_line(std::string const& path)
+{
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+/** Returns the number of words in a segment of about `bytes` bytes,
+  * rounded down to a power of two.
+  */
+std::size_t words_for(std::size_t bytes)
+{
+    std::size_t words = 512;
+    while (words * 2 * sizeof(std::uint64_t) <= bytes)
+        words *= 2;
+    return words;
+}
+
+}
+
+// cache_info {{{
+
+std::size_t parse_size(std::string const& text)
+{
+    std::istringstream in(text);
+    std::size_t n = 0;
+    char unit = 0;
+    if (!(in >> n))
+        return 0;
+    in >> unit >> std::ws;
+    if (!in.eof())
+        return 0;
+    switch (unit) {
+      case 0:   return n;
+      case 'K': return n << 10;
+      case 'M': return n << 20;
+      case 'G': return n << 30;
+      default:  return 0;
+    }
+}
+
+cache_info read_cache_info(std::string const& dir)
+{
+    cache_info result = { 0, 0, 0 };
+    for (int i = 0;; ++i) {
+        auto index = dir + "/index" + std::to_string(i) + '/';
+        auto level = read_line(index + "level");
+        if (level.empty())
+            break;
+        if (read_line(index + "type") == "Instruction")
+            continue;
+        auto size = parse_size(read_line(index + "size"));
+        if (level == "1")
+            result.l1d = size;
+        else if (level == "2")
+            result.l2 = size;
+        else if (level == "3")
+            result.l3 = size;
+    }
+    return result;
+}
+
+// }}}
+// tuning {{{
+
+options detect_options(cache_info const& caches)
+{
+    // A segment of half the L2 cache leaves room for the pre-sieve pattern
+    // and base primes.  The largest pattern (for primes up to 13) is 117
+    // KiB, so is worthwhile only with a roomy L2.  Where many threads share
+    // a small L3, their segments must fit in it together.
+
+    auto opts = default_options();
+    opts.threads = std::max(1u, std::thread::hardware_concurrency());
+    if (caches.l2)
+        opts.segment_words = words_for(caches.l2 / 2);
+    else if (caches.l1d)
+        opts.segment_words = words_for(caches.l1d);
+    if (caches.l3) {
+        opts.segment_words = std::min(
+                opts.segment_words, words_for(caches.l3 / opts.threads));
+    }
+    opts.presieve = caches.l2 >= (1 << 20) ? 13 : 11;
+    return opts;
+}
+
+options calibrate(options const& start)
+{
+    // Time a single-threaded count, which is representative of each
+    // worker's share of a larger sweep, over values large enough that base
+    // prime placement matters.
+
+    std::uint64_t const lo = 10000000000, n = 1 << 25;
+
+    auto best      = start;
+    auto best_time = std::chrono::steady_clock::duration::max();
+    for (auto words : { start.segment_words / 2,
+                        start.segment_words,
+                        start.segment_words * 2,
+                        start.segment_words * 4 }) {
+        for (unsigned presieve : { 11, 13 }) {
+            if (words == 0)
+                continue;
+            engine e(options{ words, presieve, 1 });
+            e.reserve(lo + n);
+            auto t0 = std::chrono::steady_clock::now();
+            e.count(lo, lo + n);
+            auto time = std::chrono::steady_clock::now() - t0;
+            if (time < best_time) {
+                best_time = time;
+                best = options{ words, presieve, start.threads };
+            }
+        }
+    }
+    return best;
+}
+
+bool load_options(options* result, std::string const& path)
+{
+    std::ifstream in(path);
+    if (!in)
+        return false;
+    auto opts = *result;
+    int found = 0;
+    for (std::string key; in >> key;) {
+        if (key == "segment_words" && in >> opts.segment_words)
+            found |= 1;
+        else if (key == "presieve" && in >> opts.presieve)
+            found |= 2;
+        else if (key == "threads" && in >> opts.threads)
+            found |= 4;
+        else
+            return false;
+    }
+    if (found != 7 || !opts.segment_words || !opts.threads)
+        return false;
+    *result = opts;
+    return true;
+}
+
+bool save_options(options const& opts, std::string const& path)
+{
+    std::ofstream out(path);
+    out << "segment_words " << opts.segment_words << '\n'
+        << "presieve "      << opts.presieve      << '\n'
+        << "threads "       << opts.threads       << '\n';
+    return bool(out.flush());
+}
+
+options tuned_options(std::string const& path)
+{
+    auto opts = default_options();
+    if (!load_options(&opts, path)) {
+        opts = calibrate(detect_options());
+        save_options(opts, path);
+    }
+    return opts;
+}
+
+// }}}
+
+}
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// vim:foldmethod=marker
@@ -0,0 +1,79 @@
+/** @file autotune.hpp Chooses engine options to suit the host.
+ *
+ * No single segment size suits every host: it should be small enough that a
+ * segment stays in cache while it is sieved and counted, but large enough
+ * that the per-segment cost of placing each base prime is amortized.  The
+ * functions in this file derive options from the host's cache sizes (as
+ * reported by Linux sysfs), optionally refine them by timing a short
+ * calibration run, and persist the result so that later runs skip the work.
+ */
+
+#ifndef INCLUDED_UNBUGGY_AUTOTUNE
+#define INCLUDED_UNBUGGY_AUTOTUNE
+
+#include "primedist.hpp"
+
+namespace primedist {
+
+// cache_info {{{
+
+/** Sizes in bytes of the host's data caches, or zero where unknown. */
+struct cache_info {
+    std::size_t l1d;    ///< level 1 data cache, per core
+    std::size_t l2;     ///< level 2 cache
+    std::size_t l3;     ///< last level cache, typically shared
+};
+
+/** Returns the number of bytes in a sysfs cache size such as "48K", or zero
+  * if `text` is not a number with an optional suffix of `K`, `M`, or `G`.
+  */
+std::size_t parse_size(std::string const& text);
+
+/** Returns the sizes of the data caches described in `dir`, which has the
+  * layout of `/sys/devices/system/cpu/cpu0/cache`.  Sizes that cannot be
+  * read are zero.
+  */
+cache_info read_cache_info(
+        std::string const& dir = "/sys/devices/system/cpu/cpu0/cache");
+
+// }}}
+// tuning {{{
+
+/** Returns options derived from `caches` and the number of hardware threads,
+  * without running anything.  Segments are sized to the L2 cache (or, if its
+  * size is unknown, the L1), but no larger than each thread's share of the
+  * L3.
+  */
+options detect_options(cache_info const& caches = read_cache_info());
+
+/** Returns whichever of several candidate options near `start` sieves a
+  * fixed calibration range fastest.  This takes a fraction of a second.
+  */
+options calibrate(options const& start);
+
+/** Loads options from the profile at `path` into `*result`.  Returns false,
+  * without modifying `*result`, if the profile is missing or malformed.
+  */
+bool load_options(options* result, std::string const& path);
+
+/** Saves `opts` to a profile at `path`.  Returns false on failure. */
+bool save_options(options const& opts, std::string const& path);
+
+/** Returns options from the profile at `path`, if it exists; otherwise,
+  * detects and calibrates options for this host, and tries to save them to
+  * `path` for next time.
+  */
+options tuned_options(std::string const& path);
+
+// }}}
+
+}
+
+#endif
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// vim:foldmethod=marker
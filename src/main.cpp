@@ -1,55 +1,135 @@
 /** @file main.cpp A program to analyze prime number distribution. */
 
-#include "std.hpp"
+#include "autotune.hpp"
+#include "pi_table.hpp"
+#include "primedist.hpp"
 
-/** Sets each bit in `*result` true if its index is prime, and false otherwise.
+/** Names of the series that `fill_series` computes, in order. */
+std::array<std::string, 6> const series_names = {{
+    "prime",        // p
+    "twin",         // p, p + 2
+    "cousin",       // p, p + 4
+    "sexy",         // p, p + 6
+    "triplet",      // p, p + 2, p + 6
+    "quadruplet"    // p, p + 2, p + 6, p + 8
+}};
+
+/** Fills one series of `weight`-value buckets per element of `series_names`
+  * into consecutive portions of `result`, in a single pass of `*engine`,
+  * collecting gaps into `*gaps` if `gaps` is not null, and filling each of
+  * `matrices` with residue counts.
   */
-void identify_primes(std::vector<bool>* result)
+void fill_series(
+        primedist::engine*                                engine,
+        primedist::span<std::size_t>                      result,
+        std::size_t                                       weight,
+        primedist::gap_collector*                         gaps,
+        primedist::span<primedist::residue_matrix const>  matrices)
 {
-    auto& r = *result;
-    auto  n = r.size();
-    if (n < 3) {
-        r.assign(n, false);
-    } else {
-        r.assign(n, true);
-        r[0] = r[1] = false;
-        for (std::size_t i = 4; i < n; i += 2)
-            r[i] = false;
-        for (std::size_t i = 3, q = std::sqrt(n); i <= q; i += 2) {
-            for (std::size_t j = i * 2; j < n; j += i)
-                r[j] = false;
+    using primedist::constellation;
+    engine->fill_patterns<
+        constellation<>,
+        constellation<2>,
+        constellation<4>,
+        constellation<6>,
+        constellation<2, 6>,
+        constellation<2, 6, 8>>(result, 0, weight, gaps, matrices);
+}
+
+/** Prints a histogram of the `w` counts beginning at `buckets`, scaled to
+  * `h` rows so that a count of `x` fills every row.
+  */
+void print_histogram(
+        std::size_t const*  buckets,
+        std::size_t         w,
+        std::size_t         h,
+        std::size_t         x)
+{
+    if (x) {
+        for (std::size_t row = h; --row;) {
+            for (std::size_t col = 0; col < w; ++col)
+                std::cout << (buckets[col] * h / x >= row ? 'o' : ' ');
+            std::cout << '\n';
         }
     }
 }
 
-/** Sets `*result` elements to counts of passing values from integer ranges.
-  * Each value `v` is considered *passing* if `filter[v]` is true.  The count
-  * at each index `i` in `*result` corresponds to the range of integers
-  * beginning at `i * weight` and containing `weight` distinct values.
-  * The behavior is undefined unless `filter` contains at least `weight *
-  * result->size()` elements.
+/** Prints a histogram of the `w` counts beginning at `buckets`, scaled to
+  * `h` rows.
+  */
+void print_histogram(std::size_t const* buckets, std::size_t w, std::size_t h)
+{
+    print_histogram(buckets, w, h, *std::max_element(buckets, buckets + w));
+}
+
+/** Returns the character representing residue class `r` in plots. */
+char residue_glyph(unsigned r)
+{
+    return r < 10 ? '0' + r : r < 36 ? 'a' + (r - 10) : '#';
+}
+
+/** Prints a single histogram of the `k` by `w` matrix `counts` (as filled by
+  * `primedist::engine::fill_residues`) in which each column stacks the
+  * counts of its residue classes, lowest class at the bottom, drawn with
+  * `residue_glyph`.
   */
-void fill_buckets(
-        std::vector<std::size_t>* result,
-        std::vector<bool> const&  filter,
-        std::size_t               weight)
+void print_stacked(
+        std::vector<std::size_t> const& counts,
+        unsigned                        k,
+        std::size_t                     w,
+        std::size_t                     h)
 {
-    assert(filter.size() >= weight * result->size());
-    auto& r = *result;
-    auto  n = r.size();
-    for (std::size_t i = 0; i < n; ++i) {
-        for (std::size_t j = i * weight, e = j + weight; j < e; ++j) {
-            if (filter[j])
-                ++r[i];
+    std::vector<std::size_t> totals(w);
+    for (unsigned r = 0; r < k; ++r) {
+        for (std::size_t col = 0; col < w; ++col)
+            totals[col] += counts[r * w + col];
+    }
+    if (auto x = *std::max_element(totals.begin(), totals.end())) {
+        for (std::size_t row = h; --row;) {
+            for (std::size_t col = 0; col < w; ++col) {
+                char c = ' ';
+                for (std::size_t r = 0, sum = 0; r < k; ++r) {
+                    sum += counts[r * w + col];
+                    if (sum * h / x >= row) {
+                        c = residue_glyph(r);
+                        break;
+                    }
+                }
+                std::cout << c;
+            }
+            std::cout << '\n';
         }
     }
+}
 
+/** Prints one histogram per nonempty residue class in the `k` by `w` matrix
+  * `counts`, all on the same scale so that classes may be compared.
+  */
+void print_residues(
+        std::vector<std::size_t> const& counts,
+        unsigned                        k,
+        std::size_t                     w,
+        std::size_t                     h)
+{
+    auto x = *std::max_element(counts.begin(), counts.end());
+    bool first = true;
+    for (unsigned r = 0; r < k; ++r) {
+        auto row = &counts[r * w];
+        if (std::none_of(row, row + w, [](std::size_t n) { return n; }))
+            continue;
+        if (!first)
+            std::cout << '\n';
+        print_histogram(row, w, h, x);
+        first = false;
+    }
 }
 
 int main(int argc, char** argv) try
 {
-    if (argc != 4)
-        throw "usage: main <column-weight> <column-count> <row-count>";
+    if (argc < 4)
+        throw "usage: main <column-weight> <column-count> <row-count> "
+              "[prime|twin|cousin|sexy|triplet|quadruplet|mod<k>|stack<k>|"
+              "maxgap|meangap]...";
 
     std::size_t m = std::stol(argv[1]); // integers per column
     std::size_t w = std::stol(argv[2]); // total output width
@@ -59,18 +139,105 @@ int main(int argc, char** argv) try
     if (w == 0) throw "The column count must be positive.";
     if (h == 0) throw "The row count must be positive.";
 
-    std::vector<bool> prime(m * w);
-    identify_primes(&prime);
+    // Each plot is either an index into `series_names`, the name of a
+    // residue plot ("mod<k>" for one histogram per class modulo `k`, or
+    // "stack<k>" for a single histogram stacking the classes), or the name
+    // of a gap statistic ("maxgap" or "meangap").
 
-    std::vector<std::size_t> buckets(w);
-    fill_buckets(&buckets, prime, m);
+    std::vector<std::string> plots(argv + 4, argv + argc);
+    if (plots.empty())
+        plots.push_back(series_names[0]);
 
-    if (auto x = *std::max_element(buckets.begin(), buckets.end())) {
-        for (std::size_t row = h; --row;) {
-            for (std::size_t col = 0; col < w; ++col)
-                std::cout << (buckets[col] * h / x >= row ? 'o' : ' ');
+    // Check every plot before sieving anything.  Residue plots of the same
+    // modulus share a matrix of counts, filled below.
+
+    std::map<unsigned long, std::vector<std::size_t>> residue_counts;
+    for (auto const& plot : plots) {
+        if (std::count(series_names.begin(), series_names.end(), plot)
+                || plot == "maxgap" || plot == "meangap") {
+            continue;
+        }
+        std::size_t n = plot.compare(0, 5, "stack") == 0 ? 5
+                      : plot.compare(0, 3, "mod")   == 0 ? 3
+                      : 0;
+        if (n == 0 || plot.size() == n
+                || plot.find_first_not_of("0123456789", n) != plot.npos) {
+            throw std::invalid_argument("unrecognized plot: " + plot);
+        }
+        auto k = std::stoul(plot.substr(n));
+        if (k == 0 || k > std::numeric_limits<unsigned>::max())
+            throw "The modulus must be a positive unsigned integer.";
+        residue_counts[k];
+    }
+
+    // Use the host's tuned profile if one is configured, creating it on
+    // first use; otherwise, derive options from the host's cache sizes.
+
+    auto profile = std::getenv("PRIMEDIST_PROFILE");
+    primedist::engine engine(profile
+            ? primedist::tuned_options(profile)
+            : primedist::detect_options());
+
+    bool fused = false;                 // whether any constellation is used
+    for (auto const& plot : plots) {
+        fused = fused || (plot != series_names[0] && std::count(
+                    series_names.begin(), series_names.end(), plot));
+    }
+    bool gapped = std::count(plots.begin(), plots.end(), "maxgap")
+               || std::count(plots.begin(), plots.end(), "meangap");
+    std::vector<primedist::gap_stats> gaps(gapped ? w : 0);
+    primedist::gap_collector collector(gaps, {});
+
+    std::vector<primedist::residues> classes;
+    std::vector<primedist::residue_matrix> matrices;
+    classes.reserve(residue_counts.size());     // keep `matrices` valid
+    for (auto& r : residue_counts) {
+        r.second.resize(r.first * w);
+        classes.emplace_back(r.first);
+        matrices.push_back({&classes.back(), r.second});
+    }
+
+    // Every count comes from one pass of the engine, except that plain
+    // prime counts alone may come from the table instead.
+
+    auto collect = gapped ? &collector : nullptr;
+    std::vector<std::size_t> buckets(w * (fused ? series_names.size() : 1));
+    if (fused) {
+        fill_series(&engine, buckets, m, collect, matrices);
+    } else if (!matrices.empty()) {
+        engine.fill_patterns<primedist::constellation<>>(
+                buckets, 0, m, collect, matrices);
+    } else if (gapped) {
+        engine.fill_buckets(buckets, 0, m, &collector);
+    } else {
+        primedist::fill_buckets(&engine, buckets, 0, m);
+    }
+
+    for (std::size_t i = 0; i < plots.size(); ++i) {
+        auto const& plot = plots[i];
+        if (i)
             std::cout << '\n';
+        auto p = std::find(series_names.begin(), series_names.end(), plot);
+        if (p != series_names.end()) {
+            print_histogram(&buckets[(p - series_names.begin()) * w], w, h);
+            continue;
+        }
+        if (plot == "maxgap" || plot == "meangap") {
+            std::vector<std::size_t> values(w);     // mean in 1/1024ths
+            for (std::size_t col = 0; col < w; ++col) {
+                values[col] = plot == "maxgap"
+                            ? gaps[col].max
+                            : std::lround(gaps[col].mean() * 1024);
+            }
+            print_histogram(values.data(), w, h);
+            continue;
         }
+        bool stacked = plot.compare(0, 5, "stack") == 0;
+        auto k = std::stoul(plot.substr(stacked ? 5 : 3));
+        if (stacked)
+            print_stacked(residue_counts[k], k, w, h);
+        else
+            print_residues(residue_counts[k], k, w, h);
     }
 
 } catch (char const* x) {
@@ -0,0 +1,40 @@
+/** @file pi_data.hpp Declares the embedded table of prime counts.
+ *
+ * The table divides `[0, limit)` into blocks of `stride` values, and records
+ * the number of primes in each block in a byte (no block of 1000 values has
+ * more than 168 primes).  A running total at the start of every `group`
+ * blocks bounds the work of finding the number of primes below any block.
+ * The definitions are generated at build time by `etc/mkpi.cpp`, which
+ * checks every count against the runtime sieve before printing it.
+ */
+
+#ifndef INCLUDED_UNBUGGY_PI_DATA
+#define INCLUDED_UNBUGGY_PI_DATA
+
+#include "std.hpp"
+
+namespace primedist {
+
+namespace pi_data {
+
+std::uint64_t const stride = 1000;              ///< values per block
+std::uint64_t const blocks = 100000;            ///< blocks in the table
+std::uint64_t const limit  = stride * blocks;   ///< one past last value
+std::uint64_t const group  = 256;               ///< blocks per running total
+
+/** Number of primes in each block. */
+extern std::uint8_t const counts[blocks];
+
+/** Number of primes below the first block of each group. */
+extern std::uint32_t const totals[blocks / group + 1];
+
+}
+
+}
+
+#endif
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
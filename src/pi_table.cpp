@@ -0,0 +1,68 @@
+/** @file pi_table.cpp Implements prime counting from the embedded table. */
+
+#include "pi_table.hpp"
+
+namespace primedist {
+
+namespace {
+
+/** Returns the number of primes below block `b` of the table. */
+std::uint64_t pi_block(std::uint64_t b)
+{
+    assert(b <= pi_data::blocks);
+    auto g = b / pi_data::group;
+    std::uint64_t n = pi_data::totals[g];
+    for (auto i = g * pi_data::group; i < b; ++i)
+        n += pi_data::counts[i];
+    return n;
+}
+
+}
+
+std::uint64_t pi(engine* e, std::uint64_t x)
+{
+    // Sieve from whichever multiple of the stride is nearer.
+
+    assert(x <= pi_data::limit);
+    auto b = x / pi_data::stride, r = x % pi_data::stride;
+    if (r == 0)
+        return pi_block(b);
+    if (r <= pi_data::stride / 2)
+        return pi_block(b) + e->count(b * pi_data::stride, x);
+    return pi_block(b + 1) - e->count(x, (b + 1) * pi_data::stride);
+}
+
+std::uint64_t count(engine* e, std::uint64_t lo, std::uint64_t hi)
+{
+    if (lo >= hi)
+        return 0;
+    if (hi > pi_data::limit)
+        return e->count(lo, hi);
+    return pi(e, hi) - pi(e, lo);
+}
+
+void fill_buckets(
+        engine*           e,
+        span<std::size_t> result,
+        std::uint64_t     lo,
+        std::uint64_t     weight)
+{
+    assert(weight > 0);
+    if (weight < pi_data::stride
+            || lo + weight * result.size() > pi_data::limit) {
+        return e->fill_buckets(result, lo, weight);
+    }
+    auto below = pi(e, lo);
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        auto next = pi(e, lo + (i + 1) * weight);
+        result[i] = next - below;
+        below = next;
+    }
+}
+
+}
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
@@ -0,0 +1,48 @@
+/** @file pi_table.hpp Prime counts answered from an embedded table.
+ *
+ * Interactive plots rarely stray beyond the first hundred million integers,
+ * and sieving that far takes a noticeable fraction of a second.  The
+ * functions in this file look up the number of primes below each multiple
+ * of `pi_data::stride` in a table embedded in the program (see
+ * `pi_data.hpp`), and sieve only the values between a range edge and the
+ * nearest such multiple.  Ranges beyond the table are sieved as usual.
+ */
+
+#ifndef INCLUDED_UNBUGGY_PI_TABLE
+#define INCLUDED_UNBUGGY_PI_TABLE
+
+#include "pi_data.hpp"
+#include "primedist.hpp"
+
+namespace primedist {
+
+/** Returns the number of primes less than `x`, sieving with `*e` any values
+  * between `x` and the nearest multiple of `pi_data::stride`.  The behavior
+  * is undefined unless `x <= pi_data::limit`.
+  */
+std::uint64_t pi(engine* e, std::uint64_t x);
+
+/** Returns the number of primes in `[lo, hi)`, using the embedded table if
+  * `hi <= pi_data::limit`, and `e->count` otherwise.
+  */
+std::uint64_t count(engine* e, std::uint64_t lo, std::uint64_t hi);
+
+/** Fills `result` as if by `e->fill_buckets(result, lo, weight)`, but using
+  * the embedded table when the buckets lie below `pi_data::limit` and are
+  * at least `pi_data::stride` wide.  Buckets whose edges are multiples of
+  * the stride are then answered without sieving at all.
+  */
+void fill_buckets(
+        engine*           e,
+        span<std::size_t> result,
+        std::uint64_t     lo,
+        std::uint64_t     weight);
+
+}
+
+#endif
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
@@ -0,0 +1,242 @@
+/** @file prime_iterator.cpp Implements lazy iteration over primes. */
+
+#include "prime_iterator.hpp"
+
+namespace primedist {
+
+namespace {
+
+/** Marks the absence of a segment; not a multiple of 64, so never a base. */
+std::uint64_t const none = ~std::uint64_t(0);
+
+/** Returns the number of words per segment for an iterator starting at
+  * `start`.  Far from zero, sieving a segment costs a visit to every base
+  * prime, hit or not, so segments grow to span four times the square root
+  * of `start`, though not beyond 64Ki words (512 KiB).
+  */
+std::size_t segment_words(std::uint64_t start, options const& opts)
+{
+    auto root = static_cast<std::uint64_t>(std::sqrt(double(start)));
+    return std::max<std::size_t>(
+            opts.segment_words, std::min<std::uint64_t>(root / 16, 1 << 16));
+}
+
+}
+
+// iterator_options {{{
+
+options iterator_options()
+{
+    auto opts = default_options();
+    auto n    = std::thread::hardware_concurrency();
+    opts.segment_words = 32768;     // 256 KiB, about one L2 cache
+    opts.threads       = std::min(4u, std::max(1u, n - 1));
+    return opts;
+}
+
+// }}}
+// prime_iterator {{{
+
+/** A background thread and the segment it sieves. */
+struct prime_iterator::worker {
+    std::vector<std::uint64_t>  words;          // the segment
+    std::uint64_t               base  = none;   // its first value, if posted
+    bool                        ready = false;  // whether it has been sieved
+    std::exception_ptr          error;          // thrown while sieving
+    sieve_cursor                cursor;         // resumes upward runs
+    std::thread                 thread;
+};
+
+void prime_iterator::run(worker* w)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_posted.wait(lock, [&] {
+            return m_stopping || (w->base != none && !w->ready);
+        });
+        if (m_stopping)
+            return;
+        auto base = w->base;
+        lock.unlock();
+        try {
+            m_engine.sieve(w->words.data(), base, w->words.size(), &w->cursor);
+        } catch (...) {
+            w->error = std::current_exception();
+        }
+        lock.lock();
+        w->ready = true;
+        m_finished.notify_all();
+    }
+}
+
+void prime_iterator::load(std::uint64_t base, bool down)
+{
+    // `reserve` is not safe to call while any worker is sieving, so it waits
+    // for them all to finish first.
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto idle = [&] {
+        for (auto& w : m_workers) {
+            if (w->base != none && !w->ready)
+                return false;
+        }
+        return true;
+    };
+
+    worker* held = nullptr;
+    for (auto& w : m_workers) {
+        if (w->base == base)
+            held = w.get();
+    }
+    if (held) {
+        m_finished.wait(lock, [&] { return held->ready; });
+        held->base  = none;
+        held->ready = false;
+        if (held->error)
+            std::rethrow_exception(std::exchange(held->error, nullptr));
+        m_words.swap(held->words);
+    } else {
+        // The iterator has jumped or turned around, so any segments sieved
+        // ahead are of no use.  Ascending segments sieved here share
+        // `m_cursor`, which finds each base prime's next multiple without
+        // division; it is left alone when going down.
+
+        m_finished.wait(lock, idle);
+        for (auto& w : m_workers) {
+            w->base  = none;
+            w->ready = false;
+            w->error = nullptr;
+        }
+        auto cursor = down ? nullptr : &m_cursor;
+        m_engine.reserve(base + m_span);
+        m_engine.sieve(m_words.data(), base, m_words.size(), cursor);
+    }
+    m_base = base;
+
+    if (!m_prefetch)
+        return;
+    if (m_workers.empty()) {
+        auto n = m_engine.opts().threads;
+        m_workers.reserve(n);
+        while (m_workers.size() < n) {
+            std::unique_ptr<worker> w(new worker);
+            w->words.resize(m_words.size());
+            w->thread = std::thread(&prime_iterator::run, this, w.get());
+            m_workers.push_back(std::move(w));
+        }
+    }
+
+    // Keep one segment per worker in flight ahead of the caller, stopping at
+    // either end of the range of 64-bit values.
+
+    auto next = base;
+    for (std::size_t k = 0; k < m_workers.size(); ++k) {
+        if (down ? next == 0 : none - next < 2 * m_span - 1)
+            break;
+        next = down ? next - m_span : next + m_span;
+        worker* w      = nullptr;
+        bool    posted = false;
+        for (auto& v : m_workers) {
+            if (v->base == next)
+                posted = true;
+            else if (v->base == none && !w)
+                w = v.get();
+        }
+        if (posted)
+            continue;
+        if (!w)
+            break;
+        if (next + (m_span - 1) >= m_engine.reserved()) {
+            m_finished.wait(lock, idle);
+            m_engine.reserve(next + (m_span - 1));
+        }
+        w->base = next;
+        m_posted.notify_all();
+    }
+}
+
+prime_iterator::prime_iterator(
+        std::uint64_t   start,
+        options const&  opts,
+        bool            prefetch):
+    m_engine(opts),
+    m_span(segment_words(start, opts) * 64),
+    m_prefetch(prefetch),
+    m_words(m_span / 64),
+    m_base(none),
+    m_next(start),
+    m_prev(start),
+    m_stopping(false)
+{
+}
+
+prime_iterator::~prime_iterator()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_posted.notify_all();
+    for (auto& w : m_workers) {
+        if (w->thread.joinable())
+            w->thread.join();
+    }
+}
+
+std::uint64_t prime_iterator::next()
+{
+    for (;;) {
+        auto v    = m_next;
+        auto base = m_base;
+        if (base == none || v - base >= m_span) {
+            base = v / m_span * m_span;
+            load(base, false);
+        }
+        auto i    = (v - base) / 64;
+        auto bits = m_words[i] & ~std::uint64_t(0) << (v - base) % 64;
+        while (!bits && ++i < m_words.size())
+            bits = m_words[i];
+        if (bits) {
+            auto p = base + i * 64 + __builtin_ctzll(bits);
+            m_next = p + 1;
+            m_prev = p;
+            return p;
+        }
+        m_next = base + m_span;
+    }
+}
+
+std::uint64_t prime_iterator::prev()
+{
+    while (m_prev > 2) {
+        auto v    = m_prev - 1;
+        auto base = m_base;
+        if (base == none || v - base >= m_span) {
+            base = v / m_span * m_span;
+            load(base, true);
+        }
+        auto i    = (v - base) / 64;
+        auto bits = m_words[i] & ~std::uint64_t(0) >> (63 - (v - base) % 64);
+        while (!bits && i > 0)
+            bits = m_words[--i];
+        if (bits) {
+            auto p = base + i * 64 + (63 - __builtin_clzll(bits));
+            m_next = p + 1;
+            m_prev = p;
+            return p;
+        }
+        m_prev = base;
+    }
+    return 0;
+}
+
+// }}}
+
+}
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// vim:foldmethod=marker
@@ -0,0 +1,184 @@
+/** @file prime_iterator.hpp Lazy, bidirectional iteration over primes.
+ *
+ * A `prime_iterator` walks the primes in order from any starting value,
+ * sieving one segment at a time as it goes, so memory use is bounded by the
+ * segment size no matter how far it travels.  While the caller consumes one
+ * segment, the segments that follow in the direction of travel are sieved by
+ * a small pool of background threads, started on first use and kept for the
+ * life of the iterator.  When compiled as C++20 or later, `primes` adapts the
+ * iterator to a coroutine generator for use in range-based `for` loops.
+ */
+
+#ifndef INCLUDED_UNBUGGY_PRIME_ITERATOR
+#define INCLUDED_UNBUGGY_PRIME_ITERATOR
+
+#include "primedist.hpp"
+
+namespace primedist {
+
+// iterator_options {{{
+
+/** Returns options suitable for a `prime_iterator`: segments about the size
+  * of a typical L2 cache, and up to four background threads, leaving one
+  * hardware thread for the caller.
+  */
+options iterator_options();
+
+// }}}
+// prime_iterator {{{
+
+/** Returns primes one at a time, in ascending or descending order. */
+class prime_iterator {
+
+    struct worker;
+
+    engine                      m_engine;
+    std::uint64_t               m_span;         // values per segment
+    bool                        m_prefetch;     // whether to sieve ahead
+    std::vector<std::uint64_t>  m_words;        // current segment
+    std::uint64_t               m_base;         // first value of `m_words`
+    std::uint64_t               m_next;         // least value `next` returns
+    std::uint64_t               m_prev;         // `prev` returns less
+    sieve_cursor                m_cursor;       // for segments sieved here
+
+    std::vector<std::unique_ptr<worker>>
+                                m_workers;      // started on first `load`
+    std::mutex                  m_mutex;        // guards workers' segments
+    std::condition_variable     m_posted;       // a segment was requested
+    std::condition_variable     m_finished;     // a segment was sieved
+    bool                        m_stopping;     // workers are to exit
+
+    /** Sieves the segments requested of `*w` until the iterator is
+      * destroyed.
+      */
+    void run(worker* w);
+
+    /** Makes the segment beginning at `base` current, and requests that idle
+      * workers sieve the segments that follow it, downward if `down`, and
+      * upward otherwise.
+      */
+    void load(std::uint64_t base, bool down);
+
+  public:
+
+    /** Creates an iterator positioned at `start`: the first call to `next`
+      * returns the least prime not less than `start`, and the first call to
+      * `prev` returns the greatest prime less than `start`.  If `prefetch` is
+      * true, `opts.threads` background threads each sieve one segment ahead;
+      * otherwise, segments are sieved only on demand, on the calling thread.
+      * `opts.segment_words` is a minimum: far from zero, segments are made
+      * larger to save sieving time.
+      */
+    explicit prime_iterator(
+            std::uint64_t   start    = 0,
+            options const&  opts     = iterator_options(),
+            bool            prefetch = true);
+
+    prime_iterator(prime_iterator const&) = delete;
+
+    prime_iterator& operator=(prime_iterator const&) = delete;
+
+    ~prime_iterator();
+
+    /** Returns the least prime greater than the one most recently returned,
+      * or, before any prime has been returned, not less than `start`.
+      */
+    std::uint64_t next();
+
+    /** Returns the greatest prime less than the one most recently returned,
+      * or, before any prime has been returned, less than `start`.  Returns
+      * zero if there is no such prime.
+      */
+    std::uint64_t prev();
+};
+
+// }}}
+// generator {{{
+
+#ifdef __cpp_lib_coroutine
+
+/** A minimal coroutine generator, yielding values of type `T`. */
+template<typename T>
+class generator {
+  public:
+
+    struct promise_type {
+        T value;
+
+        generator get_return_object()
+        {
+            return generator(handle::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        std::suspend_always yield_value(T v) noexcept
+        {
+            value = v;
+            return {};
+        }
+
+        void return_void() noexcept { }
+
+        void unhandled_exception() { throw; }
+    };
+
+    typedef std::coroutine_handle<promise_type> handle;
+
+    class iterator {
+        handle m_h;
+      public:
+        explicit iterator(handle h): m_h(h) { }
+
+        T const& operator*() const { return m_h.promise().value; }
+
+        iterator& operator++() { m_h.resume(); return *this; }
+
+        bool operator==(std::default_sentinel_t) const { return m_h.done(); }
+    };
+
+    explicit generator(handle h): m_h(h) { }
+
+    generator(generator&& other): m_h(std::exchange(other.m_h, nullptr)) { }
+
+    generator(generator const&) = delete;
+
+    generator& operator=(generator const&) = delete;
+
+    ~generator() { if (m_h) m_h.destroy(); }
+
+    iterator begin() { m_h.resume(); return iterator(m_h); }
+
+    std::default_sentinel_t end() const { return {}; }
+
+  private:
+    handle m_h;
+};
+
+/** Yields the primes in `[lo, hi)` in ascending order. */
+inline generator<std::uint64_t> primes(
+        std::uint64_t   lo,
+        std::uint64_t   hi,
+        options         opts = iterator_options())
+{
+    prime_iterator it(lo, opts);
+    for (auto p = it.next(); p < hi; p = it.next())
+        co_yield p;
+}
+
+#endif
+
+// }}}
+
+}
+
+#endif
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// vim:foldmethod=marker
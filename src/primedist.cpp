@@ -0,0 +1,501 @@
+/** @file primedist.cpp Implements the segmented prime sieve. */
+
+#include "primedist.hpp"
+
+namespace primedist {
+
+namespace {
+
+/** Primes small enough to be removed by copying a periodic pattern. */
+std::array<unsigned, 6> const small_primes = {{ 2, 3, 5, 7, 11, 13 }};
+
+/** Multiples `m * p` of a base prime `p` need crossing off only if `m` is
+  * coprime to 30, since 2, 3, and 5 cross off the rest, whether as base
+  * primes or by the pre-sieve pattern.  Such `m` step through a wheel of
+  * eight residues modulo 30, and `wheel_steps[k]` is the step from the
+  * `k`th residue to the next.
+  */
+std::array<unsigned, 8> const wheel_steps = {{ 6, 4, 2, 4, 2, 4, 6, 2 }};
+
+/** For each `r` in `[0, 30)`, the least `d` such that `r + d` is coprime to
+  * 30, and the position of `(r + d) % 30` in the wheel, packed as `d * 8 +
+  * position`.
+  */
+std::array<unsigned char, 30> const wheel_start = {{
+    1 * 8 + 0, 0 * 8 + 0, 5 * 8 + 1, 4 * 8 + 1, 3 * 8 + 1, 2 * 8 + 1,
+    1 * 8 + 1, 0 * 8 + 1, 3 * 8 + 2, 2 * 8 + 2, 1 * 8 + 2, 0 * 8 + 2,
+    1 * 8 + 3, 0 * 8 + 3, 3 * 8 + 4, 2 * 8 + 4, 1 * 8 + 4, 0 * 8 + 4,
+    1 * 8 + 5, 0 * 8 + 5, 3 * 8 + 6, 2 * 8 + 6, 1 * 8 + 6, 0 * 8 + 6,
+    5 * 8 + 7, 4 * 8 + 7, 3 * 8 + 7, 2 * 8 + 7, 1 * 8 + 7, 0 * 8 + 7,
+}};
+
+/** Returns the largest `r` such that `r * r <= n`. */
+std::uint64_t isqrt(std::uint64_t n)
+{
+    auto r = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(n)));
+    while (r > 0 && (r > n / r))
+        --r;
+    while ((r + 1) <= n / (r + 1))
+        ++r;
+    return r;
+}
+
+}
+
+// residues {{{
+
+residues::residues(unsigned k):
+    m_modulus(k),
+    m_phases(k <= 64 ? k / (k & (0 - k)) : 0)  // k / gcd(k, 64)
+{
+    assert(k > 0);
+    m_masks.assign(m_phases * k, 0);
+    for (std::uint64_t v = 0; v < m_phases * 64; ++v)
+        m_masks[v / 64 * k + v % k] |= std::uint64_t(1) << v % 64;
+}
+
+void tally_residues(
+        segment const&  s,
+        std::uint64_t   a,
+        std::uint64_t   b,
+        residues const& classes,
+        std::uint64_t*  result)
+{
+    auto k = classes.modulus();
+    for_each_word(s, a, b, [&](std::size_t i, std::uint64_t mask) {
+        auto bits = s.words[i] & mask;
+        if (!bits)
+            return;
+        auto base = s.base + i * 64;
+        if (auto masks = classes.masks(base)) {
+            for (unsigned r = 0; r < k; ++r)
+                result[r] += popcount(bits & masks[r]);
+        } else {
+            for (; bits; bits &= bits - 1)
+                ++result[(base + __builtin_ctzll(bits)) % k];
+        }
+    });
+}
+
+// }}}
+// gaps {{{
+
+void gap_collector::record(std::size_t bucket, std::uint64_t gap)
+{
+    auto& stats = m_stats[bucket];
+    ++stats.count;
+    stats.sum += gap;
+    stats.max = std::max(stats.max, gap);
+    if (m_bins) {
+        auto bin = std::min<std::uint64_t>(gap / 2, m_bins - 1);
+        ++m_histogram[bucket * m_bins + bin];
+    }
+}
+
+gap_collector::gap_collector(
+        span<gap_stats>     stats,
+        span<std::size_t>   histogram):
+    m_stats(stats),
+    m_histogram(histogram),
+    m_bins(stats.size() ? histogram.size() / stats.size() : 0)
+{
+    assert(m_bins * stats.size() == histogram.size());
+}
+
+void gap_collector::start(unsigned workers)
+{
+    std::fill(m_stats.begin(), m_stats.end(), gap_stats{0, 0, 0});
+    std::fill(m_histogram.begin(), m_histogram.end(), 0);
+    m_edges.assign(workers, edge{0, 0});
+}
+
+std::uint64_t gap_collector::scan(
+        unsigned        t,
+        segment const&  s,
+        std::uint64_t   a,
+        std::uint64_t   b,
+        std::size_t     bucket)
+{
+    // Zero is never prime, so it marks a worker that has seen no primes.
+    // The gaps ending in a bucket telescope, so their count and sum follow
+    // from the number of primes and the last one.  Gaps within a word are
+    // visited one by one only for the histogram, or if the word's primes
+    // are spread wider than the longest gap so far, which soon rules out
+    // most words.  Statistics are kept in locals, which the sieve words
+    // cannot alias, and stored once.
+
+    auto& e     = m_edges[t];
+    auto  first = e.first;
+    auto  last  = e.last;
+    auto  max   = m_stats[bucket].max;
+    auto  bins  = m_bins ? &m_histogram[bucket * m_bins] : nullptr;
+    auto  gap   = [&](std::uint64_t g) {
+        max = std::max(max, g);
+        if (bins)
+            ++bins[std::min<std::uint64_t>(g / 2, m_bins - 1)];
+    };
+    std::uint64_t n = 0;
+    for_each_word(s, a, b, [&](std::size_t i, std::uint64_t mask) {
+        auto bits = s.words[i] & mask;
+        if (!bits)
+            return;
+        auto base = s.base + i * 64;
+        auto low  = base + __builtin_ctzll(bits);
+        auto high = base + 63 - __builtin_clzll(bits);
+        n += popcount(bits);
+        if (last)
+            gap(low - last);
+        else
+            first = low;
+        if (bins || high - low > max) {
+            for (bits &= bits - 1; bits; bits &= bits - 1) {
+                auto p = base + __builtin_ctzll(bits);
+                gap(p - low);
+                low = p;
+            }
+        }
+        last = high;
+    });
+    if (n) {
+        auto& stats = m_stats[bucket];
+        stats.count += e.last ? n : n - 1;
+        stats.sum   += last - (e.last ? e.last : first);
+        stats.max    = max;
+        e.first      = first;
+        e.last       = last;
+    }
+    return n;
+}
+
+void gap_collector::finish(std::uint64_t lo, std::uint64_t weight)
+{
+    std::uint64_t last = 0;
+    for (auto const& e : m_edges) {
+        if (!e.first)
+            continue;
+        if (last)
+            record((e.first - lo) / weight, e.first - last);
+        last = e.last;
+    }
+}
+
+// }}}
+// options {{{
+
+options default_options()
+{
+    return options{
+        4096,   // segment_words: 32 KiB, about one L1 data cache
+        11,     // presieve: pattern of 1155 words
+        1,      // threads
+    };
+}
+
+// }}}
+// engine {{{
+
+void engine::prepare(std::uint64_t hi)
+{
+    // `run` sieves one word past the end of each segment, and the last
+    // segment ends as much as 63 values past `hi`.
+
+    reserve(hi + 128);
+    if (m_scratch.size() < m_opts.threads) {
+        m_scratch.resize(m_opts.threads);
+        m_cursors.resize(m_opts.threads);
+    }
+    for (auto& words : m_scratch)
+        words.resize(m_opts.segment_words + 1);  // see `segment`
+}
+
+void engine::sieve(
+        std::uint64_t* words,
+        std::uint64_t  base,
+        std::size_t    n) const
+{
+    sieve(words, base, n, nullptr);
+}
+
+void engine::sieve(
+        std::uint64_t* words,
+        std::uint64_t  base,
+        std::size_t    n,
+        sieve_cursor*  cursor) const
+{
+    // Start from the pre-sieve pattern, which has a period that is a
+    // multiple of 64 values, then cross off multiples of larger primes.
+
+    auto period = m_pattern.size();
+    for (std::size_t i = 0, k = base / 64 % period; i < n;) {
+        auto m = std::min(n - i, period - k);
+        std::copy_n(&m_pattern[k], m, &words[i]);
+        i += m;
+        k = 0;
+    }
+    auto clear = [words](std::uint64_t j) {
+        words[j / 64] &= ~(std::uint64_t(1) << j % 64);
+    };
+
+    // Each prime's first multiple is found by division, unless the cursor
+    // left off just below `base`.  Primes 3 and 5, when not pre-sieved,
+    // cross off all their odd multiples; larger primes turn the wheel.
+
+    std::size_t resumed = 0;
+    if (cursor) {
+        if (cursor->m_end != base) {
+            cursor->m_next.clear();
+            cursor->m_turn.clear();
+        }
+        resumed = cursor->m_next.size();
+        cursor->m_end = base + n * 64;
+    }
+    std::uint64_t const end = base + n * 64, size = n * 64;
+    auto start = [&](std::size_t i, std::uint64_t& j, unsigned& k) {
+        std::uint64_t p = m_primes[i];
+        if (i < resumed) {
+            j = cursor->m_next[i] - base;
+            k = cursor->m_turn[i];
+            return true;
+        }
+        if (p * p >= end)
+            return false;
+        auto m = std::max(p, (base + p - 1) / p);
+        if (p < 7) {
+            m |= 1;
+            k = 0;
+        } else {
+            auto w = wheel_start[m % 30];
+            m += w / 8;
+            k = w % 8;
+        }
+        j = m * p - base;
+        return true;
+    };
+    auto save = [&](std::size_t i, std::uint64_t j, unsigned k) {
+        if (!cursor)
+            return;
+        if (i < resumed) {
+            cursor->m_next[i] = base + j;
+            cursor->m_turn[i] = static_cast<std::uint8_t>(k);
+        } else {
+            cursor->m_next.push_back(base + j);
+            cursor->m_turn.push_back(static_cast<std::uint8_t>(k));
+        }
+    };
+    std::size_t i = 0;
+    for (; i < m_primes.size() && m_primes[i] * 2 < size; ++i) {
+        std::uint64_t p = m_primes[i];
+        std::uint64_t j;
+        unsigned      k;
+        if (!start(i, j, k))
+            break;
+        if (p < 7) {
+            for (; j < size; j += p * 2)
+                clear(j);
+        } else {
+
+            // Turn the wheel to its start, then a whole turn at a time.
+
+            for (; k && j < size; k = (k + 1) % 8) {
+                clear(j);
+                j += p * wheel_steps[k];
+            }
+            for (; j + p * 28 < size; j += p * 30) {
+                clear(j);
+                clear(j + p * 6);
+                clear(j + p * 10);
+                clear(j + p * 12);
+                clear(j + p * 16);
+                clear(j + p * 18);
+                clear(j + p * 22);
+                clear(j + p * 28);
+            }
+            for (; j < size; k = (k + 1) % 8) {
+                clear(j);
+                j += p * wheel_steps[k];
+            }
+        }
+        save(i, j, k);
+    }
+
+    // Larger primes step past the whole range, so each crosses off at most
+    // one value, which is done without branching: for primes up to 16 times
+    // the range's width, whether a prime hits the range is as good as
+    // random, and mispredicting it costs more than the crossing.  A miss
+    // clears no bits of the first word.
+
+    auto const far = size * 16;
+    for (; i < m_primes.size() && (i < resumed || m_primes[i] < far); ++i) {
+        std::uint64_t p = m_primes[i];
+        std::uint64_t j;
+        unsigned      k;
+        if (!start(i, j, k))
+            break;
+        std::uint64_t hit = j < size;
+        auto x = hit ? j : 0;
+        words[x / 64] &= ~(hit << x % 64);
+        j += hit * p * wheel_steps[k];
+        k = (k + hit) % 8;
+        save(i, j, k);
+    }
+
+    // The largest primes seldom hit the range, so that a branch predicts
+    // them well, and remembering them would cost more memory traffic than
+    // the division it saves; they are left out of the cursor.  Clearing an
+    // even multiple is harmless, since the pattern has cleared it already.
+
+    for (; i < m_primes.size(); ++i) {
+        std::uint64_t p = m_primes[i];
+        if (p * p >= end)
+            break;
+        auto j = std::max(p * p, (base + p - 1) / p * p) - base;
+        if (j < size)
+            clear(j);
+    }
+
+    // The pattern removes the small primes themselves, and leaves 1.
+
+    if (base == 0) {
+        words[0] &= ~std::uint64_t(2);
+        for (auto p : small_primes) {
+            if (p <= m_opts.presieve)
+                words[0] |= std::uint64_t(1) << p;
+        }
+    }
+}
+
+engine::engine(): engine(default_options())
+{
+}
+
+engine::engine(options const& opts):
+    m_opts(opts),
+    m_limit(0)
+{
+    assert(opts.segment_words > 0);
+    assert(opts.threads > 0);
+
+    m_opts.presieve = std::max(2u, std::min(13u, m_opts.presieve));
+}
+
+void engine::reserve(std::uint64_t hi)
+{
+    // A value survives the pattern if it has no factor among the small
+    // primes.  The pattern repeats every `product` values, and must also
+    // span a whole number of words; since `product` is even, 32 periods do.
+    // It is built on first use, so engines that never sieve don't pay.
+
+    if (m_pattern.empty()) {
+        std::uint64_t product = 1;
+        for (auto p : small_primes) {
+            if (p <= m_opts.presieve)
+                product *= p;
+        }
+        m_pattern.assign(product / 2, ~std::uint64_t(0));
+        for (auto p : small_primes) {
+            if (p > m_opts.presieve)
+                break;
+            for (std::uint64_t v = 0; v < product * 32; v += p)
+                m_pattern[v / 64] &= ~(std::uint64_t(1) << v % 64);
+        }
+    }
+
+    // Base primes are needed up to the square root of the largest value.
+    // Grow them geometrically, so that slowly increasing ranges don't
+    // re-sieve them on every call.
+
+    auto limit = isqrt(hi) + 1;
+    if (limit > m_limit) {
+        limit = std::max(limit, m_limit * 2);
+        std::vector<bool> composite(limit);
+        m_primes.clear();
+        for (std::uint64_t i = 3; i < limit; i += 2) {
+            if (composite[i])
+                continue;
+            if (i > m_opts.presieve)
+                m_primes.push_back(static_cast<std::uint32_t>(i));
+            for (auto j = i * i; j < limit; j += i * 2)
+                composite[j] = true;
+        }
+        m_limit = limit;
+    }
+}
+
+std::uint64_t engine::count(std::uint64_t lo, std::uint64_t hi)
+{
+    std::atomic<std::uint64_t> total(0);
+    sweep(lo, hi, 1, [&](unsigned, segment const& s) {
+        total += primedist::count(s, s.lo, s.hi);
+    });
+    return total;
+}
+
+void engine::fill_buckets(
+        span<std::size_t> result,
+        std::uint64_t     lo,
+        std::uint64_t     weight)
+{
+    fill_patterns<constellation<>>(result, lo, weight);
+}
+
+void engine::fill_buckets(
+        span<std::size_t> result,
+        std::uint64_t     lo,
+        std::uint64_t     weight,
+        gap_collector*    gaps)
+{
+    assert(weight > 0);
+    std::fill(result.begin(), result.end(), 0);
+    gaps->start(m_opts.threads);
+    auto hi = lo + weight * result.size();
+    sweep(lo, hi, weight, [&](unsigned t, segment const& s) {
+        auto i = (s.lo - lo) / weight;
+        for (auto a = s.lo; a < s.hi; ++i) {
+            auto b = std::min(s.hi, lo + (i + 1) * weight);
+            result[i] += gaps->scan(t, s, a, b, i);
+            a = b;
+        }
+    });
+    gaps->finish(lo, weight);
+}
+
+void engine::fill_residues(
+        span<std::size_t> result,
+        std::uint64_t     lo,
+        std::uint64_t     weight,
+        residues const&   classes)
+{
+    auto k = classes.modulus();
+    assert(weight > 0);
+    assert(result.size() % k == 0);
+    std::fill(result.begin(), result.end(), 0);
+    auto w = result.size() / k;
+
+    // Each worker counts one bucket at a time into its own row of `counts`,
+    // then scatters the row into a column of `result`.
+
+    m_counts.resize(std::size_t(m_opts.threads) * k);
+    sweep(lo, lo + weight * w, weight, [&](unsigned t, segment const& s) {
+        auto n = &m_counts[std::size_t(t) * k];
+        auto i = (s.lo - lo) / weight;
+        for (auto a = s.lo; a < s.hi; ++i) {
+            auto b = std::min(s.hi, lo + (i + 1) * weight);
+            std::fill(n, n + k, 0);
+            tally_residues(s, a, b, classes, n);
+            for (unsigned r = 0; r < k; ++r)
+                result[r * w + i] += n[r];
+            a = b;
+        }
+    });
+}
+
+// }}}
+
+}
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// vim:foldmethod=marker
@@ -0,0 +1,780 @@
+/** @file primedist.hpp A reusable segmented sieve for prime distribution.
+ *
+ * The `engine` class sieves arbitrary half-open ranges `[lo, hi)` one
+ * segment at a time, so memory use is bounded by the segment size rather than
+ * by `hi`.  Scratch memory (base primes, pre-sieve pattern, and per-worker
+ * segment buffers) is owned by the engine and reused across calls; once an
+ * engine has seen a range of a given size, later calls of the same or smaller
+ * size do not allocate unless they spawn worker threads.
+ *
+ * Output buffers are supplied by the caller as `span` objects, which are
+ * non-owning views of contiguous memory.  See `primedist_c.hpp` for a C
+ * interface to the same engine.
+ */
+
+#ifndef INCLUDED_UNBUGGY_PRIMEDIST
+#define INCLUDED_UNBUGGY_PRIMEDIST
+
+#include "std.hpp"
+
+namespace primedist {
+
+// span {{{
+
+/** A non-owning view of `size()` contiguous objects of type `T`. */
+template<typename T>
+class span {
+    T*          m_data;
+    std::size_t m_size;
+  public:
+
+    span(): m_data(nullptr), m_size(0) { }
+
+    span(T* data, std::size_t size): m_data(data), m_size(size) { }
+
+    /** Views the elements of the contiguous `container`, which must provide
+      * `data()` and `size()`; e.g., `std::vector` or `std::array`.
+      */
+    template<typename C>
+    span(C& container): m_data(container.data()), m_size(container.size()) { }
+
+    T* begin() const { return m_data; }
+
+    T* data() const { return m_data; }
+
+    T* end() const { return m_data + m_size; }
+
+    std::size_t size() const { return m_size; }
+
+    T& operator[](std::size_t i) const { assert(i < m_size); return m_data[i]; }
+};
+
+// }}}
+// segment {{{
+
+/** A sieved window of integers, as passed to `engine::sweep` visitors.  Bit
+  * `i % 64` of `words[i / 64]` is set if `base + i` is prime, and clear
+  * otherwise.  Only values in `[lo, hi)` are counted, but `words` covers
+  * `[base, hi)` rounded up to a whole word, plus one more word, so that
+  * values up to 64 beyond `hi` may be inspected.
+  */
+struct segment {
+    std::uint64_t const* words; ///< sieve bits, least significant first
+    std::uint64_t        base;  ///< value of bit 0; a multiple of 64
+    std::uint64_t        lo;    ///< first valid value; `base <= lo`
+    std::uint64_t        hi;    ///< one past the last valid value
+};
+
+/** Returns the number of set bits in `x`. */
+inline unsigned popcount(std::uint64_t x)
+{
+    return __builtin_popcountll(x);
+}
+
+// }}}
+// constellation {{{
+
+/** Returns a word whose bit `j` is bit `j + D` of the bit string beginning
+  * at `words[i]`; i.e., the sieve bits of values `D` greater than those of
+  * word `i`.  The behavior is undefined unless `0 < D <= 64`.
+  */
+template<unsigned D>
+std::uint64_t shifted(std::uint64_t const* words, std::size_t i)
+{
+    if (D == 64)
+        return words[i + 1];
+    return words[i] >> D % 64 | words[i + 1] << (64 - D) % 64;
+}
+
+/** A prime constellation `(p, p + D...)`, such as `constellation<2>` for
+  * twin primes or `constellation<2, 6, 8>` for prime quadruplets.  The empty
+  * constellation matches every prime.  Offsets must lie in `[1, 64]`.
+  */
+template<unsigned... D>
+struct constellation;
+
+template<>
+struct constellation<> {
+
+    /** Returns the bits of word `i` whose values begin a match. */
+    static std::uint64_t match(std::uint64_t const* words, std::size_t i)
+    {
+        return words[i];
+    }
+};
+
+template<unsigned D, unsigned... E>
+struct constellation<D, E...> {
+
+    static_assert(0 < D && D <= 64, "constellation offset out of range");
+
+    static std::uint64_t match(std::uint64_t const* words, std::size_t i)
+    {
+        return shifted<D>(words, i) & constellation<E...>::match(words, i);
+    }
+};
+
+template<typename... P, std::size_t... I>
+void tally_word(
+        std::uint64_t const*        words,
+        std::size_t                 i,
+        std::uint64_t               mask,
+        std::uint64_t*              result,
+        std::index_sequence<I...>)
+{
+    int expand[] = {
+        0, (result[I] += popcount(P::match(words, i) & mask), 0)...
+    };
+    (void)expand;
+}
+
+/** Calls `f(i, mask)` for each index `i` of a word of `s.words` holding
+  * values in `[a, b)`, in ascending order, where `mask` selects the bits of
+  * that word holding such values.  The behavior is undefined unless
+  * `[a, b)` lies within `[s.lo, s.hi)`.
+  */
+template<typename F>
+void for_each_word(segment const& s, std::uint64_t a, std::uint64_t b, F f)
+{
+    assert(s.lo <= a && a <= b && b <= s.hi);
+    if (a == b)
+        return;
+    auto i    = (a - s.base) / 64, j = (b - s.base) / 64;
+    auto head = ~std::uint64_t(0) << (a - s.base) % 64;
+    auto tail = (std::uint64_t(1) << (b - s.base) % 64) - 1;
+    if (i == j)
+        return f(i, head & tail);
+    f(i, head);
+    while (++i < j)
+        f(i, ~std::uint64_t(0));
+    if (tail)
+        f(j, tail);
+}
+
+/** Adds to each `result[k]` the number of values in `[a, b)` beginning a
+  * match of the `k`th constellation in `P`.  Every constellation is matched
+  * against each word while it is loaded, so counting several costs little
+  * more than counting one.  The behavior is undefined unless `[a, b)` lies
+  * within `[s.lo, s.hi)`.
+  */
+template<typename... P>
+void tally(
+        segment const&  s,
+        std::uint64_t   a,
+        std::uint64_t   b,
+        std::uint64_t*  result)
+{
+    for_each_word(s, a, b, [&](std::size_t i, std::uint64_t mask) {
+        tally_word<P...>(
+                s.words, i, mask, result, std::index_sequence_for<P...>());
+    });
+}
+
+/** Returns the number of primes in `[a, b)`, which must lie within
+  * `[s.lo, s.hi)`.
+  */
+inline std::uint64_t count(segment const& s, std::uint64_t a, std::uint64_t b)
+{
+    std::uint64_t n = 0;
+    tally<constellation<>>(s, a, b, &n);
+    return n;
+}
+
+// }}}
+// kernels {{{
+
+/** Counts constellation matches in any range of values, masking the words
+  * at either end.  This is the fallback for bucket weights with no more
+  * specific kernel.
+  */
+struct masked_kernel {
+    template<typename... P>
+    static void tally(
+            segment const&  s,
+            std::uint64_t   a,
+            std::uint64_t   b,
+            std::uint64_t*  result)
+    {
+        primedist::tally<P...>(s, a, b, result);
+    }
+};
+
+/** Counts constellation matches in ranges that begin and end on word
+  * boundaries, with no edge masks.  Whole buckets of `W` words, if `W` is
+  * nonzero, are counted by a loop of fixed length that the compiler unrolls.
+  */
+template<std::size_t W>
+struct block_kernel {
+    template<typename... P>
+    static void tally(
+            segment const&  s,
+            std::uint64_t   a,
+            std::uint64_t   b,
+            std::uint64_t*  result)
+    {
+        assert(a % 64 == 0 && b % 64 == 0);
+        auto seq = std::index_sequence_for<P...>();
+        auto i   = (a - s.base) / 64, n = (b - a) / 64;
+        auto all = ~std::uint64_t(0);
+        if (W && n == W) {
+            for (std::size_t j = 0; j < W; ++j)
+                tally_word<P...>(s.words, i + j, all, result, seq);
+        } else {
+            for (std::size_t j = 0; j < n; ++j)
+                tally_word<P...>(s.words, i + j, all, result, seq);
+        }
+    }
+};
+
+/** Counts constellation matches in ranges of exactly `B` values that lie
+  * within a single word at a multiple of `B`, using a constant mask.  The
+  * behavior is undefined unless `B` is a power of two less than 64.
+  */
+template<unsigned B>
+struct field_kernel {
+    template<typename... P>
+    static void tally(
+            segment const&  s,
+            std::uint64_t   a,
+            std::uint64_t   b,
+            std::uint64_t*  result)
+    {
+        static_assert(B < 64 && (B & (B - 1)) == 0, "bad field width");
+        assert(b - a == B && a % B == 0);
+        auto mask = (std::uint64_t(1) << B) - 1;
+        auto off  = a - s.base;
+        tally_word<P...>(
+                s.words, off / 64, mask << off % 64, result,
+                std::index_sequence_for<P...>());
+    }
+};
+
+// }}}
+// residues {{{
+
+/** Precomputed masks selecting residue classes modulo `k`.  For `k <= 64`,
+  * the masks of a word depend only on the word's position modulo
+  * `k / gcd(k, 64)` words, and are stored for each such phase; larger moduli
+  * have too many classes per word for masks to pay, and are not stored.
+  */
+class residues {
+    unsigned                   m_modulus;
+    std::uint64_t              m_phases;    // distinct mask sets, or zero
+    std::vector<std::uint64_t> m_masks;     // `m_modulus` per phase
+  public:
+
+    /** The behavior is undefined unless `k` is positive. */
+    explicit residues(unsigned k);
+
+    unsigned modulus() const { return m_modulus; }
+
+    /** Returns `modulus()` masks, the `r`th of which selects values
+      * congruent to `r` in the word beginning at value `base`, or a null
+      * pointer if `modulus() > 64`.
+      */
+    std::uint64_t const* masks(std::uint64_t base) const
+    {
+        return m_phases ? &m_masks[base / 64 % m_phases * m_modulus] : nullptr;
+    }
+};
+
+/** Adds to each `result[r]` the number of primes in `[a, b)` congruent to
+  * `r` modulo `classes.modulus()`, using one masked popcount per class and
+  * word.  The behavior is undefined unless `[a, b)` lies within
+  * `[s.lo, s.hi)`.
+  */
+void tally_residues(
+        segment const&  s,
+        std::uint64_t   a,
+        std::uint64_t   b,
+        residues const& classes,
+        std::uint64_t*  result);
+
+/** A matrix of counts of primes in each residue class, to be filled by
+  * `engine::fill_patterns` alongside its other counts.  `result` is laid
+  * out as by `engine::fill_residues`.
+  */
+struct residue_matrix {
+    residues const*   classes;
+    span<std::size_t> result;
+};
+
+// }}}
+// gaps {{{
+
+/** Summary of the gaps between consecutive primes ending in one bucket. */
+struct gap_stats {
+    std::uint64_t count;    ///< number of gaps
+    std::uint64_t sum;      ///< total length of all gaps
+    std::uint64_t max;      ///< length of the longest gap, or zero
+
+    /** Returns the mean gap length, or zero if there are no gaps. */
+    double mean() const { return count ? double(sum) / count : 0; }
+};
+
+/** Collects prime gap statistics per bucket, alongside the counts filled by
+  * `engine::fill_buckets` or `engine::fill_patterns`.  A gap is the
+  * difference `q - p` between consecutive primes `p < q` within the swept
+  * range, and is attributed to the bucket containing `q`.  Each bucket also
+  * has a row of gap length counts in `histogram`, whose bin `j` counts gaps
+  * of length `2 * j` or `2 * j + 1`; the last bin also counts all longer
+  * gaps.  Primes are found by scanning sieve words for set bits, and gaps
+  * spanning segment or worker boundaries are joined up when the sweep
+  * finishes.
+  */
+class gap_collector {
+
+    struct edge {
+        std::uint64_t first;    // least prime seen by a worker, or zero
+        std::uint64_t last;     // greatest prime seen by a worker, or zero
+    };
+
+    span<gap_stats>     m_stats;
+    span<std::size_t>   m_histogram;
+    std::size_t         m_bins;
+    std::vector<edge>   m_edges;    // one per worker
+
+    void record(std::size_t bucket, std::uint64_t gap);
+
+  public:
+
+    /** The behavior is undefined unless `histogram.size()` is a multiple of
+      * `stats.size()`.  `histogram` may be empty.
+      */
+    gap_collector(span<gap_stats> stats, span<std::size_t> histogram);
+
+    /** Returns the number of gap length bins per bucket. */
+    std::size_t bins() const { return m_bins; }
+
+    /** Clears all statistics for a sweep by at most `workers` threads. */
+    void start(unsigned workers);
+
+    /** Records the gaps ending in `[a, b)` of `s` as belonging to `bucket`,
+      * and returns the number of primes in `[a, b)`.  Worker `t` must scan
+      * its values in ascending order.
+      */
+    std::uint64_t scan(
+            unsigned        t,
+            segment const&  s,
+            std::uint64_t   a,
+            std::uint64_t   b,
+            std::size_t     bucket);
+
+    /** Records the gaps between workers, whose buckets are `weight` values
+      * wide and begin at `lo`.  Call this after all workers have finished.
+      */
+    void finish(std::uint64_t lo, std::uint64_t weight);
+};
+
+// }}}
+// options {{{
+
+/** Tuning parameters of an `engine`.  None affects results, only speed. */
+struct options {
+    std::size_t segment_words;  ///< 64-bit words sieved per segment
+    unsigned    presieve;       ///< largest prime removed by pattern copy
+    unsigned    threads;        ///< maximum worker threads per call
+};
+
+/** Returns options suitable for a single-threaded caller on typical hosts. */
+options default_options();
+
+// }}}
+// sieve_cursor {{{
+
+/** Remembers where a call to `engine::sieve` left off among the multiples of
+  * each base prime, so that the next call, if it sieves the values that
+  * immediately follow, needs no division to find them.  A cursor may be
+  * used with only one engine, and by only one thread at a time.
+  */
+class sieve_cursor {
+
+    friend class engine;
+
+    std::uint64_t               m_end = 0;  // one past the last value sieved
+    std::vector<std::uint64_t>  m_next;     // next multiple of each base prime
+    std::vector<std::uint8_t>   m_turn;     // its position in the wheel
+};
+
+// }}}
+// engine {{{
+
+/** Counts primes over ranges of integers using a segmented sieve. */
+class engine {
+
+    options                                 m_opts;
+    std::uint64_t                           m_limit;    // `m_primes` bound
+    std::vector<std::uint32_t>              m_primes;   // > presieve, < limit
+    std::vector<std::uint64_t>              m_pattern;  // pre-sieved words
+    std::vector<std::vector<std::uint64_t>> m_scratch;  // one per worker
+    std::vector<sieve_cursor>               m_cursors;  // one per worker
+    std::vector<std::uint64_t>              m_counts;   // per-worker tallies
+
+    /** Makes base primes and scratch space ready to `sweep` values below
+      * `hi`.
+      */
+    void prepare(std::uint64_t hi);
+
+    template<typename F>
+    void run(unsigned t, std::uint64_t lo, std::uint64_t hi, F& visit);
+
+    /** Implements `fill_patterns` using kernel `K` to count each bucket,
+      * `gaps`, if not null, to collect gaps, and `tally_residues` to fill
+      * `matrices`.
+      */
+    template<typename K, typename... P>
+    void fill_with(
+            span<std::size_t>           result,
+            std::uint64_t               lo,
+            std::uint64_t               weight,
+            gap_collector*              gaps,
+            span<residue_matrix const>  matrices);
+
+  public:
+
+    engine();
+
+    /** The behavior is undefined unless `opts.segment_words` and
+      * `opts.threads` are positive.  Values of `opts.presieve` above 13 are
+      * treated as 13.
+      */
+    explicit engine(options const& opts);
+
+    // ACCESSORS
+
+    options const& opts() const { return m_opts; }
+
+    /** Returns a bound below which values may be sieved without another
+      * call to `reserve`.
+      */
+    std::uint64_t reserved() const
+    {
+        return m_limit >> 32 ? ~std::uint64_t(0) : m_limit * m_limit;
+    }
+
+    /** Sieves `n` words of values beginning at `base` into `words`, setting
+      * bit `i % 64` of `words[i / 64]` if `base + i` is prime.  This function
+      * may be called concurrently from any number of threads.  The behavior
+      * is undefined unless `base` is a multiple of 64, and `reserve` has been
+      * called with a value of at least `base + n * 64`.
+      */
+    void sieve(std::uint64_t* words, std::uint64_t base, std::size_t n) const;
+
+    /** Sieves as above, resuming from `*cursor` if its previous use sieved
+      * the values just below `base`, and leaving it ready to resume at
+      * `base + n * 64`.
+      */
+    void sieve(
+            std::uint64_t*  words,
+            std::uint64_t   base,
+            std::size_t     n,
+            sieve_cursor*   cursor) const;
+
+    // MANIPULATORS
+
+    /** Computes the base primes needed to `sieve` values below `hi`. */
+    void reserve(std::uint64_t hi);
+
+    /** Returns the number of primes in `[lo, hi)`. */
+    std::uint64_t count(std::uint64_t lo, std::uint64_t hi);
+
+    /** Sets each element of `result` to the number of primes in a range of
+      * integers.  The count at index `i` corresponds to the range beginning
+      * at `lo + i * weight` and containing `weight` distinct values.  The
+      * behavior is undefined unless `weight` is positive.
+      */
+    void fill_buckets(
+            span<std::size_t> result,
+            std::uint64_t     lo,
+            std::uint64_t     weight);
+
+    /** Fills `result` as if by `fill_buckets(result, lo, weight)`, and
+      * `gaps` with the statistics of gaps between primes in each bucket, in
+      * a single pass.  The behavior is undefined unless `weight` is positive
+      * and `gaps` was constructed with `result.size()` buckets.
+      */
+    void fill_buckets(
+            span<std::size_t> result,
+            std::uint64_t     lo,
+            std::uint64_t     weight,
+            gap_collector*    gaps);
+
+    /** Fills one series of buckets per constellation in `P`, in a single
+      * pass.  `result` is divided into `sizeof...(P)` equal series, the
+      * `k`th of which is filled as if by `fill_buckets`, but counting values
+      * beginning a match of the `k`th constellation.  The behavior is
+      * undefined unless `weight` is positive and `result.size()` is a
+      * multiple of `sizeof...(P)`.
+      */
+    template<typename... P>
+    void fill_patterns(
+            span<std::size_t> result,
+            std::uint64_t     lo,
+            std::uint64_t     weight);
+
+    /** Fills `result` as if by `fill_patterns<P...>(result, lo, weight)`,
+      * and `gaps` with the statistics of gaps between primes in each bucket,
+      * in the same pass.  The behavior is undefined unless `gaps` was
+      * constructed with `result.size() / sizeof...(P)` buckets.
+      */
+    template<typename... P>
+    void fill_patterns(
+            span<std::size_t> result,
+            std::uint64_t     lo,
+            std::uint64_t     weight,
+            gap_collector*    gaps);
+
+    /** Fills `result`, and `gaps` if not null, as if by
+      * `fill_patterns<P...>(result, lo, weight, gaps)`, and each of
+      * `matrices` as if by `fill_residues`, all in the same pass.  The
+      * behavior is undefined unless the `result` of each matrix has
+      * `result.size() / sizeof...(P)` columns.
+      */
+    template<typename... P>
+    void fill_patterns(
+            span<std::size_t>           result,
+            std::uint64_t               lo,
+            std::uint64_t               weight,
+            gap_collector*              gaps,
+            span<residue_matrix const>  matrices);
+
+    /** Fills a `classes.modulus()` by `w` matrix of bucket counts, where `w`
+      * is `result.size() / classes.modulus()`.  Row `r` of the matrix, at
+      * `result[r * w]`, is filled as if by `fill_buckets`, but counting only
+      * primes congruent to `r` modulo `classes.modulus()`; the rows sum to
+      * the total count.  All rows are filled in a single pass.  The behavior
+      * is undefined unless `weight` is positive and `result.size()` is a
+      * multiple of `classes.modulus()`.
+      */
+    void fill_residues(
+            span<std::size_t> result,
+            std::uint64_t     lo,
+            std::uint64_t     weight,
+            residues const&   classes);
+
+    /** Sieves `[lo, hi)` and calls `visit(t, s)` for each resulting segment
+      * `s`, where `t` identifies the worker thread.  Each worker receives its
+      * segments in ascending order, and every value seen by worker `t` is
+      * less than every value seen by worker `t + 1`.  Workers are split only
+      * at values `lo + k * grain`, so no range of `grain` values aligned to
+      * `lo` is ever seen by two workers.  `visit` is called concurrently
+      * from different workers, and must not throw.
+      */
+    template<typename F>
+    void sweep(
+            std::uint64_t lo,
+            std::uint64_t hi,
+            std::uint64_t grain,
+            F             visit);
+};
+
+template<typename F>
+void engine::run(unsigned t, std::uint64_t lo, std::uint64_t hi, F& visit)
+{
+    // Each segment's extra word begins the next segment, so it is carried
+    // over rather than sieved twice, and the cursor always resumes.
+
+    auto  words  = m_scratch[t].data();
+    auto  cursor = &m_cursors[t];
+    auto  step   = m_opts.segment_words * 64;
+    auto  base   = lo / 64 * 64;
+    sieve(words, base, 1, cursor);
+    for (; base < hi; base += step) {
+        auto n = std::min<std::uint64_t>(
+                m_opts.segment_words,
+                (hi - base + 63) / 64);
+        sieve(words + 1, base + 64, n, cursor);
+        visit(t, segment{
+                words,
+                base,
+                std::max(lo, base),
+                std::min(hi, base + n * 64)});
+        words[0] = words[n];
+    }
+}
+
+template<typename F>
+void engine::sweep(
+        std::uint64_t lo,
+        std::uint64_t hi,
+        std::uint64_t grain,
+        F             visit)
+{
+    assert(grain > 0);
+    if (lo >= hi)
+        return;
+    prepare(hi);
+
+    // Split `[lo, hi)` into at most one run of whole grains per worker, but
+    // don't bother waking workers for less than a segment apiece.
+
+    std::uint64_t grains = (hi - lo - 1) / grain + 1;
+    std::uint64_t n = std::min<std::uint64_t>({
+            m_opts.threads,
+            grains,
+            (hi - lo - 1) / (m_opts.segment_words * 64) + 1});
+    if (n == 1)
+        return run(0, lo, hi, visit);
+
+    auto edge = [&](std::uint64_t t) {
+        auto g = t * (grains / n) + std::min(t, grains % n);
+        return g == grains ? hi : lo + g * grain;
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < n; ++t) {
+        workers.emplace_back([this, t, &edge, &visit] {
+            run(t, edge(t), edge(t + 1), visit);
+        });
+    }
+    run(0, lo, edge(1), visit);
+    for (auto& w : workers)
+        w.join();
+}
+
+template<typename K, typename... P>
+void engine::fill_with(
+        span<std::size_t>           result,
+        std::uint64_t               lo,
+        std::uint64_t               weight,
+        gap_collector*              gaps,
+        span<residue_matrix const>  matrices)
+{
+    std::size_t const k = sizeof...(P);
+    std::fill(result.begin(), result.end(), 0);
+    if (gaps)
+        gaps->start(m_opts.threads);
+    auto w = result.size() / k;
+
+    // Each worker tallies residues one bucket at a time into its own row of
+    // `m_counts`, which holds the classes of every matrix side by side.
+
+    std::size_t classes = 0;
+    for (auto const& m : matrices) {
+        assert(m.result.size() == m.classes->modulus() * w);
+        std::fill(m.result.begin(), m.result.end(), 0);
+        classes += m.classes->modulus();
+    }
+    m_counts.resize(std::size_t(m_opts.threads) * classes);
+    sweep(lo, lo + weight * w, weight, [&](unsigned t, segment const& s) {
+        auto i = (s.lo - lo) / weight;
+        for (auto a = s.lo; a < s.hi; ++i) {
+            auto b = std::min(s.hi, lo + (i + 1) * weight);
+            std::uint64_t n[k] = {};
+            K::template tally<P...>(s, a, b, n);
+            for (std::size_t j = 0; j < k; ++j)
+                result[j * w + i] += n[j];
+            if (gaps)
+                gaps->scan(t, s, a, b, i);
+            auto c = m_counts.data() + t * classes;
+            for (auto const& m : matrices) {
+                auto q = m.classes->modulus();
+                std::fill(c, c + q, 0);
+                tally_residues(s, a, b, *m.classes, c);
+                for (unsigned r = 0; r < q; ++r)
+                    m.result[r * w + i] += c[r];
+                c += q;
+            }
+            a = b;
+        }
+    });
+    if (gaps)
+        gaps->finish(lo, weight);
+}
+
+template<typename... P>
+void engine::fill_patterns(
+        span<std::size_t> result,
+        std::uint64_t     lo,
+        std::uint64_t     weight)
+{
+    fill_patterns<P...>(result, lo, weight, nullptr);
+}
+
+template<typename... P>
+void engine::fill_patterns(
+        span<std::size_t> result,
+        std::uint64_t     lo,
+        std::uint64_t     weight,
+        gap_collector*    gaps)
+{
+    fill_patterns<P...>(result, lo, weight, gaps, {});
+}
+
+template<typename... P>
+void engine::fill_patterns(
+        span<std::size_t>           result,
+        std::uint64_t               lo,
+        std::uint64_t               weight,
+        gap_collector*              gaps,
+        span<residue_matrix const>  matrices)
+{
+    static_assert(sizeof...(P) > 0, "at least one constellation is required");
+    assert(weight > 0);
+    assert(result.size() % sizeof...(P) == 0);
+
+    // Buckets aligned to words need no edge masks.  Workers and segments
+    // split only at bucket or word boundaries, so every range passed to a
+    // kernel is then either whole words, or (for weights dividing 64) one
+    // whole bucket within a word.
+
+    if (lo % 64 == 0) {
+        switch (weight) {
+          case 1:
+            return fill_with<field_kernel<1>, P...>(
+                    result, lo, 1, gaps, matrices);
+          case 2:
+            return fill_with<field_kernel<2>, P...>(
+                    result, lo, 2, gaps, matrices);
+          case 4:
+            return fill_with<field_kernel<4>, P...>(
+                    result, lo, 4, gaps, matrices);
+          case 8:
+            return fill_with<field_kernel<8>, P...>(
+                    result, lo, 8, gaps, matrices);
+          case 16:
+            return fill_with<field_kernel<16>, P...>(
+                    result, lo, 16, gaps, matrices);
+          case 32:
+            return fill_with<field_kernel<32>, P...>(
+                    result, lo, 32, gaps, matrices);
+          case 64:
+            return fill_with<block_kernel<1>, P...>(
+                    result, lo, 64, gaps, matrices);
+          case 128:
+            return fill_with<block_kernel<2>, P...>(
+                    result, lo, 128, gaps, matrices);
+          case 256:
+            return fill_with<block_kernel<4>, P...>(
+                    result, lo, 256, gaps, matrices);
+          case 512:
+            return fill_with<block_kernel<8>, P...>(
+                    result, lo, 512, gaps, matrices);
+          case 1024:
+            return fill_with<block_kernel<16>, P...>(
+                    result, lo, 1024, gaps, matrices);
+          case 2048:
+            return fill_with<block_kernel<32>, P...>(
+                    result, lo, 2048, gaps, matrices);
+          case 4096:
+            return fill_with<block_kernel<64>, P...>(
+                    result, lo, 4096, gaps, matrices);
+        }
+        if (weight % 64 == 0)
+            return fill_with<block_kernel<0>, P...>(
+                    result, lo, weight, gaps, matrices);
+    }
+    fill_with<masked_kernel, P...>(result, lo, weight, gaps, matrices);
+}
+
+// }}}
+
+}
+
+#endif
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// vim:foldmethod=marker
@@ -0,0 +1,58 @@
+/** @file primedist_c.cpp Implements the C interface to `primedist::engine`. */
+
+#include "primedist_c.hpp"
+
+#include "primedist.hpp"
+
+struct primedist_engine {
+    primedist::engine impl;
+};
+
+primedist_engine* primedist_create(unsigned threads) try
+{
+    auto opts = primedist::default_options();
+    if (threads)
+        opts.threads = threads;
+    return new primedist_engine{primedist::engine(opts)};
+} catch (...) {
+    return nullptr;
+}
+
+void primedist_destroy(primedist_engine* engine)
+{
+    delete engine;
+}
+
+int primedist_count(
+        primedist_engine*   engine,
+        uint64_t*           result,
+        uint64_t            lo,
+        uint64_t            hi) try
+{
+    if (!engine || !result)
+        return -1;
+    *result = engine->impl.count(lo, hi);
+    return 0;
+} catch (...) {
+    return -2;
+}
+
+int primedist_fill_buckets(
+        primedist_engine*   engine,
+        size_t*             result,
+        size_t              n,
+        uint64_t            lo,
+        uint64_t            weight) try
+{
+    if (!engine || (n && !result) || !weight)
+        return -1;
+    engine->impl.fill_buckets({result, n}, lo, weight);
+    return 0;
+} catch (...) {
+    return -2;
+}
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
@@ -0,0 +1,56 @@
+/** @file primedist_c.hpp A C interface to the prime distribution engine.
+ *
+ * This header may be included from C or C++.  Each `primedist_engine` wraps a
+ * `primedist::engine` (see `primedist.hpp`), and so reuses its scratch memory
+ * across calls; create one per thread and keep it for the life of the thread.
+ * Functions returning `int` return zero on success, and nonzero on failure.
+ */
+
+#ifndef INCLUDED_UNBUGGY_PRIMEDIST_C
+#define INCLUDED_UNBUGGY_PRIMEDIST_C
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct primedist_engine primedist_engine;
+
+/** Returns a new engine using at most `threads` worker threads, or a null
+  * pointer on failure.  Passing zero selects the default.
+  */
+primedist_engine* primedist_create(unsigned threads);
+
+/** Releases `engine`, which may be null. */
+void primedist_destroy(primedist_engine* engine);
+
+/** Stores in `*result` the number of primes in `[lo, hi)`. */
+int primedist_count(
+        primedist_engine*   engine,
+        uint64_t*           result,
+        uint64_t            lo,
+        uint64_t            hi);
+
+/** Stores in each of the `n` elements of `result` the number of primes in
+  * consecutive ranges of `weight` integers, beginning at `lo`.  Fails if
+  * `weight` is zero.
+  */
+int primedist_fill_buckets(
+        primedist_engine*   engine,
+        size_t*             result,
+        size_t              n,
+        uint64_t            lo,
+        uint64_t            weight);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+//         Copyright Unbuggy Software, LLC 2014.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
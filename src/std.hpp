@@ -76,6 +76,14 @@
 #include <valarray>
 #include <vector>
 
+// Later standards, when enabled:
+
+#if __cplusplus > 201703L && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#endif
+#endif
+
 // }}}
 
 #endif
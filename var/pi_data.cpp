@@ -0,0 +1,6308 @@
+// Generated by etc/mkpi.cpp; do not edit.
+
+#include "pi_data.hpp"
+
+std::uint8_t const primedist::pi_data::counts[] = {
+    168, 135, 127, 120, 119, 114, 117, 107, 110, 112, 106, 103, 109, 105, 102, 108,
+    98, 104, 94, 104, 98, 104, 100, 104, 94, 98, 101, 94, 98, 92, 95, 92,
+    106, 100, 94, 92, 99, 94, 90, 96, 88, 101, 102, 85, 96, 86, 90, 95,
+    89, 98, 89, 97, 89, 92, 90, 93, 99, 91, 90, 94, 88, 87, 88, 93,
+    80, 98, 84, 99, 80, 81, 98, 95, 90, 83, 92, 91, 83, 95, 84, 91,
+    88, 92, 89, 84, 87, 85, 88, 93, 76, 94, 89, 85, 97, 86, 87, 95,
+    84, 82, 87, 87, 81, 93, 87, 80, 91, 82, 92, 76, 91, 88, 83, 84,
+    81, 88, 82, 93, 81, 90, 79, 87, 88, 86, 88, 88, 83, 84, 83, 86,
+    89, 83, 85, 83, 87, 82, 80, 89, 96, 80, 85, 84, 87, 87, 82, 77,
+    79, 85, 84, 83, 83, 91, 85, 90, 88, 77, 84, 85, 76, 88, 77, 85,
+    85, 84, 81, 83, 77, 80, 81, 83, 73, 87, 87, 81, 89, 79, 83, 75,
+    95, 73, 89, 94, 71, 79, 91, 79, 83, 91, 79, 87, 80, 88, 75, 81,
+    89, 84, 74, 85, 76, 87, 86, 77, 77, 87, 78, 78, 77, 83, 83, 87,
+    85, 88, 84, 86, 69, 81, 86, 74, 76, 80, 84, 91, 78, 80, 81, 80,
+    83, 84, 76, 80, 89, 88, 84, 78, 76, 71, 87, 73, 76, 73, 87, 79,
+    80, 91, 76, 77, 88, 80, 84, 79, 88, 80, 71, 88, 78, 81, 76, 87,
+    72, 78, 86, 76, 77, 73, 79, 84, 80, 78, 87, 94, 75, 78, 84, 78,
+    83, 71, 80, 83, 83, 74, 81, 73, 87, 85, 77, 72, 90, 77, 71, 71,
+    77, 85, 84, 77, 78, 68, 85, 75, 82, 73, 73, 78, 85, 83, 72, 84,
+    88, 80, 82, 73, 76, 80, 79, 69, 86, 86, 76, 77, 84, 84, 81, 86,
+    79, 80, 81, 71, 87, 85, 73, 86, 73, 81, 80, 82, 72, 81, 77, 77,
+    84, 80, 77, 68, 84, 77, 77, 80, 80, 76, 80, 82, 77, 82, 74, 81,
+    82, 76, 87, 79, 67, 80, 83, 71, 68, 79, 76, 84, 77, 77, 85, 79,
+    72, 68, 70, 76, 81, 73, 82, 85, 80, 71, 77, 83, 72, 76, 74, 81,
+    78, 80, 78, 69, 75, 84, 81, 79, 86, 87, 75, 72, 75, 75, 82, 81,
+    70, 71, 76, 75, 70, 83, 67, 81, 79, 82, 73, 81, 74, 69, 90, 80,
+    67, 82, 85, 75, 75, 73, 77, 83, 81, 74, 71, 78, 71, 89, 76, 79,
+    84, 80, 85, 82, 73, 70, 75, 75, 79, 72, 85, 88, 82, 68, 68, 73,
+    70, 80, 92, 76, 63, 72, 74, 82, 73, 77, 75, 68, 77, 69, 74, 77,
+    85, 74, 69, 83, 85, 72, 87, 78, 73, 78, 80, 86, 75, 69, 85, 71,
+    77, 78, 82, 75, 65, 63, 82, 78, 83, 78, 78, 76, 67, 82, 80, 87,
+    68, 81, 72, 81, 79, 74, 67, 76, 76, 83, 76, 71, 76, 75, 72, 82,
+    70, 77, 81, 66, 85, 83, 76, 78, 73, 83, 79, 69, 77, 79, 84, 72,
+    70, 78, 80, 68, 79, 74, 72, 71, 87, 67, 78, 71, 73, 77, 78, 81,
+    68, 69, 73, 76, 77, 78, 79, 75, 71, 80, 77, 61, 88, 68, 74, 77,
+    86, 61, 83, 67, 77, 78, 72, 72, 71, 80, 85, 72, 85, 72, 70, 77,
+    78, 77, 76, 77, 73, 79, 73, 78, 72, 81, 79, 87, 73, 68, 71, 67,
+    80, 77, 78, 77, 79, 73, 72, 73, 76, 73, 83, 76, 73, 74, 72, 78,
+    78, 80, 73, 71, 76, 79, 71, 75, 85, 81, 67, 73, 77, 70, 74, 75,
+    78, 69, 70, 70, 71, 75, 67, 81, 77, 70, 82, 78, 73, 74, 59, 72,
+    77, 71, 68, 70, 86, 75, 74, 79, 73, 84, 61, 74, 85, 69, 78, 73,
+    71, 70, 79, 73, 83, 70, 74, 77, 77, 77, 73, 74, 66, 74, 75, 76,
+    76, 77, 73, 75, 74, 63, 82, 83, 75, 78, 66, 78, 72, 74, 74, 82,
+    74, 79, 60, 79, 77, 73, 76, 77, 73, 79, 62, 72, 75, 71, 81, 71,
+    87, 68, 82, 74, 77, 77, 78, 76, 72, 73, 66, 83, 69, 65, 67, 74,
+    78, 77, 73, 86, 75, 69, 76, 75, 76, 75, 69, 76, 71, 75, 74, 79,
+    69, 78, 70, 81, 67, 74, 73, 67, 64, 67, 76, 71, 76, 72, 68, 85,
+    73, 71, 83, 70, 66, 68, 79, 77, 77, 80, 68, 79, 72, 82, 78, 68,
+    77, 74, 77, 75, 70, 76, 72, 67, 70, 76, 81, 71, 70, 82, 68, 75,
+    75, 77, 70, 73, 80, 68, 78, 71, 82, 71, 73, 79, 77, 72, 71, 71,
+    85, 66, 70, 69, 78, 79, 68, 70, 69, 78, 78, 72, 69, 72, 78, 69,
+    75, 75, 62, 83, 75, 72, 84, 78, 71, 81, 78, 69, 69, 68, 76, 79,
+    82, 68, 67, 73, 71, 64, 80, 69, 70, 69, 83, 68, 78, 70, 69, 77,
+    75, 68, 70, 77, 74, 66, 71, 73, 78, 76, 69, 71, 77, 74, 83, 60,
+    80, 80, 68, 78, 80, 73, 79, 58, 76, 65, 75, 80, 75, 67, 78, 75,
+    80, 69, 72, 73, 69, 77, 76, 71, 77, 68, 68, 80, 69, 72, 74, 80,
+    64, 75, 76, 61, 74, 73, 70, 63, 81, 70, 80, 80, 79, 82, 62, 81,
+    71, 54, 73, 70, 72, 79, 75, 71, 72, 72, 72, 81, 76, 80, 74, 63,
+    70, 80, 69, 69, 76, 68, 81, 68, 71, 71, 72, 68, 74, 79, 72, 76,
+    73, 66, 72, 66, 67, 75, 76, 70, 78, 65, 73, 76, 58, 69, 77, 69,
+    68, 88, 71, 74, 74, 70, 73, 66, 75, 73, 76, 78, 74, 63, 85, 70,
+    66, 60, 80, 65, 67, 75, 70, 70, 70, 76, 76, 63, 71, 72, 71, 79,
+    65, 68, 78, 69, 69, 83, 74, 65, 75, 77, 81, 72, 63, 73, 82, 76,
+    79, 75, 66, 70, 83, 67, 71, 74, 72, 72, 70, 74, 79, 74, 72, 70,
+    70, 78, 73, 67, 74, 75, 71, 62, 72, 75, 78, 66, 78, 65, 70, 64,
+    77, 74, 70, 73, 77, 72, 65, 78, 66, 79, 62, 73, 67, 67, 73, 70,
+    73, 66, 76, 71, 70, 72, 59, 84, 69, 71, 69, 73, 73, 76, 74, 75,
+    64, 69, 75, 78, 75, 65, 66, 81, 82, 71, 68, 73, 71, 66, 75, 70,
+    74, 56, 74, 79, 76, 81, 79, 72, 68, 72, 60, 77, 73, 71, 78, 68,
+    77, 76, 75, 67, 83, 68, 76, 74, 81, 68, 72, 74, 62, 79, 72, 58,
+    82, 65, 64, 75, 67, 73, 67, 76, 79, 70, 70, 79, 71, 74, 71, 75,
+    73, 69, 66, 70, 67, 73, 70, 65, 76, 67, 70, 75, 65, 72, 77, 75,
+    65, 72, 70, 75, 74, 77, 75, 68, 70, 80, 81, 82, 68, 73, 70, 73,
+    69, 68, 76, 70, 71, 63, 76, 73, 69, 73, 82, 73, 83, 69, 70, 76,
+    75, 74, 62, 80, 72, 74, 68, 74, 73, 76, 71, 65, 68, 72, 72, 74,
+    64, 68, 74, 72, 61, 66, 70, 65, 64, 72, 76, 75, 75, 76, 76, 67,
+    72, 80, 66, 81, 60, 67, 70, 69, 69, 77, 75, 61, 75, 70, 65, 85,
+    61, 63, 64, 72, 60, 77, 73, 74, 68, 73, 67, 71, 77, 63, 80, 72,
+    76, 77, 70, 64, 69, 62, 79, 78, 67, 72, 82, 70, 74, 65, 72, 75,
+    66, 80, 79, 68, 69, 70, 75, 77, 72, 73, 60, 67, 73, 66, 68, 79,
+    64, 73, 79, 66, 67, 77, 73, 77, 78, 68, 64, 66, 73, 69, 63, 73,
+    70, 78, 60, 73, 71, 74, 66, 82, 66, 64, 77, 65, 70, 74, 74, 74,
+    71, 64, 64, 75, 69, 74, 76, 62, 65, 80, 84, 71, 69, 65, 79, 59,
+    75, 66, 65, 76, 73, 71, 62, 66, 80, 70, 69, 74, 75, 69, 78, 73,
+    66, 69, 67, 67, 71, 57, 75, 77, 69, 66, 71, 79, 75, 56, 81, 65,
+    74, 70, 69, 74, 68, 68, 75, 68, 74, 69, 73, 68, 68, 66, 71, 75,
+    71, 76, 81, 74, 70, 77, 60, 63, 68, 81, 71, 65, 68, 72, 75, 67,
+    62, 80, 68, 72, 81, 74, 79, 83, 65, 66, 64, 76, 63, 66, 65, 76,
+    70, 68, 75, 68, 81, 67, 57, 62, 68, 70, 62, 72, 72, 68, 65, 80,
+    71, 69, 85, 68, 65, 75, 66, 78, 72, 72, 76, 73, 69, 75, 74, 68,
+    67, 73, 68, 68, 69, 72, 72, 79, 60, 74, 75, 64, 70, 72, 77, 82,
+    61, 69, 68, 63, 74, 78, 76, 68, 68, 79, 70, 69, 61, 73, 58, 74,
+    75, 68, 67, 59, 76, 77, 73, 78, 70, 69, 70, 75, 68, 62, 75, 69,
+    68, 80, 75, 71, 71, 75, 74, 68, 69, 69, 65, 60, 83, 69, 68, 75,
+    78, 76, 76, 61, 80, 65, 79, 69, 63, 81, 68, 62, 71, 74, 68, 67,
+    68, 66, 61, 77, 75, 73, 58, 74, 65, 74, 66, 59, 67, 69, 68, 76,
+    70, 71, 73, 67, 76, 67, 62, 64, 62, 79, 72, 76, 73, 67, 72, 67,
+    68, 73, 61, 84, 68, 71, 78, 71, 66, 63, 58, 78, 70, 78, 68, 68,
+    62, 70, 78, 68, 72, 72, 67, 69, 72, 70, 60, 73, 71, 66, 65, 72,
+    73, 66, 66, 64, 76, 74, 65, 61, 68, 64, 79, 73, 62, 76, 68, 60,
+    72, 77, 79, 77, 72, 70, 72, 69, 64, 67, 77, 68, 65, 59, 74, 70,
+    71, 64, 77, 69, 69, 72, 69, 68, 67, 74, 75, 78, 69, 69, 69, 69,
+    74, 75, 78, 68, 79, 53, 60, 67, 68, 62, 73, 75, 68, 73, 72, 67,
+    58, 76, 75, 63, 74, 71, 73, 75, 76, 64, 65, 65, 67, 67, 78, 67,
+    56, 74, 77, 82, 69, 79, 68, 60, 66, 75, 72, 76, 66, 66, 83, 70,
+    72, 68, 65, 56, 69, 79, 69, 69, 68, 60, 68, 74, 71, 67, 72, 68,
+    67, 76, 73, 77, 68, 81, 72, 56, 70, 67, 71, 70, 70, 71, 71, 69,
+    66, 62, 73, 68, 75, 58, 79, 64, 71, 70, 66, 58, 75, 64, 79, 74,
+    63, 71, 66, 64, 72, 68, 67, 68, 70, 61, 78, 75, 70, 65, 67, 68,
+    66, 71, 76, 68, 74, 81, 72, 69, 81, 71, 64, 67, 69, 65, 67, 59,
+    64, 62, 64, 70, 73, 66, 66, 77, 71, 66, 71, 62, 69, 79, 72, 67,
+    70, 64, 80, 66, 77, 69, 71, 72, 66, 65, 71, 69, 66, 62, 74, 72,
+    71, 70, 71, 77, 61, 61, 87, 69, 75, 64, 60, 70, 71, 70, 77, 73,
+    66, 78, 70, 66, 68, 65, 72, 75, 62, 61, 68, 65, 78, 62, 66, 79,
+    80, 68, 77, 66, 73, 69, 72, 77, 66, 69, 73, 61, 60, 66, 64, 67,
+    63, 69, 78, 72, 70, 66, 75, 72, 63, 73, 57, 82, 68, 69, 78, 78,
+    66, 70, 69, 70, 73, 67, 64, 77, 66, 80, 73, 73, 70, 60, 71, 71,
+    65, 65, 67, 74, 67, 73, 75, 61, 75, 72, 60, 72, 69, 73, 68, 67,
+    66, 75, 73, 72, 74, 69, 61, 68, 74, 67, 71, 62, 69, 63, 69, 68,
+    68, 64, 69, 74, 72, 73, 69, 71, 74, 70, 69, 77, 66, 76, 65, 59,
+    73, 71, 58, 75, 63, 73, 78, 79, 68, 73, 66, 71, 66, 64, 70, 66,
+    67, 67, 69, 79, 67, 68, 72, 73, 68, 76, 74, 67, 71, 56, 67, 68,
+    68, 72, 78, 67, 65, 67, 61, 71, 70, 75, 68, 65, 69, 66, 68, 61,
+    68, 63, 66, 58, 73, 71, 55, 66, 78, 65, 66, 72, 79, 65, 79, 64,
+    72, 61, 69, 72, 71, 58, 77, 71, 69, 71, 66, 69, 77, 75, 73, 66,
+    69, 66, 71, 67, 70, 73, 64, 82, 74, 69, 60, 69, 65, 77, 77, 72,
+    69, 68, 63, 70, 71, 72, 66, 73, 59, 69, 67, 73, 69, 74, 64, 62,
+    86, 74, 68, 66, 68, 65, 66, 71, 68, 62, 74, 75, 64, 64, 73, 61,
+    63, 67, 74, 65, 65, 68, 72, 60, 76, 71, 73, 72, 62, 65, 75, 74,
+    75, 63, 74, 59, 73, 74, 68, 69, 63, 66, 66, 70, 59, 67, 70, 75,
+    68, 63, 67, 70, 62, 72, 72, 73, 75, 64, 65, 72, 71, 66, 61, 70,
+    64, 71, 67, 67, 71, 72, 72, 66, 74, 70, 73, 63, 74, 64, 72, 68,
+    61, 68, 68, 74, 77, 65, 67, 63, 69, 66, 69, 67, 63, 71, 76, 69,
+    69, 78, 60, 68, 73, 63, 62, 69, 79, 72, 63, 64, 73, 69, 68, 70,
+    82, 65, 65, 69, 68, 64, 64, 69, 76, 67, 68, 69, 71, 80, 80, 68,
+    64, 67, 69, 74, 58, 69, 59, 66, 79, 62, 70, 65, 82, 62, 65, 67,
+    77, 71, 67, 64, 68, 64, 65, 67, 74, 66, 68, 65, 72, 70, 71, 63,
+    74, 77, 61, 65, 73, 62, 60, 58, 74, 64, 70, 70, 69, 65, 74, 75,
+    64, 76, 81, 57, 70, 59, 58, 74, 67, 64, 64, 66, 63, 67, 68, 74,
+    65, 70, 72, 75, 73, 68, 65, 69, 64, 75, 69, 75, 68, 61, 70, 64,
+    70, 68, 64, 68, 69, 70, 66, 71, 75, 62, 55, 71, 61, 78, 67, 72,
+    78, 71, 74, 61, 80, 64, 62, 72, 76, 60, 76, 70, 70, 71, 74, 76,
+    72, 70, 74, 67, 61, 68, 69, 63, 65, 66, 61, 62, 61, 75, 64, 71,
+    69, 68, 72, 67, 69, 70, 61, 70, 62, 73, 71, 70, 73, 76, 61, 68,
+    69, 57, 65, 75, 76, 70, 70, 69, 57, 63, 69, 67, 63, 63, 71, 70,
+    61, 62, 71, 73, 59, 60, 76, 81, 64, 65, 62, 60, 70, 79, 66, 69,
+    70, 68, 63, 64, 74, 69, 68, 68, 65, 69, 52, 76, 66, 60, 79, 59,
+    69, 69, 66, 63, 70, 73, 67, 75, 64, 66, 71, 73, 75, 66, 69, 69,
+    69, 69, 66, 63, 74, 65, 56, 68, 73, 64, 67, 66, 71, 79, 72, 63,
+    64, 64, 73, 75, 68, 76, 68, 67, 66, 62, 63, 60, 73, 73, 77, 72,
+    64, 58, 69, 75, 66, 70, 61, 70, 61, 66, 68, 60, 71, 78, 70, 60,
+    73, 77, 66, 69, 65, 73, 73, 62, 61, 67, 73, 66, 68, 64, 66, 69,
+    61, 64, 75, 71, 64, 63, 60, 64, 80, 68, 65, 68, 73, 74, 62, 63,
+    74, 74, 60, 72, 75, 70, 67, 64, 67, 63, 75, 74, 74, 67, 60, 65,
+    82, 65, 62, 66, 65, 62, 68, 71, 68, 66, 66, 62, 69, 68, 64, 70,
+    67, 69, 69, 58, 70, 70, 77, 74, 68, 65, 67, 63, 59, 68, 79, 58,
+    70, 74, 63, 73, 64, 65, 75, 66, 73, 67, 75, 56, 69, 66, 67, 73,
+    69, 66, 75, 72, 53, 61, 68, 71, 63, 65, 74, 76, 80, 67, 71, 58,
+    65, 78, 78, 67, 65, 58, 73, 64, 70, 56, 80, 61, 66, 66, 62, 67,
+    73, 68, 64, 59, 74, 71, 59, 68, 73, 66, 74, 68, 63, 66, 63, 72,
+    72, 74, 63, 73, 62, 55, 75, 72, 73, 59, 74, 61, 76, 62, 72, 74,
+    72, 75, 71, 62, 73, 77, 65, 74, 68, 63, 67, 68, 64, 74, 64, 67,
+    62, 67, 76, 66, 71, 70, 64, 69, 63, 64, 67, 64, 67, 67, 63, 60,
+    70, 68, 67, 71, 69, 66, 72, 79, 64, 70, 67, 56, 68, 64, 66, 74,
+    71, 63, 63, 68, 58, 77, 69, 75, 76, 73, 65, 59, 67, 65, 62, 70,
+    66, 76, 62, 71, 67, 81, 57, 73, 70, 66, 69, 72, 64, 67, 70, 70,
+    74, 70, 75, 64, 64, 68, 59, 62, 81, 74, 60, 63, 67, 64, 52, 71,
+    59, 72, 65, 75, 71, 60, 63, 77, 69, 65, 62, 71, 70, 70, 63, 74,
+    65, 72, 68, 68, 67, 67, 76, 64, 67, 73, 70, 66, 71, 63, 62, 64,
+    77, 69, 66, 71, 72, 64, 69, 60, 74, 68, 68, 71, 66, 69, 83, 67,
+    60, 59, 66, 75, 62, 59, 64, 61, 68, 71, 66, 72, 66, 63, 60, 65,
+    58, 65, 67, 75, 68, 72, 81, 58, 67, 64, 65, 75, 62, 60, 71, 67,
+    70, 61, 59, 66, 76, 61, 68, 72, 68, 74, 73, 67, 62, 72, 65, 69,
+    71, 64, 60, 75, 61, 71, 71, 67, 60, 70, 65, 66, 63, 67, 69, 67,
+    75, 70, 64, 69, 57, 62, 60, 77, 68, 64, 68, 69, 57, 67, 76, 78,
+    67, 63, 71, 74, 72, 65, 69, 56, 78, 75, 71, 73, 71, 77, 63, 64,
+    64, 75, 65, 72, 75, 68, 72, 66, 67, 66, 59, 56, 64, 74, 71, 66,
+    66, 83, 74, 65, 71, 73, 69, 66, 60, 69, 71, 71, 58, 63, 67, 68,
+    80, 64, 67, 68, 63, 67, 65, 73, 52, 76, 60, 63, 67, 71, 65, 67,
+    67, 75, 72, 66, 64, 59, 66, 62, 70, 78, 57, 62, 69, 64, 60, 65,
+    70, 65, 70, 63, 76, 62, 69, 68, 64, 71, 70, 61, 63, 70, 67, 60,
+    72, 60, 64, 75, 70, 65, 66, 64, 70, 70, 65, 73, 68, 70, 62, 66,
+    64, 65, 64, 67, 65, 68, 73, 69, 71, 66, 74, 61, 68, 72, 66, 58,
+    62, 73, 71, 60, 72, 57, 67, 69, 74, 69, 72, 69, 62, 62, 56, 65,
+    73, 60, 71, 58, 69, 73, 69, 73, 69, 59, 64, 69, 58, 58, 68, 65,
+    76, 67, 72, 67, 65, 77, 64, 68, 69, 69, 68, 59, 66, 67, 67, 68,
+    66, 65, 61, 72, 75, 71, 67, 69, 68, 73, 72, 56, 64, 56, 69, 67,
+    74, 69, 63, 65, 65, 78, 72, 65, 62, 68, 70, 75, 65, 71, 56, 71,
+    65, 67, 64, 76, 71, 63, 70, 60, 61, 71, 56, 67, 75, 65, 61, 66,
+    66, 64, 76, 62, 74, 54, 71, 64, 69, 67, 68, 60, 58, 73, 67, 60,
+    71, 69, 66, 75, 64, 66, 63, 72, 60, 65, 66, 61, 71, 72, 62, 62,
+    69, 63, 69, 62, 72, 71, 65, 60, 56, 69, 63, 69, 69, 70, 72, 74,
+    65, 65, 79, 68, 73, 67, 69, 63, 72, 70, 60, 63, 71, 65, 65, 77,
+    72, 71, 63, 76, 67, 68, 58, 68, 69, 62, 66, 57, 52, 66, 80, 67,
+    68, 69, 67, 68, 71, 68, 68, 61, 63, 72, 64, 70, 70, 70, 80, 59,
+    68, 67, 65, 70, 60, 63, 63, 76, 65, 69, 69, 71, 60, 69, 64, 65,
+    66, 63, 65, 74, 57, 65, 73, 56, 71, 67, 65, 66, 73, 65, 68, 69,
+    72, 72, 66, 65, 74, 71, 52, 68, 64, 59, 62, 73, 70, 73, 79, 64,
+    54, 70, 66, 76, 78, 59, 69, 60, 65, 64, 73, 53, 68, 66, 74, 77,
+    59, 69, 68, 68, 68, 74, 61, 69, 69, 67, 68, 63, 74, 66, 71, 67,
+    76, 69, 74, 71, 61, 58, 71, 75, 68, 63, 74, 71, 63, 53, 76, 69,
+    73, 68, 69, 58, 70, 66, 66, 69, 65, 67, 66, 70, 65, 68, 63, 68,
+    72, 71, 61, 72, 75, 66, 75, 64, 64, 61, 62, 64, 66, 66, 70, 70,
+    61, 65, 69, 68, 63, 61, 67, 70, 63, 66, 72, 63, 81, 63, 61, 68,
+    61, 78, 64, 68, 70, 63, 67, 59, 68, 59, 71, 76, 68, 75, 77, 46,
+    69, 64, 60, 80, 62, 60, 70, 69, 68, 68, 72, 70, 61, 60, 67, 61,
+    66, 75, 63, 53, 67, 58, 65, 65, 70, 71, 75, 57, 73, 72, 62, 74,
+    64, 70, 63, 67, 72, 57, 64, 67, 60, 68, 77, 53, 77, 72, 65, 64,
+    70, 71, 60, 62, 60, 72, 59, 67, 58, 74, 67, 66, 74, 70, 74, 61,
+    64, 63, 66, 65, 68, 70, 69, 59, 55, 67, 68, 66, 59, 63, 57, 60,
+    70, 68, 50, 68, 74, 80, 68, 72, 65, 73, 73, 59, 65, 59, 70, 63,
+    71, 74, 72, 61, 66, 58, 68, 69, 70, 66, 71, 75, 62, 64, 70, 67,
+    53, 67, 70, 70, 66, 76, 58, 65, 63, 72, 72, 75, 71, 60, 63, 62,
+    70, 69, 71, 74, 69, 63, 72, 58, 65, 69, 67, 58, 74, 60, 66, 64,
+    73, 66, 70, 71, 64, 64, 60, 70, 68, 70, 64, 67, 77, 72, 65, 72,
+    62, 73, 64, 71, 75, 69, 53, 64, 70, 69, 74, 61, 55, 64, 72, 67,
+    61, 69, 66, 57, 64, 66, 60, 65, 62, 70, 67, 64, 71, 65, 61, 65,
+    67, 69, 66, 59, 56, 66, 66, 62, 67, 65, 55, 67, 67, 57, 67, 63,
+    63, 65, 63, 75, 68, 67, 72, 60, 67, 56, 68, 72, 56, 59, 63, 83,
+    66, 73, 53, 66, 63, 69, 61, 74, 73, 69, 64, 65, 59, 60, 65, 73,
+    66, 62, 63, 58, 70, 59, 57, 65, 71, 59, 65, 72, 72, 67, 62, 79,
+    61, 66, 53, 66, 59, 70, 64, 65, 59, 71, 70, 75, 61, 61, 64, 65,
+    65, 62, 64, 73, 74, 62, 67, 72, 62, 62, 68, 68, 68, 71, 62, 76,
+    63, 70, 69, 65, 56, 66, 64, 66, 67, 62, 68, 57, 67, 70, 65, 67,
+    67, 62, 78, 71, 67, 53, 74, 58, 60, 65, 70, 67, 67, 77, 66, 65,
+    73, 67, 66, 58, 73, 71, 68, 77, 63, 76, 66, 61, 79, 69, 72, 58,
+    68, 73, 64, 60, 66, 71, 82, 62, 71, 62, 71, 63, 67, 71, 70, 61,
+    68, 71, 61, 60, 62, 62, 66, 71, 64, 74, 58, 67, 56, 70, 69, 59,
+    61, 60, 68, 49, 67, 59, 64, 73, 72, 71, 64, 63, 63, 59, 73, 66,
+    67, 69, 67, 61, 68, 69, 68, 63, 78, 65, 64, 67, 75, 72, 79, 71,
+    56, 60, 64, 62, 68, 63, 71, 62, 73, 59, 72, 68, 61, 64, 72, 72,
+    74, 60, 68, 70, 67, 67, 65, 67, 67, 66, 55, 70, 72, 59, 54, 71,
+    74, 66, 68, 64, 63, 72, 66, 73, 64, 67, 63, 62, 78, 65, 80, 63,
+    67, 78, 69, 69, 65, 62, 59, 72, 68, 69, 60, 65, 58, 66, 63, 66,
+    61, 65, 68, 56, 81, 65, 70, 69, 69, 72, 62, 59, 74, 65, 65, 62,
+    57, 56, 57, 68, 60, 69, 64, 74, 63, 64, 62, 60, 57, 73, 71, 67,
+    60, 77, 61, 67, 70, 58, 71, 60, 73, 65, 72, 66, 57, 67, 60, 67,
+    72, 57, 59, 63, 71, 66, 75, 67, 61, 73, 61, 64, 80, 64, 63, 61,
+    55, 74, 76, 62, 69, 60, 76, 72, 66, 72, 67, 62, 71, 71, 70, 69,
+    58, 76, 49, 64, 70, 76, 71, 58, 66, 59, 60, 72, 60, 72, 62, 66,
+    65, 81, 67, 61, 65, 68, 69, 60, 75, 66, 57, 64, 66, 64, 67, 63,
+    71, 65, 66, 67, 65, 64, 70, 61, 68, 64, 58, 69, 69, 58, 67, 61,
+    62, 70, 68, 65, 62, 66, 61, 69, 67, 66, 64, 70, 55, 69, 73, 72,
+    56, 69, 71, 69, 67, 75, 73, 63, 68, 61, 65, 69, 57, 69, 55, 67,
+    62, 60, 69, 77, 66, 69, 74, 65, 60, 55, 71, 70, 62, 56, 66, 79,
+    65, 59, 70, 64, 75, 65, 64, 71, 68, 74, 67, 63, 67, 61, 61, 64,
+    61, 78, 66, 60, 78, 55, 68, 76, 68, 55, 73, 69, 67, 69, 66, 69,
+    58, 60, 60, 73, 61, 68, 61, 67, 63, 64, 61, 60, 76, 51, 59, 68,
+    65, 71, 66, 66, 63, 70, 74, 58, 74, 78, 60, 59, 65, 73, 55, 63,
+    56, 60, 74, 58, 64, 66, 60, 63, 75, 68, 62, 66, 54, 61, 70, 63,
+    68, 69, 71, 59, 64, 52, 78, 72, 68, 59, 73, 66, 63, 60, 70, 70,
+    63, 67, 63, 63, 58, 71, 75, 69, 63, 68, 68, 67, 61, 68, 70, 64,
+    69, 63, 66, 72, 72, 67, 76, 58, 70, 71, 67, 67, 71, 64, 77, 62,
+    70, 62, 68, 58, 67, 68, 56, 65, 58, 71, 74, 58, 65, 69, 63, 65,
+    60, 69, 61, 69, 71, 61, 63, 64, 68, 75, 67, 63, 64, 73, 72, 61,
+    68, 64, 56, 64, 63, 72, 70, 69, 69, 58, 72, 59, 71, 68, 66, 66,
+    67, 63, 75, 58, 62, 60, 66, 60, 69, 68, 78, 64, 58, 78, 64, 64,
+    64, 61, 57, 71, 67, 65, 47, 68, 65, 73, 51, 67, 69, 65, 65, 65,
+    69, 63, 63, 58, 65, 57, 66, 54, 70, 66, 67, 66, 63, 72, 58, 75,
+    64, 64, 53, 69, 75, 68, 70, 64, 64, 65, 64, 75, 64, 67, 63, 66,
+    67, 76, 76, 68, 63, 68, 65, 65, 60, 63, 63, 65, 63, 64, 69, 61,
+    65, 59, 74, 68, 58, 69, 70, 70, 67, 73, 60, 70, 66, 70, 67, 66,
+    67, 60, 67, 68, 66, 60, 60, 66, 71, 65, 68, 63, 63, 77, 73, 60,
+    65, 65, 66, 66, 70, 56, 66, 65, 62, 68, 68, 57, 73, 71, 64, 69,
+    65, 66, 59, 66, 64, 66, 56, 72, 56, 74, 71, 60, 51, 67, 55, 66,
+    71, 69, 68, 69, 67, 55, 61, 63, 72, 69, 72, 63, 72, 69, 64, 64,
+    63, 63, 67, 63, 66, 65, 66, 69, 67, 68, 59, 56, 67, 61, 68, 69,
+    66, 65, 74, 60, 57, 59, 67, 71, 60, 71, 67, 54, 62, 67, 61, 70,
+    56, 64, 63, 58, 78, 62, 65, 63, 64, 59, 74, 63, 72, 58, 70, 79,
+    63, 54, 64, 70, 67, 65, 56, 67, 75, 74, 49, 65, 66, 76, 68, 70,
+    59, 58, 54, 66, 58, 72, 73, 67, 70, 64, 59, 67, 76, 55, 61, 58,
+    76, 70, 61, 73, 64, 64, 63, 61, 63, 63, 62, 68, 67, 60, 67, 60,
+    64, 75, 61, 63, 66, 60, 64, 60, 63, 65, 74, 65, 62, 60, 71, 56,
+    76, 61, 62, 65, 79, 80, 64, 60, 61, 60, 57, 73, 68, 68, 73, 64,
+    69, 61, 62, 70, 52, 75, 60, 73, 59, 62, 60, 62, 73, 57, 62, 67,
+    65, 60, 75, 64, 65, 64, 64, 56, 67, 61, 72, 61, 66, 80, 64, 62,
+    66, 67, 68, 73, 63, 75, 65, 67, 69, 69, 63, 68, 72, 72, 61, 68,
+    58, 67, 58, 66, 70, 71, 71, 66, 69, 73, 68, 67, 62, 68, 64, 66,
+    59, 76, 66, 65, 61, 72, 65, 68, 64, 65, 66, 63, 70, 65, 68, 58,
+    64, 65, 69, 68, 66, 67, 65, 60, 63, 65, 66, 65, 74, 64, 67, 57,
+    67, 67, 63, 67, 81, 67, 71, 64, 70, 66, 61, 65, 62, 61, 73, 59,
+    69, 62, 64, 62, 68, 61, 65, 69, 74, 67, 65, 60, 58, 66, 60, 64,
+    61, 64, 67, 60, 72, 62, 64, 64, 64, 65, 60, 63, 58, 68, 72, 60,
+    64, 72, 65, 64, 56, 67, 65, 60, 65, 58, 65, 66, 66, 67, 64, 66,
+    60, 75, 70, 61, 58, 61, 68, 60, 73, 75, 67, 68, 69, 57, 60, 62,
+    58, 71, 71, 76, 67, 62, 67, 67, 76, 58, 65, 53, 61, 68, 64, 67,
+    68, 64, 73, 67, 61, 62, 67, 71, 67, 60, 60, 68, 59, 65, 67, 74,
+    67, 63, 76, 52, 70, 66, 66, 54, 67, 59, 70, 67, 63, 64, 65, 72,
+    68, 67, 70, 64, 72, 62, 61, 55, 65, 64, 77, 66, 67, 60, 59, 65,
+    78, 60, 67, 53, 64, 72, 72, 56, 59, 67, 64, 72, 64, 61, 66, 70,
+    66, 62, 59, 66, 56, 66, 71, 73, 59, 73, 58, 72, 53, 62, 64, 62,
+    52, 71, 63, 59, 70, 64, 63, 72, 69, 59, 62, 68, 74, 64, 65, 66,
+    63, 67, 63, 76, 62, 65, 60, 79, 64, 69, 67, 71, 59, 76, 65, 74,
+    63, 59, 60, 59, 63, 66, 65, 71, 75, 69, 61, 55, 76, 65, 59, 69,
+    68, 60, 59, 62, 67, 67, 59, 63, 65, 66, 66, 59, 74, 73, 64, 64,
+    69, 65, 67, 49, 67, 73, 60, 71, 58, 64, 71, 63, 71, 77, 66, 63,
+    67, 70, 62, 53, 64, 65, 73, 64, 59, 64, 65, 66, 62, 62, 67, 54,
+    64, 60, 67, 70, 60, 63, 72, 65, 66, 68, 61, 62, 63, 78, 60, 62,
+    77, 58, 64, 59, 53, 64, 71, 73, 58, 62, 67, 57, 73, 65, 72, 62,
+    56, 64, 68, 66, 65, 66, 53, 65, 63, 58, 68, 67, 68, 65, 65, 66,
+    65, 64, 70, 78, 67, 59, 70, 60, 66, 58, 64, 60, 68, 70, 58, 62,
+    67, 72, 64, 70, 60, 67, 73, 61, 63, 58, 53, 68, 64, 64, 62, 61,
+    75, 60, 66, 84, 67, 76, 68, 59, 62, 61, 63, 58, 66, 59, 65, 70,
+    67, 63, 67, 70, 70, 56, 69, 57, 62, 62, 71, 61, 75, 62, 54, 73,
+    67, 65, 75, 68, 67, 63, 60, 74, 62, 61, 58, 66, 60, 66, 62, 67,
+    69, 73, 65, 60, 69, 64, 69, 66, 70, 64, 77, 65, 59, 78, 63, 67,
+    69, 68, 61, 72, 75, 72, 61, 56, 59, 60, 73, 68, 73, 54, 58, 69,
+    63, 61, 70, 59, 65, 52, 71, 66, 66, 71, 65, 68, 65, 60, 65, 67,
+    68, 58, 72, 59, 68, 62, 63, 72, 63, 58, 70, 68, 63, 66, 54, 69,
+    76, 65, 72, 58, 58, 69, 65, 65, 69, 66, 64, 69, 63, 74, 51, 54,
+    74, 72, 68, 66, 65, 81, 57, 72, 66, 62, 55, 62, 69, 56, 62, 76,
+    69, 73, 65, 74, 56, 59, 60, 70, 69, 64, 76, 67, 62, 70, 67, 73,
+    64, 66, 52, 67, 57, 57, 67, 71, 63, 65, 58, 70, 60, 55, 71, 71,
+    58, 68, 62, 61, 67, 56, 63, 72, 68, 56, 71, 63, 70, 65, 50, 66,
+    72, 70, 68, 69, 61, 67, 62, 66, 59, 70, 62, 65, 57, 64, 65, 68,
+    62, 70, 66, 62, 62, 60, 60, 68, 60, 58, 68, 67, 64, 68, 69, 67,
+    71, 66, 69, 59, 67, 53, 73, 55, 69, 61, 67, 64, 62, 68, 69, 74,
+    52, 57, 74, 62, 68, 61, 70, 61, 68, 62, 70, 60, 70, 66, 63, 75,
+    58, 63, 67, 64, 69, 66, 59, 59, 67, 67, 65, 63, 64, 69, 51, 71,
+    68, 48, 60, 68, 66, 67, 68, 59, 66, 68, 67, 61, 60, 65, 60, 67,
+    61, 78, 69, 66, 62, 69, 75, 51, 65, 59, 61, 67, 73, 68, 67, 67,
+    58, 64, 66, 69, 72, 60, 63, 65, 72, 61, 62, 58, 56, 70, 60, 73,
+    64, 63, 71, 49, 72, 58, 68, 66, 68, 66, 66, 54, 65, 66, 60, 71,
+    64, 65, 61, 73, 68, 63, 66, 55, 62, 60, 65, 58, 66, 70, 57, 64,
+    69, 64, 67, 58, 62, 64, 60, 70, 56, 68, 72, 55, 71, 62, 74, 60,
+    62, 71, 67, 72, 66, 68, 74, 62, 59, 58, 63, 60, 65, 72, 64, 74,
+    60, 64, 64, 63, 69, 70, 61, 57, 72, 63, 65, 60, 67, 66, 67, 64,
+    58, 71, 62, 60, 63, 65, 73, 64, 72, 57, 66, 74, 61, 63, 70, 62,
+    71, 77, 68, 55, 79, 58, 61, 63, 62, 59, 59, 66, 67, 67, 68, 63,
+    71, 62, 63, 64, 58, 66, 74, 67, 69, 62, 68, 55, 67, 58, 69, 64,
+    67, 57, 65, 54, 62, 58, 60, 75, 63, 68, 76, 66, 61, 64, 69, 67,
+    66, 60, 64, 61, 69, 67, 67, 67, 70, 62, 67, 61, 63, 61, 57, 55,
+    72, 60, 66, 64, 72, 61, 72, 58, 58, 57, 72, 62, 70, 68, 59, 71,
+    59, 67, 70, 62, 64, 68, 68, 62, 65, 61, 63, 66, 67, 66, 67, 69,
+    60, 75, 67, 55, 59, 63, 56, 66, 67, 63, 68, 68, 65, 62, 65, 62,
+    72, 71, 55, 60, 63, 60, 66, 63, 67, 65, 57, 58, 67, 68, 66, 74,
+    72, 63, 67, 61, 59, 73, 76, 64, 72, 60, 51, 80, 59, 60, 66, 65,
+    67, 56, 63, 63, 63, 64, 67, 66, 61, 63, 58, 66, 59, 63, 66, 65,
+    70, 59, 71, 66, 59, 60, 69, 71, 61, 66, 57, 60, 70, 63, 69, 69,
+    64, 65, 70, 55, 72, 60, 73, 58, 64, 68, 57, 57, 72, 69, 63, 69,
+    68, 59, 58, 59, 69, 64, 60, 71, 66, 61, 80, 63, 54, 73, 56, 62,
+    73, 62, 72, 64, 68, 62, 72, 58, 66, 70, 59, 59, 66, 61, 56, 67,
+    70, 64, 60, 62, 66, 62, 56, 60, 78, 64, 62, 67, 58, 71, 64, 57,
+    71, 59, 58, 65, 59, 69, 71, 67, 58, 66, 67, 72, 58, 69, 60, 73,
+    51, 77, 64, 68, 60, 58, 62, 69, 54, 62, 69, 72, 56, 74, 50, 55,
+    69, 62, 64, 61, 69, 57, 58, 71, 60, 62, 57, 62, 66, 74, 69, 80,
+    63, 67, 66, 63, 69, 53, 61, 57, 64, 62, 60, 60, 71, 61, 62, 67,
+    58, 72, 57, 59, 62, 70, 66, 61, 65, 73, 58, 63, 57, 67, 75, 66,
+    65, 66, 78, 67, 66, 63, 52, 71, 58, 55, 52, 74, 72, 62, 61, 69,
+    70, 61, 65, 69, 56, 56, 64, 67, 63, 72, 65, 62, 66, 61, 67, 70,
+    61, 57, 69, 60, 58, 62, 60, 73, 69, 64, 69, 67, 66, 58, 54, 71,
+    62, 65, 64, 62, 62, 57, 65, 61, 74, 49, 78, 66, 65, 61, 67, 69,
+    62, 61, 69, 68, 64, 61, 64, 58, 63, 56, 64, 60, 69, 62, 57, 72,
+    60, 61, 69, 72, 53, 64, 66, 69, 52, 62, 65, 69, 64, 67, 65, 66,
+    59, 63, 64, 61, 60, 66, 64, 63, 72, 59, 58, 73, 63, 66, 59, 61,
+    61, 60, 67, 62, 70, 63, 69, 62, 64, 57, 79, 71, 60, 68, 57, 67,
+    73, 65, 73, 66, 66, 68, 59, 68, 68, 59, 65, 58, 61, 63, 63, 63,
+    68, 74, 61, 66, 68, 68, 71, 65, 60, 70, 65, 53, 68, 63, 66, 68,
+    61, 58, 68, 70, 63, 58, 58, 62, 57, 60, 64, 72, 69, 62, 68, 69,
+    63, 63, 54, 66, 72, 68, 57, 74, 55, 73, 68, 57, 61, 67, 58, 66,
+    60, 67, 59, 63, 64, 64, 58, 62, 65, 55, 70, 63, 76, 61, 60, 63,
+    59, 63, 60, 62, 62, 64, 69, 57, 68, 60, 63, 62, 66, 66, 63, 64,
+    69, 60, 70, 54, 61, 67, 71, 61, 55, 73, 55, 77, 64, 68, 65, 65,
+    70, 62, 67, 63, 62, 54, 73, 65, 61, 58, 63, 66, 70, 62, 61, 67,
+    57, 63, 54, 66, 65, 62, 70, 70, 62, 52, 72, 65, 61, 55, 69, 65,
+    70, 55, 68, 69, 63, 56, 77, 75, 62, 62, 58, 76, 71, 55, 63, 66,
+    62, 61, 61, 54, 71, 59, 55, 70, 65, 61, 62, 72, 53, 67, 67, 65,
+    77, 56, 57, 67, 68, 67, 58, 59, 71, 69, 78, 64, 75, 61, 69, 65,
+    57, 68, 54, 71, 66, 66, 65, 76, 54, 67, 57, 69, 64, 65, 65, 65,
+    63, 67, 59, 72, 66, 62, 68, 71, 62, 70, 65, 67, 69, 65, 68, 62,
+    69, 55, 79, 61, 62, 67, 65, 65, 59, 67, 66, 55, 75, 65, 65, 71,
+    52, 68, 66, 63, 63, 64, 64, 73, 62, 56, 61, 68, 64, 58, 71, 58,
+    69, 58, 67, 64, 60, 63, 62, 67, 63, 69, 64, 62, 66, 61, 68, 55,
+    65, 60, 64, 61, 57, 67, 64, 59, 57, 74, 68, 65, 54, 66, 59, 64,
+    69, 66, 72, 69, 59, 66, 65, 67, 50, 66, 62, 60, 57, 59, 71, 68,
+    66, 59, 63, 64, 76, 60, 65, 76, 65, 67, 68, 63, 54, 66, 68, 64,
+    61, 69, 63, 62, 63, 65, 69, 68, 64, 73, 65, 66, 69, 62, 66, 63,
+    53, 62, 48, 59, 57, 66, 60, 67, 68, 63, 69, 63, 61, 63, 56, 62,
+    58, 64, 68, 74, 63, 68, 64, 70, 65, 61, 68, 65, 52, 63, 62, 58,
+    67, 60, 66, 62, 56, 69, 62, 77, 62, 65, 62, 68, 70, 54, 70, 63,
+    62, 61, 57, 70, 54, 50, 70, 66, 77, 61, 67, 62, 68, 55, 58, 70,
+    63, 63, 72, 66, 72, 65, 66, 63, 66, 63, 58, 61, 66, 72, 61, 71,
+    59, 63, 60, 70, 65, 67, 58, 67, 60, 62, 63, 67, 59, 63, 64, 67,
+    67, 64, 61, 58, 64, 64, 62, 66, 62, 66, 65, 69, 66, 61, 62, 61,
+    63, 63, 60, 62, 67, 72, 66, 66, 68, 68, 64, 56, 60, 70, 55, 72,
+    67, 59, 59, 67, 67, 61, 71, 69, 65, 73, 57, 63, 65, 60, 61, 71,
+    61, 64, 60, 65, 66, 57, 58, 54, 68, 63, 62, 65, 56, 70, 64, 55,
+    55, 67, 70, 62, 73, 66, 72, 66, 64, 66, 72, 60, 61, 67, 58, 61,
+    61, 74, 65, 56, 57, 66, 57, 66, 64, 57, 57, 57, 67, 70, 62, 63,
+    68, 56, 64, 74, 68, 61, 61, 60, 68, 65, 67, 67, 62, 54, 69, 59,
+    66, 74, 55, 65, 58, 68, 60, 66, 58, 67, 70, 69, 49, 70, 70, 57,
+    69, 71, 67, 58, 65, 63, 67, 67, 70, 62, 55, 65, 67, 66, 66, 65,
+    70, 58, 64, 62, 61, 63, 61, 66, 70, 75, 63, 73, 61, 63, 62, 72,
+    66, 59, 59, 71, 56, 61, 74, 65, 73, 65, 76, 60, 64, 71, 69, 68,
+    60, 69, 67, 54, 58, 66, 67, 61, 58, 60, 53, 77, 63, 65, 68, 62,
+    66, 65, 59, 70, 65, 65, 65, 71, 58, 65, 73, 59, 65, 56, 64, 66,
+    64, 65, 67, 54, 57, 65, 69, 66, 61, 61, 64, 48, 70, 69, 68, 62,
+    53, 68, 68, 56, 71, 67, 64, 60, 61, 57, 58, 70, 63, 66, 69, 66,
+    56, 60, 60, 59, 53, 70, 61, 66, 62, 56, 60, 62, 66, 65, 63, 67,
+    61, 60, 57, 59, 59, 71, 61, 61, 60, 69, 66, 67, 57, 69, 71, 64,
+    55, 67, 64, 58, 72, 67, 61, 60, 66, 60, 73, 56, 60, 61, 63, 67,
+    65, 63, 63, 72, 58, 65, 63, 67, 68, 65, 67, 60, 57, 65, 62, 60,
+    60, 60, 60, 63, 58, 65, 63, 60, 70, 65, 67, 58, 70, 59, 60, 63,
+    62, 59, 73, 73, 62, 64, 70, 61, 71, 55, 59, 71, 59, 71, 57, 65,
+    68, 62, 67, 62, 62, 59, 63, 63, 63, 58, 66, 61, 66, 69, 60, 59,
+    58, 70, 65, 70, 66, 56, 66, 53, 66, 67, 72, 60, 60, 59, 69, 60,
+    65, 62, 70, 62, 74, 64, 74, 63, 62, 58, 55, 67, 65, 60, 67, 61,
+    76, 61, 57, 56, 75, 69, 60, 58, 70, 59, 63, 60, 72, 64, 57, 56,
+    75, 70, 63, 65, 62, 61, 56, 61, 70, 64, 66, 61, 59, 68, 66, 68,
+    55, 73, 62, 68, 64, 58, 60, 56, 71, 58, 68, 63, 58, 60, 72, 74,
+    68, 70, 64, 57, 59, 64, 65, 59, 70, 58, 67, 63, 67, 63, 61, 67,
+    65, 63, 63, 60, 66, 70, 70, 73, 66, 62, 66, 64, 58, 64, 54, 70,
+    62, 63, 60, 63, 66, 58, 72, 64, 60, 68, 63, 65, 63, 71, 67, 57,
+    66, 61, 72, 59, 68, 67, 65, 69, 69, 65, 69, 59, 61, 58, 58, 61,
+    59, 67, 61, 64, 62, 64, 68, 60, 57, 63, 62, 64, 55, 72, 55, 64,
+    73, 68, 61, 66, 59, 70, 60, 71, 55, 57, 58, 60, 75, 56, 63, 65,
+    62, 61, 54, 59, 67, 66, 68, 61, 65, 65, 57, 69, 65, 65, 57, 68,
+    60, 66, 68, 62, 60, 66, 57, 66, 60, 67, 60, 59, 61, 65, 60, 56,
+    67, 63, 64, 66, 71, 66, 60, 63, 64, 72, 62, 63, 63, 66, 65, 64,
+    59, 63, 72, 71, 67, 65, 61, 69, 56, 66, 69, 75, 56, 65, 60, 57,
+    63, 77, 65, 63, 65, 70, 54, 69, 57, 63, 64, 64, 67, 63, 65, 66,
+    64, 64, 59, 58, 66, 63, 53, 64, 68, 70, 63, 70, 62, 62, 64, 70,
+    60, 62, 68, 67, 67, 66, 66, 71, 68, 53, 56, 71, 61, 63, 57, 59,
+    65, 66, 63, 62, 62, 68, 60, 57, 65, 61, 70, 64, 63, 59, 65, 65,
+    63, 61, 64, 61, 68, 51, 60, 51, 69, 64, 61, 65, 55, 70, 69, 69,
+    62, 58, 77, 59, 64, 65, 66, 68, 56, 57, 69, 77, 57, 61, 69, 62,
+    60, 66, 71, 61, 69, 70, 53, 60, 58, 68, 63, 68, 63, 62, 60, 65,
+    69, 64, 60, 57, 64, 69, 62, 61, 60, 60, 79, 65, 67, 61, 70, 55,
+    60, 56, 67, 61, 70, 69, 66, 66, 65, 69, 59, 71, 61, 67, 74, 66,
+    65, 65, 70, 63, 69, 60, 55, 58, 62, 70, 68, 59, 70, 55, 74, 52,
+    66, 68, 70, 59, 73, 63, 65, 53, 66, 68, 62, 68, 66, 54, 70, 72,
+    64, 52, 64, 59, 67, 60, 65, 50, 64, 68, 68, 61, 66, 68, 57, 68,
+    56, 69, 56, 60, 62, 68, 71, 74, 58, 60, 67, 58, 59, 66, 61, 56,
+    63, 67, 65, 59, 64, 69, 69, 66, 69, 61, 75, 55, 59, 68, 63, 61,
+    60, 62, 62, 75, 66, 66, 60, 75, 70, 76, 55, 67, 56, 56, 57, 59,
+    70, 65, 63, 67, 79, 59, 62, 64, 63, 56, 58, 71, 57, 72, 66, 63,
+    56, 63, 60, 66, 63, 61, 63, 56, 65, 60, 64, 69, 61, 68, 65, 60,
+    58, 59, 72, 66, 57, 70, 68, 62, 55, 63, 66, 66, 59, 64, 63, 66,
+    61, 66, 63, 50, 69, 56, 69, 55, 70, 69, 70, 59, 72, 56, 65, 65,
+    62, 63, 66, 64, 79, 61, 64, 66, 63, 63, 70, 65, 62, 61, 67, 67,
+    70, 67, 61, 60, 69, 68, 65, 72, 59, 65, 62, 66, 61, 55, 72, 60,
+    66, 61, 64, 61, 61, 63, 50, 60, 63, 68, 53, 61, 62, 53, 75, 70,
+    67, 60, 68, 63, 63, 69, 65, 60, 59, 64, 64, 62, 66, 60, 67, 62,
+    61, 75, 65, 73, 47, 67, 60, 58, 68, 61, 73, 57, 80, 60, 72, 68,
+    67, 57, 67, 62, 61, 69, 59, 62, 59, 66, 68, 68, 56, 58, 56, 56,
+    69, 59, 67, 64, 69, 60, 54, 59, 56, 54, 64, 61, 68, 62, 58, 68,
+    65, 63, 61, 47, 77, 69, 61, 71, 53, 68, 59, 70, 53, 72, 60, 70,
+    65, 61, 58, 57, 71, 64, 71, 63, 57, 63, 58, 63, 66, 63, 71, 56,
+    73, 59, 67, 67, 54, 66, 68, 54, 43, 64, 70, 62, 66, 67, 55, 60,
+    69, 64, 65, 60, 64, 60, 66, 69, 63, 53, 63, 62, 66, 65, 61, 70,
+    70, 63, 58, 71, 65, 56, 60, 67, 60, 62, 64, 66, 62, 65, 59, 62,
+    70, 58, 71, 53, 63, 67, 64, 67, 64, 67, 64, 55, 67, 57, 52, 68,
+    61, 69, 68, 56, 58, 72, 60, 61, 70, 62, 66, 67, 67, 61, 62, 68,
+    59, 71, 62, 64, 57, 66, 62, 64, 57, 65, 57, 61, 71, 70, 59, 73,
+    62, 64, 58, 70, 59, 61, 65, 63, 69, 63, 59, 73, 61, 67, 60, 62,
+    60, 56, 71, 66, 55, 66, 57, 66, 74, 65, 62, 67, 68, 66, 52, 65,
+    75, 60, 60, 57, 57, 66, 60, 65, 64, 64, 62, 67, 65, 58, 62, 54,
+    64, 57, 67, 64, 79, 63, 57, 63, 68, 63, 61, 61, 71, 60, 60, 65,
+    66, 61, 58, 63, 62, 62, 66, 77, 55, 55, 53, 65, 62, 58, 70, 53,
+    58, 66, 60, 59, 77, 58, 58, 67, 69, 57, 72, 65, 69, 61, 65, 59,
+    63, 74, 55, 63, 62, 61, 73, 60, 65, 67, 55, 62, 55, 73, 73, 61,
+    67, 61, 72, 56, 73, 57, 66, 69, 60, 62, 53, 55, 69, 62, 65, 61,
+    53, 64, 61, 63, 68, 60, 60, 64, 65, 67, 58, 65, 60, 57, 62, 63,
+    58, 65, 66, 58, 63, 68, 73, 71, 55, 60, 60, 67, 72, 54, 63, 67,
+    57, 70, 70, 56, 65, 59, 67, 72, 59, 64, 60, 71, 54, 57, 66, 65,
+    58, 73, 60, 64, 77, 60, 58, 73, 68, 65, 62, 62, 65, 57, 59, 61,
+    65, 62, 59, 63, 65, 48, 63, 67, 61, 60, 57, 56, 67, 66, 63, 57,
+    54, 64, 75, 74, 66, 67, 62, 65, 60, 62, 64, 65, 62, 64, 64, 68,
+    60, 62, 58, 68, 51, 65, 54, 58, 62, 64, 68, 63, 62, 60, 65, 59,
+    67, 72, 55, 62, 66, 58, 52, 64, 59, 75, 58, 67, 68, 73, 51, 59,
+    62, 66, 58, 61, 64, 55, 56, 56, 63, 72, 73, 65, 59, 67, 63, 62,
+    63, 65, 54, 67, 69, 74, 60, 62, 62, 66, 65, 64, 69, 62, 63, 67,
+    69, 58, 60, 63, 67, 70, 55, 73, 62, 53, 70, 65, 52, 58, 55, 60,
+    61, 79, 65, 66, 54, 61, 57, 56, 62, 62, 65, 59, 69, 65, 52, 66,
+    62, 57, 61, 77, 63, 65, 62, 59, 65, 74, 63, 62, 66, 63, 64, 66,
+    69, 62, 67, 60, 68, 70, 64, 68, 69, 60, 65, 62, 68, 53, 56, 58,
+    64, 66, 62, 62, 56, 56, 55, 70, 79, 66, 70, 68, 68, 61, 68, 53,
+    56, 60, 67, 61, 65, 57, 64, 60, 58, 70, 58, 68, 65, 56, 68, 66,
+    70, 63, 60, 62, 63, 63, 68, 65, 58, 60, 68, 65, 65, 63, 53, 66,
+    64, 62, 65, 65, 60, 63, 65, 65, 70, 64, 60, 59, 60, 64, 64, 59,
+    60, 62, 73, 56, 65, 69, 59, 69, 64, 62, 68, 58, 70, 65, 59, 71,
+    61, 64, 61, 66, 61, 67, 58, 60, 62, 59, 58, 55, 69, 63, 61, 76,
+    64, 54, 70, 60, 67, 62, 66, 65, 69, 55, 70, 72, 56, 56, 60, 62,
+    59, 71, 62, 55, 63, 58, 64, 72, 51, 53, 70, 58, 66, 61, 60, 65,
+    65, 53, 62, 58, 73, 60, 56, 63, 81, 57, 62, 66, 54, 70, 59, 58,
+    61, 68, 64, 65, 64, 59, 62, 60, 60, 49, 71, 68, 65, 73, 71, 55,
+    53, 58, 69, 64, 70, 67, 60, 65, 58, 55, 51, 64, 58, 63, 65, 58,
+    56, 67, 65, 63, 69, 62, 66, 61, 62, 70, 51, 62, 70, 72, 61, 62,
+    66, 61, 64, 60, 73, 76, 64, 53, 65, 59, 54, 64, 60, 72, 60, 71,
+    62, 60, 50, 62, 62, 64, 62, 67, 57, 59, 66, 68, 58, 68, 64, 73,
+    61, 65, 68, 68, 69, 67, 64, 71, 60, 53, 62, 69, 65, 59, 70, 64,
+    53, 63, 68, 57, 67, 65, 63, 69, 62, 52, 70, 54, 64, 62, 64, 74,
+    57, 66, 67, 60, 60, 62, 72, 65, 68, 62, 66, 68, 61, 58, 60, 64,
+    70, 64, 63, 63, 66, 58, 63, 65, 64, 56, 65, 63, 56, 59, 57, 52,
+    64, 66, 72, 66, 65, 73, 56, 59, 66, 65, 67, 57, 59, 69, 56, 62,
+    61, 63, 63, 65, 61, 62, 66, 64, 64, 64, 57, 62, 74, 56, 70, 59,
+    58, 66, 57, 69, 61, 66, 59, 69, 62, 73, 64, 64, 66, 55, 71, 55,
+    60, 64, 51, 64, 57, 61, 58, 63, 71, 64, 63, 64, 64, 60, 61, 59,
+    61, 67, 65, 58, 68, 65, 60, 66, 70, 68, 63, 55, 60, 62, 63, 72,
+    60, 66, 69, 67, 64, 51, 56, 70, 52, 67, 62, 64, 63, 64, 66, 51,
+    76, 53, 59, 64, 66, 61, 62, 66, 66, 64, 58, 59, 67, 57, 60, 64,
+    62, 63, 58, 61, 61, 69, 62, 65, 65, 63, 70, 54, 67, 55, 59, 64,
+    56, 59, 65, 61, 62, 60, 55, 64, 72, 63, 66, 57, 74, 70, 63, 54,
+    61, 59, 60, 57, 67, 75, 58, 65, 80, 65, 61, 63, 61, 65, 72, 64,
+    58, 67, 54, 71, 54, 61, 71, 60, 66, 61, 58, 64, 56, 58, 65, 64,
+    60, 59, 55, 64, 61, 63, 67, 59, 71, 59, 59, 57, 57, 64, 57, 71,
+    59, 53, 64, 66, 57, 67, 53, 67, 55, 62, 64, 67, 58, 69, 63, 63,
+    71, 56, 54, 65, 70, 66, 63, 62, 64, 63, 63, 64, 81, 66, 66, 71,
+    54, 59, 59, 67, 53, 66, 59, 63, 61, 57, 57, 59, 62, 68, 59, 60,
+    68, 58, 53, 63, 61, 70, 70, 72, 57, 65, 66, 65, 61, 71, 60, 61,
+    65, 62, 70, 64, 65, 63, 59, 64, 50, 69, 63, 62, 63, 55, 57, 70,
+    55, 65, 67, 67, 65, 69, 68, 72, 57, 59, 65, 58, 61, 74, 59, 54,
+    60, 63, 61, 62, 70, 55, 59, 75, 54, 70, 61, 61, 58, 71, 75, 62,
+    62, 64, 66, 68, 60, 64, 67, 59, 66, 64, 56, 60, 58, 67, 67, 55,
+    64, 54, 61, 79, 61, 57, 63, 63, 71, 69, 58, 59, 68, 66, 49, 72,
+    67, 67, 63, 69, 68, 57, 61, 51, 66, 62, 67, 64, 58, 62, 58, 64,
+    56, 62, 70, 57, 59, 56, 72, 57, 57, 61, 62, 58, 67, 70, 62, 61,
+    68, 57, 69, 61, 63, 61, 69, 57, 69, 60, 66, 66, 77, 70, 53, 52,
+    65, 54, 65, 68, 58, 60, 59, 69, 64, 57, 63, 58, 74, 63, 62, 68,
+    60, 60, 64, 56, 65, 59, 69, 61, 73, 64, 60, 60, 61, 54, 72, 72,
+    58, 57, 65, 67, 52, 61, 64, 58, 74, 61, 56, 58, 66, 61, 58, 64,
+    65, 61, 67, 62, 62, 73, 66, 61, 60, 67, 74, 62, 70, 62, 55, 73,
+    65, 57, 65, 54, 65, 61, 67, 64, 52, 58, 57, 59, 62, 65, 59, 62,
+    66, 68, 52, 62, 64, 60, 62, 66, 54, 76, 66, 61, 63, 57, 66, 63,
+    68, 72, 54, 66, 55, 71, 61, 62, 62, 64, 62, 63, 58, 63, 62, 62,
+    69, 71, 59, 54, 55, 62, 57, 68, 69, 53, 63, 66, 68, 64, 61, 71,
+    56, 56, 73, 64, 64, 58, 66, 62, 61, 56, 59, 61, 66, 57, 54, 67,
+    71, 55, 55, 68, 65, 66, 59, 59, 61, 54, 57, 60, 60, 60, 55, 74,
+    62, 59, 61, 65, 64, 68, 61, 65, 62, 63, 73, 57, 60, 66, 64, 56,
+    67, 61, 58, 54, 60, 66, 61, 59, 64, 69, 65, 63, 57, 64, 70, 62,
+    73, 60, 60, 69, 62, 75, 58, 60, 58, 64, 64, 67, 66, 62, 66, 63,
+    61, 60, 68, 51, 68, 60, 66, 63, 58, 70, 57, 62, 68, 68, 56, 71,
+    65, 66, 58, 60, 61, 65, 70, 59, 61, 63, 65, 70, 70, 64, 62, 73,
+    54, 56, 55, 69, 64, 63, 74, 58, 61, 58, 66, 57, 77, 58, 59, 71,
+    58, 61, 68, 56, 67, 46, 64, 73, 72, 70, 72, 56, 51, 67, 64, 54,
+    62, 59, 66, 61, 57, 54, 64, 60, 68, 69, 65, 70, 59, 74, 66, 59,
+    76, 63, 66, 56, 70, 65, 61, 58, 64, 54, 70, 55, 61, 66, 67, 61,
+    59, 64, 58, 63, 70, 66, 53, 63, 63, 66, 58, 68, 64, 59, 58, 71,
+    64, 71, 64, 69, 60, 60, 68, 56, 71, 53, 65, 60, 60, 67, 61, 63,
+    59, 64, 59, 71, 63, 55, 56, 58, 64, 63, 66, 64, 65, 62, 67, 70,
+    62, 61, 54, 64, 55, 58, 59, 63, 56, 70, 66, 67, 67, 65, 68, 64,
+    75, 57, 61, 60, 69, 69, 67, 53, 56, 60, 63, 60, 67, 65, 60, 65,
+    65, 56, 53, 55, 67, 52, 70, 48, 66, 68, 58, 70, 67, 70, 59, 67,
+    60, 65, 60, 65, 68, 61, 58, 62, 69, 62, 61, 62, 62, 70, 58, 61,
+    60, 69, 67, 62, 55, 59, 66, 68, 61, 67, 65, 65, 66, 60, 66, 63,
+    68, 57, 65, 62, 60, 69, 66, 62, 56, 64, 63, 72, 63, 62, 59, 53,
+    59, 67, 62, 64, 64, 65, 58, 69, 59, 55, 60, 61, 67, 55, 70, 63,
+    57, 65, 52, 64, 69, 62, 72, 62, 70, 64, 63, 69, 61, 60, 64, 64,
+    70, 68, 54, 62, 64, 67, 62, 62, 63, 53, 53, 60, 66, 74, 65, 69,
+    72, 64, 58, 71, 59, 60, 53, 55, 64, 64, 62, 57, 70, 57, 64, 63,
+    59, 61, 63, 67, 72, 49, 58, 65, 56, 70, 63, 52, 59, 67, 72, 58,
+    62, 64, 55, 58, 63, 60, 62, 61, 67, 71, 75, 62, 63, 59, 55, 67,
+    60, 57, 59, 59, 61, 70, 51, 67, 66, 57, 57, 55, 67, 63, 63, 76,
+    61, 62, 54, 68, 62, 66, 70, 56, 53, 60, 55, 63, 65, 68, 60, 59,
+    58, 59, 59, 59, 60, 67, 61, 61, 71, 70, 65, 53, 62, 70, 67, 60,
+    62, 56, 66, 57, 49, 68, 75, 65, 70, 47, 58, 60, 63, 72, 67, 63,
+    59, 64, 66, 62, 57, 54, 64, 56, 57, 56, 69, 63, 67, 64, 70, 60,
+    66, 66, 62, 64, 63, 62, 62, 71, 56, 58, 74, 63, 64, 70, 67, 59,
+    64, 64, 62, 53, 60, 70, 61, 64, 66, 66, 63, 62, 65, 60, 58, 64,
+    54, 67, 64, 65, 66, 51, 65, 69, 67, 61, 63, 62, 60, 55, 55, 58,
+    63, 63, 48, 67, 72, 60, 66, 60, 58, 56, 66, 65, 57, 61, 58, 64,
+    71, 58, 58, 62, 64, 66, 68, 65, 60, 68, 65, 69, 64, 63, 55, 63,
+    66, 69, 58, 69, 67, 60, 60, 67, 60, 51, 53, 56, 62, 58, 57, 77,
+    53, 56, 59, 59, 66, 55, 64, 65, 50, 67, 64, 67, 69, 60, 56, 72,
+    54, 64, 57, 56, 60, 65, 64, 63, 60, 66, 64, 59, 56, 74, 53, 59,
+    75, 57, 54, 67, 65, 73, 65, 69, 51, 61, 56, 48, 66, 65, 54, 66,
+    62, 64, 54, 69, 64, 62, 62, 67, 60, 59, 60, 69, 65, 62, 64, 65,
+    58, 60, 65, 55, 58, 75, 57, 55, 61, 66, 74, 69, 58, 60, 67, 67,
+    67, 67, 60, 61, 60, 57, 69, 58, 64, 57, 55, 73, 64, 71, 60, 71,
+    62, 57, 67, 60, 57, 58, 62, 60, 57, 56, 62, 54, 61, 69, 57, 69,
+    66, 59, 53, 62, 52, 74, 63, 61, 65, 54, 62, 64, 67, 63, 55, 68,
+    71, 61, 66, 68, 67, 65, 60, 67, 66, 64, 66, 58, 47, 68, 58, 70,
+    64, 58, 55, 61, 57, 60, 63, 61, 65, 65, 55, 60, 61, 71, 73, 53,
+    62, 65, 65, 56, 60, 63, 63, 60, 68, 66, 67, 70, 53, 68, 55, 66,
+    64, 66, 59, 67, 57, 72, 55, 66, 65, 58, 60, 68, 67, 64, 62, 62,
+    64, 60, 58, 51, 65, 55, 71, 64, 59, 61, 70, 59, 69, 66, 68, 54,
+    58, 68, 60, 65, 70, 65, 60, 69, 64, 57, 69, 60, 66, 65, 70, 59,
+    61, 60, 67, 57, 64, 58, 70, 61, 61, 60, 66, 68, 59, 47, 66, 64,
+    62, 70, 73, 59, 67, 54, 57, 64, 67, 78, 57, 59, 61, 52, 60, 62,
+    62, 62, 57, 62, 65, 68, 64, 68, 55, 64, 65, 57, 63, 62, 62, 66,
+    69, 56, 60, 63, 63, 65, 58, 55, 59, 65, 59, 60, 55, 73, 66, 63,
+    58, 71, 64, 66, 62, 68, 67, 59, 61, 60, 52, 60, 66, 66, 61, 66,
+    69, 60, 65, 66, 56, 57, 58, 60, 55, 67, 53, 69, 62, 67, 63, 60,
+    61, 63, 51, 72, 57, 69, 67, 50, 65, 71, 67, 59, 51, 57, 65, 65,
+    66, 65, 74, 64, 62, 65, 64, 62, 55, 68, 60, 62, 68, 59, 71, 59,
+    58, 55, 71, 69, 59, 64, 57, 61, 61, 72, 60, 63, 57, 61, 58, 70,
+    56, 49, 68, 64, 57, 58, 68, 65, 62, 62, 65, 61, 65, 66, 63, 58,
+    60, 51, 68, 60, 62, 62, 70, 58, 66, 52, 66, 58, 61, 68, 70, 57,
+    53, 59, 66, 66, 62, 65, 69, 49, 65, 64, 58, 69, 58, 66, 55, 64,
+    61, 53, 67, 60, 61, 61, 61, 57, 63, 55, 65, 58, 66, 61, 57, 66,
+    65, 60, 68, 67, 56, 57, 64, 62, 71, 67, 60, 68, 54, 55, 65, 55,
+    62, 56, 56, 65, 63, 64, 69, 60, 58, 58, 64, 57, 71, 67, 60, 68,
+    59, 69, 59, 63, 60, 57, 62, 62, 66, 59, 57, 57, 61, 70, 58, 69,
+    65, 63, 51, 69, 63, 60, 71, 56, 58, 63, 59, 62, 62, 66, 64, 65,
+    67, 72, 56, 61, 70, 55, 71, 58, 61, 65, 59, 65, 56, 63, 52, 61,
+    63, 69, 64, 58, 62, 57, 68, 61, 50, 62, 64, 70, 61, 73, 69, 54,
+    58, 58, 57, 67, 61, 78, 55, 54, 67, 61, 73, 64, 60, 52, 57, 59,
+    67, 63, 65, 72, 59, 65, 67, 62, 54, 62, 68, 46, 54, 68, 61, 60,
+    63, 70, 59, 66, 65, 57, 65, 54, 77, 63, 63, 64, 62, 72, 68, 68,
+    68, 76, 63, 61, 59, 62, 56, 70, 66, 53, 68, 51, 72, 60, 61, 63,
+    63, 61, 59, 58, 66, 56, 60, 60, 62, 65, 55, 57, 54, 80, 61, 62,
+    72, 63, 53, 67, 59, 56, 64, 70, 68, 65, 56, 62, 57, 70, 58, 62,
+    62, 57, 62, 61, 64, 59, 65, 59, 59, 59, 69, 58, 64, 67, 74, 58,
+    66, 67, 57, 62, 66, 52, 68, 67, 49, 69, 61, 63, 62, 67, 58, 61,
+    67, 62, 62, 69, 65, 69, 55, 62, 59, 66, 62, 53, 63, 57, 69, 71,
+    59, 69, 63, 53, 66, 63, 58, 59, 69, 57, 59, 56, 71, 61, 52, 65,
+    67, 50, 53, 69, 59, 63, 55, 63, 64, 60, 67, 68, 58, 65, 61, 70,
+    60, 59, 59, 57, 58, 59, 56, 60, 62, 73, 58, 72, 55, 60, 72, 59,
+    70, 64, 74, 52, 58, 69, 59, 68, 68, 61, 67, 52, 68, 59, 54, 72,
+    65, 68, 58, 54, 68, 61, 62, 57, 66, 63, 56, 56, 61, 64, 63, 70,
+    65, 66, 51, 58, 59, 61, 56, 64, 59, 60, 63, 63, 55, 64, 69, 56,
+    58, 65, 62, 58, 64, 66, 56, 63, 61, 63, 56, 65, 66, 59, 73, 54,
+    64, 73, 61, 61, 57, 72, 57, 69, 59, 69, 60, 62, 74, 63, 62, 65,
+    50, 61, 61, 57, 61, 60, 59, 68, 58, 73, 69, 63, 72, 60, 57, 58,
+    53, 66, 64, 60, 71, 62, 61, 61, 70, 57, 58, 60, 65, 58, 61, 58,
+    61, 58, 54, 58, 62, 62, 64, 67, 62, 56, 58, 63, 56, 59, 57, 66,
+    63, 64, 62, 69, 67, 65, 66, 50, 60, 70, 67, 52, 59, 64, 58, 61,
+    65, 65, 58, 60, 56, 60, 62, 65, 59, 70, 59, 54, 69, 53, 63, 58,
+    72, 62, 61, 64, 64, 58, 64, 70, 69, 58, 57, 59, 61, 64, 59, 60,
+    63, 64, 56, 57, 59, 67, 58, 65, 56, 63, 56, 68, 65, 69, 53, 61,
+    65, 53, 61, 69, 59, 58, 61, 58, 61, 71, 54, 63, 69, 70, 63, 65,
+    64, 52, 63, 68, 65, 59, 68, 59, 55, 63, 59, 56, 66, 54, 71, 64,
+    54, 61, 67, 57, 62, 58, 61, 63, 60, 60, 70, 57, 55, 67, 64, 62,
+    62, 65, 60, 61, 50, 68, 68, 54, 66, 67, 60, 54, 64, 49, 69, 52,
+    69, 62, 59, 57, 58, 58, 60, 57, 58, 71, 64, 62, 58, 67, 64, 53,
+    61, 60, 66, 60, 58, 71, 59, 60, 54, 65, 65, 58, 69, 64, 67, 60,
+    53, 66, 59, 67, 60, 64, 72, 64, 66, 59, 63, 60, 61, 61, 59, 55,
+    68, 64, 68, 61, 61, 63, 68, 64, 60, 59, 66, 60, 65, 69, 66, 57,
+    61, 64, 64, 70, 58, 62, 66, 55, 61, 71, 58, 60, 61, 71, 63, 63,
+    63, 67, 53, 58, 59, 57, 56, 64, 63, 66, 62, 63, 62, 63, 57, 69,
+    65, 68, 57, 74, 57, 57, 65, 64, 57, 64, 57, 58, 63, 65, 67, 60,
+    56, 66, 58, 68, 67, 58, 56, 59, 60, 51, 73, 62, 65, 66, 57, 63,
+    61, 64, 64, 54, 66, 62, 63, 60, 67, 56, 67, 56, 69, 72, 59, 55,
+    59, 66, 61, 59, 59, 53, 61, 65, 72, 61, 66, 56, 73, 61, 66, 72,
+    60, 60, 53, 67, 58, 67, 71, 67, 59, 58, 52, 63, 59, 60, 69, 60,
+    63, 68, 56, 58, 58, 58, 69, 54, 67, 57, 59, 60, 53, 61, 76, 68,
+    51, 57, 69, 65, 55, 66, 56, 56, 69, 62, 67, 56, 60, 48, 70, 57,
+    58, 58, 53, 70, 59, 61, 60, 57, 68, 61, 69, 66, 61, 56, 65, 62,
+    59, 49, 61, 71, 55, 65, 56, 61, 57, 55, 61, 60, 61, 68, 67, 72,
+    64, 62, 67, 62, 67, 59, 67, 63, 54, 65, 77, 55, 61, 51, 66, 65,
+    48, 62, 57, 68, 64, 61, 62, 61, 62, 57, 63, 65, 62, 69, 66, 57,
+    57, 64, 61, 66, 68, 67, 64, 61, 64, 55, 71, 64, 77, 56, 55, 60,
+    57, 78, 56, 63, 68, 62, 59, 58, 56, 60, 57, 69, 60, 51, 67, 57,
+    69, 58, 72, 61, 61, 55, 66, 60, 66, 62, 62, 53, 57, 60, 60, 56,
+    66, 60, 63, 74, 57, 58, 61, 55, 53, 60, 60, 71, 60, 79, 53, 71,
+    53, 56, 71, 62, 57, 68, 64, 62, 58, 70, 58, 73, 64, 66, 48, 65,
+    63, 62, 65, 64, 69, 67, 57, 52, 58, 55, 53, 62, 66, 62, 57, 66,
+    66, 60, 57, 62, 60, 57, 73, 63, 67, 64, 59, 57, 66, 57, 58, 69,
+    66, 67, 66, 63, 57, 65, 56, 57, 62, 60, 56, 58, 66, 67, 54, 65,
+    69, 61, 66, 68, 52, 61, 69, 54, 65, 68, 68, 65, 69, 59, 63, 60,
+    68, 64, 67, 61, 58, 51, 64, 63, 59, 55, 59, 71, 63, 64, 68, 64,
+    64, 58, 67, 62, 61, 59, 64, 62, 61, 56, 61, 69, 65, 61, 69, 62,
+    60, 55, 65, 64, 64, 52, 70, 62, 62, 59, 50, 69, 68, 66, 60, 62,
+    54, 62, 66, 52, 65, 61, 69, 66, 61, 70, 53, 58, 56, 73, 55, 60,
+    68, 59, 74, 62, 69, 63, 63, 61, 63, 58, 62, 59, 66, 64, 56, 61,
+    61, 58, 63, 64, 60, 67, 57, 63, 61, 73, 69, 64, 65, 56, 52, 66,
+    64, 64, 64, 59, 56, 68, 61, 61, 68, 57, 63, 73, 63, 60, 57, 61,
+    57, 68, 70, 63, 56, 57, 64, 56, 57, 55, 70, 64, 65, 61, 62, 50,
+    55, 58, 58, 68, 63, 62, 57, 63, 67, 59, 64, 58, 66, 61, 60, 47,
+    76, 62, 67, 71, 64, 65, 59, 64, 52, 67, 63, 67, 67, 50, 66, 57,
+    67, 59, 66, 70, 59, 64, 68, 66, 59, 54, 62, 70, 55, 59, 57, 57,
+    63, 59, 56, 75, 59, 58, 54, 66, 61, 70, 58, 62, 67, 61, 56, 56,
+    66, 68, 66, 63, 55, 56, 67, 66, 54, 60, 62, 56, 63, 68, 60, 58,
+    67, 54, 60, 63, 68, 57, 64, 68, 55, 57, 58, 55, 69, 60, 59, 69,
+    69, 60, 64, 61, 60, 69, 61, 59, 61, 69, 61, 59, 56, 59, 60, 64,
+    66, 64, 59, 63, 54, 71, 70, 64, 71, 62, 68, 52, 47, 64, 65, 64,
+    55, 62, 66, 64, 60, 62, 62, 63, 53, 66, 62, 61, 56, 71, 68, 68,
+    70, 68, 58, 72, 62, 60, 61, 59, 61, 68, 64, 55, 67, 67, 61, 64,
+    70, 59, 53, 61, 58, 72, 64, 57, 56, 68, 58, 60, 64, 64, 65, 52,
+    60, 76, 60, 77, 51, 67, 58, 67, 61, 67, 61, 72, 67, 59, 61, 61,
+    65, 61, 57, 56, 63, 59, 61, 59, 68, 57, 53, 63, 65, 56, 55, 65,
+    63, 71, 51, 66, 67, 71, 57, 56, 57, 54, 70, 60, 63, 62, 62, 65,
+    56, 57, 66, 60, 50, 66, 68, 62, 57, 57, 63, 65, 59, 65, 58, 61,
+    49, 56, 54, 62, 63, 61, 63, 67, 58, 66, 72, 58, 58, 62, 67, 59,
+    56, 58, 65, 55, 58, 54, 66, 68, 59, 59, 64, 66, 59, 57, 66, 64,
+    62, 65, 62, 59, 59, 65, 66, 60, 59, 62, 59, 68, 65, 67, 49, 67,
+    66, 57, 58, 58, 58, 66, 56, 63, 55, 63, 68, 66, 54, 55, 59, 61,
+    63, 72, 65, 62, 62, 56, 65, 73, 69, 60, 63, 72, 54, 59, 64, 65,
+    62, 60, 66, 67, 57, 55, 57, 71, 59, 52, 60, 73, 64, 60, 72, 54,
+    66, 58, 68, 55, 61, 68, 64, 58, 58, 54, 60, 68, 65, 54, 55, 57,
+    65, 58, 60, 59, 60, 58, 62, 72, 63, 60, 58, 67, 58, 66, 57, 59,
+    64, 70, 66, 66, 57, 67, 62, 72, 65, 59, 53, 58, 61, 63, 70, 58,
+    50, 63, 64, 53, 65, 63, 60, 62, 63, 61, 71, 56, 70, 67, 68, 56,
+    64, 62, 59, 56, 56, 68, 62, 56, 70, 65, 51, 74, 57, 67, 57, 66,
+    69, 69, 52, 64, 66, 69, 55, 59, 54, 70, 57, 62, 66, 59, 58, 59,
+    64, 67, 71, 57, 67, 52, 65, 65, 61, 58, 59, 50, 54, 64, 60, 68,
+    71, 59, 57, 61, 64, 64, 60, 59, 78, 61, 54, 60, 55, 60, 52, 72,
+    66, 59, 69, 56, 60, 62, 58, 62, 62, 72, 59, 66, 59, 61, 53, 59,
+    57, 58, 59, 67, 57, 65, 54, 63, 56, 56, 62, 56, 72, 66, 56, 61,
+    65, 59, 69, 61, 51, 63, 65, 60, 71, 53, 60, 62, 56, 60, 69, 63,
+    61, 61, 61, 63, 71, 59, 62, 69, 55, 55, 67, 60, 73, 61, 66, 53,
+    67, 69, 65, 59, 66, 68, 53, 65, 59, 67, 63, 51, 68, 61, 58, 53,
+    66, 66, 60, 77, 55, 65, 67, 61, 60, 60, 64, 62, 55, 62, 65, 57,
+    56, 67, 63, 68, 68, 69, 56, 57, 73, 54, 62, 63, 65, 65, 56, 55,
+    62, 67, 63, 54, 68, 66, 75, 52, 70, 63, 59, 63, 62, 50, 62, 70,
+    58, 55, 55, 55, 54, 57, 58, 62, 59, 54, 67, 63, 59, 53, 65, 67,
+    57, 60, 58, 69, 55, 64, 62, 65, 60, 61, 58, 71, 70, 62, 60, 64,
+    66, 54, 59, 71, 59, 64, 55, 57, 70, 61, 69, 69, 63, 54, 59, 67,
+    56, 68, 54, 64, 63, 66, 64, 67, 73, 60, 61, 61, 61, 55, 69, 67,
+    62, 66, 64, 47, 55, 66, 73, 63, 52, 70, 51, 64, 59, 62, 61, 61,
+    61, 68, 65, 68, 54, 60, 56, 63, 57, 62, 64, 64, 55, 64, 51, 60,
+    67, 58, 62, 64, 65, 64, 49, 64, 66, 56, 63, 67, 51, 57, 58, 63,
+    65, 59, 67, 57, 56, 67, 60, 67, 57, 67, 62, 66, 62, 61, 59, 57,
+    65, 68, 64, 73, 62, 57, 56, 73, 58, 49, 59, 58, 63, 76, 56, 68,
+    50, 70, 56, 62, 50, 62, 61, 55, 57, 65, 65, 68, 48, 55, 64, 54,
+    53, 88, 49, 61, 57, 75, 59, 66, 59, 57, 64, 72, 70, 64, 62, 59,
+    56, 65, 51, 59, 48, 61, 64, 58, 71, 55, 64, 53, 64, 63, 71, 70,
+    57, 60, 62, 61, 58, 62, 57, 63, 69, 61, 56, 63, 67, 70, 69, 61,
+    54, 67, 48, 66, 61, 54, 63, 61, 64, 65, 57, 58, 56, 53, 59, 66,
+    67, 58, 59, 63, 65, 63, 62, 73, 59, 60, 66, 45, 73, 63, 60, 59,
+    63, 58, 66, 59, 60, 63, 60, 52, 66, 58, 61, 60, 65, 65, 59, 62,
+    62, 53, 60, 62, 60, 60, 70, 54, 66, 50, 78, 50, 57, 59, 57, 64,
+    62, 77, 59, 60, 67, 59, 66, 56, 63, 67, 59, 62, 58, 56, 60, 61,
+    62, 65, 58, 64, 51, 68, 56, 63, 63, 60, 72, 65, 62, 62, 53, 68,
+    61, 60, 63, 67, 58, 62, 52, 57, 50, 65, 61, 59, 62, 57, 66, 66,
+    61, 57, 65, 69, 61, 65, 59, 56, 64, 57, 49, 69, 63, 61, 74, 66,
+    66, 65, 65, 66, 57, 65, 62, 58, 63, 61, 69, 62, 56, 57, 67, 64,
+    76, 63, 59, 56, 58, 70, 58, 58, 59, 65, 65, 56, 47, 60, 67, 65,
+    53, 59, 63, 59, 56, 68, 62, 65, 67, 65, 52, 63, 70, 55, 59, 67,
+    64, 69, 47, 55, 62, 57, 61, 65, 47, 66, 62, 58, 58, 65, 63, 58,
+    59, 62, 71, 60, 63, 69, 65, 60, 58, 62, 64, 66, 72, 60, 51, 68,
+    61, 67, 64, 61, 69, 70, 71, 64, 51, 61, 60, 65, 59, 62, 62, 66,
+    59, 57, 71, 54, 59, 58, 62, 62, 65, 50, 74, 60, 62, 64, 65, 63,
+    53, 60, 63, 63, 62, 61, 63, 53, 57, 59, 67, 72, 54, 61, 61, 63,
+    77, 56, 61, 59, 64, 54, 67, 71, 49, 62, 61, 61, 62, 57, 62, 56,
+    59, 65, 64, 66, 64, 63, 60, 65, 76, 60, 73, 62, 59, 64, 66, 65,
+    69, 63, 71, 55, 66, 61, 61, 73, 60, 60, 59, 63, 57, 67, 51, 57,
+    56, 58, 63, 53, 58, 58, 61, 58, 49, 61, 62, 64, 63, 57, 64, 65,
+    59, 66, 61, 71, 68, 62, 69, 61, 55, 69, 55, 63, 71, 56, 58, 57,
+    57, 65, 68, 65, 54, 58, 65, 65, 58, 59, 63, 54, 54, 55, 58, 64,
+    51, 57, 72, 60, 63, 66, 77, 54, 54, 66, 60, 71, 56, 49, 71, 59,
+    65, 67, 59, 70, 71, 53, 70, 60, 51, 64, 59, 54, 63, 59, 67, 58,
+    66, 51, 65, 66, 58, 66, 57, 65, 51, 73, 57, 59, 60, 62, 53, 65,
+    62, 55, 61, 63, 66, 68, 59, 64, 69, 57, 53, 60, 64, 65, 57, 60,
+    59, 65, 60, 64, 62, 71, 61, 60, 61, 57, 58, 57, 66, 63, 59, 66,
+    55, 66, 53, 60, 61, 47, 54, 76, 72, 59, 59, 59, 60, 59, 62, 60,
+    56, 50, 62, 69, 73, 60, 66, 71, 59, 73, 66, 55, 64, 64, 55, 63,
+    61, 54, 58, 58, 66, 68, 61, 65, 64, 59, 66, 68, 65, 62, 59, 63,
+    63, 58, 57, 60, 54, 64, 63, 63, 62, 61, 63, 62, 58, 63, 56, 67,
+    54, 70, 56, 63, 62, 67, 49, 59, 66, 60, 56, 60, 57, 62, 67, 63,
+    50, 62, 47, 63, 57, 57, 68, 53, 64, 73, 60, 58, 68, 52, 54, 63,
+    58, 74, 63, 71, 56, 66, 55, 71, 69, 69, 55, 60, 58, 67, 58, 60,
+    55, 51, 68, 64, 62, 65, 67, 72, 65, 62, 54, 58, 59, 66, 57, 67,
+    55, 60, 68, 51, 63, 57, 62, 59, 69, 62, 59, 66, 57, 59, 65, 61,
+    67, 63, 64, 58, 51, 63, 67, 61, 54, 66, 61, 60, 60, 75, 61, 55,
+    59, 57, 67, 60, 62, 63, 71, 78, 66, 62, 50, 47, 60, 67, 66, 57,
+    54, 63, 64, 55, 64, 55, 60, 76, 68, 57, 70, 59, 55, 65, 66, 63,
+    68, 67, 66, 58, 55, 68, 68, 60, 62, 58, 59, 69, 60, 56, 57, 64,
+    57, 66, 48, 62, 52, 69, 64, 66, 60, 52, 60, 60, 62, 56, 68, 70,
+    68, 64, 53, 63, 62, 61, 73, 51, 56, 60, 64, 62, 66, 61, 56, 53,
+    56, 68, 52, 57, 64, 61, 62, 55, 57, 65, 66, 66, 57, 70, 58, 69,
+    65, 61, 61, 67, 54, 48, 66, 64, 53, 61, 55, 64, 64, 62, 64, 57,
+    52, 61, 72, 57, 62, 54, 61, 67, 65, 60, 60, 62, 61, 54, 63, 67,
+    60, 64, 64, 54, 57, 64, 66, 62, 66, 60, 68, 65, 68, 66, 60, 63,
+    59, 61, 61, 58, 54, 56, 57, 64, 62, 67, 67, 58, 64, 60, 59, 63,
+    49, 71, 55, 57, 63, 56, 61, 58, 67, 68, 55, 59, 54, 59, 56, 57,
+    62, 59, 60, 59, 71, 51, 62, 73, 63, 58, 61, 67, 59, 58, 65, 65,
+    63, 67, 60, 61, 68, 56, 66, 54, 60, 71, 62, 54, 55, 63, 67, 57,
+    66, 49, 54, 60, 64, 64, 65, 54, 64, 66, 69, 61, 57, 74, 63, 63,
+    63, 66, 58, 62, 65, 68, 60, 49, 61, 57, 66, 62, 57, 62, 64, 54,
+    61, 66, 60, 56, 56, 64, 66, 58, 59, 54, 62, 62, 70, 63, 61, 68,
+    50, 58, 49, 64, 58, 70, 59, 61, 67, 56, 71, 60, 58, 58, 66, 59,
+    58, 60, 65, 60, 48, 55, 71, 65, 59, 58, 54, 61, 69, 57, 54, 71,
+    71, 56, 57, 70, 71, 68, 58, 60, 69, 56, 54, 63, 62, 60, 66, 57,
+    61, 55, 70, 62, 66, 66, 60, 62, 70, 71, 57, 57, 55, 62, 56, 58,
+    62, 61, 62, 57, 59, 66, 55, 55, 58, 69, 52, 61, 59, 62, 66, 58,
+    59, 67, 66, 65, 58, 56, 60, 65, 62, 57, 67, 56, 68, 60, 56, 68,
+    62, 64, 65, 55, 72, 54, 60, 56, 70, 48, 58, 56, 65, 70, 61, 58,
+    68, 56, 70, 59, 69, 63, 62, 51, 58, 66, 64, 69, 58, 51, 64, 67,
+    67, 58, 68, 61, 65, 60, 71, 70, 72, 56, 60, 60, 64, 63, 59, 61,
+    62, 67, 59, 68, 50, 60, 54, 62, 56, 58, 59, 64, 58, 60, 60, 58,
+    63, 62, 56, 54, 59, 57, 56, 60, 61, 72, 58, 58, 64, 62, 59, 67,
+    55, 65, 62, 69, 64, 67, 59, 64, 56, 61, 82, 67, 66, 69, 60, 69,
+    68, 61, 63, 57, 54, 59, 62, 56, 58, 64, 62, 66, 70, 58, 62, 61,
+    63, 54, 57, 57, 57, 62, 62, 62, 61, 68, 62, 55, 66, 63, 56, 67,
+    55, 59, 66, 67, 54, 57, 72, 62, 62, 62, 68, 72, 56, 66, 58, 63,
+    60, 57, 63, 66, 67, 68, 51, 56, 56, 70, 64, 62, 56, 60, 63, 58,
+    56, 61, 62, 60, 63, 55, 60, 57, 63, 62, 64, 68, 60, 64, 59, 59,
+    62, 62, 61, 59, 62, 63, 57, 63, 55, 63, 67, 63, 64, 66, 64, 60,
+    62, 49, 54, 59, 59, 59, 56, 67, 60, 64, 66, 59, 64, 66, 65, 63,
+    59, 55, 70, 63, 60, 56, 59, 61, 63, 62, 65, 53, 63, 69, 51, 47,
+    54, 62, 61, 57, 53, 59, 57, 59, 58, 62, 56, 65, 70, 61, 54, 57,
+    65, 66, 59, 75, 64, 62, 63, 61, 70, 60, 71, 64, 60, 55, 59, 65,
+    69, 48, 69, 62, 52, 56, 52, 60, 58, 56, 58, 61, 61, 63, 71, 65,
+    62, 59, 60, 52, 63, 60, 61, 61, 69, 63, 63, 57, 66, 52, 58, 58,
+    70, 55, 58, 53, 59, 61, 61, 59, 65, 64, 63, 62, 51, 57, 71, 58,
+    59, 70, 56, 61, 64, 62, 58, 69, 56, 65, 62, 59, 70, 54, 66, 58,
+    61, 59, 60, 62, 63, 59, 62, 61, 65, 64, 58, 63, 62, 59, 71, 68,
+    58, 63, 69, 66, 54, 55, 53, 64, 60, 76, 63, 54, 53, 64, 66, 56,
+    58, 64, 62, 61, 59, 67, 67, 62, 60, 70, 57, 54, 58, 65, 65, 58,
+    64, 62, 65, 53, 51, 62, 65, 62, 65, 63, 56, 65, 52, 61, 50, 59,
+    68, 66, 58, 57, 62, 58, 61, 63, 63, 54, 52, 69, 58, 65, 61, 56,
+    65, 55, 68, 55, 68, 67, 68, 60, 70, 57, 62, 60, 58, 64, 61, 56,
+    63, 57, 68, 57, 62, 61, 54, 61, 67, 59, 68, 71, 55, 59, 59, 52,
+    68, 53, 67, 46, 65, 61, 74, 64, 56, 69, 71, 57, 66, 76, 58, 59,
+    57, 52, 67, 62, 61, 70, 58, 62, 58, 57, 56, 69, 67, 71, 56, 65,
+    61, 64, 65, 60, 66, 58, 64, 63, 58, 61, 65, 62, 56, 60, 53, 65,
+    58, 56, 69, 73, 60, 57, 59, 64, 63, 66, 62, 58, 55, 60, 65, 60,
+    62, 71, 55, 68, 59, 59, 63, 58, 67, 56, 71, 64, 58, 62, 56, 63,
+    58, 63, 61, 53, 57, 69, 57, 55, 68, 62, 60, 56, 68, 61, 64, 66,
+    61, 58, 61, 57, 67, 72, 55, 56, 54, 49, 64, 75, 56, 60, 56, 64,
+    68, 58, 59, 54, 58, 62, 62, 72, 65, 57, 56, 68, 70, 60, 59, 63,
+    66, 58, 60, 61, 59, 66, 62, 63, 57, 57, 66, 50, 64, 58, 74, 52,
+    72, 69, 52, 64, 57, 58, 68, 59, 68, 51, 60, 61, 60, 66, 63, 66,
+    66, 60, 65, 63, 61, 57, 70, 60, 62, 56, 58, 52, 71, 50, 57, 60,
+    63, 57, 63, 48, 60, 61, 57, 60, 62, 67, 66, 55, 70, 71, 53, 58,
+    53, 59, 62, 57, 59, 62, 48, 69, 63, 54, 60, 69, 52, 57, 66, 59,
+    61, 61, 61, 53, 59, 61, 68, 68, 56, 45, 67, 68, 57, 54, 62, 60,
+    61, 65, 61, 55, 67, 57, 65, 63, 52, 61, 61, 61, 59, 64, 58, 56,
+    61, 65, 64, 65, 53, 60, 62, 62, 63, 60, 62, 64, 54, 58, 57, 70,
+    63, 66, 52, 50, 67, 67, 56, 65, 52, 65, 70, 60, 50, 69, 64, 57,
+    47, 67, 62, 54, 55, 60, 59, 57, 64, 59, 62, 56, 54, 66, 63, 66,
+    63, 63, 57, 65, 69, 63, 66, 65, 63, 54, 62, 55, 69, 66, 67, 62,
+    62, 61, 46, 65, 63, 70, 46, 62, 63, 64, 71, 66, 66, 59, 63, 58,
+    55, 54, 60, 58, 60, 63, 57, 56, 57, 54, 61, 63, 63, 73, 57, 62,
+    56, 62, 61, 57, 53, 63, 71, 54, 71, 55, 56, 68, 69, 57, 57, 68,
+    51, 57, 53, 58, 61, 53, 58, 58, 62, 64, 56, 60, 57, 60, 56, 68,
+    61, 62, 66, 56, 63, 64, 65, 60, 63, 49, 60, 56, 65, 64, 64, 55,
+    63, 54, 52, 69, 46, 53, 61, 70, 57, 70, 60, 55, 57, 62, 64, 65,
+    56, 69, 61, 69, 59, 59, 58, 64, 55, 57, 63, 60, 53, 61, 59, 55,
+    73, 56, 64, 61, 63, 63, 65, 63, 61, 60, 62, 63, 62, 55, 67, 57,
+    65, 63, 63, 59, 63, 63, 67, 59, 60, 61, 56, 54, 65, 58, 65, 61,
+    58, 65, 51, 62, 62, 64, 63, 57, 56, 53, 61, 56, 60, 62, 67, 57,
+    56, 62, 54, 66, 65, 62, 65, 61, 67, 63, 57, 65, 69, 61, 54, 56,
+    64, 63, 72, 63, 56, 60, 64, 57, 62, 68, 58, 59, 67, 60, 64, 63,
+    63, 61, 60, 63, 62, 58, 55, 65, 53, 68, 56, 66, 58, 52, 78, 60,
+    66, 60, 51, 56, 63, 71, 67, 57, 62, 59, 54, 62, 69, 62, 61, 62,
+    55, 55, 60, 65, 70, 55, 61, 51, 66, 55, 56, 64, 59, 57, 70, 68,
+    62, 56, 52, 66, 58, 72, 60, 63, 44, 56, 64, 58, 60, 58, 60, 56,
+    71, 64, 54, 64, 51, 66, 66, 64, 52, 69, 64, 68, 64, 59, 61, 64,
+    64, 54, 58, 60, 64, 64, 62, 55, 65, 58, 51, 57, 51, 54, 66, 62,
+    63, 69, 66, 65, 58, 61, 60, 67, 59, 59, 63, 65, 66, 60, 55, 66,
+    60, 68, 58, 64, 64, 59, 74, 59, 59, 55, 59, 59, 48, 60, 59, 65,
+    56, 61, 62, 58, 63, 64, 71, 61, 62, 59, 68, 49, 62, 61, 60, 60,
+    66, 59, 55, 63, 57, 64, 65, 57, 60, 63, 58, 59, 69, 63, 56, 60,
+    61, 58, 70, 76, 68, 51, 64, 52, 69, 59, 51, 63, 56, 65, 73, 65,
+    58, 55, 65, 62, 59, 59, 64, 66, 48, 56, 65, 62, 60, 61, 58, 63,
+    59, 61, 61, 65, 60, 69, 62, 65, 59, 57, 59, 60, 53, 67, 62, 53,
+    61, 57, 56, 66, 52, 71, 62, 58, 54, 64, 55, 63, 54, 56, 67, 59,
+    70, 62, 64, 55, 58, 54, 69, 57, 62, 65, 63, 67, 62, 61, 67, 55,
+    60, 57, 57, 62, 51, 57, 56, 70, 64, 60, 58, 54, 52, 61, 68, 59,
+    58, 55, 71, 62, 67, 56, 54, 59, 53, 61, 57, 65, 68, 54, 64, 66,
+    63, 52, 58, 60, 65, 69, 67, 46, 63, 64, 59, 59, 64, 66, 64, 65,
+    49, 51, 55, 66, 74, 59, 65, 57, 53, 63, 60, 66, 61, 61, 53, 77,
+    47, 59, 63, 61, 53, 62, 51, 62, 66, 55, 64, 63, 58, 74, 56, 61,
+    64, 57, 51, 65, 57, 63, 61, 67, 55, 62, 58, 62, 57, 71, 56, 57,
+    62, 68, 55, 72, 57, 63, 51, 52, 66, 48, 61, 57, 65, 65, 70, 61,
+    58, 65, 54, 61, 61, 61, 62, 55, 70, 59, 57, 59, 61, 57, 63, 55,
+    63, 69, 57, 69, 61, 53, 62, 58, 65, 59, 63, 65, 57, 59, 62, 61,
+    58, 64, 69, 69, 68, 65, 55, 55, 57, 64, 57, 61, 58, 58, 59, 57,
+    61, 68, 58, 66, 70, 61, 65, 70, 61, 59, 63, 69, 59, 71, 51, 62,
+    58, 60, 62, 63, 52, 70, 53, 55, 61, 52, 51, 71, 73, 60, 64, 55,
+    66, 67, 59, 60, 61, 59, 59, 58, 63, 65, 66, 57, 65, 52, 60, 54,
+    55, 64, 63, 65, 64, 59, 58, 71, 58, 65, 60, 69, 60, 55, 63, 61,
+    53, 71, 60, 70, 63, 75, 57, 57, 69, 68, 52, 59, 59, 60, 67, 64,
+    57, 61, 59, 54, 54, 62, 66, 68, 63, 66, 63, 64, 47, 58, 55, 65,
+    62, 52, 61, 59, 64, 56, 60, 66, 69, 60, 64, 61, 63, 54, 64, 52,
+    63, 56, 62, 64, 68, 61, 63, 67, 57, 64, 57, 54, 68, 57, 55, 71,
+    57, 52, 61, 74, 60, 51, 49, 64, 64, 64, 55, 53, 69, 56, 55, 53,
+    68, 60, 71, 62, 56, 70, 65, 63, 66, 61, 66, 68, 61, 52, 54, 50,
+    66, 57, 56, 62, 62, 61, 65, 60, 64, 61, 52, 60, 51, 61, 63, 66,
+    50, 60, 58, 70, 65, 67, 60, 62, 61, 71, 64, 65, 76, 53, 56, 65,
+    64, 69, 58, 59, 59, 63, 63, 50, 54, 52, 63, 54, 72, 71, 67, 57,
+    49, 64, 67, 58, 58, 58, 65, 57, 66, 52, 64, 72, 55, 63, 51, 67,
+    60, 58, 59, 61, 58, 59, 71, 61, 57, 56, 54, 67, 52, 62, 59, 59,
+    68, 60, 75, 57, 66, 67, 63, 60, 67, 66, 59, 59, 58, 65, 59, 62,
+    52, 63, 69, 50, 69, 62, 67, 55, 55, 51, 57, 63, 69, 69, 58, 56,
+    65, 60, 59, 64, 66, 51, 64, 69, 51, 69, 62, 59, 64, 63, 68, 64,
+    52, 66, 59, 58, 61, 55, 62, 69, 63, 63, 59, 69, 62, 60, 72, 63,
+    59, 54, 58, 60, 65, 68, 59, 62, 63, 53, 63, 61, 66, 54, 66, 71,
+    59, 54, 66, 64, 65, 50, 64, 59, 55, 60, 60, 56, 69, 56, 64, 52,
+    63, 61, 52, 63, 67, 63, 61, 47, 59, 62, 64, 64, 64, 62, 62, 53,
+    52, 53, 59, 57, 67, 56, 64, 69, 68, 47, 54, 62, 62, 62, 56, 57,
+    68, 54, 65, 57, 60, 51, 62, 58, 58, 61, 55, 69, 60, 54, 70, 63,
+    50, 64, 62, 63, 55, 43, 56, 66, 65, 59, 54, 63, 64, 67, 58, 62,
+    61, 55, 57, 56, 61, 63, 57, 62, 61, 76, 58, 61, 53, 65, 57, 59,
+    58, 63, 57, 65, 53, 70, 67, 61, 58, 64, 59, 69, 52, 59, 66, 70,
+    63, 58, 62, 59, 60, 54, 59, 55, 67, 60, 60, 58, 58, 63, 61, 59,
+    54, 58, 61, 62, 67, 57, 59, 53, 59, 51, 64, 63, 70, 69, 62, 54,
+    55, 57, 67, 66, 48, 56, 66, 65, 64, 66, 70, 55, 55, 64, 56, 61,
+    67, 65, 64, 63, 68, 57, 57, 51, 64, 64, 60, 67, 57, 56, 62, 63,
+    65, 55, 63, 59, 58, 63, 62, 58, 58, 55, 74, 59, 69, 61, 70, 72,
+    58, 58, 55, 64, 46, 64, 71, 62, 59, 53, 66, 55, 51, 70, 63, 69,
+    61, 64, 54, 50, 70, 62, 63, 66, 54, 58, 62, 76, 56, 60, 70, 55,
+    56, 50, 66, 61, 61, 58, 56, 62, 57, 65, 58, 64, 64, 60, 59, 58,
+    58, 62, 65, 67, 48, 56, 66, 62, 58, 63, 57, 67, 60, 55, 60, 61,
+    57, 63, 63, 61, 60, 54, 58, 62, 57, 73, 45, 62, 62, 56, 61, 52,
+    45, 67, 60, 62, 63, 59, 62, 58, 56, 59, 64, 58, 56, 67, 65, 64,
+    60, 59, 54, 66, 60, 60, 61, 66, 58, 60, 62, 68, 53, 55, 66, 64,
+    63, 58, 60, 57, 51, 54, 71, 58, 61, 61, 70, 72, 57, 63, 61, 59,
+    54, 69, 61, 63, 56, 58, 71, 54, 59, 62, 66, 65, 56, 52, 64, 64,
+    58, 67, 62, 54, 65, 65, 49, 65, 69, 68, 54, 56, 63, 57, 58, 58,
+    56, 72, 66, 63, 56, 65, 69, 61, 61, 61, 67, 56, 68, 51, 61, 70,
+    67, 63, 58, 53, 56, 69, 55, 57, 61, 59, 66, 54, 67, 60, 48, 61,
+    66, 54, 59, 62, 65, 74, 48, 62, 58, 61, 65, 72, 59, 69, 59, 56,
+    58, 53, 62, 57, 50, 63, 61, 65, 68, 58, 60, 63, 58, 67, 55, 61,
+    66, 59, 62, 66, 53, 65, 59, 62, 58, 65, 52, 66, 56, 64, 74, 71,
+    71, 67, 65, 62, 59, 72, 63, 49, 66, 54, 60, 59, 59, 63, 67, 51,
+    55, 69, 61, 56, 58, 63, 64, 54, 65, 68, 60, 59, 55, 68, 58, 69,
+    69, 64, 64, 61, 58, 62, 64, 64, 62, 58, 58, 63, 68, 57, 56, 69,
+    59, 60, 48, 61, 59, 61, 66, 54, 63, 61, 64, 56, 64, 49, 55, 75,
+    58, 64, 62, 63, 42, 68, 69, 57, 56, 67, 54, 59, 59, 61, 61, 62,
+    66, 58, 56, 58, 56, 55, 61, 68, 62, 60, 62, 63, 67, 61, 58, 61,
+    54, 62, 55, 65, 66, 56, 62, 60, 55, 57, 68, 56, 63, 66, 69, 47,
+    59, 57, 53, 64, 59, 65, 64, 56, 60, 67, 49, 65, 66, 61, 75, 62,
+    68, 59, 57, 63, 63, 45, 69, 55, 59, 52, 69, 55, 63, 60, 62, 57,
+    63, 56, 56, 51, 64, 62, 68, 58, 68, 61, 51, 52, 63, 57, 69, 63,
+    64, 56, 57, 53, 61, 57, 58, 61, 65, 64, 53, 59, 69, 62, 71, 51,
+    66, 55, 62, 62, 57, 58, 59, 63, 60, 63, 63, 57, 63, 59, 62, 68,
+    57, 55, 62, 56, 60, 65, 61, 66, 58, 58, 59, 63, 68, 54, 61, 61,
+    67, 59, 66, 52, 57, 67, 55, 65, 58, 62, 58, 63, 65, 71, 57, 56,
+    65, 52, 72, 65, 59, 65, 59, 65, 63, 52, 66, 51, 68, 58, 66, 65,
+    57, 58, 54, 63, 71, 72, 55, 59, 59, 53, 67, 59, 55, 61, 50, 69,
+    62, 56, 58, 60, 61, 54, 58, 57, 56, 71, 67, 52, 60, 55, 48, 71,
+    52, 58, 53, 64, 72, 59, 56, 60, 63, 60, 55, 67, 54, 64, 66, 61,
+    48, 71, 52, 63, 66, 49, 55, 56, 56, 56, 65, 69, 66, 56, 59, 67,
+    64, 52, 53, 55, 66, 67, 61, 55, 69, 68, 64, 58, 55, 63, 58, 55,
+    67, 61, 64, 53, 70, 61, 69, 53, 66, 61, 63, 78, 56, 48, 62, 66,
+    57, 58, 60, 67, 59, 60, 67, 60, 57, 51, 53, 68, 57, 50, 65, 63,
+    64, 60, 60, 73, 48, 57, 62, 62, 65, 51, 73, 54, 62, 61, 68, 71,
+    62, 45, 64, 53, 65, 58, 57, 66, 59, 71, 63, 58, 61, 61, 55, 63,
+    62, 60, 63, 61, 59, 58, 65, 56, 56, 62, 65, 66, 47, 66, 66, 63,
+    57, 63, 65, 63, 57, 55, 68, 57, 61, 59, 54, 60, 65, 64, 57, 57,
+    74, 64, 64, 57, 61, 69, 75, 64, 60, 57, 61, 54, 63, 70, 49, 59,
+    62, 54, 61, 69, 57, 63, 72, 56, 55, 53, 55, 57, 63, 65, 61, 57,
+    57, 59, 66, 72, 67, 58, 64, 64, 50, 59, 56, 59, 62, 69, 50, 58,
+    62, 65, 58, 59, 58, 65, 66, 59, 58, 66, 46, 61, 62, 65, 66, 58,
+    60, 62, 58, 58, 58, 65, 63, 64, 69, 64, 64, 61, 63, 69, 56, 53,
+    65, 47, 57, 55, 60, 55, 71, 54, 69, 58, 62, 59, 61, 62, 62, 63,
+    59, 60, 62, 48, 62, 69, 58, 60, 59, 55, 62, 56, 67, 68, 64, 44,
+    61, 53, 64, 49, 54, 71, 55, 65, 52, 66, 64, 60, 61, 67, 62, 62,
+    53, 51, 69, 61, 57, 64, 63, 55, 56, 58, 56, 65, 58, 54, 62, 58,
+    60, 64, 63, 61, 62, 52, 62, 54, 69, 60, 63, 53, 62, 53, 55, 51,
+    72, 65, 70, 59, 58, 60, 53, 63, 53, 66, 69, 58, 61, 61, 69, 62,
+    61, 59, 63, 68, 63, 62, 69, 52, 67, 71, 46, 58, 72, 44, 64, 55,
+    50, 51, 55, 64, 57, 54, 69, 55, 56, 67, 62, 58, 57, 66, 59, 57,
+    55, 68, 49, 66, 60, 56, 60, 60, 64, 60, 47, 65, 61, 66, 62, 65,
+    66, 66, 64, 55, 58, 63, 52, 61, 56, 65, 58, 58, 60, 70, 60, 58,
+    57, 66, 59, 62, 54, 56, 58, 58, 66, 60, 63, 60, 62, 58, 65, 63,
+    59, 67, 68, 61, 55, 59, 66, 60, 54, 61, 59, 58, 61, 60, 66, 61,
+    69, 59, 62, 54, 60, 55, 66, 56, 63, 64, 57, 64, 60, 64, 62, 60,
+    59, 66, 61, 60, 56, 55, 63, 54, 66, 58, 58, 60, 58, 70, 63, 50,
+    57, 54, 59, 67, 72, 57, 57, 58, 50, 52, 63, 63, 58, 68, 65, 57,
+    64, 70, 54, 60, 68, 54, 56, 54, 65, 65, 67, 64, 59, 57, 55, 63,
+    64, 55, 65, 56, 54, 62, 64, 60, 61, 61, 63, 55, 55, 61, 60, 60,
+    62, 63, 62, 61, 55, 63, 65, 54, 63, 56, 63, 60, 62, 66, 56, 66,
+    69, 62, 44, 67, 49, 60, 55, 62, 67, 57, 63, 56, 58, 67, 59, 64,
+    64, 59, 54, 60, 57, 59, 62, 62, 59, 71, 56, 72, 66, 65, 66, 57,
+    63, 58, 72, 61, 60, 56, 51, 59, 62, 60, 58, 58, 54, 63, 55, 57,
+    59, 61, 66, 48, 60, 67, 62, 57, 58, 58, 58, 60, 50, 66, 57, 66,
+    57, 54, 62, 66, 50, 58, 65, 64, 67, 56, 56, 52, 64, 62, 65, 67,
+    54, 66, 57, 62, 56, 62, 56, 55, 68, 53, 59, 66, 60, 57, 69, 71,
+    64, 55, 62, 59, 65, 52, 62, 63, 67, 56, 62, 67, 65, 60, 57, 67,
+    58, 54, 63, 62, 59, 60, 68, 56, 60, 73, 57, 53, 61, 53, 65, 73,
+    59, 61, 62, 60, 53, 69, 58, 64, 62, 67, 60, 53, 55, 69, 64, 62,
+    62, 64, 62, 57, 58, 50, 65, 65, 71, 55, 47, 68, 58, 66, 56, 64,
+    60, 55, 60, 60, 63, 58, 71, 55, 51, 62, 63, 65, 63, 48, 65, 53,
+    60, 65, 65, 61, 68, 57, 61, 69, 59, 56, 61, 59, 61, 59, 65, 54,
+    57, 58, 60, 63, 50, 62, 56, 72, 62, 49, 57, 65, 59, 59, 66, 61,
+    62, 63, 61, 64, 63, 63, 51, 68, 56, 60, 64, 63, 56, 62, 67, 62,
+    67, 57, 61, 61, 60, 55, 59, 64, 57, 38, 55, 62, 69, 61, 57, 50,
+    62, 55, 70, 51, 61, 53, 57, 63, 60, 55, 64, 65, 60, 63, 62, 51,
+    61, 54, 64, 63, 50, 63, 50, 60, 53, 60, 61, 62, 59, 60, 50, 66,
+    68, 55, 59, 66, 65, 49, 65, 59, 57, 72, 53, 64, 67, 66, 48, 59,
+    60, 57, 64, 56, 64, 54, 61, 62, 61, 53, 65, 63, 50, 66, 50, 65,
+    60, 63, 57, 59, 64, 60, 57, 55, 52, 57, 66, 59, 67, 68, 58, 63,
+    64, 56, 57, 58, 69, 55, 66, 60, 64, 59, 64, 57, 52, 58, 61, 57,
+    69, 58, 71, 63, 51, 69, 55, 65, 59, 56, 59, 54, 54, 70, 64, 60,
+    60, 65, 56, 60, 60, 61, 55, 66, 68, 53, 62, 64, 66, 57, 66, 64,
+    62, 63, 57, 60, 50, 77, 57, 68, 52, 70, 65, 60, 61, 59, 71, 53,
+    67, 63, 56, 66, 60, 53, 71, 60, 55, 63, 55, 62, 64, 60, 63, 63,
+    61, 62, 62, 54, 60, 57, 60, 57, 57, 70, 60, 61, 51, 73, 55, 67,
+    64, 64, 53, 76, 64, 61, 57, 60, 63, 68, 56, 58, 65, 50, 68, 55,
+    67, 57, 63, 48, 72, 52, 61, 66, 50, 63, 65, 56, 66, 61, 59, 57,
+    54, 59, 69, 66, 60, 71, 64, 63, 69, 57, 55, 68, 59, 52, 52, 55,
+    62, 59, 61, 61, 64, 65, 52, 68, 57, 62, 62, 57, 60, 68, 62, 51,
+    66, 61, 63, 53, 65, 57, 61, 58, 54, 57, 70, 60, 65, 60, 61, 59,
+    64, 60, 53, 69, 60, 61, 60, 58, 55, 61, 60, 56, 57, 59, 65, 60,
+    66, 54, 51, 69, 56, 66, 59, 68, 63, 61, 54, 58, 57, 67, 58, 61,
+    71, 75, 59, 61, 65, 53, 62, 55, 64, 59, 67, 55, 59, 52, 59, 57,
+    60, 66, 53, 57, 59, 63, 61, 61, 68, 61, 58, 61, 67, 57, 50, 55,
+    61, 67, 60, 61, 53, 69, 51, 58, 71, 60, 60, 55, 64, 58, 66, 64,
+    67, 59, 64, 69, 57, 60, 55, 59, 54, 63, 60, 53, 65, 61, 56, 54,
+    51, 68, 62, 64, 48, 61, 66, 54, 63, 65, 66, 70, 59, 57, 68, 50,
+    55, 58, 65, 63, 62, 54, 61, 57, 61, 60, 60, 63, 59, 60, 54, 57,
+    70, 60, 68, 59, 50, 72, 61, 56, 53, 53, 66, 60, 62, 56, 59, 57,
+    57, 53, 66, 71, 60, 53, 53, 63, 78, 54, 58, 65, 59, 54, 53, 52,
+    64, 62, 63, 59, 56, 54, 63, 62, 54, 60, 60, 53, 67, 57, 64, 70,
+    52, 66, 61, 59, 60, 53, 66, 57, 54, 57, 61, 65, 55, 60, 67, 60,
+    62, 68, 67, 56, 60, 66, 55, 58, 55, 64, 68, 60, 60, 60, 63, 61,
+    59, 61, 64, 53, 67, 59, 58, 66, 61, 76, 62, 52, 68, 69, 72, 58,
+    59, 58, 60, 62, 54, 63, 71, 60, 63, 65, 49, 66, 63, 66, 55, 52,
+    62, 63, 58, 64, 69, 59, 60, 65, 67, 60, 50, 63, 56, 59, 63, 63,
+    65, 62, 61, 54, 58, 57, 49, 55, 67, 62, 54, 63, 62, 63, 65, 56,
+    58, 63, 66, 49, 65, 59, 50, 63, 57, 54, 61, 60, 61, 65, 52, 67,
+    64, 65, 58, 69, 63, 56, 53, 73, 61, 59, 58, 59, 68, 68, 56, 63,
+    58, 50, 75, 52, 66, 49, 61, 58, 59, 57, 54, 50, 55, 64, 72, 57,
+    66, 63, 56, 64, 52, 66, 60, 54, 61, 62, 67, 61, 62, 59, 64, 59,
+    66, 50, 69, 60, 56, 56, 65, 61, 57, 61, 56, 63, 58, 58, 63, 60,
+    64, 56, 63, 61, 55, 71, 58, 59, 63, 54, 62, 60, 54, 68, 61, 68,
+    56, 52, 64, 56, 56, 65, 55, 61, 54, 60, 64, 55, 65, 66, 55, 54,
+    62, 62, 57, 68, 61, 62, 55, 62, 54, 63, 63, 63, 66, 58, 70, 61,
+    51, 69, 58, 58, 56, 58, 55, 59, 58, 55, 62, 58, 65, 64, 61, 54,
+    58, 61, 61, 57, 66, 51, 53, 52, 54, 67, 59, 55, 63, 52, 61, 61,
+    67, 63, 67, 63, 61, 66, 59, 64, 59, 70, 57, 65, 68, 65, 56, 61,
+    51, 55, 52, 67, 56, 59, 58, 71, 58, 64, 49, 59, 62, 61, 52, 61,
+    63, 57, 62, 64, 65, 64, 58, 55, 62, 56, 58, 49, 64, 56, 64, 63,
+    63, 63, 58, 65, 56, 56, 58, 68, 58, 66, 60, 62, 61, 56, 59, 71,
+    51, 54, 70, 60, 57, 59, 55, 63, 60, 62, 65, 55, 55, 64, 71, 71,
+    56, 56, 66, 70, 57, 54, 52, 53, 62, 59, 56, 62, 50, 60, 56, 65,
+    55, 67, 53, 61, 64, 57, 59, 58, 55, 68, 65, 67, 53, 53, 59, 57,
+    62, 46, 61, 60, 66, 61, 70, 50, 59, 60, 57, 61, 53, 71, 55, 59,
+    66, 63, 67, 64, 61, 62, 53, 56, 62, 69, 52, 63, 67, 70, 65, 56,
+    59, 54, 67, 59, 63, 59, 57, 64, 67, 67, 67, 53, 54, 62, 60, 59,
+    54, 61, 57, 63, 57, 57, 66, 68, 50, 58, 56, 64, 59, 70, 68, 66,
+    61, 61, 54, 64, 58, 60, 58, 61, 54, 59, 54, 57, 65, 58, 69, 61,
+    57, 63, 52, 72, 58, 63, 60, 62, 62, 63, 64, 58, 65, 73, 57, 50,
+    59, 61, 60, 68, 53, 58, 59, 56, 55, 57, 58, 63, 56, 63, 59, 61,
+    65, 65, 69, 54, 53, 67, 68, 56, 62, 53, 67, 52, 64, 60, 63, 64,
+    63, 60, 53, 70, 65, 57, 64, 48, 68, 61, 53, 55, 62, 58, 45, 69,
+    51, 58, 62, 61, 59, 52, 55, 54, 55, 71, 65, 59, 56, 55, 58, 65,
+    64, 51, 48, 61, 56, 59, 66, 58, 53, 71, 55, 66, 59, 63, 65, 57,
+    60, 61, 60, 50, 55, 57, 71, 64, 54, 53, 64, 66, 58, 62, 60, 60,
+    49, 64, 57, 64, 73, 62, 54, 51, 60, 64, 63, 61, 63, 56, 53, 61,
+    66, 55, 69, 58, 56, 59, 70, 63, 59, 56, 62, 61, 55, 59, 63, 56,
+    53, 67, 63, 54, 59, 67, 62, 62, 52, 60, 57, 69, 62, 63, 60, 58,
+    64, 53, 64, 51, 59, 60, 75, 77, 65, 53, 65, 54, 63, 59, 58, 51,
+    64, 67, 65, 58, 65, 62, 56, 67, 61, 51, 58, 64, 59, 65, 65, 62,
+    59, 47, 46, 59, 65, 65, 50, 58, 58, 56, 57, 57, 65, 61, 65, 64,
+    62, 53, 64, 64, 57, 59, 63, 55, 60, 62, 67, 57, 72, 62, 62, 53,
+    59, 56, 63, 56, 71, 51, 56, 65, 67, 67, 72, 57, 68, 57, 59, 61,
+    55, 59, 60, 68, 61, 58, 59, 61, 54, 67, 59, 61, 57, 72, 56, 56,
+    59, 62, 58, 53, 53, 50, 60, 74, 56, 70, 51, 74, 57, 43, 67, 56,
+    62, 55, 67, 53, 59, 63, 65, 54, 62, 55, 58, 62, 68, 54, 61, 69,
+    63, 48, 55, 51, 54, 62, 58, 57, 58, 57, 55, 68, 59, 53, 58, 63,
+    67, 62, 60, 56, 63, 60, 57, 61, 63, 63, 66, 53, 51, 57, 53, 49,
+    63, 60, 64, 66, 66, 64, 56, 57, 61, 65, 66, 65, 61, 63, 60, 67,
+    60, 58, 68, 64, 58, 60, 65, 59, 55, 60, 66, 59, 64, 55, 63, 66,
+    69, 57, 58, 58, 70, 48, 62, 61, 60, 72, 66, 54, 59, 62, 57, 54,
+    60, 57, 60, 55, 55, 56, 70, 58, 62, 59, 61, 59, 60, 59, 59, 60,
+    62, 61, 63, 62, 66, 59, 52, 62, 61, 60, 63, 65, 56, 65, 65, 61,
+    61, 62, 59, 64, 56, 50, 63, 58, 57, 58, 62, 58, 63, 58, 68, 61,
+    64, 45, 59, 66, 71, 56, 61, 56, 60, 64, 63, 62, 54, 59, 58, 63,
+    65, 62, 61, 57, 62, 57, 65, 55, 70, 44, 59, 49, 50, 61, 65, 70,
+    53, 59, 57, 64, 58, 64, 60, 62, 64, 58, 60, 60, 67, 52, 55, 64,
+    65, 61, 60, 57, 58, 59, 54, 69, 65, 67, 55, 52, 64, 66, 61, 63,
+    61, 61, 70, 60, 56, 66, 57, 67, 58, 47, 59, 61, 60, 61, 62, 61,
+    56, 72, 57, 60, 66, 57, 60, 64, 55, 56, 57, 72, 64, 54, 60, 49,
+    66, 59, 68, 61, 55, 69, 53, 66, 60, 57, 54, 70, 61, 64, 56, 60,
+    51, 70, 55, 53, 65, 61, 65, 75, 66, 55, 61, 65, 69, 59, 59, 55,
+    58, 60, 56, 53, 65, 51, 59, 60, 53, 73, 63, 62, 57, 66, 67, 58,
+    68, 62, 63, 60, 63, 62, 50, 54, 65, 64, 52, 61, 57, 53, 56, 60,
+    62, 61, 62, 64, 57, 66, 62, 59, 50, 62, 57, 66, 71, 54, 58, 59,
+    51, 57, 58, 59, 67, 48, 61, 53, 63, 60, 61, 65, 64, 61, 74, 48,
+    59, 55, 61, 54, 63, 61, 54, 71, 56, 75, 57, 58, 59, 56, 57, 55,
+    59, 60, 67, 54, 55, 55, 55, 61, 59, 63, 60, 58, 66, 65, 58, 64,
+    65, 55, 57, 59, 66, 63, 62, 59, 61, 51, 72, 62, 58, 58, 58, 54,
+    63, 56, 62, 56, 73, 62, 56, 64, 59, 57, 57, 60, 54, 60, 59, 64,
+    58, 65, 59, 50, 69, 57, 60, 69, 46, 61, 65, 60, 66, 55, 64, 68,
+    62, 61, 63, 58, 64, 57, 48, 73, 68, 74, 60, 58, 75, 59, 73, 60,
+    57, 69, 53, 63, 52, 57, 54, 60, 54, 62, 71, 62, 60, 63, 56, 58,
+    66, 70, 62, 63, 53, 60, 63, 69, 50, 58, 63, 54, 52, 57, 58, 63,
+    60, 64, 76, 58, 65, 59, 55, 51, 48, 73, 62, 57, 66, 60, 65, 63,
+    66, 65, 60, 59, 65, 60, 60, 50, 69, 52, 63, 58, 61, 63, 53, 68,
+    57, 65, 61, 66, 54, 66, 64, 56, 63, 57, 58, 57, 62, 61, 63, 56,
+    47, 65, 61, 56, 65, 61, 51, 68, 52, 58, 49, 48, 64, 57, 54, 64,
+    64, 68, 63, 71, 58, 62, 62, 55, 64, 62, 61, 61, 59, 66, 66, 61,
+    55, 57, 66, 63, 61, 54, 69, 58, 59, 59, 57, 61, 54, 58, 50, 60,
+    58, 69, 70, 64, 65, 53, 71, 55, 61, 56, 69, 59, 64, 55, 55, 47,
+    65, 60, 59, 55, 61, 64, 63, 54, 56, 58, 64, 71, 58, 51, 62, 69,
+    47, 65, 65, 53, 60, 59, 59, 61, 62, 59, 65, 62, 51, 64, 59, 58,
+    55, 65, 55, 58, 49, 65, 57, 62, 64, 58, 58, 67, 60, 55, 55, 51,
+    63, 64, 67, 51, 69, 56, 55, 63, 56, 57, 58, 60, 54, 51, 63, 64,
+    60, 54, 60, 59, 60, 58, 54, 67, 56, 50, 57, 72, 53, 55, 60, 56,
+    59, 57, 62, 61, 54, 60, 56, 65, 67, 55, 60, 55, 62, 62, 49, 58,
+    59, 69, 60, 62, 57, 59, 59, 61, 53, 60, 55, 59, 52, 64, 53, 64,
+    66, 58, 67, 56, 58, 62, 69, 59, 59, 59, 46, 65, 69, 70, 53, 65,
+    60, 65, 64, 64, 58, 56, 65, 65, 61, 58, 67, 51, 60, 57, 55, 61,
+    52, 63, 55, 63, 52, 59, 60, 65, 62, 62, 63, 62, 54, 63, 62, 56,
+    57, 58, 56, 59, 59, 57, 62, 62, 66, 61, 56, 56, 61, 64, 67, 51,
+    64, 64, 59, 61, 60, 55, 65, 57, 65, 53, 62, 65, 60, 69, 66, 56,
+    64, 64, 51, 71, 59, 65, 61, 60, 55, 71, 59, 52, 54, 62, 71, 58,
+    57, 57, 63, 64, 61, 70, 59, 66, 80, 47, 67, 68, 53, 68, 55, 62,
+    65, 64, 64, 62, 62, 60, 62, 54, 62, 46, 52, 74, 61, 66, 65, 59,
+    57, 54, 55, 62, 50, 60, 56, 61, 59, 65, 61, 67, 46, 59, 62, 62,
+    67, 61, 51, 59, 52, 55, 61, 55, 58, 58, 66, 61, 67, 55, 60, 54,
+    54, 76, 61, 58, 60, 64, 53, 62, 56, 70, 67, 52, 58, 60, 56, 63,
+    62, 51, 62, 59, 72, 61, 55, 65, 61, 66, 62, 62, 62, 63, 64, 58,
+    65, 61, 81, 60, 50, 66, 63, 63, 56, 60, 56, 54, 60, 57, 62, 71,
+    56, 48, 55, 62, 60, 54, 67, 59, 59, 64, 62, 57, 58, 58, 62, 63,
+    55, 63, 66, 59, 55, 63, 62, 59, 70, 52, 53, 58, 62, 57, 67, 56,
+    56, 57, 63, 57, 61, 55, 58, 57, 64, 59, 55, 64, 61, 64, 70, 60,
+    58, 58, 67, 62, 63, 64, 60, 73, 66, 55, 57, 61, 60, 60, 64, 61,
+    60, 58, 60, 68, 47, 62, 63, 68, 64, 59, 55, 68, 67, 76, 56, 63,
+    61, 66, 60, 58, 58, 53, 58, 63, 60, 57, 50, 63, 57, 53, 56, 62,
+    56, 71, 56, 51, 58, 64, 63, 65, 52, 62, 65, 60, 60, 60, 58, 50,
+    68, 57, 58, 59, 62, 68, 56, 65, 65, 62, 60, 59, 66, 63, 66, 59,
+    55, 60, 59, 59, 55, 53, 64, 59, 57, 62, 59, 56, 62, 62, 63, 60,
+    66, 64, 58, 61, 64, 58, 54, 57, 66, 67, 62, 58, 53, 67, 60, 61,
+    65, 62, 57, 57, 59, 66, 65, 57, 53, 66, 57, 52, 62, 62, 59, 57,
+    45, 56, 55, 68, 62, 53, 66, 55, 64, 58, 55, 59, 62, 65, 62, 51,
+    60, 61, 54, 61, 61, 68, 60, 69, 67, 53, 65, 54, 60, 56, 62, 71,
+    58, 62, 60, 64, 54, 63, 64, 64, 59, 63, 62, 47, 65, 58, 59, 59,
+    54, 48, 59, 59, 59, 58, 57, 64, 56, 57, 56, 61, 66, 55, 63, 56,
+    49, 55, 68, 57, 54, 59, 65, 54, 70, 54, 51, 54, 62, 66, 50, 68,
+    62, 60, 63, 60, 65, 63, 53, 61, 62, 59, 61, 63, 62, 66, 55, 65,
+    62, 59, 62, 51, 66, 61, 53, 65, 59, 65, 62, 56, 51, 67, 53, 56,
+    58, 67, 58, 46, 62, 57, 64, 60, 68, 57, 65, 57, 51, 44, 67, 67,
+    61, 70, 57, 66, 58, 58, 65, 50, 61, 69, 55, 55, 53, 60, 59, 62,
+    60, 54, 61, 47, 61, 52, 61, 53, 59, 62, 63, 57, 58, 60, 57, 69,
+    53, 57, 55, 67, 56, 60, 51, 67, 57, 62, 60, 61, 54, 61, 65, 69,
+    62, 58, 61, 69, 56, 56, 65, 55, 66, 67, 55, 60, 67, 71, 68, 60,
+    59, 64, 65, 67, 59, 58, 54, 48, 57, 61, 58, 53, 67, 60, 66, 63,
+    62, 66, 56, 60, 51, 56, 57, 62, 57, 58, 63, 57, 59, 57, 66, 53,
+    66, 56, 51, 57, 59, 60, 67, 58, 57, 60, 57, 67, 54, 56, 64, 57,
+    51, 59, 62, 63, 59, 57, 50, 69, 59, 54, 59, 58, 63, 57, 58, 56,
+    64, 50, 62, 68, 66, 61, 63, 61, 70, 70, 57, 63, 58, 54, 63, 52,
+    71, 57, 56, 67, 56, 67, 55, 57, 63, 62, 50, 62, 56, 60, 58, 58,
+    61, 51, 63, 55, 72, 58, 62, 63, 57, 52, 59, 66, 68, 60, 61, 60,
+    51, 54, 65, 64, 52, 54, 58, 61, 63, 53, 62, 48, 67, 55, 63, 65,
+    58, 59, 62, 62, 57, 65, 54, 64, 63, 58, 67, 56, 56, 54, 61, 65,
+    66, 63, 64, 62, 63, 59, 67, 56, 54, 60, 65, 59, 66, 62, 62, 68,
+    57, 72, 65, 63, 54, 69, 58, 60, 63, 63, 57, 63, 67, 58, 60, 56,
+    67, 62, 60, 62, 52, 62, 66, 58, 61, 62, 66, 58, 60, 65, 65, 50,
+    71, 53, 64, 56, 67, 49, 68, 65, 50, 57, 56, 71, 52, 71, 59, 51,
+    64, 64, 54, 58, 52, 64, 54, 57, 58, 54, 67, 55, 60, 61, 56, 59,
+    71, 53, 61, 57, 59, 58, 62, 58, 59, 59, 59, 52, 60, 60, 52, 52,
+    64, 60, 66, 69, 56, 59, 61, 62, 59, 59, 52, 56, 64, 48, 63, 56,
+    55, 62, 63, 58, 59, 61, 57, 70, 66, 57, 59, 67, 59, 62, 59, 50,
+    54, 60, 58, 58, 54, 56, 57, 57, 60, 57, 63, 55, 61, 73, 53, 59,
+    58, 58, 62, 62, 49, 48, 50, 58, 58, 57, 63, 68, 65, 57, 60, 62,
+    63, 67, 64, 57, 62, 59, 69, 64, 53, 56, 57, 63, 65, 64, 59, 59,
+    52, 55, 57, 63, 61, 56, 60, 62, 65, 52, 61, 55, 62, 55, 57, 63,
+    66, 60, 54, 56, 67, 58, 57, 63, 64, 53, 64, 64, 72, 60, 66, 55,
+    59, 58, 58, 58, 61, 59, 58, 59, 61, 45, 60, 57, 62, 60, 56, 65,
+    62, 53, 53, 60, 60, 48, 62, 62, 59, 59, 65, 67, 56, 59, 67, 65,
+    58, 54, 70, 62, 52, 50, 62, 52, 54, 52, 53, 59, 56, 64, 55, 66,
+    65, 58, 60, 57, 65, 59, 51, 58, 66, 52, 61, 56, 69, 54, 64, 53,
+    54, 59, 62, 71, 60, 59, 57, 59, 66, 57, 62, 66, 68, 53, 65, 58,
+    61, 55, 51, 56, 51, 76, 69, 61, 70, 58, 62, 64, 69, 58, 62, 75,
+    72, 51, 61, 61, 49, 69, 58, 53, 74, 49, 61, 50, 63, 58, 62, 71,
+    57, 58, 54, 62, 61, 56, 67, 72, 62, 62, 61, 64, 60, 58, 58, 53,
+    55, 64, 59, 56, 66, 64, 55, 70, 65, 54, 64, 57, 63, 61, 49, 55,
+    63, 67, 56, 61, 61, 66, 67, 63, 55, 53, 53, 64, 53, 57, 63, 56,
+    65, 65, 55, 69, 67, 63, 58, 60, 52, 63, 63, 61, 62, 59, 69, 57,
+    56, 62, 62, 63, 69, 64, 51, 62, 71, 58, 58, 55, 57, 58, 58, 63,
+    67, 59, 51, 56, 52, 61, 57, 62, 67, 52, 63, 56, 56, 54, 59, 63,
+    70, 51, 58, 62, 51, 51, 53, 54, 61, 59, 57, 61, 55, 61, 57, 62,
+    65, 61, 54, 64, 54, 58, 61, 61, 60, 58, 64, 58, 58, 63, 61, 53,
+    62, 60, 64, 60, 55, 56, 60, 57, 56, 62, 62, 56, 56, 67, 61, 58,
+    60, 59, 68, 66, 57, 66, 59, 58, 63, 56, 61, 70, 54, 71, 59, 56,
+    69, 52, 64, 63, 59, 55, 51, 51, 63, 58, 55, 54, 59, 56, 61, 62,
+    56, 60, 52, 68, 65, 66, 62, 63, 71, 62, 53, 65, 59, 63, 58, 54,
+    58, 54, 57, 67, 54, 62, 50, 62, 52, 65, 62, 60, 64, 67, 62, 58,
+    60, 47, 66, 55, 61, 51, 53, 66, 51, 54, 56, 57, 55, 63, 67, 54,
+    63, 57, 63, 61, 58, 59, 55, 55, 59, 60, 61, 66, 60, 55, 53, 63,
+    62, 60, 51, 61, 58, 54, 59, 57, 61, 63, 55, 57, 65, 64, 59, 56,
+    49, 57, 61, 72, 55, 65, 60, 57, 55, 57, 64, 59, 59, 62, 65, 57,
+    46, 67, 67, 63, 58, 56, 61, 65, 57, 62, 54, 55, 66, 58, 63, 69,
+    52, 56, 60, 60, 55, 58, 74, 63, 51, 60, 60, 62, 56, 67, 61, 56,
+    57, 53, 51, 56, 70, 67, 59, 59, 61, 58, 64, 63, 62, 60, 62, 57,
+    60, 58, 52, 57, 66, 59, 52, 64, 72, 57, 64, 65, 66, 60, 64, 53,
+    66, 56, 62, 65, 60, 64, 60, 49, 60, 55, 59, 61, 71, 68, 57, 59,
+    50, 55, 66, 62, 57, 67, 56, 69, 57, 60, 51, 51, 65, 65, 53, 67,
+    58, 66, 60, 58, 66, 58, 53, 66, 58, 60, 57, 61, 56, 69, 59, 63,
+    62, 56, 56, 61, 56, 65, 67, 64, 61, 66, 57, 68, 54, 64, 61, 69,
+    54, 57, 64, 58, 60, 61, 62, 60, 53, 62, 62, 60, 64, 55, 68, 58,
+    50, 65, 63, 52, 56, 57, 69, 53, 58, 47, 57, 57, 59, 62, 52, 46,
+    59, 61, 62, 60, 59, 63, 63, 54, 61, 61, 64, 50, 68, 48, 59, 51,
+    61, 63, 67, 52, 62, 68, 59, 63, 57, 56, 63, 60, 57, 60, 63, 60,
+    46, 58, 56, 59, 60, 65, 65, 62, 66, 64, 61, 59, 60, 67, 64, 58,
+    69, 64, 56, 62, 60, 68, 56, 60, 54, 60, 56, 58, 61, 60, 52, 58,
+    64, 67, 59, 64, 54, 63, 58, 56, 61, 68, 61, 66, 57, 55, 68, 55,
+    55, 55, 65, 59, 66, 63, 64, 56, 63, 54, 58, 58, 53, 58, 59, 58,
+    64, 55, 64, 49, 68, 65, 64, 68, 51, 56, 53, 53, 57, 58, 58, 56,
+    66, 66, 52, 57, 62, 60, 51, 60, 63, 60, 60, 55, 63, 58, 52, 60,
+    60, 61, 52, 67, 60, 60, 50, 67, 60, 65, 68, 62, 58, 57, 60, 58,
+    49, 67, 58, 67, 74, 60, 57, 59, 57, 55, 59, 51, 55, 58, 63, 58,
+    66, 55, 70, 70, 63, 59, 55, 61, 56, 63, 55, 61, 71, 51, 60, 62,
+    61, 56, 55, 62, 65, 73, 57, 63, 56, 55, 61, 55, 71, 50, 59, 57,
+    54, 65, 68, 60, 48, 56, 46, 60, 66, 56, 54, 54, 61, 57, 68, 60,
+    50, 60, 68, 61, 60, 56, 52, 60, 53, 49, 47, 64, 62, 66, 70, 55,
+    62, 57, 59, 62, 70, 57, 55, 55, 56, 64, 62, 58, 56, 61, 66, 55,
+    68, 68, 63, 58, 79, 60, 55, 56, 67, 56, 59, 65, 55, 60, 60, 63,
+    63, 62, 59, 59, 64, 65, 71, 52, 50, 63, 58, 55, 60, 67, 53, 52,
+    57, 61, 59, 64, 63, 63, 58, 52, 48, 64, 62, 59, 56, 52, 66, 54,
+    56, 57, 66, 61, 56, 54, 64, 66, 73, 70, 53, 62, 61, 61, 60, 61,
+    49, 59, 57, 74, 58, 62, 54, 59, 61, 56, 53, 64, 58, 52, 57, 58,
+    64, 59, 66, 59, 53, 66, 53, 60, 63, 66, 63, 56, 47, 53, 61, 50,
+    60, 61, 59, 61, 64, 60, 58, 60, 62, 70, 66, 59, 49, 60, 60, 62,
+    61, 60, 69, 60, 62, 56, 57, 65, 57, 61, 60, 63, 56, 58, 60, 60,
+    56, 59, 67, 55, 56, 56, 62, 52, 51, 54, 62, 54, 65, 54, 64, 62,
+    77, 51, 64, 59, 53, 60, 61, 63, 59, 64, 59, 52, 65, 70, 50, 67,
+    63, 55, 63, 55, 64, 57, 60, 51, 61, 47, 62, 63, 67, 52, 56, 48,
+    59, 65, 63, 65, 42, 51, 64, 54, 61, 65, 58, 46, 66, 65, 63, 67,
+    68, 67, 60, 57, 64, 52, 63, 57, 46, 57, 62, 60, 65, 61, 65, 67,
+    70, 60, 48, 54, 60, 49, 66, 60, 65, 59, 57, 53, 70, 59, 57, 58,
+    60, 58, 61, 69, 62, 66, 55, 57, 68, 55, 55, 56, 56, 59, 62, 63,
+    59, 52, 64, 58, 59, 66, 57, 47, 57, 53, 58, 62, 65, 57, 65, 63,
+    59, 53, 59, 73, 58, 58, 57, 64, 62, 53, 65, 58, 61, 59, 63, 66,
+    65, 61, 54, 66, 55, 63, 46, 55, 47, 49, 69, 66, 57, 56, 66, 59,
+    47, 61, 60, 63, 44, 63, 67, 61, 56, 67, 57, 57, 62, 65, 54, 53,
+    57, 67, 60, 60, 61, 56, 49, 52, 65, 60, 62, 62, 64, 63, 60, 61,
+    58, 59, 63, 62, 64, 59, 54, 54, 69, 65, 61, 63, 63, 54, 57, 60,
+    66, 56, 55, 52, 58, 59, 61, 62, 66, 60, 55, 52, 59, 62, 61, 59,
+    64, 66, 50, 58, 60, 50, 62, 63, 53, 58, 57, 71, 57, 59, 66, 55,
+    52, 64, 51, 54, 70, 64, 70, 64, 56, 72, 59, 54, 55, 58, 67, 69,
+    53, 58, 55, 70, 61, 53, 49, 63, 65, 66, 58, 63, 65, 55, 62, 56,
+    59, 66, 64, 64, 59, 55, 62, 46, 58, 63, 55, 61, 55, 63, 70, 46,
+    55, 59, 59, 54, 65, 50, 63, 69, 74, 59, 59, 65, 54, 55, 69, 57,
+    60, 60, 58, 67, 54, 64, 59, 57, 61, 49, 60, 58, 64, 59, 53, 57,
+    74, 50, 62, 56, 62, 66, 61, 61, 70, 67, 57, 60, 63, 69, 56, 64,
+    51, 63, 60, 60, 56, 51, 53, 58, 56, 58, 62, 61, 60, 66, 50, 73,
+    64, 69, 63, 54, 59, 60, 67, 51, 61, 58, 63, 69, 64, 61, 51, 63,
+    59, 50, 59, 62, 59, 63, 56, 52, 58, 66, 67, 58, 62, 61, 65, 62,
+    58, 64, 68, 63, 65, 51, 61, 56, 58, 55, 59, 54, 56, 63, 56, 72,
+    64, 70, 58, 62, 54, 69, 55, 48, 52, 49, 64, 51, 67, 55, 52, 64,
+    59, 61, 63, 62, 62, 62, 55, 64, 62, 62, 63, 55, 50, 57, 56, 57,
+    54, 61, 49, 58, 56, 62, 50, 61, 63, 58, 62, 61, 68, 59, 66, 61,
+    59, 55, 58, 51, 61, 66, 58, 55, 56, 64, 65, 67, 61, 56, 56, 59,
+    55, 53, 60, 65, 56, 66, 48, 58, 51, 66, 68, 55, 54, 62, 62, 56,
+    62, 52, 62, 62, 64, 53, 58, 57, 59, 56, 56, 57, 62, 58, 61, 57,
+    62, 57, 56, 58, 57, 53, 57, 60, 61, 52, 58, 69, 56, 57, 59, 59,
+    60, 68, 50, 64, 56, 55, 64, 53, 51, 61, 53, 54, 65, 58, 65, 54,
+    57, 51, 54, 56, 71, 53, 54, 63, 60, 59, 64, 72, 57, 68, 56, 56,
+    58, 65, 57, 67, 62, 59, 66, 61, 69, 55, 57, 53, 51, 57, 65, 57,
+    61, 65, 69, 65, 55, 59, 67, 50, 64, 63, 64, 61, 59, 57, 65, 59,
+    53, 64, 53, 57, 53, 62, 62, 58, 70, 58, 51, 56, 52, 61, 61, 59,
+    50, 70, 54, 58, 57, 61, 60, 64, 58, 60, 57, 52, 72, 51, 58, 57,
+    55, 60, 70, 60, 70, 51, 61, 63, 54, 61, 57, 53, 61, 62, 62, 56,
+    56, 64, 56, 60, 58, 66, 51, 63, 57, 61, 68, 55, 61, 54, 69, 65,
+    61, 63, 59, 61, 57, 61, 60, 67, 54, 59, 61, 61, 64, 65, 66, 62,
+    60, 51, 64, 53, 57, 61, 60, 52, 54, 62, 55, 52, 61, 61, 65, 55,
+    54, 57, 65, 57, 62, 49, 66, 55, 64, 58, 61, 63, 65, 63, 53, 66,
+    57, 63, 65, 62, 61, 63, 51, 62, 61, 67, 58, 52, 65, 57, 57, 62,
+    61, 56, 67, 60, 59, 58, 56, 65, 65, 60, 60, 58, 55, 69, 59, 55,
+    51, 59, 62, 58, 57, 54, 65, 59, 56, 64, 60, 69, 60, 59, 59, 62,
+    71, 58, 58, 55, 60, 61, 66, 65, 67, 59, 60, 56, 69, 57, 65, 45,
+    67, 55, 68, 57, 55, 57, 67, 54, 55, 50, 62, 62, 56, 63, 63, 65,
+    65, 56, 58, 66, 55, 55, 54, 64, 51, 56, 59, 58, 63, 60, 57, 49,
+    55, 71, 62, 65, 58, 64, 62, 60, 56, 62, 59, 64, 61, 65, 62, 58,
+    57, 56, 60, 62, 54, 58, 60, 63, 60, 56, 48, 66, 58, 57, 57, 52,
+    70, 68, 51, 59, 60, 55, 64, 65, 58, 59, 52, 71, 66, 64, 71, 53,
+    49, 64, 60, 64, 61, 56, 47, 56, 50, 55, 61, 55, 61, 60, 51, 57,
+    63, 66, 62, 63, 61, 52, 64, 55, 65, 58, 54, 67, 65, 56, 63, 73,
+    57, 65, 57, 58, 62, 67, 50, 67, 56, 57, 57, 53, 69, 66, 53, 54,
+    64, 65, 65, 59, 52, 55, 55, 67, 61, 65, 68, 50, 59, 65, 53, 59,
+    62, 54, 62, 60, 62, 72, 61, 61, 61, 62, 53, 62, 67, 57, 60, 47,
+    59, 50, 63, 52, 54, 67, 58, 53, 58, 60, 66, 63, 60, 50, 66, 57,
+    66, 65, 54, 60, 57, 67, 62, 59, 58, 56, 62, 58, 64, 65, 58, 54,
+    70, 53, 55, 60, 59, 65, 61, 53, 61, 57, 55, 64, 50, 66, 60, 59,
+    65, 67, 51, 67, 55, 59, 55, 70, 45, 68, 68, 60, 66, 55, 64, 61,
+    60, 59, 64, 70, 55, 51, 53, 61, 65, 65, 59, 58, 58, 59, 50, 59,
+    65, 57, 66, 65, 54, 51, 64, 63, 52, 68, 59, 56, 53, 57, 62, 56,
+    65, 59, 76, 53, 56, 60, 56, 59, 61, 68, 59, 62, 55, 62, 59, 63,
+    53, 57, 55, 67, 62, 65, 49, 58, 55, 66, 66, 59, 50, 64, 59, 66,
+    58, 63, 63, 44, 64, 57, 57, 63, 60, 67, 62, 56, 63, 60, 57, 52,
+    62, 58, 54, 55, 62, 54, 59, 64, 61, 52, 51, 62, 61, 57, 62, 64,
+    60, 58, 56, 66, 55, 59, 60, 57, 59, 56, 44, 56, 60, 54, 61, 68,
+    62, 64, 48, 63, 59, 73, 54, 61, 59, 61, 60, 50, 57, 65, 58, 61,
+    50, 66, 61, 57, 63, 71, 58, 56, 69, 66, 68, 57, 67, 50, 66, 50,
+    69, 59, 67, 64, 62, 56, 65, 64, 50, 62, 50, 58, 58, 71, 48, 61,
+    56, 47, 59, 60, 51, 69, 59, 56, 61, 67, 58, 53, 67, 46, 55, 69,
+    53, 58, 55, 56, 58, 50, 67, 51, 53, 50, 65, 60, 64, 60, 58, 50,
+    61, 65, 62, 49, 59, 58, 54, 67, 64, 65, 60, 60, 57, 69, 56, 66,
+    57, 57, 55, 68, 63, 63, 57, 57, 55, 55, 70, 53, 57, 56, 66, 55,
+    57, 55, 61, 66, 62, 60, 59, 67, 56, 51, 68, 52, 61, 52, 51, 55,
+    56, 58, 67, 64, 57, 59, 59, 66, 66, 64, 56, 64, 52, 63, 57, 59,
+    62, 53, 60, 48, 66, 59, 52, 67, 53, 50, 67, 59, 59, 53, 63, 55,
+    64, 66, 63, 57, 72, 54, 62, 50, 64, 57, 61, 63, 66, 58, 65, 62,
+    54, 57, 55, 64, 52, 53, 55, 58, 62, 52, 61, 56, 67, 52, 61, 59,
+    57, 59, 49, 60, 60, 63, 63, 56, 65, 60, 59, 59, 61, 61, 58, 59,
+    64, 52, 62, 54, 66, 62, 67, 55, 57, 61, 70, 63, 62, 62, 61, 54,
+    68, 57, 56, 57, 50, 56, 65, 64, 58, 62, 63, 60, 57, 63, 59, 59,
+    59, 59, 70, 59, 57, 58, 54, 52, 63, 58, 60, 58, 58, 57, 61, 57,
+    56, 63, 63, 56, 56, 67, 45, 59, 53, 60, 58, 58, 58, 52, 57, 66,
+    49, 66, 63, 56, 58, 57, 61, 59, 56, 61, 68, 62, 65, 52, 56, 61,
+    59, 60, 47, 60, 65, 54, 49, 55, 63, 59, 48, 63, 57, 58, 66, 54,
+    59, 61, 61, 63, 69, 48, 65, 67, 57, 53, 71, 62, 56, 63, 48, 52,
+    61, 69, 61, 60, 59, 67, 60, 51, 65, 65, 60, 53, 53, 61, 61, 58,
+    54, 57, 50, 65, 49, 60, 53, 55, 60, 67, 66, 58, 66, 56, 54, 67,
+    65, 52, 57, 63, 61, 60, 61, 69, 53, 64, 67, 56, 55, 59, 58, 50,
+    66, 59, 66, 60, 55, 71, 61, 64, 64, 60, 57, 63, 57, 64, 52, 66,
+    56, 49, 59, 48, 57, 61, 63, 64, 50, 58, 54, 60, 72, 62, 56, 61,
+    54, 54, 59, 60, 64, 67, 50, 60, 60, 61, 63, 55, 56, 68, 54, 50,
+    53, 69, 65, 67, 51, 61, 58, 64, 67, 51, 64, 69, 70, 54, 54, 57,
+    63, 55, 54, 61, 61, 63, 51, 50, 67, 55, 64, 64, 66, 61, 66, 60,
+    66, 53, 66, 57, 66, 60, 60, 57, 53, 56, 53, 63, 52, 56, 54, 61,
+    46, 58, 70, 68, 64, 54, 57, 61, 53, 51, 62, 53, 68, 53, 62, 72,
+    59, 66, 65, 61, 63, 62, 56, 61, 54, 55, 58, 57, 58, 65, 55, 55,
+    59, 63, 55, 54, 53, 49, 55, 62, 58, 68, 72, 70, 54, 69, 52, 54,
+    52, 67, 63, 58, 59, 51, 55, 60, 48, 59, 62, 56, 68, 67, 58, 62,
+    53, 63, 68, 64, 60, 69, 56, 65, 63, 61, 58, 65, 66, 57, 67, 68,
+    55, 63, 57, 53, 58, 60, 60, 63, 55, 60, 64, 60, 57, 71, 68, 57,
+    60, 57, 53, 73, 54, 61, 57, 70, 61, 61, 61, 53, 59, 61, 61, 56,
+    53, 66, 57, 62, 56, 58, 68, 53, 68, 57, 50, 63, 56, 54, 68, 57,
+    58, 63, 59, 55, 65, 52, 65, 54, 50, 57, 65, 58, 65, 59, 65, 52,
+    66, 56, 71, 56, 59, 55, 58, 52, 59, 68, 65, 56, 61, 58, 54, 62,
+    54, 64, 52, 55, 58, 57, 63, 68, 65, 64, 57, 54, 52, 56, 59, 52,
+    59, 58, 59, 67, 55, 67, 64, 60, 54, 63, 57, 60, 45, 66, 59, 68,
+    68, 54, 50, 57, 56, 63, 65, 63, 50, 58, 53, 64, 54, 57, 66, 59,
+    58, 59, 53, 47, 63, 55, 60, 57, 57, 70, 53, 60, 61, 49, 62, 47,
+    53, 68, 52, 63, 59, 58, 64, 69, 58, 60, 61, 65, 76, 54, 57, 62,
+    54, 59, 66, 52, 66, 61, 59, 56, 44, 55, 70, 52, 65, 62, 68, 63,
+    58, 55, 64, 53, 64, 62, 51, 67, 57, 61, 52, 68, 55, 64, 69, 60,
+    61, 55, 52, 63, 60, 69, 62, 59, 62, 50, 57, 53, 57, 65, 65, 56,
+    52, 61, 58, 65, 59, 58, 54, 58, 57, 61, 59, 57, 59, 50, 62, 56,
+    60, 55, 66, 60, 58, 58, 56, 67, 64, 56, 62, 53, 59, 54, 65, 63,
+    61, 56, 65, 59, 57, 60, 56, 67, 58, 52, 57, 61, 59, 40, 48, 67,
+    58, 53, 66, 63, 63, 57, 56, 64, 66, 56, 58, 64, 61, 54, 61, 65,
+    62, 58, 52, 56, 59, 60, 57, 60, 50, 57, 57, 51, 64, 57, 60, 67,
+    62, 56, 65, 58, 68, 66, 64, 61, 54, 63, 57, 61, 58, 71, 46, 61,
+    59, 68, 56, 63, 54, 57, 54, 54, 65, 58, 65, 58, 62, 65, 71, 56,
+    58, 59, 64, 58, 60, 63, 56, 59, 70, 61, 57, 61, 63, 55, 57, 68,
+    51, 55, 66, 60, 63, 50, 48, 59, 60, 65, 56, 55, 72, 55, 63, 60,
+    64, 62, 58, 63, 53, 61, 60, 60, 57, 47, 66, 60, 63, 59, 62, 62,
+    62, 59, 61, 64, 58, 55, 69, 58, 49, 57, 67, 60, 54, 49, 56, 64,
+    61, 61, 50, 68, 62, 53, 54, 50, 59, 67, 66, 51, 64, 57, 53, 60,
+    60, 64, 56, 56, 54, 52, 52, 61, 62, 55, 64, 60, 68, 56, 57, 64,
+    61, 60, 64, 57, 55, 57, 52, 53, 59, 60, 74, 49, 65, 59, 61, 65,
+    73, 62, 51, 54, 63, 55, 60, 60, 61, 66, 49, 54, 63, 56, 56, 58,
+    66, 63, 67, 52, 55, 61, 63, 63, 58, 63, 56, 64, 53, 63, 63, 44,
+    51, 66, 49, 61, 58, 57, 43, 61, 53, 64, 54, 57, 51, 58, 64, 69,
+    58, 69, 60, 60, 65, 63, 56, 57, 60, 65, 62, 61, 55, 59, 56, 61,
+    40, 67, 60, 54, 54, 55, 70, 56, 62, 62, 50, 68, 64, 62, 58, 58,
+    54, 62, 62, 62, 47, 67, 57, 53, 63, 57, 56, 49, 61, 57, 63, 61,
+    61, 55, 54, 66, 54, 67, 46, 58, 60, 61, 61, 56, 59, 56, 60, 54,
+    55, 63, 57, 59, 62, 62, 58, 61, 50, 68, 55, 50, 56, 58, 62, 67,
+    63, 56, 54, 56, 67, 65, 63, 60, 57, 60, 54, 62, 62, 64, 59, 65,
+    62, 60, 57, 59, 67, 56, 64, 56, 53, 66, 73, 64, 61, 60, 54, 66,
+    67, 57, 62, 62, 56, 56, 70, 57, 63, 66, 50, 56, 67, 58, 54, 60,
+    58, 63, 60, 65, 54, 56, 62, 59, 67, 62, 45, 55, 64, 49, 67, 56,
+    58, 59, 60, 70, 57, 50, 58, 62, 48, 69, 54, 65, 69, 46, 57, 70,
+    60, 57, 54, 61, 55, 58, 45, 71, 52, 52, 61, 73, 58, 59, 72, 62,
+    49, 62, 65, 51, 59, 58, 51, 54, 62, 62, 52, 67, 52, 54, 67, 66,
+    62, 53, 57, 60, 59, 65, 60, 61, 59, 50, 61, 58, 63, 58, 57, 59,
+    66, 53, 62, 59, 68, 51, 66, 59, 58, 62, 55, 66, 62, 63, 58, 60,
+    66, 53, 55, 59, 56, 59, 62, 63, 57, 58, 63, 48, 49, 57, 55, 67,
+    65, 62, 68, 65, 53, 58, 62, 59, 53, 57, 55, 61, 59, 53, 49, 58,
+    57, 59, 69, 65, 62, 56, 59, 53, 62, 53, 64, 60, 59, 58, 56, 67,
+    58, 53, 59, 62, 71, 58, 68, 53, 56, 51, 65, 70, 71, 64, 51, 68,
+    73, 54, 53, 70, 56, 58, 58, 57, 69, 62, 56, 65, 61, 54, 60, 61,
+    68, 50, 58, 60, 68, 57, 70, 50, 70, 66, 55, 55, 59, 69, 59, 45,
+    54, 72, 53, 58, 52, 61, 65, 63, 53, 60, 54, 71, 56, 50, 50, 57,
+    54, 52, 54, 61, 54, 63, 59, 65, 52, 61, 47, 61, 57, 53, 62, 65,
+    62, 57, 62, 52, 56, 57, 57, 58, 59, 64, 63, 58, 64, 57, 52, 51,
+    73, 59, 59, 59, 59, 65, 53, 57, 59, 59, 57, 69, 60, 57, 60, 55,
+    62, 50, 62, 58, 56, 60, 62, 71, 64, 50, 51, 58, 59, 59, 65, 55,
+    58, 56, 60, 55, 60, 58, 65, 56, 67, 62, 55, 68, 65, 60, 63, 53,
+    56, 58, 61, 59, 60, 59, 53, 63, 62, 61, 61, 68, 55, 57, 65, 57,
+    58, 50, 56, 57, 65, 71, 56, 70, 59, 67, 59, 60, 61, 53, 47, 54,
+    68, 55, 57, 60, 64, 61, 55, 58, 64, 61, 49, 70, 53, 67, 58, 60,
+    53, 63, 62, 46, 63, 57, 59, 56, 66, 51, 64, 53, 65, 51, 56, 59,
+    53, 56, 64, 58, 52, 58, 60, 61, 64, 65, 57, 63, 59, 62, 54, 59,
+    58, 52, 65, 63, 52, 63, 63, 69, 62, 51, 64, 61, 65, 62, 56, 56,
+    61, 59, 60, 61, 59, 61, 49, 53, 60, 67, 65, 64, 47, 65, 58, 60,
+    61, 70, 50, 57, 62, 57, 57, 59, 64, 64, 52, 65, 65, 64, 60, 50,
+    57, 62, 67, 57, 60, 58, 50, 63, 55, 57, 67, 61, 59, 59, 50, 62,
+    66, 54, 55, 65, 54, 64, 60, 56, 53, 70, 71, 53, 60, 72, 51, 59,
+    61, 63, 59, 65, 50, 65, 64, 66, 51, 53, 54, 52, 57, 57, 58, 62,
+    54, 59, 60, 75, 64, 61, 55, 61, 60, 55, 56, 54, 54, 61, 59, 57,
+    60, 69, 74, 61, 57, 59, 59, 60, 54, 56, 64, 59, 59, 65, 55, 60,
+    66, 63, 52, 65, 54, 60, 58, 56, 54, 51, 53, 61, 53, 59, 58, 69,
+    58, 59, 65, 55, 68, 56, 53, 63, 53, 58, 60, 55, 67, 61, 65, 55,
+    64, 53, 67, 62, 63, 48, 58, 53, 63, 57, 60, 62, 63, 55, 64, 64,
+    56, 56, 56, 56, 72, 56, 66, 57, 61, 57, 53, 65, 62, 51, 64, 61,
+    53, 63, 48, 75, 53, 63, 54, 67, 47, 62, 58, 57, 61, 65, 60, 57,
+    67, 61, 53, 62, 62, 66, 48, 56, 54, 62, 60, 57, 67, 60, 70, 61,
+    64, 63, 49, 61, 52, 59, 57, 60, 53, 54, 62, 49, 59, 59, 67, 66,
+    58, 60, 62, 52, 62, 58, 60, 55, 63, 58, 66, 67, 58, 56, 56, 72,
+    53, 55, 69, 54, 72, 58, 52, 65, 51, 68, 46, 71, 61, 64, 61, 62,
+    64, 62, 65, 57, 57, 58, 64, 68, 54, 69, 63, 69, 53, 55, 63, 69,
+    56, 48, 55, 57, 54, 65, 69, 54, 63, 57, 54, 54, 55, 53, 55, 67,
+    64, 54, 56, 72, 57, 54, 57, 49, 64, 54, 59, 62, 55, 60, 65, 52,
+    55, 65, 62, 64, 64, 65, 58, 59, 58, 57, 52, 47, 63, 63, 61, 61,
+    65, 57, 56, 60, 60, 60, 60, 44, 66, 55, 61, 62, 66, 62, 58, 56,
+    56, 50, 61, 58, 63, 64, 68, 61, 57, 61, 59, 54, 65, 62, 65, 60,
+    62, 65, 61, 58, 61, 60, 65, 59, 53, 59, 57, 75, 62, 57, 59, 66,
+    66, 54, 58, 68, 60, 50, 53, 58, 49, 60, 61, 65, 55, 60, 57, 55,
+    55, 51, 61, 60, 57, 55, 64, 60, 70, 57, 48, 61, 57, 54, 51, 50,
+    59, 58, 67, 53, 54, 66, 48, 53, 53, 62, 53, 55, 54, 67, 61, 60,
+    60, 54, 64, 55, 61, 60, 52, 62, 52, 63, 64, 46, 51, 65, 53, 63,
+    67, 52, 66, 63, 59, 52, 62, 54, 58, 61, 63, 55, 62, 54, 65, 52,
+    66, 60, 63, 57, 55, 61, 55, 58, 65, 60, 60, 52, 50, 65, 62, 71,
+    60, 58, 57, 56, 57, 61, 58, 55, 51, 65, 56, 59, 64, 50, 57, 58,
+    56, 69, 54, 60, 62, 61, 58, 62, 62, 55, 61, 60, 59, 59, 58, 59,
+    57, 58, 56, 65, 55, 63, 65, 62, 59, 61, 47, 56, 55, 65, 62, 51,
+    56, 62, 49, 51, 55, 69, 56, 50, 53, 66, 53, 60, 61, 66, 56, 59,
+    58, 59, 49, 63, 67, 62, 58, 50, 51, 53, 56, 63, 58, 58, 56, 69,
+    54, 57, 63, 59, 60, 57, 57, 49, 53, 52, 66, 65, 57, 66, 51, 62,
+    58, 60, 63, 57, 48, 69, 57, 52, 59, 60, 68, 56, 70, 58, 57, 61,
+    57, 47, 55, 64, 61, 63, 58, 59, 64, 58, 57, 55, 57, 65, 62, 50,
+    65, 59, 57, 56, 69, 58, 53, 64, 59, 62, 55, 54, 53, 51, 60, 52,
+    67, 64, 58, 57, 57, 71, 42, 60, 65, 65, 55, 62, 67, 56, 57, 63,
+    61, 54, 54, 68, 58, 58, 55, 56, 65, 64, 55, 67, 67, 58, 63, 61,
+    56, 65, 66, 66, 59, 50, 57, 62, 51, 67, 56, 55, 57, 53, 54, 56,
+    58, 54, 64, 69, 52, 53, 58, 56, 58, 51, 58, 62, 58, 59, 56, 62,
+    60, 64, 56, 56, 52, 53, 71, 54, 57, 63, 57, 57, 57, 60, 62, 55,
+    57, 63, 62, 55, 64, 71, 61, 58, 58, 48, 56, 60, 53, 71, 58, 62,
+    56, 60, 53, 58, 45, 62, 61, 59, 60, 51, 60, 58, 52, 66, 67, 60,
+    68, 55, 51, 64, 51, 65, 62, 50, 63, 64, 59, 65, 58, 52, 52, 54,
+    75, 54, 64, 59, 67, 55, 60, 54, 55, 59, 59, 59, 59, 51, 56, 58,
+    68, 50, 58, 58, 55, 58, 62, 63, 43, 58, 50, 59, 62, 64, 64, 57,
+    59, 56, 53, 56, 64, 61, 60, 57, 63, 64, 60, 56, 60, 61, 57, 60,
+    56, 64, 62, 61, 57, 62, 61, 57, 62, 44, 58, 59, 56, 67, 65, 58,
+    66, 52, 53, 66, 61, 60, 69, 58, 56, 54, 52, 59, 64, 59, 53, 62,
+    59, 64, 60, 53, 63, 56, 63, 56, 58, 59, 66, 55, 52, 56, 60, 53,
+    58, 64, 68, 59, 65, 62, 52, 56, 70, 53, 59, 70, 50, 70, 52, 62,
+    54, 61, 57, 65, 61, 58, 64, 64, 58, 70, 60, 55, 50, 63, 55, 61,
+    60, 61, 65, 55, 59, 57, 61, 66, 61, 49, 70, 56, 55, 68, 59, 57,
+    58, 59, 58, 62, 55, 58, 60, 60, 74, 55, 66, 63, 56, 52, 63, 62,
+    56, 58, 51, 59, 56, 64, 65, 68, 51, 60, 69, 61, 58, 58, 53, 60,
+    65, 63, 51, 55, 68, 60, 62, 52, 54, 56, 58, 54, 66, 53, 69, 49,
+    55, 70, 47, 58, 60, 56, 60, 67, 58, 54, 67, 63, 63, 59, 71, 61,
+    64, 60, 63, 62, 57, 54, 61, 63, 55, 61, 58, 57, 60, 49, 56, 52,
+    55, 60, 51, 55, 65, 54, 55, 54, 55, 65, 65, 62, 61, 52, 56, 57,
+    50, 61, 61, 57, 68, 65, 50, 71, 62, 54, 61, 55, 63, 51, 51, 67,
+    50, 50, 63, 65, 72, 56, 76, 60, 64, 59, 47, 49, 64, 58, 63, 59,
+    54, 66, 55, 65, 68, 56, 58, 66, 67, 58, 64, 64, 49, 62, 53, 60,
+    61, 61, 62, 57, 71, 60, 51, 61, 63, 57, 57, 61, 55, 61, 57, 59,
+    56, 61, 53, 65, 52, 52, 60, 61, 60, 64, 63, 58, 58, 66, 60, 64,
+    59, 58, 63, 57, 61, 53, 57, 60, 64, 55, 57, 59, 61, 55, 67, 54,
+    61, 61, 56, 57, 58, 61, 61, 61, 60, 61, 61, 51, 56, 59, 59, 56,
+    55, 55, 59, 66, 59, 48, 52, 61, 62, 63, 65, 62, 60, 55, 57, 55,
+    53, 67, 57, 54, 63, 67, 52, 55, 56, 60, 61, 59, 55, 58, 49, 57,
+    60, 62, 57, 60, 60, 58, 53, 66, 55, 59, 61, 67, 59, 59, 51, 62,
+    50, 57, 57, 55, 71, 52, 60, 68, 52, 58, 51, 57, 64, 50, 59, 60,
+    62, 57, 56, 71, 55, 51, 64, 57, 66, 67, 59, 64, 58, 74, 54, 62,
+    61, 61, 58, 60, 62, 55, 62, 58, 65, 56, 64, 49, 60, 60, 59, 62,
+    62, 54, 68, 53, 62, 53, 59, 62, 49, 59, 64, 55, 66, 56, 55, 64,
+    62, 58, 65, 57, 65, 52, 58, 65, 56, 63, 53, 65, 51, 60, 70, 59,
+    64, 53, 59, 62, 66, 57, 57, 55, 51, 63, 64, 58, 51, 61, 61, 62,
+    52, 62, 66, 65, 67, 58, 64, 56, 50, 64, 52, 58, 59, 56, 74, 53,
+    59, 59, 59, 48, 63, 64, 54, 57, 55, 69, 46, 60, 64, 63, 60, 56,
+    56, 48, 63, 56, 60, 63, 64, 59, 65, 52, 51, 54, 65, 56, 59, 66,
+    59, 60, 51, 55, 58, 61, 64, 57, 66, 59, 62, 60, 55, 50, 63, 56,
+    63, 56, 56, 59, 60, 67, 55, 67, 54, 53, 61, 52, 53, 60, 61, 58,
+    51, 69, 69, 64, 50, 61, 58, 58, 55, 69, 65, 66, 58, 51, 68, 71,
+    65, 55, 63, 56, 55, 60, 58, 64, 62, 58, 60, 64, 54, 63, 57, 57,
+    68, 67, 51, 61, 56, 62, 62, 60, 62, 55, 58, 59, 53, 57, 58, 60,
+    51, 68, 62, 59, 57, 57, 59, 55, 60, 67, 62, 58, 66, 51, 61, 64,
+    57, 60, 58, 56, 57, 56, 58, 53, 61, 49, 65, 57, 68, 50, 56, 66,
+    66, 65, 58, 61, 55, 65, 60, 59, 53, 58, 57, 51, 52, 57, 63, 56,
+    63, 59, 51, 57, 53, 51, 60, 60, 61, 60, 67, 58, 54, 59, 60, 63,
+    59, 59, 51, 62, 66, 57, 60, 67, 58, 60, 48, 61, 58, 61, 53, 61,
+    55, 60, 59, 47, 50, 62, 64, 53, 51, 68, 57, 58, 62, 46, 70, 64,
+    59, 65, 60, 66, 46, 55, 66, 60, 57, 57, 50, 63, 57, 59, 64, 64,
+    51, 58, 62, 68, 48, 67, 63, 71, 55, 64, 65, 57, 58, 76, 70, 60,
+    58, 62, 58, 57, 62, 56, 61, 58, 44, 54, 60, 59, 64, 58, 53, 61,
+    53, 57, 57, 56, 57, 47, 63, 60, 50, 57, 56, 55, 58, 60, 57, 63,
+    58, 66, 60, 61, 52, 60, 56, 55, 49, 56, 58, 61, 59, 69, 61, 52,
+    61, 58, 65, 58, 58, 60, 58, 61, 64, 64, 49, 53, 59, 52, 60, 52,
+    69, 64, 59, 63, 54, 54, 53, 68, 54, 58, 72, 47, 61, 53, 56, 61,
+    63, 57, 62, 52, 66, 56, 65, 63, 48, 59, 62, 62, 56, 67, 57, 65,
+    52, 70, 54, 56, 65, 61, 54, 70, 71, 52, 51, 65, 56, 66, 60, 66,
+    61, 60, 65, 64, 51, 60, 55, 55, 66, 54, 49, 57, 50, 64, 67, 54,
+    59, 62, 62, 61, 58, 61, 66, 57, 58, 60, 63, 57, 65, 69, 58, 66,
+    57, 56, 60, 53, 53, 64, 57, 71, 53, 55, 66, 59, 64, 58, 55, 62,
+    54, 57, 53, 57, 52, 67, 62, 57, 53, 57, 53, 61, 56, 68, 67, 53,
+    53, 63, 49, 60, 64, 51, 72, 62, 68, 65, 61, 48, 60, 68, 57, 68,
+    60, 60, 50, 53, 58, 59, 67, 55, 68, 61, 59, 65, 59, 63, 62, 54,
+    60, 53, 62, 52, 55, 53, 60, 59, 58, 53, 48, 56, 60, 49, 57, 57,
+    60, 61, 57, 52, 54, 59, 64, 58, 48, 61, 61, 51, 65, 57, 64, 58,
+    68, 48, 65, 58, 57, 58, 53, 57, 57, 58, 52, 69, 55, 57, 52, 70,
+    66, 55, 53, 55, 54, 56, 61, 70, 53, 61, 66, 52, 54, 59, 65, 60,
+    65, 55, 70, 60, 65, 52, 59, 65, 54, 51, 52, 63, 58, 63, 62, 63,
+    65, 70, 52, 53, 60, 55, 65, 61, 59, 68, 57, 62, 66, 56, 63, 59,
+    55, 62, 70, 64, 51, 61, 49, 57, 60, 62, 68, 51, 63, 55, 47, 57,
+    59, 60, 51, 60, 54, 56, 51, 71, 73, 52, 65, 58, 58, 61, 50, 58,
+    56, 56, 52, 69, 56, 59, 55, 62, 54, 58, 56, 60, 56, 58, 59, 55,
+    55, 66, 61, 57, 57, 55, 65, 64, 60, 62, 59, 63, 49, 63, 57, 65,
+    56, 63, 62, 55, 69, 59, 59, 51, 64, 53, 58, 61, 65, 71, 58, 51,
+    59, 60, 63, 52, 58, 67, 51, 56, 54, 65, 62, 57, 55, 55, 54, 58,
+    63, 61, 63, 60, 61, 52, 50, 60, 62, 66, 61, 61, 58, 51, 60, 55,
+    54, 47, 54, 60, 50, 66, 61, 61, 63, 60, 63, 60, 54, 65, 63, 66,
+    55, 63, 56, 53, 65, 63, 50, 56, 61, 52, 61, 63, 63, 56, 60, 61,
+    62, 50, 59, 61, 58, 63, 57, 62, 59, 60, 59, 67, 65, 50, 57, 71,
+    54, 57, 51, 64, 55, 53, 56, 60, 60, 59, 59, 61, 50, 63, 51, 56,
+    61, 54, 65, 65, 66, 61, 51, 58, 61, 55, 63, 68, 65, 52, 56, 60,
+    70, 66, 51, 64, 57, 57, 58, 60, 52, 65, 54, 64, 65, 61, 63, 53,
+    50, 58, 57, 62, 52, 59, 65, 62, 56, 58, 58, 59, 56, 52, 61, 61,
+    68, 56, 61, 61, 54, 59, 56, 60, 51, 71, 56, 54, 54, 58, 55, 59,
+    52, 64, 59, 52, 60, 59, 54, 52, 61, 60, 63, 57, 60, 56, 58, 60,
+    66, 52, 62, 53, 53, 60, 58, 57, 61, 58, 56, 59, 57, 55, 55, 61,
+    56, 68, 62, 61, 65, 50, 56, 54, 53, 49, 75, 66, 55, 60, 61, 63,
+    59, 57, 51, 68, 64, 57, 61, 52, 63, 58, 56, 55, 61, 58, 68, 55,
+    60, 55, 65, 68, 51, 66, 60, 53, 63, 55, 57, 58, 65, 51, 54, 57,
+    64, 61, 54, 64, 60, 49, 59, 58, 64, 51, 60, 59, 58, 67, 58, 57,
+    56, 62, 53, 57, 54, 66, 54, 56, 60, 63, 58, 65, 60, 66, 57, 69,
+    69, 55, 55, 49, 63, 51, 58, 59, 51, 52, 62, 52, 46, 59, 67, 58,
+    67, 61, 61, 54, 55, 56, 63, 50, 47, 53, 61, 55, 60, 55, 59, 56,
+    68, 62, 50, 60, 44, 73, 59, 66, 65, 54, 66, 56, 49, 62, 69, 55,
+    62, 56, 55, 63, 50, 61, 65, 60, 54, 63, 51, 66, 68, 60, 58, 52,
+    72, 62, 59, 59, 49, 62, 55, 61, 62, 62, 52, 64, 51, 63, 61, 61,
+    63, 57, 69, 62, 67, 61, 66, 53, 65, 62, 61, 64, 58, 52, 56, 54,
+    54, 57, 58, 62, 49, 65, 59, 55, 62, 65, 57, 63, 57, 56, 56, 52,
+    58, 65, 65, 59, 55, 65, 63, 55, 57, 54, 63, 67, 49, 61, 54, 50,
+    53, 54, 69, 60, 58, 59, 53, 53, 60, 49, 56, 63, 69, 53, 59, 65,
+    60, 57, 52, 70, 53, 60, 54, 59, 59, 61, 56, 62, 44, 63, 67, 60,
+    62, 61, 55, 57, 53, 70, 54, 62, 62, 64, 66, 53, 58, 54, 66, 62,
+    63, 52, 61, 65, 66, 58, 59, 65, 52, 69, 55, 56, 59, 61, 57, 51,
+    53, 64, 56, 57, 66, 60, 62, 52, 62, 60, 58, 55, 59, 55, 65, 61,
+    49, 51, 58, 52, 65, 68, 62, 65, 70, 57, 54, 66, 46, 57, 52, 58,
+    64, 54, 63, 63, 55, 68, 53, 64, 58, 59, 64, 65, 58, 62, 53, 58,
+    58, 57, 58, 65, 57, 51, 60, 61, 69, 50, 64, 54, 64, 68, 51, 59,
+    51, 48, 66, 66, 55, 64, 62, 56, 59, 62, 52, 56, 45, 57, 65, 56,
+    54, 55, 53, 57, 60, 54, 72, 61, 67, 47, 46, 64, 65, 55, 63, 56,
+    59, 65, 61, 60, 62, 54, 53, 58, 48, 53, 58, 54, 57, 63, 51, 54,
+    56, 64, 60, 59, 62, 66, 61, 49, 66, 64, 57, 53, 50, 55, 61, 76,
+    66, 59, 54, 67, 61, 57, 60, 56, 63, 59, 64, 63, 63, 62, 65, 58,
+    60, 62, 59, 58, 62, 68, 57, 53, 57, 64, 50, 62, 54, 52, 57, 61,
+    54, 58, 66, 59, 66, 56, 54, 51, 59, 74, 55, 57, 62, 48, 73, 63,
+    63, 59, 55, 54, 59, 62, 52, 55, 64, 58, 56, 50, 58, 65, 52, 67,
+    52, 57, 54, 65, 60, 61, 61, 58, 59, 67, 56, 67, 49, 60, 51, 63,
+    56, 68, 56, 64, 68, 68, 44, 69, 59, 68, 53, 61, 58, 57, 65, 60,
+    59, 57, 52, 51, 58, 66, 49, 60, 58, 67, 58, 54, 67, 57, 72, 54,
+    55, 60, 63, 63, 67, 55, 49, 52, 50, 59, 57, 65, 64, 55, 62, 58,
+    58, 61, 54, 64, 65, 59, 63, 59, 59, 70, 54, 54, 71, 63, 57, 57,
+    65, 67, 52, 52, 73, 44, 60, 55, 57, 56, 64, 63, 63, 50, 63, 69,
+    55, 70, 58, 54, 60, 57, 59, 60, 60, 50, 65, 54, 57, 66, 63, 45,
+    55, 62, 58, 56, 61, 54, 56, 66, 55, 66, 61, 55, 59, 57, 56, 68,
+    55, 59, 61, 64, 55, 56, 52, 60, 60, 47, 61, 59, 61, 64, 58, 51,
+    68, 56, 71, 57, 63, 62, 54, 61, 57, 54, 60, 64, 63, 52, 61, 52,
+    51, 55, 57, 63, 60, 66, 52, 59, 54, 58, 64, 67, 61, 62, 54, 66,
+    55, 55, 63, 55, 65, 57, 70, 48, 66, 57, 62, 55, 61, 54, 66, 59,
+    57, 61, 58, 63, 59, 59, 64, 60, 55, 60, 54, 59, 63, 62, 68, 56,
+    63, 60, 55, 54, 49, 59, 59, 55, 61, 61, 53, 56, 60, 61, 65, 64,
+    54, 53, 52, 57, 77, 54, 57, 49, 55, 57, 64, 50, 64, 60, 48, 69,
+    54, 61, 52, 60, 59, 54, 59, 54, 51, 57, 51, 56, 58, 58, 63, 61,
+    58, 64, 56, 65, 49, 53, 57, 52, 60, 71, 49, 68, 71, 60, 66, 49,
+    61, 59, 55, 61, 63, 61, 60, 70, 58, 46, 64, 55, 56, 53, 58, 66,
+    55, 52, 57, 61, 70, 54, 50, 64, 68, 54, 61, 68, 60, 56, 58, 57,
+    58, 54, 64, 53, 60, 58, 55, 54, 65, 58, 59, 62, 65, 58, 58, 61,
+    53, 58, 61, 62, 54, 58, 67, 59, 52, 63, 65, 67, 50, 53, 57, 74,
+    58, 46, 68, 57, 65, 63, 62, 60, 61, 58, 61, 56, 46, 61, 49, 58,
+    60, 59, 58, 62, 63, 57, 52, 52, 57, 59, 67, 54, 62, 60, 64, 65,
+    63, 61, 61, 51, 51, 60, 54, 57, 63, 57, 63, 50, 59, 55, 64, 55,
+    62, 53, 59, 59, 60, 58, 55, 65, 48, 70, 60, 58, 44, 52, 56, 56,
+    55, 58, 76, 53, 52, 61, 70, 55, 60, 48, 59, 67, 53, 56, 64, 61,
+    63, 68, 59, 56, 64, 60, 60, 57, 56, 47, 61, 57, 54, 61, 60, 59,
+    60, 56, 61, 64, 55, 60, 58, 61, 51, 53, 49, 60, 62, 55, 64, 64,
+    65, 58, 57, 58, 58, 60, 46, 63, 62, 56, 65, 63, 55, 69, 61, 62,
+    54, 62, 64, 65, 58, 58, 65, 62, 54, 63, 58, 70, 55, 64, 65, 60,
+    68, 57, 57, 58, 54, 57, 60, 67, 52, 61, 55, 59, 58, 64, 58, 49,
+    62, 59, 57, 66, 65, 61, 59, 50, 68, 64, 59, 61, 57, 54, 58, 50,
+    72, 64, 65, 60, 52, 58, 67, 59, 62, 58, 54, 55, 60, 60, 46, 56,
+    50, 60, 57, 56, 53, 56, 66, 59, 60, 57, 64, 57, 59, 55, 66, 52,
+    62, 57, 71, 55, 58, 65, 47, 47, 57, 60, 56, 56, 63, 54, 68, 65,
+    58, 64, 59, 69, 63, 65, 63, 60, 59, 62, 53, 64, 56, 63, 56, 55,
+    47, 60, 68, 59, 44, 64, 58, 66, 60, 70, 48, 53, 49, 60, 55, 54,
+    54, 55, 57, 63, 49, 60, 58, 60, 60, 72, 60, 57, 64, 63, 57, 58,
+    53, 62, 53, 59, 56, 51, 62, 48, 60, 61, 49, 60, 64, 57, 48, 56,
+    57, 64, 51, 53, 62, 65, 60, 56, 61, 63, 53, 49, 53, 64, 55, 61,
+    55, 59, 64, 56, 54, 66, 61, 64, 65, 70, 52, 63, 65, 50, 54, 59,
+    63, 59, 56, 57, 65, 54, 56, 67, 67, 59, 63, 61, 58, 56, 65, 48,
+    49, 55, 60, 59, 59, 52, 64, 59, 55, 64, 62, 65, 54, 52, 58, 58,
+    62, 62, 56, 59, 61, 51, 59, 55, 59, 65, 52, 67, 53, 62, 62, 66,
+    53, 55, 52, 54, 51, 63, 48, 45, 63, 74, 57, 58, 53, 57, 55, 63,
+    63, 56, 59, 49, 59, 56, 64, 59, 55, 55, 56, 68, 58, 58, 49, 54,
+    70, 60, 61, 53, 58, 50, 55, 54, 67, 72, 53, 60, 66, 52, 58, 65,
+    60, 65, 51, 59, 62, 63, 56, 67, 52, 65, 58, 63, 61, 58, 67, 62,
+    61, 58, 72, 56, 50, 57, 57, 60, 49, 64, 49, 57, 64, 55, 55, 70,
+    54, 63, 58, 53, 61, 50, 46, 61, 67, 68, 55, 56, 69, 64, 60, 50,
+    66, 58, 58, 64, 73, 52, 61, 58, 46, 70, 58, 57, 57, 60, 59, 55,
+    58, 59, 60, 61, 53, 48, 58, 55, 50, 54, 64, 59, 60, 56, 55, 52,
+    52, 64, 63, 56, 46, 64, 56, 58, 60, 56, 67, 52, 62, 55, 66, 65,
+    61, 57, 56, 66, 62, 52, 62, 66, 58, 55, 59, 62, 54, 61, 49, 63,
+    62, 57, 63, 62, 59, 64, 55, 54, 68, 60, 60, 62, 59, 60, 60, 64,
+    50, 60, 55, 50, 66, 54, 63, 54, 56, 64, 60, 56, 60, 69, 58, 56,
+    63, 64, 61, 59, 60, 57, 66, 64, 63, 59, 61, 59, 59, 65, 57, 65,
+    54, 58, 64, 55, 56, 55, 59, 56, 58, 58, 63, 65, 56, 53, 58, 54,
+    61, 58, 51, 56, 53, 59, 49, 49, 62, 57, 65, 58, 54, 58, 46, 54,
+    56, 53, 61, 58, 60, 52, 52, 58, 62, 56, 71, 62, 66, 54, 45, 63,
+    56, 65, 52, 72, 65, 52, 57, 65, 52, 49, 64, 60, 50, 58, 55, 62,
+    74, 60, 54, 63, 61, 56, 60, 54, 65, 57, 49, 54, 51, 60, 59, 60,
+    62, 54, 54, 60, 51, 56, 52, 57, 62, 65, 54, 55, 65, 64, 57, 50,
+    55, 52, 65, 58, 51, 61, 56, 59, 58, 67, 58, 52, 60, 48, 66, 52,
+    58, 51, 51, 62, 55, 57, 62, 58, 44, 67, 60, 59, 63, 55, 55, 50,
+    50, 67, 52, 61, 50, 57, 63, 60, 60, 60, 66, 57, 63, 61, 58, 59,
+    59, 58, 46, 61, 56, 66, 62, 70, 64, 62, 54, 71, 59, 66, 52, 54,
+    55, 52, 55, 55, 62, 52, 58, 64, 59, 53, 55, 62, 51, 55, 53, 53,
+    58, 64, 65, 62, 59, 62, 67, 59, 62, 60, 57, 66, 58, 56, 49, 61,
+    61, 56, 64, 58, 60, 59, 65, 58, 63, 55, 50, 62, 57, 64, 64, 58,
+    55, 59, 56, 56, 56, 70, 60, 62, 60, 66, 52, 51, 68, 57, 57, 64,
+    60, 51, 52, 48, 52, 66, 57, 58, 53, 58, 55, 55, 60, 59, 58, 55,
+    56, 65, 60, 53, 62, 52, 57, 55, 51, 58, 65, 59, 64, 52, 61, 62,
+    56, 60, 62, 65, 55, 60, 64, 57, 59, 59, 53, 51, 62, 66, 65, 62,
+    62, 62, 58, 54, 64, 60, 61, 60, 58, 59, 57, 54, 54, 55, 61, 67,
+    68, 48, 51, 53, 54, 61, 59, 62, 52, 58, 67, 58, 56, 54, 44, 59,
+    58, 66, 62, 47, 50, 59, 71, 61, 55, 52, 64, 56, 54, 54, 65, 55,
+    65, 48, 63, 56, 68, 63, 57, 58, 58, 61, 57, 64, 62, 58, 66, 69,
+    51, 58, 62, 56, 61, 62, 60, 57, 66, 59, 68, 62, 64, 58, 57, 58,
+    61, 64, 61, 50, 54, 61, 72, 57, 51, 58, 54, 54, 56, 70, 57, 52,
+    55, 55, 62, 55, 58, 68, 60, 52, 54, 61, 51, 60, 59, 55, 47, 58,
+    51, 67, 57, 56, 52, 64, 55, 62, 59, 47, 61, 55, 62, 52, 56, 62,
+    57, 65, 61, 64, 63, 59, 55, 69, 55, 64, 56, 67, 57, 53, 64, 57,
+    61, 66, 57, 56, 63, 66, 54, 63, 56, 56, 59, 65, 58, 58, 62, 56,
+    52, 45, 66, 68, 56, 53, 59, 62, 55, 61, 47, 62, 60, 61, 57, 56,
+    52, 54, 65, 54, 57, 64, 64, 72, 56, 58, 59, 64, 54, 59, 63, 52,
+    68, 57, 64, 66, 58, 58, 53, 54, 60, 50, 67, 58, 61, 65, 56, 51,
+    62, 58, 54, 56, 50, 67, 60, 56, 55, 49, 51, 74, 63, 57, 64, 58,
+    50, 54, 57, 55, 54, 59, 62, 62, 61, 63, 59, 55, 59, 50, 65, 55,
+    54, 59, 71, 68, 70, 58, 58, 60, 61, 53, 65, 60, 57, 59, 59, 58,
+    55, 57, 63, 68, 61, 61, 57, 52, 40, 57, 64, 50, 56, 64, 55, 49,
+    47, 64, 61, 54, 52, 62, 48, 64, 52, 46, 57, 66, 49, 73, 55, 57,
+    60, 71, 53, 70, 64, 57, 68, 59, 57, 56, 56, 47, 53, 58, 60, 63,
+    55, 63, 58, 59, 60, 61, 61, 58, 60, 70, 49, 54, 65, 62, 59, 64,
+    62, 62, 54, 65, 59, 60, 60, 61, 71, 56, 57, 50, 55, 60, 51, 59,
+    54, 54, 61, 56, 48, 55, 53, 66, 62, 60, 66, 67, 57, 56, 60, 59,
+    52, 59, 58, 58, 69, 54, 60, 63, 57, 55, 62, 59, 65, 62, 69, 54,
+    52, 60, 54, 62, 59, 64, 59, 54, 66, 62, 61, 61, 51, 59, 50, 59,
+    62, 53, 59, 51, 61, 58, 62, 60, 55, 58, 73, 50, 53, 61, 67, 48,
+    65, 64, 58, 59, 61, 56, 49, 68, 53, 56, 73, 59, 57, 56, 63, 61,
+    60, 59, 59, 66, 58, 59, 59, 58, 69, 62, 54, 66, 43, 46, 58, 55,
+    72, 64, 65, 57, 54, 63, 52, 63, 63, 59, 57, 54, 66, 52, 69, 65,
+    65, 51, 67, 60, 46, 58, 77, 51, 55, 60, 56, 54, 59, 57, 57, 59,
+    58, 57, 63, 49, 50, 64, 58, 64, 60, 55, 67, 55, 58, 55, 63, 64,
+    53, 52, 48, 58, 61, 60, 58, 52, 61, 54, 63, 61, 57, 69, 67, 58,
+    74, 52, 58, 54, 64, 63, 50, 54, 63, 57, 58, 58, 58, 62, 44, 54,
+    65, 52, 50, 62, 58, 56, 57, 70, 57, 55, 67, 62, 54, 51, 67, 61,
+    55, 58, 53, 63, 68, 51, 66, 62, 53, 66, 54, 56, 67, 71, 55, 66,
+    54, 58, 62, 59, 61, 51, 55, 62, 56, 55, 62, 55, 50, 56, 64, 51,
+    54, 59, 64, 54, 58, 57, 52, 48, 59, 60, 60, 60, 55, 55, 66, 55,
+    63, 57, 66, 60, 60, 64, 59, 59, 63, 62, 58, 54, 63, 60, 65, 60,
+    63, 49, 47, 67, 70, 62, 61, 65, 66, 56, 53, 52, 63, 52, 49, 58,
+    68, 56, 60, 57, 57, 63, 58, 50, 56, 55, 55, 64, 62, 52, 55, 65,
+    57, 59, 53, 53, 66, 66, 54, 51, 49, 67, 61, 61, 56, 50, 66, 64,
+    55, 58, 56, 58, 58, 66, 49, 73, 63, 63, 56, 55, 57, 63, 59, 45,
+    61, 56, 63, 55, 58, 56, 59, 61, 59, 63, 62, 64, 51, 60, 63, 63,
+    53, 67, 58, 53, 55, 52, 56, 58, 63, 60, 67, 49, 47, 53, 59, 58,
+    61, 55, 60, 55, 57, 60, 65, 66, 71, 54, 59, 60, 61, 52, 63, 60,
+    58, 69, 49, 55, 62, 68, 52, 46, 56, 57, 58, 51, 50, 58, 67, 58,
+    63, 59, 53, 59, 65, 61, 59, 57, 71, 55, 62, 67, 49, 62, 58, 68,
+    60, 60, 56, 64, 51, 61, 62, 47, 61, 62, 60, 60, 57, 56, 53, 66,
+    51, 58, 58, 57, 59, 63, 58, 56, 55, 66, 49, 58, 57, 60, 66, 62,
+    58, 58, 60, 60, 64, 51, 58, 64, 53, 55, 56, 53, 64, 52, 59, 57,
+    67, 60, 56, 65, 54, 59, 47, 57, 55, 65, 59, 64, 50, 56, 59, 51,
+    61, 55, 62, 44, 56, 58, 64, 57, 58, 66, 53, 58, 54, 63, 61, 58,
+    55, 62, 59, 61, 60, 59, 67, 53, 61, 74, 58, 55, 59, 67, 47, 53,
+    69, 62, 56, 54, 57, 59, 55, 57, 63, 56, 64, 61, 60, 58, 63, 55,
+    56, 59, 48, 46, 53, 63, 56, 44, 47, 50, 63, 64, 53, 53, 67, 63,
+    58, 58, 52, 57, 57, 45, 67, 56, 69, 56, 58, 62, 58, 62, 62, 64,
+    55, 59, 57, 64, 69, 61, 54, 59, 47, 56, 65, 56, 62, 60, 58, 61,
+    59, 53, 56, 60, 55, 61, 53, 58, 64, 64, 59, 69, 55, 56, 60, 56,
+    62, 52, 64, 55, 59, 57, 55, 67, 48, 46, 66, 66, 64, 46, 57, 56,
+    63, 58, 55, 68, 70, 56, 68, 62, 48, 62, 62, 67, 53, 61, 66, 57,
+    57, 61, 43, 53, 54, 59, 59, 52, 57, 60, 52, 62, 56, 64, 52, 66,
+    58, 55, 57, 53, 57, 58, 52, 70, 66, 59, 65, 59, 56, 58, 57, 61,
+    54, 52, 68, 64, 55, 57, 56, 57, 61, 58, 73, 53, 56, 58, 63, 58,
+    66, 52, 53, 54, 68, 52, 52, 60, 71, 57, 60, 53, 58, 72, 61, 56,
+    63, 62, 67, 67, 72, 50, 59, 59, 53, 57, 60, 71, 54, 65, 62, 64,
+    65, 57, 57, 60, 65, 57, 64, 59, 58, 49, 67, 61, 49, 51, 52, 56,
+    66, 53, 66, 50, 56, 54, 54, 52, 53, 59, 52, 51, 54, 61, 58, 58,
+    62, 58, 58, 59, 52, 49, 63, 61, 55, 69, 60, 63, 62, 60, 62, 59,
+    51, 62, 54, 60, 62, 58, 72, 67, 55, 57, 56, 64, 66, 57, 51, 45,
+    54, 49, 64, 66, 66, 51, 60, 66, 58, 65, 54, 62, 58, 47, 67, 59,
+    61, 60, 62, 69, 52, 64, 62, 55, 62, 61, 63, 61, 63, 68, 56, 55,
+    49, 62, 55, 53, 55, 58, 53, 64, 51, 67, 66, 50, 51, 58, 56, 61,
+    63, 62, 58, 65, 53, 66, 59, 53, 67, 62, 57, 55, 63, 55, 65, 55,
+    61, 46, 70, 61, 64, 63, 44, 63, 54, 64, 60, 65, 61, 60, 68, 61,
+    58, 50, 59, 61, 60, 60, 53, 58, 50, 60, 58, 64, 48, 64, 57, 56,
+    57, 56, 55, 46, 62, 65, 60, 68, 58, 58, 63, 64, 54, 59, 58, 64,
+    59, 62, 56, 57, 58, 59, 55, 60, 60, 57, 51, 53, 51, 61, 60, 56,
+    57, 55, 57, 62, 56, 55, 61, 55, 57, 62, 64, 54, 59, 56, 62, 58,
+    55, 66, 57, 57, 64, 59, 59, 57, 65, 53, 59, 59, 48, 65, 58, 64,
+    55, 65, 56, 63, 68, 62, 53, 60, 49, 55, 57, 53, 64, 60, 54, 63,
+    69, 60, 53, 53, 57, 54, 63, 59, 64, 67, 53, 61, 61, 64, 58, 61,
+    58, 42, 52, 55, 69, 62, 62, 47, 70, 61, 62, 60, 58, 64, 65, 48,
+    53, 43, 56, 56, 62, 57, 56, 55, 65, 65, 50, 56, 58, 69, 52, 55,
+    56, 50, 63, 70, 65, 64, 64, 64, 62, 60, 60, 56, 57, 58, 62, 56,
+    55, 50, 56, 55, 56, 56, 57, 58, 50, 55, 59, 57, 53, 56, 66, 56,
+    56, 60, 66, 53, 65, 44, 53, 57, 65, 62, 53, 64, 49, 53, 64, 55,
+    51, 61, 61, 50, 52, 60, 57, 49, 62, 52, 62, 63, 58, 68, 58, 58,
+    64, 69, 60, 51, 56, 64, 53, 51, 49, 48, 61, 61, 59, 61, 54, 60,
+    56, 73, 55, 61, 60, 60, 63, 65, 64, 55, 55, 58, 65, 52, 59, 54,
+    50, 66, 62, 56, 58, 57, 60, 55, 53, 61, 66, 51, 59, 62, 61, 64,
+    63, 50, 69, 57, 54, 49, 67, 56, 50, 58, 60, 49, 57, 48, 60, 54,
+    70, 60, 66, 64, 55, 54, 60, 61, 46, 62, 63, 52, 62, 62, 54, 58,
+    68, 51, 63, 63, 63, 53, 52, 61, 58, 60, 65, 59, 58, 60, 56, 54,
+    54, 61, 60, 60, 61, 60, 56, 68, 56, 58, 63, 51, 67, 59, 60, 53,
+    55, 66, 66, 62, 58, 55, 58, 59, 58, 59, 64, 52, 53, 61, 54, 67,
+    60, 52, 63, 66, 55, 57, 58, 57, 48, 58, 60, 63, 57, 59, 67, 59,
+    62, 60, 57, 53, 63, 53, 57, 72, 57, 62, 61, 46, 61, 57, 55, 59,
+    47, 61, 64, 59, 64, 68, 58, 52, 65, 52, 57, 67, 55, 57, 53, 51,
+    56, 53, 60, 62, 74, 52, 61, 57, 55, 58, 57, 57, 61, 47, 70, 62,
+    64, 66, 59, 66, 50, 71, 59, 54, 59, 57, 59, 49, 59, 54, 68, 60,
+    61, 56, 53, 58, 48, 64, 64, 62, 61, 51, 62, 51, 57, 50, 64, 55,
+    61, 64, 59, 63, 62, 54, 64, 62, 64, 50, 52, 68, 58, 69, 59, 55,
+    58, 60, 51, 61, 54, 59, 54, 56, 62, 62, 60, 53, 61, 54, 63, 60,
+    62, 58, 57, 59, 62, 57, 56, 54, 61, 57, 56, 51, 56, 56, 57, 54,
+    57, 57, 65, 46, 59, 54, 70, 61, 52, 62, 57, 57, 59, 61, 62, 56,
+    63, 60, 56, 55, 62, 64, 56, 60, 57, 54, 61, 53, 63, 59, 64, 62,
+    53, 55, 68, 60, 67, 54, 68, 58, 57, 65, 53, 63, 57, 59, 54, 63,
+    64, 62, 58, 70, 70, 60, 54, 57, 56, 57, 59, 74, 49, 61, 51, 62,
+    58, 52, 48, 58, 53, 69, 53, 60, 54, 61, 53, 65, 52, 65, 62, 52,
+    55, 56, 59, 55, 67, 57, 55, 63, 60, 55, 65, 64, 55, 63, 54, 46,
+    63, 57, 72, 60, 59, 54, 57, 54, 64, 65, 60, 61, 68, 55, 55, 56,
+    58, 64, 70, 46, 60, 64, 62, 56, 57, 63, 63, 48, 53, 56, 61, 55,
+    57, 49, 63, 54, 55, 67, 62, 52, 67, 60, 59, 65, 56, 62, 57, 55,
+    52, 55, 55, 61, 51, 61, 61, 63, 45, 58, 51, 49, 58, 57, 62, 60,
+    62, 54, 71, 56, 59, 59, 59, 49, 58, 49, 52, 62, 60, 57, 65, 62,
+    58, 58, 55, 59, 66, 59, 49, 61, 58, 59, 68, 54, 60, 58, 60, 62,
+    61, 56, 57, 47, 62, 59, 65, 55, 52, 53, 53, 60, 48, 67, 58, 54,
+    61, 55, 70, 60, 58, 55, 60, 61, 53, 56, 65, 47, 58, 53, 58, 64,
+    68, 60, 48, 52, 63, 53, 50, 61, 56, 53, 56, 55, 51, 52, 68, 60,
+    55, 66, 57, 55, 55, 63, 63, 67, 62, 57, 56, 63, 58, 55, 58, 65,
+    56, 52, 50, 58, 60, 55, 69, 59, 59, 66, 53, 53, 48, 60, 63, 51,
+    57, 57, 62, 58, 60, 49, 60, 58, 59, 58, 55, 60, 48, 54, 68, 70,
+    58, 53, 57, 54, 58, 71, 52, 61, 53, 76, 57, 56, 55, 60, 58, 54,
+    54, 65, 55, 52, 65, 58, 67, 54, 52, 58, 61, 62, 59, 66, 60, 59,
+    59, 47, 65, 54, 59, 58, 56, 58, 52, 56, 54, 50, 58, 53, 58, 55,
+    62, 58, 69, 62, 47, 63, 64, 60, 65, 52, 61, 46, 60, 61, 58, 61,
+    62, 63, 53, 63, 60, 64, 65, 67, 46, 50, 69, 57, 55, 58, 59, 61,
+    54, 54, 56, 63, 64, 58, 57, 55, 59, 61, 58, 64, 56, 66, 61, 50,
+    53, 62, 54, 66, 54, 73, 66, 62, 62, 56, 55, 52, 60, 59, 56, 62,
+    68, 66, 61, 60, 55, 57, 61, 62, 48, 56, 48, 58, 60, 63, 53, 59,
+    48, 59, 59, 57, 55, 59, 52, 58, 70, 60, 52, 66, 58, 62, 55, 59,
+    57, 49, 69, 56, 60, 57, 54, 55, 53, 55, 54, 64, 61, 59, 52, 60,
+    57, 57, 66, 61, 52, 54, 60, 53, 65, 52, 52, 48, 55, 57, 63, 58,
+    63, 71, 59, 51, 67, 54, 61, 53, 60, 62, 62, 62, 58, 64, 57, 60,
+    59, 59, 52, 62, 61, 58, 56, 61, 50, 67, 61, 53, 54, 62, 55, 58,
+    54, 61, 59, 68, 61, 52, 66, 56, 61, 55, 64, 53, 64, 55, 65, 56,
+    51, 60, 64, 54, 51, 64, 58, 59, 55, 59, 69, 56, 54, 66, 53, 52,
+    74, 53, 52, 59, 65, 56, 53, 56, 58, 63, 60, 59, 62, 60, 63, 68,
+    54, 65, 64, 52, 62, 64, 62, 51, 52, 65, 68, 66, 62, 58, 58, 66,
+    64, 60, 70, 63, 56, 57, 60, 50, 56, 60, 49, 55, 66, 48, 46, 63,
+    54, 55, 63, 56, 54, 54, 65, 53, 55, 62, 68, 58, 57, 57, 61, 63,
+    56, 70, 53, 54, 71, 52, 56, 54, 61, 61, 69, 48, 55, 50, 57, 52,
+    65, 58, 52, 62, 57, 52, 64, 54, 61, 56, 65, 63, 46, 67, 54, 70,
+    59, 60, 47, 62, 54, 54, 55, 64, 44, 57, 55, 60, 57, 70, 51, 62,
+    58, 46, 70, 56, 63, 53, 56, 48, 59, 51, 54, 58, 62, 63, 59, 52,
+    62, 55, 57, 63, 65, 62, 60, 66, 49, 61, 63, 53, 53, 59, 65, 66,
+    54, 60, 49, 50, 53, 56, 57, 59, 59, 56, 63, 55, 67, 62, 61, 51,
+    59, 57, 76, 70, 67, 64, 58, 61, 68, 62, 67, 58, 63, 63, 52, 59,
+    54, 59, 66, 54, 63, 52, 62, 67, 56, 61, 45, 51, 45, 46, 62, 52,
+    63, 63, 63, 62, 59, 57, 61, 65, 58, 54, 53, 53, 56, 46, 56, 60,
+    66, 55, 64, 58, 60, 58, 63, 61, 59, 62, 48, 57, 51, 56, 57, 51,
+    59, 58, 56, 55, 64, 55, 61, 55, 63, 67, 62, 46, 60, 58, 69, 55,
+    62, 57, 66, 56, 58, 58, 46, 57, 51, 54, 64, 73, 50, 55, 60, 56,
+    49, 49, 62, 57, 62, 55, 54, 57, 57, 62, 59, 70, 52, 63, 51, 57,
+    56, 48, 55, 54, 60, 55, 58, 57, 54, 61, 65, 60, 53, 56, 51, 55,
+    54, 55, 68, 57, 60, 62, 61, 61, 58, 52, 54, 69, 57, 53, 61, 75,
+    60, 49, 62, 59, 57, 64, 67, 58, 59, 56, 62, 51, 63, 61, 54, 52,
+    59, 52, 53, 61, 47, 67, 70, 58, 62, 62, 68, 59, 54, 62, 55, 60,
+    58, 58, 65, 64, 57, 61, 54, 67, 52, 57, 64, 48, 69, 62, 63, 64,
+    49, 58, 62, 59, 61, 62, 46, 66, 52, 57, 65, 61, 60, 62, 57, 57,
+    53, 59, 53, 60, 56, 51, 61, 68, 55, 63, 52, 67, 52, 63, 49, 62,
+    57, 57, 62, 50, 66, 57, 63, 57, 61, 57, 54, 57, 58, 65, 67, 63,
+    63, 56, 56, 61, 47, 63, 68, 57, 59, 57, 55, 59, 52, 58, 54, 57,
+    58, 60, 50, 62, 59, 60, 59, 54, 55, 54, 58, 64, 60, 62, 45, 55,
+    53, 54, 66, 61, 65, 60, 52, 53, 65, 57, 59, 59, 64, 61, 65, 59,
+    60, 55, 59, 54, 60, 68, 60, 70, 56, 73, 59, 53, 59, 55, 55, 59,
+    53, 63, 71, 59, 63, 62, 54, 58, 57, 51, 57, 56, 51, 47, 61, 74,
+    62, 63, 54, 48, 48, 47, 58, 55, 48, 55, 61, 60, 62, 52, 51, 68,
+    55, 56, 60, 57, 60, 56, 61, 56, 69, 56, 64, 54, 61, 53, 54, 58,
+    63, 64, 64, 57, 59, 57, 60, 69, 55, 54, 58, 57, 52, 59, 60, 61,
+    66, 64, 60, 61, 54, 66, 58, 49, 47, 59, 52, 58, 52, 58, 56, 64,
+    57, 56, 58, 58, 54, 58, 67, 49, 52, 56, 64, 55, 57, 63, 61, 52,
+    60, 65, 59, 55, 55, 58, 56, 60, 60, 57, 61, 64, 55, 63, 62, 47,
+    66, 61, 75, 53, 61, 64, 61, 55, 51, 60, 59, 69, 58, 53, 46, 57,
+    55, 60, 64, 57, 53, 54, 60, 53, 61, 53, 67, 67, 50, 64, 60, 50,
+    57, 56, 65, 52, 56, 52, 55, 54, 60, 62, 44, 60, 56, 48, 60, 55,
+    63, 50, 65, 54, 55, 53, 59, 66, 49, 60, 65, 63, 73, 53, 61, 59,
+    62, 65, 57, 60, 55, 57, 59, 61, 55, 56, 61, 44, 58, 58, 69, 64,
+    56, 65, 62, 63, 57, 63, 60, 61, 56, 54, 60, 61, 60, 58, 58, 53,
+    62, 67, 61, 59, 62, 58, 58, 52, 62, 55, 59, 58, 60, 51, 61, 58,
+    53, 50, 64, 60, 53, 61, 57, 58, 67, 57, 61, 64, 67, 60, 53, 59,
+    54, 59, 59, 71, 61, 61, 59, 52, 54, 49, 53, 63, 61, 55, 59, 52,
+    56, 66, 73, 57, 68, 60, 59, 54, 61, 55, 67, 50, 66, 60, 61, 60,
+    59, 58, 50, 56, 65, 61, 61, 57, 58, 58, 63, 58, 55, 54, 68, 62,
+    56, 62, 60, 57, 61, 56, 59, 60, 54, 42, 64, 62, 53, 65, 69, 50,
+    63, 56, 63, 55, 55, 45, 60, 61, 55, 53, 51, 61, 66, 58, 57, 54,
+    54, 48, 65, 55, 61, 55, 67, 56, 49, 46, 61, 57, 50, 68, 59, 57,
+    55, 66, 57, 60, 57, 64, 63, 57, 47, 53, 58, 66, 53, 64, 56, 48,
+    51, 58, 62, 59, 53, 54, 63, 59, 64, 62, 66, 57, 62, 54, 56, 58,
+    53, 56, 62, 57, 61, 56, 57, 62, 58, 58, 49, 54, 58, 59, 58, 50,
+    50, 58, 58, 56, 64, 59, 70, 61, 58, 55, 67, 59, 53, 63, 59, 57,
+    55, 58, 55, 65, 51, 60, 66, 62, 52, 68, 63, 61, 63, 61, 53, 53,
+    63, 60, 52, 60, 63, 46, 57, 49, 54, 64, 66, 63, 58, 54, 59, 46,
+    58, 65, 63, 47, 46, 62, 68, 64, 56, 44, 68, 42, 61, 61, 63, 53,
+    57, 52, 61, 55, 64, 63, 57, 54, 53, 63, 75, 57, 59, 53, 69, 70,
+    60, 66, 64, 58, 55, 56, 59, 65, 68, 54, 60, 63, 58, 58, 54, 58,
+    63, 62, 62, 49, 63, 52, 64, 56, 63, 59, 52, 60, 55, 62, 57, 52,
+    59, 47, 64, 63, 65, 46, 53, 53, 61, 67, 57, 53, 59, 52, 60, 58,
+    55, 60, 57, 61, 61, 63, 57, 57, 64, 61, 55, 53, 66, 59, 55, 70,
+    49, 51, 59, 56, 57, 55, 63, 54, 60, 64, 58, 58, 52, 54, 62, 52,
+    63, 59, 58, 58, 49, 62, 62, 58, 67, 66, 57, 58, 55, 68, 55, 63,
+    62, 52, 67, 57, 59, 60, 40, 48, 60, 51, 59, 54, 57, 66, 57, 60,
+    57, 57, 69, 51, 58, 60, 57, 54, 58, 68, 54, 51, 66, 71, 52, 62,
+    56, 60, 62, 65, 55, 59, 59, 53, 68, 60, 57, 49, 55, 57, 60, 58,
+    58, 46, 75, 60, 60, 64, 60, 55, 58, 55, 59, 60, 57, 61, 56, 60,
+    61, 45, 67, 53, 62, 56, 54, 61, 57, 67, 51, 60, 57, 58, 53, 63,
+    63, 61, 53, 54, 62, 60, 62, 49, 68, 62, 55, 55, 60, 62, 67, 65,
+    55, 52, 57, 50, 56, 54, 47, 62, 54, 61, 56, 57, 55, 49, 49, 59,
+    57, 59, 61, 69, 49, 50, 54, 58, 65, 66, 60, 54, 53, 65, 57, 59,
+    59, 62, 54, 51, 59, 60, 68, 52, 63, 56, 65, 56, 59, 54, 59, 58,
+    66, 60, 58, 63, 56, 50, 74, 56, 56, 66, 58, 49, 61, 57, 50, 63,
+    72, 57, 50, 55, 54, 60, 54, 59, 52, 51, 59, 46, 64, 61, 51, 58,
+    55, 59, 59, 62, 46, 65, 63, 57, 56, 67, 51, 52, 56, 59, 63, 59,
+    61, 53, 55, 58, 58, 64, 61, 61, 57, 59, 60, 69, 61, 57, 59, 54,
+    59, 52, 58, 50, 57, 56, 50, 59, 56, 61, 56, 57, 52, 46, 57, 55,
+    56, 61, 57, 53, 58, 52, 75, 63, 61, 51, 65, 60, 55, 74, 56, 52,
+    53, 56, 55, 60, 55, 64, 55, 59, 56, 54, 56, 60, 68, 61, 54, 54,
+    56, 59, 59, 67, 53, 73, 56, 61, 58, 57, 54, 64, 64, 59, 63, 63,
+    58, 48, 47, 59, 55, 64, 56, 69, 58, 64, 56, 58, 58, 54, 51, 57,
+    59, 60, 67, 59, 50, 61, 52, 58, 57, 56, 58, 65, 48, 60, 60, 59,
+    59, 56, 61, 65, 60, 52, 60, 63, 59, 55, 60, 60, 47, 59, 63, 56,
+    47, 63, 67, 59, 62, 60, 64, 58, 68, 60, 66, 64, 48, 51, 56, 55,
+    62, 61, 58, 62, 54, 53, 62, 65, 49, 66, 45, 50, 59, 47, 61, 49,
+    50, 60, 67, 52, 63, 62, 64, 62, 54, 63, 67, 55, 56, 61, 52, 51,
+    59, 64, 48, 48, 62, 51, 51, 67, 57, 69, 56, 51, 56, 55, 59, 62,
+    63, 62, 57, 56, 50, 58, 64, 63, 62, 57, 61, 54, 55, 66, 61, 54,
+    62, 57, 53, 62, 55, 55, 65, 62, 52, 58, 69, 51, 59, 57, 51, 61,
+    65, 48, 60, 65, 50, 59, 64, 64, 54, 63, 50, 58, 49, 68, 60, 54,
+    60, 66, 60, 52, 60, 54, 64, 61, 59, 58, 48, 58, 68, 58, 56, 57,
+    65, 53, 53, 56, 59, 61, 61, 57, 64, 60, 50, 51, 51, 54, 64, 59,
+    54, 55, 52, 60, 59, 57, 68, 55, 54, 56, 61, 62, 50, 53, 56, 57,
+    66, 58, 52, 54, 65, 67, 58, 61, 57, 53, 66, 67, 51, 48, 65, 50,
+    56, 70, 58, 55, 60, 51, 61, 62, 56, 54, 56, 64, 63, 56, 56, 53,
+    55, 65, 59, 56, 62, 56, 53, 64, 64, 55, 55, 60, 73, 54, 48, 57,
+    56, 52, 70, 53, 53, 62, 57, 67, 65, 52, 60, 51, 52, 67, 49, 58,
+    58, 57, 57, 59, 50, 60, 65, 61, 54, 50, 55, 61, 63, 64, 55, 56,
+    62, 67, 46, 61, 50, 55, 63, 67, 61, 53, 51, 54, 46, 61, 54, 51,
+    62, 60, 55, 60, 59, 65, 59, 58, 56, 59, 58, 65, 44, 61, 62, 55,
+    60, 61, 56, 54, 61, 47, 47, 66, 62, 69, 64, 63, 54, 56, 72, 55,
+    64, 50, 58, 51, 54, 59, 64, 53, 61, 65, 56, 63, 60, 59, 67, 52,
+    48, 55, 63, 54, 53, 56, 54, 44, 58, 62, 71, 59, 60, 58, 43, 56,
+    47, 53, 61, 58, 53, 58, 56, 62, 59, 54, 56, 56, 58, 58, 59, 62,
+    39, 61, 63, 60, 67, 61, 66, 64, 57, 51, 53, 58, 66, 57, 59, 55,
+    66, 58, 64, 59, 56, 58, 53, 63, 57, 64, 56, 59, 57, 54, 56, 51,
+    61, 60, 64, 67, 49, 60, 68, 67, 58, 68, 64, 56, 53, 62, 55, 64,
+    60, 72, 53, 61, 51, 58, 58, 66, 57, 57, 59, 64, 60, 56, 61, 55,
+    53, 57, 55, 53, 55, 68, 53, 72, 56, 70, 49, 56, 56, 57, 61, 59,
+    51, 53, 64, 66, 63, 64, 56, 60, 51, 52, 67, 47, 56, 57, 59, 63,
+    58, 67, 62, 55, 53, 68, 57, 58, 60, 68, 72, 54, 61, 62, 52, 68,
+    65, 54, 47, 63, 61, 57, 53, 55, 60, 53, 57, 61, 62, 71, 64, 56,
+    68, 57, 53, 57, 61, 56, 53, 53, 56, 51, 55, 60, 62, 55, 51, 53,
+    58, 57, 59, 63, 63, 53, 62, 51, 61, 53, 60, 60, 50, 61, 61, 69,
+    48, 51, 69, 61, 52, 52, 53, 56, 61, 53, 50, 50, 66, 59, 49, 67,
+    48, 55, 58, 46, 54, 57, 54, 64, 53, 65, 62, 54, 55, 71, 54, 55,
+    59, 63, 52, 54, 52, 59, 57, 64, 55, 56, 52, 56, 68, 52, 61, 54,
+    55, 69, 53, 50, 60, 51, 67, 67, 44, 59, 57, 63, 60, 54, 63, 52,
+    62, 55, 55, 63, 62, 52, 66, 56, 61, 49, 55, 68, 62, 70, 50, 57,
+    57, 67, 56, 57, 55, 62, 62, 56, 64, 56, 52, 57, 55, 64, 52, 52,
+    61, 56, 55, 50, 60, 62, 55, 62, 66, 46, 56, 61, 66, 65, 53, 55,
+    58, 54, 61, 64, 61, 62, 61, 61, 56, 58, 62, 52, 56, 64, 58, 46,
+    72, 57, 62, 70, 57, 47, 51, 54, 55, 58, 68, 69, 53, 54, 52, 65,
+    58, 57, 65, 58, 58, 55, 49, 61, 49, 61, 59, 52, 52, 51, 62, 62,
+    60, 61, 54, 53, 56, 54, 62, 63, 69, 56, 58, 61, 56, 54, 55, 60,
+    55, 61, 57, 53, 63, 57, 62, 57, 65, 56, 69, 58, 56, 66, 65, 56,
+    56, 57, 52, 55, 50, 76, 47, 56, 48, 60, 55, 61, 56, 66, 56, 57,
+    56, 60, 71, 60, 57, 69, 63, 61, 53, 53, 57, 42, 58, 64, 55, 57,
+    58, 51, 56, 61, 58, 51, 66, 54, 69, 62, 64, 57, 49, 61, 55, 53,
+    56, 61, 55, 60, 54, 61, 68, 58, 63, 58, 50, 65, 55, 65, 56, 54,
+    57, 57, 61, 64, 51, 62, 69, 61, 64, 55, 58, 47, 63, 57, 59, 52,
+    52, 51, 63, 56, 62, 58, 60, 61, 56, 55, 67, 67, 60, 58, 58, 64,
+    50, 64, 62, 60, 53, 66, 58, 51, 55, 57, 64, 53, 57, 59, 57, 67,
+    58, 59, 63, 68, 66, 64, 46, 70, 55, 61, 58, 62, 64, 62, 61, 52,
+    64, 51, 57, 66, 59, 59, 52, 57, 67, 58, 45, 56, 65, 55, 50, 59,
+    53, 54, 63, 51, 53, 56, 60, 48, 56, 57, 52, 62, 60, 61, 59, 56,
+    50, 58, 56, 59, 42, 57, 55, 67, 59, 45, 50, 61, 71, 63, 52, 64,
+    55, 56, 52, 62, 55, 57, 62, 60, 58, 54, 47, 55, 57, 63, 66, 55,
+    66, 45, 57, 51, 55, 56, 53, 63, 63, 68, 59, 60, 54, 51, 54, 59,
+    56, 57, 64, 50, 62, 53, 49, 60, 61, 51, 63, 59, 61, 56, 58, 48,
+    64, 61, 57, 64, 58, 57, 58, 57, 56, 66, 50, 62, 63, 54, 64, 55,
+    46, 64, 64, 58, 61, 55, 59, 61, 60, 64, 59, 64, 66, 54, 66, 58,
+    54, 57, 59, 79, 51, 54, 60, 62, 57, 58, 67, 66, 58, 60, 61, 60,
+    53, 54, 55, 63, 60, 47, 66, 57, 58, 60, 65, 56, 58, 66, 65, 67,
+    54, 48, 58, 56, 64, 59, 59, 62, 66, 56, 60, 55, 61, 53, 49, 60,
+    59, 56, 53, 54, 53, 61, 50, 65, 64, 56, 61, 51, 54, 60, 68, 57,
+    65, 58, 56, 56, 52, 56, 61, 54, 65, 59, 52, 59, 65, 61, 57, 73,
+    57, 55, 63, 60, 55, 67, 62, 67, 61, 61, 60, 66, 48, 59, 62, 61,
+    60, 60, 50, 60, 50, 62, 55, 60, 48, 51, 56, 57, 58, 68, 57, 61,
+    62, 57, 65, 55, 60, 59, 59, 64, 58, 63, 49, 60, 48, 51, 62, 63,
+    62, 64, 60, 72, 53, 55, 60, 54, 57, 52, 63, 66, 59, 57, 57, 56,
+    62, 57, 53, 57, 65, 59, 60, 63, 55, 63, 57, 60, 55, 62, 63, 61,
+    66, 65, 47, 58, 57, 59, 62, 54, 54, 63, 61, 57, 53, 60, 63, 62,
+    58, 50, 60, 64, 56, 50, 60, 55, 68, 58, 56, 56, 53, 57, 66, 55,
+    58, 56, 51, 54, 59, 59, 56, 58, 49, 70, 65, 64, 59, 63, 61, 45,
+    61, 54, 62, 60, 54, 64, 62, 46, 56, 65, 57, 64, 52, 54, 65, 60,
+    67, 68, 64, 55, 68, 59, 52, 67, 62, 56, 54, 59, 62, 52, 57, 62,
+    49, 52, 47, 70, 56, 62, 60, 56, 50, 45, 66, 63, 50, 58, 62, 53,
+    59, 53, 52, 56, 57, 65, 63, 65, 56, 57, 55, 52, 53, 55, 67, 65,
+    63, 56, 64, 70, 58, 58, 55, 56, 62, 53, 52, 64, 54, 59, 67, 72,
+    64, 55, 58, 67, 59, 49, 55, 58, 51, 59, 57, 59, 56, 67, 54, 58,
+    49, 53, 58, 58, 54, 47, 62, 57, 49, 67, 57, 57, 62, 61, 56, 58,
+    60, 64, 60, 45, 63, 63, 53, 60, 59, 60, 62, 57, 63, 54, 55, 53,
+    55, 61, 57, 65, 54, 66, 64, 59, 59, 61, 58, 56, 52, 58, 63, 57,
+    61, 57, 61, 58, 55, 53, 57, 65, 65, 57, 57, 64, 52, 62, 54, 57,
+    64, 67, 59, 49, 60, 57, 57, 56, 60, 65, 51, 51, 68, 58, 48, 57,
+    72, 56, 59, 59, 59, 62, 50, 61, 51, 50, 62, 48, 60, 56, 54, 54,
+    62, 59, 66, 64, 57, 61, 55, 54, 57, 64, 57, 49, 63, 55, 58, 62,
+    52, 53, 62, 59, 63, 57, 48, 66, 60, 65, 71, 56, 60, 50, 58, 51,
+    57, 52, 59, 63, 61, 68, 49, 65, 63, 59, 60, 62, 55, 61, 62, 58,
+    53, 57, 53, 52, 66, 51, 62, 54, 53, 72, 55, 64, 63, 55, 53, 51,
+    56, 61, 64, 58, 66, 57, 58, 64, 59, 59, 65, 61, 62, 57, 52, 60,
+    61, 67, 60, 53, 57, 63, 57, 53, 59, 52, 59, 63, 52, 63, 49, 59,
+    60, 60, 61, 57, 72, 49, 58, 58, 52, 54, 63, 65, 51, 51, 64, 48,
+    61, 64, 64, 60, 46, 52, 52, 54, 47, 61, 69, 50, 62, 66, 56, 61,
+    61, 71, 62, 54, 50, 63, 55, 58, 57, 61, 55, 54, 61, 66, 57, 63,
+    60, 56, 49, 64, 58, 59, 69, 65, 60, 57, 56, 54, 60, 61, 55, 59,
+    53, 49, 59, 50, 59, 60, 63, 51, 49, 48, 59, 58, 57, 57, 48, 60,
+    54, 64, 57, 60, 53, 53, 47, 63, 50, 47, 57, 47, 65, 62, 62, 51,
+    58, 50, 61, 53, 55, 58, 51, 57, 62, 69, 64, 54, 63, 51, 62, 55,
+    58, 52, 58, 58, 62, 60, 61, 58, 58, 67, 50, 59, 53, 64, 58, 58,
+    53, 62, 55, 60, 56, 53, 60, 62, 57, 60, 58, 62, 57, 57, 63, 59,
+    49, 51, 63, 56, 51, 54, 65, 52, 64, 49, 52, 63, 60, 63, 52, 58,
+    68, 57, 57, 58, 58, 66, 64, 62, 54, 57, 59, 60, 55, 55, 53, 58,
+    51, 64, 65, 53, 50, 67, 65, 64, 59, 73, 64, 56, 57, 58, 57, 56,
+    59, 57, 61, 60, 53, 59, 55, 53, 54, 59, 58, 58, 48, 57, 54, 55,
+    61, 64, 70, 53, 52, 63, 67, 55, 59, 58, 51, 62, 59, 62, 65, 50,
+    51, 65, 59, 58, 58, 56, 67, 61, 56, 57, 57, 64, 55, 53, 61, 61,
+    63, 72, 51, 68, 65, 56, 66, 48, 60, 56, 51, 59, 48, 58, 64, 66,
+    54, 58, 54, 59, 61, 58, 64, 57, 61, 61, 54, 50, 62, 62, 60, 56,
+    66, 57, 56, 52, 57, 46, 58, 69, 61, 50, 57, 59, 55, 59, 63, 64,
+    58, 60, 66, 57, 59, 57, 53, 60, 62, 63, 71, 58, 59, 68, 53, 55,
+    64, 64, 57, 61, 55, 66, 58, 57, 62, 58, 60, 61, 58, 66, 55, 55,
+    59, 58, 66, 52, 55, 50, 63, 48, 68, 47, 55, 57, 58, 64, 61, 62,
+    58, 54, 64, 57, 57, 53, 57, 60, 59, 51, 56, 60, 64, 50, 67, 60,
+    50, 63, 48, 59, 52, 57, 56, 66, 68, 44, 53, 56, 55, 57, 67, 63,
+    60, 54, 60, 57, 58, 66, 58, 60, 54, 54, 51, 58, 68, 56, 60, 60,
+    58, 56, 67, 63, 51, 54, 58, 55, 63, 54, 53, 48, 61, 58, 52, 62,
+    56, 59, 61, 52, 57, 61, 61, 57, 53, 56, 56, 63, 57, 54, 61, 52,
+    59, 64, 57, 53, 60, 57, 54, 54, 67, 59, 55, 55, 61, 55, 68, 52,
+    55, 62, 54, 58, 45, 56, 60, 48, 66, 63, 68, 61, 53, 63, 60, 44,
+    68, 57, 53, 54, 67, 49, 62, 60, 56, 53, 62, 64, 65, 61, 54, 51,
+    53, 59, 57, 64, 55, 51, 55, 67, 65, 59, 61, 63, 62, 60, 64, 55,
+    52, 57, 63, 47, 69, 53, 53, 57, 61, 64, 60, 61, 49, 52, 53, 48,
+    64, 61, 60, 57, 61, 65, 61, 55, 54, 60, 69, 58, 69, 57, 60, 51,
+    62, 50, 60, 54, 58, 63, 55, 56, 58, 58, 64, 66, 56, 58, 63, 61,
+    64, 48, 56, 64, 64, 49, 66, 58, 57, 56, 56, 59, 65, 45, 55, 61,
+    59, 63, 59, 59, 55, 66, 59, 58, 55, 60, 59, 67, 61, 59, 56, 55,
+    59, 51, 52, 55, 68, 61, 61, 52, 60, 47, 58, 51, 53, 50, 67, 51,
+    71, 59, 60, 54, 56, 60, 58, 53, 61, 62, 51, 59, 51, 62, 61, 54,
+    62, 66, 51, 60, 60, 51, 45, 57, 55, 59, 55, 67, 60, 55, 69, 56,
+    50, 61, 54, 56, 68, 50, 61, 56, 54, 55, 57, 53, 54, 58, 46, 57,
+    61, 60, 57, 68, 52, 49, 61, 53, 53, 56, 62, 53, 56, 52, 57, 66,
+    52, 48, 58, 62, 66, 58, 56, 59, 59, 64, 60, 58, 64, 59, 57, 52,
+    56, 63, 51, 61, 61, 53, 62, 59, 62, 61, 60, 58, 51, 59, 52, 60,
+    66, 62, 61, 52, 54, 50, 60, 58, 57, 62, 61, 62, 52, 52, 68, 60,
+    52, 49, 68, 56, 54, 44, 58, 50, 59, 49, 60, 43, 59, 57, 49, 61,
+    53, 64, 56, 61, 59, 61, 63, 57, 56, 56, 53, 55, 55, 51, 55, 67,
+    58, 63, 59, 65, 62, 50, 53, 66, 55, 59, 54, 49, 53, 55, 63, 62,
+    51, 50, 57, 60, 48, 64, 63, 57, 51, 60, 59, 60, 53, 58, 58, 51,
+    52, 53, 58, 63, 57, 63, 54, 66, 62, 58, 54, 67, 45, 68, 52, 60,
+    60, 62, 59, 62, 57, 63, 63, 61, 57, 56, 62, 51, 61, 48, 60, 68,
+    61, 58, 61, 58, 48, 63, 64, 60, 57, 58, 68, 56, 51, 64, 58, 54,
+    52, 56, 57, 64, 64, 55, 51, 55, 59, 61, 64, 54, 57, 49, 47, 57,
+    57, 60, 60, 50, 62, 56, 61, 57, 54, 54, 62, 48, 53, 53, 50, 58,
+    73, 60, 49, 66, 56, 56, 61, 45, 67, 60, 55, 59, 56, 63, 52, 58,
+    48, 71, 61, 59, 63, 59, 53, 55, 62, 52, 54, 57, 57, 56, 65, 51,
+    62, 62, 61, 49, 62, 52, 58, 63, 52, 64, 66, 54, 55, 64, 57, 59,
+    53, 58, 65, 58, 58, 65, 65, 50, 66, 53, 55, 61, 51, 63, 65, 48,
+    54, 58, 57, 49, 52, 59, 65, 51, 53, 60, 60, 54, 58, 54, 59, 50,
+    66, 65, 55, 56, 54, 51, 58, 54, 68, 56, 57, 54, 62, 73, 58, 64,
+    52, 61, 64, 64, 61, 68, 56, 61, 61, 66, 59, 52, 49, 58, 58, 59,
+    58, 45, 52, 57, 66, 61, 58, 69, 54, 58, 57, 59, 59, 64, 61, 64,
+    59, 60, 60, 55, 61, 57, 51, 56, 57, 59, 54, 48, 60, 47, 61, 51,
+    59, 69, 60, 65, 58, 61, 60, 56, 66, 56, 54, 67, 51, 63, 65, 52,
+    50, 59, 59, 54, 59, 50, 61, 70, 58, 52, 62, 56, 61, 60, 54, 58,
+    50, 51, 51, 59, 59, 52, 62, 63, 64, 54, 51, 60, 54, 62, 59, 58,
+    61, 53, 58, 54, 52, 61, 67, 50, 55, 53, 60, 60, 70, 58, 62, 65,
+    52, 54, 50, 62, 68, 55, 51, 48, 63, 60, 61, 56, 60, 55, 59, 59,
+    57, 52, 61, 58, 63, 57, 53, 55, 61, 64, 58, 58, 53, 60, 55, 62,
+    53, 61, 59, 52, 54, 64, 47, 63, 54, 65, 57, 57, 59, 47, 60, 60,
+    58, 64, 54, 56, 56, 61, 54, 56, 58, 64, 62, 51, 61, 52, 51, 55,
+    54, 60, 56, 59, 55, 63, 59, 62, 52, 52, 60, 60, 57, 58, 57, 56,
+    55, 55, 55, 58, 58, 63, 48, 55, 42, 72, 62, 58, 53, 63, 57, 49,
+    50, 55, 64, 53, 62, 60, 57, 55, 60, 64, 60, 56, 57, 55, 49, 57,
+    50, 65, 55, 55, 58, 63, 60, 58, 55, 54, 56, 59, 67, 50, 59, 65,
+    56, 53, 55, 60, 51, 65, 62, 55, 62, 50, 58, 42, 56, 62, 61, 57,
+    51, 59, 57, 54, 56, 60, 59, 60, 53, 52, 64, 61, 56, 57, 70, 61,
+    50, 48, 59, 64, 50, 68, 69, 57, 64, 59, 61, 65, 59, 62, 64, 50,
+    62, 58, 62, 60, 59, 58, 58, 57, 64, 58, 59, 57, 58, 56, 61, 59,
+    62, 65, 54, 54, 52, 61, 67, 57, 56, 54, 62, 53, 63, 56, 64, 48,
+    60, 50, 52, 52, 53, 61, 65, 55, 55, 61, 54, 65, 57, 47, 60, 57,
+    63, 68, 61, 60, 59, 60, 58, 59, 58, 54, 57, 56, 57, 51, 62, 72,
+    55, 61, 47, 60, 64, 51, 51, 62, 54, 47, 61, 54, 67, 62, 56, 63,
+    57, 56, 56, 57, 55, 62, 60, 56, 56, 60, 58, 54, 65, 54, 51, 60,
+    60, 52, 59, 58, 58, 57, 63, 62, 64, 62, 63, 63, 65, 55, 60, 57,
+    63, 39, 61, 69, 59, 47, 53, 58, 59, 56, 57, 59, 57, 68, 60, 66,
+    57, 56, 45, 64, 64, 64, 63, 56, 53, 50, 55, 53, 58, 61, 62, 62,
+    63, 39, 49, 54, 54, 66, 51, 55, 54, 54, 61, 54, 57, 54, 60, 67,
+    51, 61, 57, 61, 59, 68, 45, 54, 66, 57, 56, 45, 64, 55, 62, 65,
+    60, 62, 52, 66, 53, 56, 52, 58, 55, 57, 53, 49, 65, 55, 55, 52,
+    58, 56, 67, 62, 53, 54, 46, 69, 67, 57, 64, 65, 54, 58, 62, 61,
+    51, 60, 57, 60, 55, 66, 55, 59, 58, 53, 58, 59, 61, 69, 51, 52,
+    54, 53, 49, 53, 60, 53, 62, 64, 57, 58, 58, 62, 62, 57, 63, 58,
+    56, 70, 64, 52, 57, 57, 55, 63, 63, 59, 58, 49, 59, 56, 62, 58,
+    58, 61, 51, 62, 50, 65, 61, 51, 66, 58, 58, 54, 58, 65, 58, 54,
+    56, 66, 52, 64, 59, 60, 61, 60, 61, 45, 59, 63, 65, 64, 55, 69,
+    61, 55, 55, 56, 57, 60, 63, 62, 60, 47, 59, 63, 52, 56, 63, 51,
+    60, 54, 59, 64, 64, 55, 62, 64, 57, 59, 56, 59, 57, 54, 56, 55,
+    54, 52, 57, 48, 59, 52, 60, 54, 58, 64, 63, 53, 56, 63, 48, 54,
+    59, 59, 62, 60, 69, 58, 55, 57, 56, 58, 61, 47, 59, 65, 54, 60,
+    53, 63, 58, 71, 57, 55, 56, 49, 55, 54, 54, 53, 58, 56, 60, 53,
+    69, 53, 61, 62, 56, 57, 63, 53, 57, 52, 61, 53, 68, 67, 57, 60,
+    56, 57, 57, 55, 55, 59, 55, 55, 59, 68, 57, 53, 67, 53, 56, 60,
+    61, 55, 55, 59, 61, 59, 69, 58, 68, 55, 50, 53, 60, 49, 49, 54,
+    64, 56, 59, 55, 62, 57, 56, 59, 71, 61, 62, 48, 48, 57, 68, 66,
+    56, 63, 53, 60, 47, 58, 52, 55, 62, 60, 65, 67, 55, 55, 54, 48,
+    58, 56, 59, 53, 65, 56, 53, 54, 54, 54, 48, 67, 53, 59, 57, 70,
+    47, 50, 67, 55, 56, 53, 60, 61, 58, 61, 58, 57, 57, 64, 52, 52,
+    55, 64, 60, 58, 58, 60, 53, 61, 52, 49, 67, 66, 55, 51, 67, 61,
+    64, 56, 54, 53, 47, 56, 72, 52, 69, 61, 54, 60, 54, 61, 63, 57,
+    57, 55, 59, 56, 65, 56, 62, 56, 52, 49, 56, 53, 61, 56, 56, 64,
+    55, 49, 64, 64, 49, 66, 62, 58, 58, 64, 66, 72, 60, 50, 77, 59,
+    59, 66, 55, 59, 61, 50, 54, 59, 61, 45, 59, 51, 56, 58, 51, 71,
+    54, 59, 58, 56, 61, 57, 50, 59, 54, 52, 68, 56, 56, 68, 61, 62,
+    63, 55, 60, 66, 49, 65, 60, 49, 60, 58, 63, 68, 52, 56, 70, 54,
+    44, 60, 58, 58, 57, 61, 41, 57, 59, 64, 50, 63, 57, 55, 53, 56,
+    58, 56, 58, 59, 64, 58, 60, 54, 57, 56, 58, 55, 65, 54, 48, 59,
+    55, 59, 44, 60, 63, 55, 61, 64, 51, 59, 61, 56, 55, 49, 61, 60,
+    57, 51, 58, 50, 65, 56, 64, 56, 59, 58, 57, 55, 63, 56, 53, 41,
+    53, 51, 56, 54, 58, 58, 64, 65, 59, 52, 55, 65, 64, 63, 63, 61,
+    59, 57, 69, 61, 53, 59, 54, 58, 61, 59, 49, 61, 49, 63, 60, 56,
+    64, 60, 61, 53, 55, 50, 58, 52, 52, 69, 54, 58, 55, 53, 56, 63,
+    65, 68, 66, 56, 53, 65, 50, 58, 45, 61, 62, 57, 54, 61, 59, 55,
+    55, 58, 60, 65, 58, 65, 60, 55, 70, 53, 61, 62, 60, 56, 62, 56,
+    52, 60, 55, 61, 61, 55, 58, 50, 53, 62, 55, 59, 62, 56, 59, 66,
+    52, 56, 56, 51, 65, 51, 55, 58, 64, 55, 67, 51, 58, 55, 65, 64,
+    58, 63, 50, 58, 57, 59, 53, 56, 58, 63, 57, 56, 59, 61, 60, 55,
+    47, 60, 59, 68, 58, 66, 49, 54, 59, 56, 58, 70, 57, 56, 56, 67,
+    54, 56, 58, 57, 57, 59, 56, 55, 56, 54, 57, 43, 59, 56, 59, 67,
+    60, 58, 60, 49, 63, 70, 54, 56, 69, 64, 60, 58, 67, 50, 54, 57,
+    58, 59, 50, 61, 57, 54, 47, 61, 60, 58, 52, 60, 54, 62, 61, 52,
+    62, 67, 55, 62, 58, 64, 53, 59, 62, 54, 63, 61, 60, 51, 52, 49,
+    54, 58, 46, 63, 54, 57, 56, 52, 60, 50, 65, 57, 62, 60, 53, 61,
+    61, 58, 66, 62, 55, 58, 56, 60, 64, 57, 58, 64, 56, 50, 58, 57,
+    53, 55, 60, 65, 60, 63, 54, 57, 65, 63, 60, 60, 65, 67, 56, 53,
+    61, 60, 53, 57, 57, 57, 56, 53, 53, 61, 68, 63, 58, 51, 60, 61,
+    56, 58, 52, 54, 55, 58, 56, 60, 62, 58, 51, 57, 59, 62, 55, 56,
+    67, 51, 65, 51, 54, 57, 61, 53, 52, 64, 66, 51, 59, 63, 56, 49,
+    57, 62, 60, 55, 63, 62, 58, 57, 61, 60, 69, 59, 57, 50, 60, 70,
+    63, 44, 47, 65, 49, 53, 49, 55, 70, 54, 66, 58, 53, 50, 59, 60,
+    54, 55, 61, 61, 63, 59, 63, 51, 53, 58, 64, 63, 67, 52, 64, 57,
+    60, 59, 55, 49, 55, 61, 58, 67, 64, 58, 57, 57, 70, 61, 50, 50,
+    58, 66, 60, 68, 50, 62, 53, 56, 55, 61, 58, 47, 50, 58, 64, 61,
+    60, 53, 74, 50, 57, 61, 62, 57, 45, 54, 65, 61, 61, 49, 57, 59,
+    49, 67, 67, 60, 63, 63, 50, 71, 48, 61, 49, 47, 61, 63, 51, 60,
+    54, 58, 61, 55, 64, 43, 62, 48, 49, 58, 57, 51, 60, 58, 60, 55,
+    64, 62, 54, 60, 51, 55, 55, 63, 63, 62, 65, 73, 54, 51, 70, 61,
+    46, 54, 56, 63, 52, 62, 53, 54, 49, 64, 52, 56, 62, 61, 57, 57,
+    67, 66, 61, 51, 60, 56, 58, 55, 48, 66, 64, 61, 59, 60, 54, 61,
+    54, 53, 67, 50, 40, 64, 65, 59, 61, 64, 50, 64, 57, 60, 50, 54,
+    63, 62, 61, 54, 62, 60, 52, 56, 56, 53, 56, 66, 54, 63, 54, 63,
+    58, 57, 54, 50, 60, 49, 65, 59, 60, 59, 55, 63, 65, 59, 52, 58,
+    60, 55, 43, 57, 58, 50, 66, 53, 61, 62, 48, 59, 61, 58, 70, 56,
+    49, 61, 54, 49, 53, 58, 52, 63, 59, 57, 61, 60, 57, 65, 55, 48,
+    69, 56, 59, 52, 57, 63, 56, 65, 65, 59, 59, 56, 63, 56, 58, 51,
+    56, 58, 51, 55, 68, 45, 61, 60, 59, 54, 64, 53, 59, 55, 56, 64,
+    61, 45, 55, 68, 53, 55, 49, 52, 55, 51, 64, 55, 52, 60, 49, 65,
+    58, 65, 62, 53, 62, 61, 59, 57, 62, 53, 51, 61, 52, 56, 54, 61,
+    54, 53, 60, 62, 60, 57, 60, 64, 54, 62, 52, 60, 56, 60, 55, 55,
+    48, 60, 56, 62, 65, 54, 53, 57, 59, 58, 50, 63, 50, 58, 63, 53,
+    65, 60, 61, 57, 68, 56, 66, 52, 60, 59, 58, 60, 59, 52, 59, 60,
+    56, 65, 63, 58, 54, 63, 53, 57, 52, 54, 55, 59, 59, 54, 60, 62,
+    51, 48, 52, 51, 60, 58, 62, 61, 62, 62, 53, 64, 60, 51, 66, 60,
+    61, 68, 56, 64, 53, 61, 58, 54, 54, 59, 64, 59, 67, 60, 62, 53,
+    57, 56, 55, 56, 56, 64, 55, 58, 59, 72, 60, 59, 53, 60, 59, 66,
+    57, 55, 57, 64, 52, 59, 67, 55, 56, 55, 60, 52, 57, 63, 51, 63,
+    56, 59, 55, 58, 56, 62, 62, 56, 54, 65, 58, 51, 63, 56, 56, 62,
+    48, 64, 56, 64, 54, 63, 41, 60, 64, 53, 55, 62, 61, 55, 60, 56,
+    56, 62, 54, 58, 52, 58, 53, 57, 64, 59, 51, 60, 56, 64, 48, 56,
+    58, 61, 56, 64, 59, 54, 53, 67, 55, 45, 52, 50, 62, 62, 51, 55,
+    55, 50, 59, 61, 60, 62, 59, 52, 57, 62, 65, 47, 49, 54, 62, 57,
+    55, 54, 60, 56, 65, 67, 54, 55, 59, 49, 61, 57, 59, 50, 57, 54,
+    57, 74, 60, 60, 62, 49, 52, 58, 58, 61, 51, 58, 62, 53, 61, 60,
+    59, 62, 49, 53, 61, 56, 55, 48, 61, 66, 53, 58, 51, 65, 59, 64,
+    58, 56, 65, 59, 63, 52, 62, 63, 60, 65, 51, 58, 54, 55, 56, 49,
+    57, 59, 65, 57, 61, 56, 55, 62, 52, 63, 73, 59, 48, 52, 57, 55,
+    59, 59, 58, 54, 61, 59, 48, 65, 46, 62, 53, 60, 69, 59, 62, 70,
+    50, 56, 58, 59, 60, 58, 53, 51, 63, 60, 67, 59, 56, 57, 58, 63,
+    56, 65, 53, 53, 57, 61, 56, 61, 50, 59, 57, 55, 54, 68, 60, 59,
+    48, 63, 62, 60, 59, 60, 55, 58, 55, 60, 51, 57, 55, 56, 59, 57,
+    54, 53, 59, 64, 55, 54, 54, 56, 69, 54, 50, 70, 60, 64, 54, 55,
+    53, 53, 50, 58, 64, 54, 55, 63, 55, 57, 68, 59, 56, 56, 54, 53,
+    65, 61, 53, 63, 47, 54, 70, 47, 69, 59, 57, 56, 57, 60, 59, 67,
+    58, 60, 55, 62, 58, 61, 60, 64, 59, 57, 59, 58, 57, 57, 65, 61,
+    54, 52, 57, 60, 59, 44, 62, 51, 56, 60, 53, 61, 55, 57, 58, 64,
+    60, 53, 63, 54, 61, 57, 70, 58, 56, 59, 63, 62, 55, 65, 54, 49,
+    40, 61, 53, 73, 56, 66, 57, 63, 66, 48, 55, 56, 55, 55, 61, 62,
+    57, 61, 53, 64, 50, 61, 48, 64, 60, 58, 48, 67, 61, 55, 63, 58,
+    62, 67, 58, 58, 55, 56, 58, 58, 51, 53, 62, 60, 61, 69, 53, 51,
+    70, 53, 57, 50, 57, 55, 62, 62, 46, 67, 61, 55, 50, 57, 62, 58,
+    59, 53, 62, 64, 54, 59, 63, 63, 51, 51, 65, 49, 62, 74, 51, 58,
+    56, 62, 53, 59, 62, 56, 59, 64, 60, 65, 63, 55, 62, 51, 53, 59,
+    55, 60, 61, 58, 57, 57, 49, 57, 62, 56, 58, 62, 59, 57, 59, 54,
+    67, 59, 60, 61, 53, 61, 53, 64, 50, 50, 54, 60, 60, 57, 60, 57,
+    58, 60, 58, 59, 58, 57, 61, 55, 48, 62, 62, 60, 59, 52, 59, 54,
+    62, 53, 58, 68, 49, 66, 54, 52, 66, 56, 58, 53, 65, 61, 53, 63,
+    53, 52, 55, 51, 60, 56, 60, 64, 59, 63, 54, 60, 60, 59, 58, 65,
+    50, 58, 64, 61, 63, 42, 57, 54, 50, 58, 60, 59, 53, 69, 62, 62,
+    56, 60, 61, 61, 48, 55, 55, 58, 53, 56, 49, 60, 67, 57, 57, 60,
+    52, 58, 53, 56, 50, 52, 66, 59, 56, 59, 52, 59, 63, 57, 53, 48,
+    58, 55, 46, 58, 52, 58, 67, 60, 61, 50, 46, 66, 60, 53, 58, 56,
+    49, 53, 73, 50, 60, 67, 64, 52, 61, 59, 56, 56, 52, 63, 54, 61,
+    62, 58, 55, 74, 58, 66, 50, 70, 61, 61, 58, 53, 45, 53, 69, 55,
+    67, 49, 59, 60, 58, 61, 52, 62, 55, 55, 60, 55, 59, 53, 43, 49,
+    66, 54, 62, 59, 48, 55, 66, 59, 55, 58, 64, 59, 58, 63, 51, 57,
+    51, 58, 58, 59, 54, 52, 71, 62, 49, 62, 47, 55, 52, 63, 62, 61,
+    54, 57, 53, 56, 62, 50, 66, 61, 61, 53, 57, 52, 50, 53, 64, 61,
+    54, 59, 54, 59, 52, 61, 58, 53, 63, 53, 64, 58, 53, 56, 62, 69,
+    58, 57, 53, 57, 59, 56, 58, 51, 66, 53, 63, 62, 56, 55, 62, 65,
+    63, 54, 60, 59, 58, 50, 60, 51, 57, 65, 52, 47, 64, 57, 53, 56,
+    59, 56, 55, 59, 60, 61, 63, 61, 58, 52, 62, 63, 57, 56, 49, 53,
+    64, 57, 59, 65, 61, 59, 54, 59, 55, 54, 56, 56, 59, 64, 64, 61,
+    54, 64, 57, 53, 63, 59, 54, 47, 47, 59, 68, 60, 54, 56, 52, 66,
+    55, 57, 64, 56, 54, 56, 49, 63, 56, 59, 59, 55, 50, 60, 47, 71,
+    61, 58, 59, 58, 58, 62, 63, 53, 51, 67, 55, 64, 69, 54, 54, 67,
+    59, 58, 56, 64, 58, 61, 50, 51, 64, 62, 55, 66, 56, 54, 59, 58,
+    66, 64, 48, 60, 47, 59, 54, 62, 76, 55, 59, 57, 42, 58, 55, 66,
+    49, 55, 56, 54, 60, 53, 56, 57, 56, 56, 57, 45, 60, 63, 66, 53,
+    62, 57, 58, 63, 56, 54, 70, 64, 64, 59, 67, 61, 60, 59, 66, 54,
+    63, 57, 54, 50, 52, 59, 57, 51, 53, 62, 61, 55, 61, 57, 60, 56,
+    70, 64, 56, 51, 53, 53, 56, 56, 58, 54, 52, 61, 60, 58, 62, 58,
+    64, 52, 65, 59, 57, 64, 53, 59, 61, 57, 52, 62, 65, 53, 59, 44,
+    56, 57, 64, 60, 61, 62, 45, 59, 66, 56, 63, 63, 53, 56, 63, 64,
+    58, 56, 52, 52, 67, 57, 56, 57, 56, 58, 54, 59, 52, 60, 53, 61,
+    51, 55, 50, 60, 58, 58, 56, 65, 63, 60, 50, 62, 56, 54, 56, 66,
+    61, 53, 57, 56, 63, 57, 55, 63, 46, 66, 53, 55, 57, 49, 51, 59,
+    63, 51, 58, 58, 59, 50, 60, 49, 52, 65, 59, 62, 58, 60, 45, 49,
+    52, 56, 56, 61, 52, 64, 45, 58, 63, 53, 63, 60, 52, 66, 52, 55,
+    56, 56, 57, 59, 66, 56, 59, 57, 54, 65, 47, 57, 54, 58, 57, 56,
+    55, 49, 69, 63, 61, 57, 71, 46, 59, 48, 57, 63, 57, 66, 63, 50,
+    54, 67, 57, 41, 70, 59, 55, 57, 63, 58, 55, 63, 58, 52, 47, 54,
+    54, 61, 55, 60, 62, 56, 58, 54, 51, 55, 57, 64, 57, 54, 60, 59,
+    52, 59, 53, 60, 59, 57, 60, 59, 65, 58, 64, 62, 45, 51, 58, 53,
+    64, 59, 55, 61, 53, 54, 54, 56, 55, 55, 48, 56, 52, 63, 52, 63,
+    69, 62, 60, 51, 48, 58, 56, 58, 55, 62, 66, 50, 54, 50, 60, 62,
+    54, 64, 52, 62, 62, 59, 60, 54, 57, 68, 58, 49, 62, 48, 56, 47,
+    53, 57, 62, 66, 63, 54, 65, 62, 49, 66, 56, 59, 54, 60, 60, 59,
+    57, 55, 52, 59, 60, 52, 61, 63, 58, 52, 69, 47, 51, 58, 55, 51,
+    63, 52, 55, 63, 55, 56, 51, 55, 64, 56, 66, 50, 65, 64, 49, 60,
+    57, 50, 59, 58, 62, 52, 64, 56, 53, 60, 56, 58, 53, 54, 56, 52,
+    56, 57, 61, 57, 62, 49, 55, 57, 55, 45, 64, 56, 50, 61, 53, 66,
+    57, 62, 51, 54, 56, 50, 61, 58, 60, 63, 44, 58, 44, 58, 55, 58,
+    67, 67, 53, 60, 61, 57, 54, 56, 53, 58, 53, 63, 59, 49, 62, 57,
+    70, 58, 60, 58, 62, 58, 57, 54, 55, 54, 61, 63, 57, 56, 59, 50,
+    58, 63, 50, 52, 56, 60, 58, 64, 56, 50, 52, 54, 56, 62, 58, 69,
+    57, 56, 53, 53, 63, 55, 54, 50, 53, 59, 52, 59, 51, 61, 63, 44,
+    70, 60, 58, 53, 58, 55, 62, 65, 64, 63, 53, 60, 54, 54, 47, 72,
+    58, 50, 61, 60, 65, 51, 54, 63, 61, 55, 56, 57, 58, 51, 55, 59,
+    62, 53, 63, 58, 62, 53, 59, 65, 52, 62, 55, 60, 59, 53, 60, 57,
+    54, 56, 62, 47, 62, 53, 55, 59, 58, 47, 63, 62, 44, 61, 52, 54,
+    54, 56, 63, 54, 57, 64, 63, 51, 52, 59, 60, 54, 60, 61, 63, 56,
+    62, 61, 49, 59, 49, 61, 50, 55, 51, 55, 48, 53, 62, 58, 57, 53,
+    55, 52, 59, 51, 61, 74, 59, 61, 55, 56, 54, 49, 57, 52, 54, 64,
+    55, 60, 47, 57, 61, 54, 57, 54, 57, 54, 51, 75, 53, 62, 55, 52,
+    61, 59, 59, 69, 65, 58, 56, 51, 64, 59, 44, 62, 53, 56, 50, 60,
+    62, 58, 60, 54, 58, 62, 70, 55, 58, 60, 59, 62, 64, 56, 54, 63,
+    44, 58, 49, 61, 57, 51, 51, 64, 58, 61, 54, 60, 67, 62, 66, 48,
+    51, 52, 52, 62, 55, 51, 62, 50, 57, 66, 62, 53, 51, 61, 50, 53,
+    58, 62, 55, 66, 64, 63, 59, 57, 64, 51, 54, 59, 47, 59, 70, 50,
+    68, 58, 59, 54, 68, 55, 60, 64, 54, 59, 55, 63, 54, 58, 64, 48,
+    59, 57, 68, 53, 64, 50, 61, 62, 55, 57, 45, 64, 56, 59, 60, 60,
+    56, 56, 55, 56, 52, 69, 54, 62, 59, 55, 62, 52, 57, 61, 53, 61,
+    63, 52, 66, 57, 61, 55, 60, 58, 63, 62, 57, 57, 58, 61, 59, 58,
+    62, 60, 54, 64, 56, 58, 62, 56, 53, 47, 62, 57, 54, 62, 56, 58,
+    57, 60, 60, 48, 53, 53, 54, 62, 58, 63, 56, 54, 57, 63, 63, 63,
+    56, 58, 52, 61, 51, 57, 60, 50, 53, 51, 63, 60, 65, 53, 50, 59,
+    62, 60, 62, 58, 59, 62, 53, 60, 59, 55, 48, 62, 56, 60, 63, 53,
+    61, 60, 68, 56, 52, 61, 50, 59, 57, 63, 64, 58, 44, 64, 63, 54,
+    66, 52, 52, 48, 50, 64, 53, 64, 65, 55, 65, 50, 60, 56, 60, 58,
+    49, 50, 59, 49, 59, 64, 57, 55, 66, 61, 59, 51, 64, 58, 61, 53,
+    60, 55, 56, 65, 55, 52, 59, 54, 51, 42, 58, 66, 58, 55, 63, 40,
+    55, 58, 46, 49, 52, 63, 51, 50, 54, 58, 60, 62, 55, 61, 54, 55,
+    62, 49, 57, 50, 59, 56, 66, 53, 66, 62, 56, 53, 72, 52, 52, 56,
+    62, 68, 57, 53, 54, 47, 64, 56, 64, 55, 56, 56, 50, 58, 62, 59,
+    60, 58, 54, 56, 58, 52, 51, 67, 67, 57, 57, 62, 55, 53, 53, 64,
+    63, 54, 60, 62, 59, 67, 42, 60, 57, 63, 62, 53, 67, 51, 55, 53,
+    52, 48, 57, 60, 56, 55, 60, 48, 56, 55, 71, 60, 48, 49, 46, 54,
+    58, 59, 59, 56, 60, 57, 48, 64, 52, 47, 53, 59, 65, 62, 68, 56,
+    68, 57, 60, 60, 65, 49, 57, 56, 58, 59, 56, 67, 52, 56, 62, 50,
+    60, 53, 58, 62, 61, 64, 61, 62, 59, 56, 57, 55, 66, 55, 58, 61,
+    57, 63, 55, 63, 56, 59, 60, 55, 52, 48, 55, 70, 58, 56, 56, 60,
+    55, 54, 57, 58, 59, 48, 62, 58, 56, 49, 53, 60, 54, 56, 53, 55,
+    62, 59, 53, 63, 60, 56, 62, 50, 55, 53, 50, 60, 49, 63, 42, 64,
+    55, 63, 56, 59, 66, 56, 68, 55, 67, 62, 50, 65, 52, 58, 62, 65,
+    59, 66, 55, 59, 65, 65, 62, 52, 59, 60, 63, 61, 60, 49, 67, 59,
+    57, 55, 61, 44, 56, 57, 55, 58, 57, 70, 57, 57, 55, 67, 52, 63,
+    57, 57, 63, 52, 55, 51, 69, 54, 53, 49, 60, 70, 58, 60, 63, 56,
+    56, 52, 61, 55, 57, 45, 62, 68, 59, 58, 67, 68, 59, 61, 58, 68,
+    62, 52, 50, 53, 52, 52, 67, 54, 55, 55, 52, 56, 64, 55, 57, 59,
+    55, 59, 56, 50, 54, 49, 66, 57, 66, 58, 70, 52, 69, 55, 56, 62,
+    50, 61, 59, 47, 59, 58, 51, 64, 61, 62, 65, 55, 53, 55, 52, 61,
+    60, 56, 65, 57, 59, 53, 52, 53, 63, 49, 60, 49, 61, 53, 59, 59,
+    60, 54, 51, 52, 61, 59, 58, 65, 58, 47, 61, 56, 56, 57, 50, 52,
+    74, 63, 56, 53, 56, 56, 50, 52, 70, 59, 52, 62, 53, 60, 55, 59,
+    52, 58, 60, 61, 57, 59, 64, 50, 61, 54, 58, 62, 58, 49, 50, 56,
+    58, 54, 56, 53, 59, 55, 65, 55, 68, 61, 53, 51, 60, 58, 56, 50,
+    54, 53, 60, 57, 54, 58, 64, 50, 61, 52, 57, 59, 65, 57, 56, 46,
+    60, 61, 55, 55, 70, 54, 55, 49, 55, 61, 57, 59, 57, 54, 66, 57,
+    66, 57, 52, 53, 60, 53, 48, 57, 56, 65, 53, 59, 62, 58, 65, 59,
+    60, 65, 68, 49, 58, 68, 51, 61, 56, 58, 47, 62, 53, 52, 50, 57,
+    60, 61, 55, 64, 56, 56, 54, 53, 70, 51, 56, 47, 60, 59, 50, 58,
+    65, 54, 56, 60, 63, 54, 60, 58, 53, 61, 61, 62, 58, 55, 61, 63,
+    60, 61, 54, 61, 53, 62, 56, 62, 61, 54, 56, 67, 53, 63, 58, 60,
+    57, 61, 51, 58, 44, 51, 64, 54, 57, 46, 63, 59, 48, 64, 63, 64,
+    61, 51, 60, 52, 47, 54, 50, 65, 61, 53, 59, 42, 69, 62, 59, 60,
+    56, 59, 60, 59, 55, 58, 60, 52, 66, 65, 54, 53, 60, 57, 57, 53,
+    63, 61, 61, 57, 61, 52, 58, 67, 48, 58, 66, 57, 58, 63, 55, 60,
+    61, 55, 56, 52, 63, 50, 59, 52, 65, 64, 52, 57, 66, 50, 61, 55,
+    68, 58, 56, 60, 64, 57, 51, 53, 68, 51, 61, 50, 64, 62, 61, 56,
+    52, 61, 58, 59, 57, 57, 56, 56, 45, 59, 45, 64, 46, 62, 53, 51,
+    56, 64, 65, 61, 57, 51, 57, 72, 58, 53, 56, 54, 57, 45, 54, 64,
+    67, 54, 52, 60, 55, 61, 57, 57, 58, 53, 60, 71, 53, 61, 65, 53,
+    64, 59, 60, 61, 54, 50, 60, 60, 64, 55, 59, 58, 50, 59, 55, 62,
+    59, 56, 64, 56, 58, 59, 58, 58, 61, 54, 48, 64, 60, 50, 62, 53,
+    65, 59, 52, 58, 63, 57, 52, 52, 62, 46, 56, 51, 58, 56, 51, 58,
+    53, 62, 58, 66, 58, 52, 60, 49, 59, 58, 58, 57, 65, 53, 48, 60,
+    54, 65, 64, 58, 51, 64, 59, 61, 60, 58, 64, 57, 53, 67, 59, 55,
+    58, 66, 53, 62, 55, 56, 58, 54, 72, 59, 66, 60, 57, 61, 59, 52,
+    53, 57, 58, 67, 55, 60, 50, 60, 58, 67, 66, 53, 56, 42, 58, 59,
+    59, 55, 61, 55, 60, 55, 52, 56, 53, 62, 68, 51, 50, 57, 59, 55,
+    45, 64, 61, 59, 61, 56, 59, 60, 66, 48, 68, 64, 58, 55, 57, 64,
+    46, 64, 54, 52, 59, 57, 50, 48, 64, 50, 59, 63, 56, 63, 53, 49,
+    63, 54, 52, 53, 55, 60, 51, 56, 63, 51, 65, 49, 61, 66, 58, 60,
+    54, 64, 65, 42, 59, 51, 60, 61, 57, 50, 61, 57, 66, 61, 54, 53,
+    58, 56, 49, 66, 54, 67, 55, 50, 54, 58, 59, 56, 55, 59, 59, 59,
+    54, 59, 53, 63, 52, 59, 61, 63, 54, 65, 58, 62, 63, 62, 57, 52,
+    58, 51, 60, 62, 73, 58, 56, 56, 56, 54, 58, 54, 65, 59, 53, 59,
+    53, 58, 56, 66, 60, 56, 62, 56, 52, 58, 60, 60, 48, 68, 55, 50,
+    57, 62, 56, 54, 56, 44, 54, 64, 51, 63, 55, 64, 53, 62, 54, 55,
+    57, 51, 60, 57, 52, 57, 62, 59, 60, 57, 51, 55, 60, 62, 48, 61,
+    63, 47, 64, 51, 69, 64, 55, 58, 59, 49, 60, 53, 52, 58, 65, 64,
+    52, 62, 59, 59, 48, 56, 60, 59, 57, 56, 57, 48, 57, 52, 60, 59,
+    64, 71, 56, 51, 59, 61, 51, 55, 64, 62, 68, 52, 66, 57, 53, 57,
+    62, 54, 57, 63, 65, 49, 54, 51, 59, 55, 59, 64, 60, 60, 62, 57,
+    52, 68, 49, 62, 62, 55, 58, 56, 52, 51, 68, 55, 57, 57, 59, 56,
+    58, 54, 60, 63, 58, 58, 49, 55, 58, 50, 65, 57, 63, 61, 53, 51,
+    61, 60, 54, 62, 45, 59, 54, 56, 52, 56, 53, 67, 60, 46, 51, 54,
+    55, 60, 59, 54, 54, 62, 48, 62, 68, 55, 53, 55, 63, 55, 66, 59,
+    55, 65, 58, 51, 53, 61, 63, 55, 58, 57, 68, 60, 57, 56, 65, 57,
+    66, 66, 53, 55, 60, 57, 60, 63, 65, 51, 57, 48, 53, 52, 50, 57,
+    62, 50, 66, 64, 64, 61, 50, 58, 59, 59, 54, 53, 57, 63, 58, 54,
+    55, 63, 67, 56, 50, 66, 62, 57, 52, 59, 67, 63, 51, 58, 61, 69,
+    43, 62, 57, 62, 60, 50, 55, 53, 56, 65, 67, 53, 60, 57, 52, 47,
+    49, 56, 49, 48, 63, 49, 62, 61, 57, 62, 61, 61, 52, 57, 59, 46,
+    63, 51, 57, 66, 55, 62, 56, 53, 57, 65, 58, 62, 63, 56, 63, 57,
+    59, 54, 58, 57, 57, 52, 61, 50, 70, 54, 51, 57, 58, 62, 65, 59,
+    57, 52, 65, 56, 56, 47, 58, 51, 56, 61, 51, 54, 55, 56, 64, 53,
+    58, 56, 60, 56, 57, 66, 50, 51, 57, 65, 49, 61, 65, 54, 56, 59,
+    43, 53, 54, 62, 51, 58, 64, 59, 54, 59, 60, 53, 50, 57, 44, 56,
+    64, 56, 53, 57, 62, 64, 47, 53, 66, 59, 55, 61, 57, 64, 59, 54,
+    58, 48, 58, 60, 59, 54, 69, 61, 53, 53, 61, 57, 59, 58, 66, 61,
+    60, 47, 52, 58, 64, 60, 55, 64, 61, 51, 55, 44, 60, 47, 56, 71,
+    61, 54, 59, 44, 66, 60, 47, 58, 58, 62, 58, 61, 48, 65, 52, 60,
+    53, 54, 57, 57, 57, 64, 55, 57, 71, 56, 55, 58, 57, 46, 46, 57,
+    66, 57, 60, 60, 63, 57, 60, 66, 61, 49, 63, 58, 68, 51, 62, 65,
+    53, 46, 57, 61, 68, 54, 63, 63, 53, 59, 63, 58, 56, 64, 58, 52,
+    56, 62, 63, 56, 59, 66, 53, 70, 54, 53, 62, 60, 63, 69, 47, 54,
+    60, 53, 62, 50, 52, 68, 51, 52, 57, 57, 71, 51, 55, 58, 50, 54,
+    54, 58, 56, 50, 57, 54, 61, 58, 51, 55, 57, 62, 59, 56, 59, 62,
+    53, 59, 58, 51, 46, 59, 54, 52, 59, 64, 57, 56, 67, 51, 68, 61,
+    59, 58, 53, 56, 63, 53, 49, 54, 63, 60, 63, 62, 61, 56, 61, 57,
+    51, 67, 59, 59, 63, 56, 46, 52, 58, 69, 62, 62, 54, 54, 66, 60,
+    60, 58, 47, 58, 61, 51, 58, 51, 57, 68, 61, 60, 58, 53, 53, 58,
+    57, 55, 54, 65, 59, 55, 49, 63, 52, 56, 55, 59, 56, 69, 47, 57,
+    51, 62, 62, 72, 65, 55, 49, 57, 53, 65, 56, 43, 55, 63, 53, 50,
+    60, 50, 62, 56, 50, 45, 64, 56, 61, 58, 56, 62, 55, 62, 57, 51,
+    61, 53, 68, 61, 56, 48, 47, 52, 66, 52, 60, 51, 48, 56, 60, 60,
+    60, 62, 65, 49, 58, 64, 51, 59, 58, 52, 58, 56, 47, 59, 53, 52,
+    58, 57, 59, 55, 55, 63, 68, 64, 55, 60, 63, 53, 53, 55, 53, 53,
+    63, 65, 66, 55, 60, 61, 58, 55, 61, 56, 63, 57, 46, 55, 58, 57,
+    57, 61, 62, 57, 42, 57, 74, 59, 61, 53, 57, 58, 62, 66, 59, 58,
+    60, 57, 57, 66, 53, 57, 61, 67, 59, 48, 65, 59, 59, 54, 56, 53,
+    66, 48, 53, 64, 48, 56, 56, 64, 59, 58, 72, 61, 54, 58, 69, 63,
+    56, 64, 61, 53, 59, 49, 62, 56, 71, 54, 63, 46, 55, 50, 58, 64,
+    63, 57, 63, 53, 49, 53, 51, 52, 58, 53, 55, 51, 62, 63, 52, 55,
+    57, 57, 65, 62, 59, 63, 60, 57, 58, 69, 66, 58, 65, 62, 57, 57,
+    61, 50, 60, 56, 58, 61, 49, 59, 55, 63, 55, 68, 56, 52, 43, 65,
+    53, 50, 61, 64, 60, 61, 61, 51, 64, 60, 51, 64, 54, 55, 54, 54,
+    67, 59, 63, 65, 61, 56, 53, 53, 60, 47, 66, 50, 55, 56, 55, 59,
+    54, 53, 62, 54, 53, 67, 46, 57, 57, 50, 57, 58, 57, 56, 61, 52,
+    57, 55, 57, 50, 62, 62, 56, 64, 61, 56, 58, 61, 50, 58, 57, 54,
+    52, 52, 61, 44, 49, 62, 61, 56, 66, 60, 58, 49, 62, 59, 54, 59,
+    59, 59, 54, 56, 65, 57, 56, 62, 58, 50, 60, 57, 49, 56, 76, 57,
+    50, 55, 55, 60, 50, 66, 60, 55, 52, 64, 63, 54, 55, 56, 56, 57,
+    60, 58, 73, 57, 59, 58, 55, 57, 61, 66, 62, 44, 63, 59, 60, 59,
+    54, 47, 60, 64, 61, 57, 59, 58, 65, 54, 54, 59, 60, 61, 55, 65,
+    58, 46, 49, 59, 50, 62, 55, 55, 55, 56, 65, 63, 55, 53, 55, 50,
+    65, 58, 70, 48, 63, 61, 58, 49, 59, 58, 59, 51, 50, 58, 55, 57,
+    59, 54, 56, 58, 57, 66, 53, 65, 58, 56, 62, 55, 59, 45, 51, 62,
+    60, 60, 55, 63, 62, 54, 65, 61, 48, 58, 57, 51, 61, 51, 59, 54,
+    58, 52, 55, 58, 60, 52, 54, 48, 54, 53, 71, 48, 63, 60, 64, 58,
+    59, 50, 60, 59, 70, 61, 65, 57, 64, 64, 58, 53, 63, 50, 63, 52,
+    53, 60, 56, 59, 64, 57, 52, 57, 61, 59, 59, 53, 51, 48, 53, 65,
+    64, 63, 58, 59, 61, 60, 48, 70, 46, 50, 48, 64, 56, 66, 56, 64,
+    57, 54, 55, 68, 54, 60, 48, 58, 46, 58, 53, 52, 54, 63, 47, 57,
+    63, 60, 61, 56, 51, 59, 51, 56, 58, 67, 56, 63, 55, 54, 67, 57,
+    62, 62, 53, 61, 65, 53, 58, 51, 50, 56, 58, 50, 58, 57, 68, 50,
+    55, 56, 54, 57, 62, 54, 48, 52, 63, 50, 56, 55, 60, 53, 52, 54,
+    64, 70, 58, 46, 61, 62, 55, 58, 62, 53, 57, 56, 53, 54, 61, 54,
+    48, 66, 52, 54, 58, 61, 55, 62, 56, 61, 47, 50, 56, 53, 63, 67,
+    60, 54, 42, 65, 48, 55, 58, 56, 56, 66, 53, 65, 60, 54, 60, 49,
+    48, 54, 63, 59, 52, 66, 52, 48, 59, 59, 68, 53, 63, 51, 63, 57,
+    73, 59, 63, 61, 57, 63, 61, 62, 51, 67, 65, 50, 58, 55, 67, 53,
+    55, 57, 66, 58, 50, 66, 57, 57, 46, 59, 60, 59, 60, 62, 57, 58,
+    56, 63, 52, 57, 49, 60, 51, 56, 67, 50, 60, 47, 58, 61, 67, 60,
+    56, 46, 60, 63, 51, 55, 60, 55, 61, 58, 59, 67, 61, 61, 53, 62,
+    57, 59, 61, 61, 63, 63, 55, 64, 50, 50, 50, 50, 51, 62, 43, 42,
+    57, 56, 50, 54, 53, 59, 57, 53, 53, 57, 57, 64, 69, 55, 56, 58,
+    56, 62, 60, 53, 58, 59, 54, 61, 66, 53, 57, 55, 60, 46, 64, 63,
+    51, 55, 69, 57, 59, 53, 54, 54, 63, 58, 52, 49, 65, 70, 61, 50,
+    56, 55, 55, 55, 60, 56, 54, 54, 47, 55, 54, 55, 49, 54, 50, 48,
+    65, 59, 60, 66, 52, 53, 55, 48, 52, 53, 54, 51, 59, 49, 52, 64,
+    36, 61, 62, 54, 47, 72, 65, 56, 56, 61, 58, 64, 53, 61, 49, 56,
+    65, 56, 63, 57, 60, 59, 60, 52, 56, 60, 63, 55, 58, 54, 62, 58,
+    56, 67, 60, 64, 45, 51, 57, 60, 61, 52, 56, 51, 57, 62, 60, 64,
+    52, 52, 52, 55, 59, 54, 69, 59, 59, 63, 67, 57, 53, 63, 52, 59,
+    63, 58, 54, 59, 55, 52, 62, 61, 59, 70, 53, 57, 63, 56, 61, 60,
+    59, 53, 58, 59, 58, 51, 46, 60, 62, 61, 51, 69, 62, 55, 56, 58,
+    53, 55, 60, 57, 57, 65, 60, 55, 54, 66, 53, 60, 54, 55, 58, 55,
+    54, 58, 55, 57, 61, 54, 56, 67, 66, 59, 53, 65, 51, 55, 58, 60,
+    56, 56, 48, 67, 62, 53, 58, 53, 64, 54, 62, 55, 59, 49, 50, 53,
+    61, 61, 63, 63, 61, 58, 59, 60, 57, 62, 50, 55, 54, 51, 60, 60,
+    77, 44, 54, 45, 65, 55, 64, 58, 53, 59, 63, 56, 55, 55, 55, 44,
+    71, 58, 62, 53, 65, 59, 69, 54, 60, 54, 56, 55, 57, 53, 70, 63,
+    66, 56, 58, 58, 69, 52, 58, 58, 51, 69, 59, 56, 51, 67, 62, 66,
+    58, 60, 58, 60, 59, 57, 63, 53, 61, 64, 60, 53, 46, 61, 67, 63,
+    56, 66, 62, 52, 60, 50, 65, 57, 58, 55, 56, 54, 58, 63, 56, 53,
+    65, 48, 59, 53, 57, 58, 50, 54, 54, 56, 53, 62, 53, 58, 62, 60,
+    55, 61, 50, 69, 50, 53, 52, 64, 59, 67, 53, 56, 48, 56, 62, 64,
+    60, 56, 59, 61, 48, 53, 53, 56, 57, 68, 66, 49, 59, 51, 54, 60,
+    65, 68, 58, 56, 63, 51, 51, 56, 60, 53, 62, 54, 61, 62, 50, 62,
+    61, 54, 52, 55, 52, 50, 61, 54, 61, 61, 55, 45, 60, 46, 53, 68,
+    50, 57, 64, 53, 60, 55, 49, 63, 54, 61, 57, 63, 58, 54, 60, 59,
+    59, 57, 55, 50, 56, 50, 61, 50, 55, 51, 50, 53, 65, 54, 57, 54,
+    59, 62, 58, 61, 58, 54, 58, 49, 61, 49, 58, 55, 72, 58, 58, 61,
+    54, 55, 69, 54, 55, 59, 55, 50, 56, 61, 54, 57, 58, 50, 60, 56,
+    52, 54, 52, 62, 52, 60, 65, 60, 48, 54, 64, 63, 55, 72, 56, 53,
+    59, 59, 56, 56, 50, 56, 58, 64, 57, 49, 63, 64, 46, 61, 52, 55,
+    59, 56, 58, 64, 62, 53, 56, 60, 59, 59, 56, 52, 58, 53, 60, 57,
+    45, 57, 57, 66, 62, 59, 60, 56, 57, 58, 56, 65, 66, 52, 69, 61,
+    54, 54, 59, 60, 54, 68, 45, 63, 47, 50, 53, 65, 55, 65, 63, 59,
+    45, 66, 58, 44, 55, 64, 60, 54, 67, 54, 58, 53, 60, 61, 61, 67,
+    58, 59, 55, 63, 46, 61, 58, 60, 64, 55, 69, 55, 55, 57, 54, 64,
+    61, 47, 55, 63, 54, 62, 60, 60, 55, 45, 51, 47, 46, 60, 58, 51,
+    55, 68, 56, 56, 61, 63, 59, 59, 62, 52, 48, 58, 59, 46, 55, 53,
+    51, 57, 63, 53, 61, 54, 50, 59, 52, 56, 57, 56, 58, 58, 68, 58,
+    59, 61, 54, 55, 55, 54, 62, 62, 52, 58, 57, 62, 52, 61, 64, 47,
+    61, 52, 58, 68, 62, 54, 64, 57, 52, 59, 67, 56, 57, 62, 55, 72,
+    53, 60, 53, 61, 59, 51, 60, 55, 50, 58, 54, 63, 60, 59, 68, 56,
+    67, 52, 50, 64, 62, 56, 52, 68, 54, 57, 67, 65, 65, 58, 64, 60,
+    50, 60, 44, 59, 48, 58, 53, 50, 60, 53, 64, 66, 56, 63, 58, 54,
+    68, 61, 63, 46, 58, 59, 57, 61, 59, 51, 58, 54, 59, 58, 56, 65,
+    51, 57, 53, 59, 55, 54, 64, 58, 60, 57, 47, 44, 72, 57, 53, 58,
+    50, 58, 63, 49, 59, 53, 57, 58, 52, 54, 58, 52, 64, 55, 48, 53,
+    52, 62, 53, 60, 53, 62, 58, 66, 54, 62, 58, 57, 66, 52, 63, 58,
+    48, 58, 65, 45, 62, 63, 41, 58, 51, 59, 59, 66, 61, 61, 57, 62,
+    59, 66, 58, 59, 51, 54, 60, 67, 51, 56, 53, 53, 54, 55, 59, 58,
+    62, 61, 58, 49, 63, 55, 65, 59, 43, 74, 64, 59, 48, 65, 56, 56,
+    57, 61, 48, 68, 55, 43, 62, 47, 53, 54, 58, 55, 58, 65, 63, 64,
+    62, 62, 54, 69, 58, 57, 51, 65, 63, 67, 54, 50, 53, 58, 50, 53,
+    61, 50, 50, 56, 54, 58, 52, 53, 60, 59, 64, 64, 61, 61, 58, 58,
+    54, 53, 49, 61, 50, 57, 55, 63, 62, 57, 51, 53, 60, 63, 63, 52,
+    55, 67, 47, 53, 66, 55, 66, 51, 53, 63, 51, 67, 57, 58, 61, 71,
+    45, 57, 62, 60, 56, 51, 69, 51, 52, 53, 53, 60, 51, 62, 57, 57,
+    60, 58, 64, 66, 58, 52, 48, 68, 56, 60, 58, 51, 52, 48, 54, 52,
+    62, 50, 59, 59, 55, 64, 46, 64, 59, 55, 63, 58, 61, 58, 61, 57,
+    53, 56, 52, 50, 64, 56, 58, 61, 56, 57, 58, 53, 57, 60, 65, 54,
+    60, 58, 49, 59, 53, 61, 55, 58, 56, 54, 57, 51, 53, 56, 63, 54,
+    50, 50, 59, 66, 60, 57, 54, 57, 52, 58, 55, 52, 60, 59, 54, 52,
+    59, 70, 49, 47, 62, 60, 74, 64, 53, 61, 56, 54, 63, 65, 60, 71,
+    53, 63, 60, 57, 50, 47, 53, 54, 54, 59, 54, 58, 66, 63, 60, 45,
+    47, 61, 59, 58, 62, 58, 63, 53, 59, 42, 54, 47, 65, 51, 67, 49,
+    58, 72, 45, 53, 58, 53, 49, 71, 52, 52, 52, 62, 52, 62, 62, 51,
+    58, 53, 53, 61, 54, 58, 53, 63, 67, 59, 48, 63, 54, 59, 59, 66,
+    65, 50, 63, 56, 54, 59, 64, 54, 51, 57, 55, 54, 54, 62, 53, 61,
+    54, 62, 60, 52, 59, 61, 58, 52, 60, 62, 55, 58, 58, 55, 67, 62,
+    51, 61, 53, 48, 44, 59, 51, 71, 53, 58, 51, 54, 53, 61, 58, 54,
+    61, 43, 59, 69, 63, 59, 52, 48, 67, 62, 58, 56, 58, 63, 70, 54,
+    58, 53, 51, 57, 54, 52, 54, 64, 48, 63, 64, 45, 53, 64, 54, 69,
+    59, 46, 52, 63, 57, 51, 48, 61, 59, 48, 72, 52, 66, 58, 47, 63,
+    59, 60, 59, 57, 55, 56, 53, 55, 63, 57, 71, 64, 53, 53, 60, 60,
+    53, 56, 56, 66, 55, 62, 56, 59, 47, 48, 60, 56, 54, 56, 49, 56,
+    49, 67, 60, 53, 53, 65, 59, 55, 64, 59, 52, 59, 53, 58, 60, 63,
+    52, 61, 61, 69, 60, 54, 54, 66, 54, 59, 56, 54, 62, 58, 60, 65,
+    55, 54, 59, 62, 56, 61, 59, 57, 53, 59, 64, 58, 60, 68, 68, 56,
+    54, 65, 52, 56, 67, 62, 51, 59, 47, 53, 53, 49, 51, 58, 51, 52,
+    57, 54, 55, 69, 63, 66, 58, 54, 64, 54, 53, 62, 60, 50, 44, 60,
+    51, 66, 59, 65, 54, 66, 60, 59, 59, 59, 57, 51, 61, 53, 59, 56,
+    55, 58, 53, 64, 43, 61, 62, 56, 61, 54, 65, 61, 50, 59, 55, 62,
+    53, 63, 65, 56, 56, 56, 56, 60, 54, 45, 59, 59, 66, 48, 65, 56,
+    53, 55, 55, 57, 56, 59, 57, 60, 73, 71, 59, 49, 55, 52, 62, 60,
+    63, 61, 50, 56, 64, 71, 66, 53, 57, 64, 58, 51, 58, 61, 54, 54,
+    61, 55, 52, 54, 53, 63, 49, 61, 62, 56, 60, 51, 58, 58, 49, 63,
+    53, 50, 64, 62, 63, 53, 57, 63, 55, 62, 55, 49, 58, 62, 51, 53,
+    53, 66, 63, 55, 66, 54, 45, 59, 60, 63, 59, 58, 61, 58, 51, 59,
+    47, 58, 60, 62, 62, 52, 59, 47, 56, 58, 56, 63, 57, 62, 69, 58,
+    61, 61, 57, 58, 57, 55, 53, 68, 51, 59, 66, 44, 59, 62, 60, 50,
+    63, 53, 64, 55, 62, 59, 50, 61, 54, 53, 54, 56, 62, 71, 53, 61,
+    56, 58, 65, 55, 59, 64, 60, 62, 60, 63, 69, 44, 60, 55, 53, 66,
+    60, 60, 56, 61, 55, 57, 56, 61, 54, 49, 59, 43, 58, 55, 69, 53,
+    61, 62, 53, 49, 56, 71, 59, 61, 63, 52, 60, 51, 53, 65, 60, 71,
+    45, 45, 62, 49, 61, 57, 60, 48, 51, 54, 72, 59, 48, 50, 64, 52,
+    57, 57, 64, 54, 51, 49, 62, 54, 59, 47, 56, 63, 57, 56, 61, 51,
+    64, 58, 64, 52, 62, 56, 62, 67, 56, 57, 51, 58, 54, 73, 65, 55,
+    46, 54, 54, 55, 57, 52, 55, 69, 57, 57, 44, 56, 70, 53, 54, 57,
+    45, 57, 58, 43, 60, 49, 50, 63, 66, 53, 61, 62, 51, 64, 54, 65,
+    51, 70, 61, 69, 54, 59, 57, 60, 54, 58, 59, 57, 49, 62, 62, 57,
+    56, 62, 53, 54, 60, 53, 57, 57, 55, 73, 63, 63, 61, 55, 50, 53,
+    61, 59, 57, 50, 53, 56, 47, 64, 58, 61, 58, 50, 57, 54, 51, 65,
+    59, 58, 53, 66, 56, 70, 52, 51, 56, 58, 54, 61, 57, 58, 57, 57,
+    67, 48, 57, 51, 63, 53, 45, 60, 65, 52, 64, 51, 58, 49, 58, 60,
+    55, 58, 52, 67, 54, 65, 59, 52, 63, 58, 66, 68, 61, 60, 56, 55,
+    55, 59, 54, 63, 55, 55, 60, 67, 60, 65, 47, 52, 58, 55, 54, 66,
+    57, 59, 56, 57, 62, 46, 43, 56, 55, 48, 60, 51, 56, 51, 54, 54,
+    57, 58, 61, 62, 65, 45, 64, 61, 55, 57, 50, 57, 58, 57, 53, 60,
+    65, 61, 49, 52, 56, 55, 63, 55, 61, 54, 51, 55, 61, 59, 53, 52,
+    50, 55, 61, 54, 65, 62, 49, 47, 54, 68, 60, 58, 55, 55, 62, 62,
+    66, 61, 47, 66, 51, 62, 65, 57, 54, 46, 56, 63, 56, 57, 45, 61,
+    58, 54, 59, 54, 52, 55, 58, 67, 57, 54, 64, 55, 56, 59, 52, 56,
+    56, 59, 51, 60, 56, 53, 59, 62, 63, 47, 49, 61, 57, 54, 57, 53,
+    58, 57, 58, 63, 53, 58, 58, 62, 62, 57, 55, 55, 52, 61, 58, 57,
+    57, 60, 55, 59, 49, 59, 64, 49, 60, 59, 46, 59, 59, 56, 62, 63,
+    53, 50, 56, 57, 50, 57, 62, 56, 54, 75, 58, 65, 57, 49, 55, 59,
+    61, 54, 63, 63, 53, 65, 59, 52, 46, 60, 64, 56, 55, 50, 66, 62,
+    58, 52, 63, 67, 62, 60, 56, 59, 62, 66, 61, 54, 62, 55, 57, 60,
+    49, 64, 57, 58, 57, 48, 50, 61, 52, 53, 60, 58, 56, 68, 61, 57,
+    67, 56, 57, 61, 64, 58, 58, 56, 56, 56, 60, 52, 63, 49, 67, 60,
+    52, 49, 70, 52, 56, 50, 62, 53, 52, 57, 62, 61, 56, 58, 51, 59,
+    63, 57, 57, 52, 61, 67, 58, 57, 60, 61, 56, 53, 45, 52, 51, 59,
+    72, 63, 62, 53, 49, 58, 60, 68, 57, 58, 63, 55, 68, 57, 63, 60,
+    58, 50, 60, 54, 58, 59, 60, 54, 65, 53, 54, 56, 46, 48, 64, 62,
+    55, 61, 54, 47, 46, 67, 63, 65, 59, 53, 60, 60, 50, 51, 66, 61,
+    60, 62, 56, 56, 49, 43, 64, 67, 56, 64, 57, 49, 53, 66, 55, 56,
+    63, 66, 60, 54, 61, 57, 55, 60, 63, 60, 58, 54, 63, 59, 53, 68,
+    55, 61, 52, 54, 60, 54, 53, 55, 60, 62, 52, 56, 65, 58, 60, 67,
+    48, 59, 48, 60, 60, 59, 58, 58, 59, 59, 64, 58, 52, 51, 53, 47,
+    65, 56, 67, 52, 60, 58, 51, 63, 51, 58, 55, 53, 52, 57, 63, 66,
+    51, 59, 50, 55, 52, 62, 65, 65, 60, 55, 62, 62, 48, 60, 65, 58,
+    66, 68, 58, 66, 61, 59, 52, 53, 50, 56, 61, 54, 62, 58, 50, 54,
+    63, 56, 45, 58, 71, 57, 60, 52, 57, 56, 53, 63, 62, 57, 52, 57,
+    57, 50, 53, 52, 61, 51, 54, 59, 63, 49, 55, 45, 57, 57, 57, 62,
+    65, 48, 50, 60, 58, 54, 63, 52, 51, 62, 62, 56, 60, 58, 52, 66,
+    50, 63, 54, 58, 60, 48, 52, 59, 49, 55, 49, 67, 50, 55, 55, 72,
+    56, 58, 55, 64, 55, 64, 58, 53, 56, 55, 53, 63, 58, 60, 59, 49,
+    60, 52, 61, 56, 50, 54, 53, 60, 54, 60, 47, 59, 61, 60, 64, 65,
+    54, 63, 52, 57, 64, 50, 54, 63, 62, 56, 64, 56, 53, 50, 52, 49,
+    59, 60, 62, 49, 56, 65, 58, 62, 47, 68, 47, 56, 53, 54, 63, 55,
+    61, 55, 59, 55, 56, 50, 63, 59, 64, 61, 61, 56, 56, 53, 64, 50,
+    54, 60, 57, 67, 62, 66, 61, 56, 55, 54, 52, 54, 46, 67, 54, 68,
+    59, 49, 51, 52, 54, 54, 55, 62, 61, 52, 65, 59, 56, 64, 62, 55,
+    58, 52, 62, 68, 51, 64, 52, 48, 56, 55, 56, 54, 63, 49, 58, 69,
+    62, 57, 59, 54, 60, 59, 60, 52, 59, 60, 59, 58, 62, 49, 58, 59,
+    60, 57, 67, 53, 61, 60, 52, 57, 50, 63, 62, 54, 65, 53, 60, 63,
+    59, 56, 52, 48, 56, 44, 54, 52, 55, 55, 56, 64, 63, 54, 64, 57,
+    56, 56, 59, 63, 58, 51, 54, 57, 64, 59, 45, 60, 60, 50, 49, 54,
+    62, 61, 61, 52, 60, 62, 57, 61, 48, 57, 51, 57, 46, 64, 65, 58,
+    54, 63, 56, 54, 64, 64, 55, 57, 59, 52, 69, 63, 53, 62, 57, 63,
+    62, 48, 50, 62, 55, 60, 57, 51, 68, 54, 62, 61, 52, 57, 71, 57,
+    58, 57, 45, 60, 55, 58, 51, 59, 45, 47, 60, 57, 63, 59, 49, 56,
+    60, 55, 52, 56, 52, 68, 58, 57, 62, 53, 43, 64, 63, 58, 67, 60,
+    67, 64, 55, 57, 64, 65, 52, 59, 74, 60, 61, 54, 66, 49, 60, 55,
+    68, 62, 43, 66, 59, 56, 54, 62, 61, 61, 58, 67, 56, 53, 59, 64,
+    52, 61, 52, 61, 58, 54, 62, 59, 56, 66, 58, 56, 58, 50, 60, 64,
+    57, 54, 60, 63, 54, 62, 55, 62, 48, 50, 53, 49, 61, 56, 58, 57,
+    63, 61, 57, 61, 62, 64, 56, 57, 57, 47, 56, 60, 51, 52, 55, 60,
+    58, 67, 58, 61, 49, 53, 54, 50, 55, 56, 54, 49, 67, 55, 61, 57,
+    54, 68, 57, 49, 58, 43, 68, 54, 59, 61, 61, 57, 59, 51, 55, 59,
+    63, 43, 60, 65, 57, 58, 59, 52, 55, 65, 56, 65, 53, 57, 56, 58,
+    67, 57, 63, 62, 54, 63, 53, 53, 58, 59, 56, 60, 64, 66, 53, 46,
+    59, 58, 50, 67, 59, 55, 54, 61, 43, 61, 55, 55, 55, 53, 60, 57,
+    56, 58, 60, 59, 66, 55, 53, 60, 59, 56, 59, 58, 57, 56, 64, 57,
+    53, 60, 45, 53, 61, 53, 58, 55, 54, 48, 56, 63, 67, 62, 53, 62,
+    53, 58, 45, 59, 54, 53, 61, 55, 58, 59, 58, 63, 64, 61, 64, 55,
+    66, 53, 51, 59, 56, 49, 57, 58, 56, 61, 58, 61, 60, 53, 56, 60,
+    58, 62, 54, 67, 50, 56, 64, 63, 58, 65, 61, 59, 61, 64, 64, 58,
+    55, 61, 57, 48, 60, 48, 52, 59, 51, 52, 56, 63, 50, 63, 52, 53,
+    58, 52, 53, 69, 64, 58, 59, 64, 58, 55, 52, 51, 61, 56, 59, 56,
+    49, 60, 62, 65, 57, 51, 60, 59, 48, 53, 49, 55, 71, 53, 51, 54,
+    58, 44, 59, 55, 57, 66, 51, 60, 59, 67, 53, 58, 58, 52, 64, 54,
+    52, 56, 66, 61, 61, 56, 50, 57, 55, 58, 56, 69, 48, 52, 57, 62,
+    59, 57, 56, 65, 62, 58, 58, 55, 70, 57, 53, 64, 63, 62, 59, 55,
+    72, 58, 55, 59, 55, 57, 63, 65, 52, 61, 57, 56, 58, 57, 53, 70,
+    61, 55, 52, 54, 61, 54, 57, 62, 53, 48, 51, 65, 58, 65, 60, 55,
+    53, 57, 63, 52, 63, 62, 50, 53, 50, 57, 56, 57, 53, 59, 61, 47,
+    64, 56, 62, 61, 63, 62, 51, 66, 54, 59, 53, 63, 54, 62, 63, 56,
+    58, 57, 60, 50, 51, 61, 52, 61, 59, 53, 53, 54, 56, 65, 60, 63,
+    45, 62, 52, 71, 60, 58, 58, 61, 51, 59, 46, 45, 50, 50, 55, 61,
+    57, 57, 65, 56, 60, 52, 52, 52, 59, 55, 49, 63, 57, 55, 57, 51,
+    56, 65, 58, 54, 63, 51, 57, 54, 51, 69, 41, 59, 67, 48, 59, 68,
+    62, 45, 60, 60, 56, 56, 55, 53, 51, 62, 62, 61, 49, 71, 61, 65,
+    48, 58, 57, 49, 51, 62, 54, 52, 67, 54, 58, 54, 62, 51, 64, 57,
+    59, 59, 70, 61, 54, 51, 66, 57, 59, 59, 51, 60, 53, 54, 60, 56,
+    54, 53, 64, 70, 45, 51, 60, 57, 64, 56, 51, 55, 64, 59, 51, 60,
+    61, 56, 55, 55, 64, 51, 55, 51, 58, 52, 58, 50, 52, 44, 60, 49,
+    66, 59, 63, 59, 66, 56, 53, 51, 63, 48, 57, 65, 46, 56, 66, 57,
+    56, 51, 66, 53, 62, 58, 58, 59, 58, 63, 54, 59, 53, 55, 57, 51,
+    58, 65, 61, 61, 44, 58, 61, 60, 60, 51, 53, 63, 59, 52, 53, 59,
+    65, 67, 43, 51, 50, 55, 56, 62, 56, 56, 46, 63, 53, 61, 59, 57,
+    56, 61, 56, 58, 48, 58, 55, 51, 54, 57, 62, 67, 57, 62, 53, 61,
+    52, 59, 49, 60, 60, 59, 67, 61, 59, 65, 55, 53, 58, 51, 47, 62,
+    58, 63, 57, 53, 49, 66, 57, 59, 46, 58, 62, 55, 60, 58, 53, 60,
+    51, 48, 51, 55, 61, 53, 47, 49, 64, 63, 52, 47, 63, 57, 58, 43,
+    60, 66, 59, 57, 46, 52, 58, 57, 67, 56, 51, 61, 49, 58, 59, 56,
+    67, 46, 60, 52, 64, 71, 63, 56, 46, 50, 59, 63, 51, 64, 53, 51,
+    63, 50, 59, 57, 49, 60, 54, 57, 62, 61, 50, 60, 59, 52, 62, 64,
+    62, 56, 56, 54, 62, 60, 63, 60, 54, 56, 58, 59, 62, 50, 57, 55,
+    47, 52, 65, 57, 54, 63, 56, 54, 54, 52, 50, 58, 61, 54, 59, 56,
+    60, 61, 57, 58, 51, 46, 62, 58, 58, 57, 58, 55, 57, 49, 50, 61,
+    60, 59, 53, 59, 58, 62, 57, 52, 51, 50, 70, 56, 54, 63, 54, 48,
+    53, 61, 60, 53, 55, 59, 55, 58, 64, 55, 62, 64, 54, 59, 56, 59,
+    64, 55, 50, 48, 55, 57, 58, 52, 60, 67, 55, 55, 57, 62, 61, 73,
+    55, 53, 66, 67, 58, 61, 56, 49, 59, 48, 53, 58, 59, 61, 58, 66,
+    50, 53, 62, 61, 63, 53, 55, 60, 64, 68, 50, 55, 49, 61, 63, 53,
+    62, 58, 49, 63, 54, 49, 57, 59, 62, 59, 46, 65, 67, 59, 56, 63,
+    53, 46, 58, 59, 63, 51, 52, 54, 57, 56, 66, 56, 52, 56, 56, 61,
+    60, 49, 55, 70, 58, 67, 58, 56, 58, 53, 50, 71, 64, 44, 51, 65,
+    52, 54, 52, 47, 58, 54, 58, 56, 61, 58, 56, 57, 59, 58, 64, 48,
+    63, 54, 50, 69, 55, 56, 51, 58, 50, 59, 56, 52, 56, 53, 60, 59,
+    55, 47, 61, 54, 62, 61, 56, 52, 55, 57, 57, 61, 61, 58, 56, 55,
+    67, 49, 53, 56, 61, 47, 50, 61, 62, 48, 62, 64, 58, 55, 67, 54,
+    60, 61, 48, 59, 55, 60, 41, 55, 61, 57, 51, 65, 54, 54, 58, 56,
+    57, 48, 52, 58, 63, 55, 61, 60, 64, 50, 63, 66, 86, 54, 44, 68,
+    52, 60, 61, 60, 55, 57, 54, 62, 65, 65, 54, 65, 47, 65, 65, 52,
+    57, 61, 53, 66, 58, 46, 60, 53, 52, 66, 60, 59, 47, 63, 60, 58,
+    64, 51, 63, 54, 59, 60, 59, 60, 56, 42, 60, 51, 62, 61, 56, 59,
+    71, 60, 61, 61, 52, 58, 62, 53, 60, 53, 65, 55, 55, 55, 67, 70,
+    47, 51, 47, 53, 60, 53, 56, 63, 47, 54, 63, 58, 56, 65, 60, 62,
+    63, 53, 59, 59, 61, 56, 47, 58, 70, 58, 57, 46, 58, 54, 50, 62,
+    55, 63, 62, 54, 63, 62, 55, 55, 59, 58, 65, 53, 46, 54, 51, 56,
+    65, 64, 61, 59, 58, 62, 54, 51, 63, 70, 57, 58, 60, 50, 47, 59,
+    61, 58, 50, 60, 53, 51, 46, 61, 56, 53, 53, 61, 55, 52, 52, 48,
+    62, 56, 57, 53, 56, 65, 58, 68, 60, 53, 51, 50, 56, 66, 60, 55,
+    48, 54, 54, 67, 62, 53, 47, 56, 57, 62, 53, 56, 65, 55, 58, 53,
+    54, 55, 57, 59, 55, 71, 43, 58, 65, 61, 50, 61, 53, 54, 59, 66,
+    61, 63, 58, 50, 56, 53, 62, 52, 57, 56, 61, 62, 51, 54, 48, 52,
+    63, 56, 60, 60, 65, 51, 63, 66, 48, 49, 62, 55, 66, 55, 59, 64,
+    64, 56, 66, 55, 56, 55, 53, 54, 48, 53, 65, 62, 55, 52, 50, 49,
+    61, 62, 57, 64, 57, 56, 59, 56, 57, 60, 58, 49, 59, 62, 60, 44,
+    51, 60, 59, 57, 60, 58, 61, 61, 54, 60, 59, 50, 64, 61, 54, 57,
+    66, 52, 49, 60, 52, 58, 46, 59, 60, 56, 44, 59, 53, 59, 51, 58,
+    57, 58, 54, 54, 61, 64, 53, 53, 54, 58, 61, 52, 62, 51, 51, 56,
+    56, 55, 51, 60, 63, 51, 47, 50, 65, 58, 53, 54, 62, 53, 49, 69,
+    59, 62, 61, 49, 57, 50, 62, 53, 59, 61, 56, 56, 60, 57, 61, 50,
+    53, 57, 58, 62, 60, 58, 43, 58, 60, 58, 63, 61, 59, 53, 39, 63,
+    46, 59, 67, 59, 54, 51, 56, 53, 53, 60, 50, 64, 55, 61, 51, 53,
+    64, 58, 59, 58, 62, 54, 63, 50, 50, 69, 58, 57, 57, 60, 60, 44,
+    57, 61, 53, 62, 60, 56, 56, 67, 52, 55, 57, 55, 52, 54, 64, 56,
+    51, 65, 52, 64, 57, 61, 51, 51, 58, 51, 54, 54, 62, 64, 56, 46,
+    52, 51, 65, 58, 62, 58, 61, 62, 65, 55, 60, 58, 55, 58, 51, 63,
+    64, 56, 53, 55, 52, 56, 62, 61, 57, 65, 55, 60, 65, 54, 58, 58,
+    65, 59, 57, 50, 55, 65, 67, 57, 62, 58, 74, 55, 60, 63, 53, 52,
+    52, 57, 62, 56, 53, 56, 62, 62, 62, 53, 58, 54, 54, 55, 66, 54,
+    60, 57, 57, 62, 54, 61, 55, 54, 62, 55, 56, 49, 60, 57, 59, 56,
+    65, 49, 61, 59, 52, 67, 51, 68, 51, 69, 52, 56, 53, 57, 62, 68,
+    62, 56, 57, 51, 61, 58, 65, 61, 56, 55, 52, 66, 63, 57, 51, 55,
+    58, 45, 56, 61, 64, 51, 51, 61, 52, 51, 55, 62, 60, 60, 58, 64,
+    51, 58, 52, 53, 52, 57, 60, 54, 56, 69, 46, 56, 74, 61, 69, 55,
+    62, 54, 66, 50, 58, 56, 62, 53, 60, 62, 57, 57, 54, 58, 64, 42,
+    54, 57, 61, 54, 47, 57, 65, 59, 53, 58, 57, 65, 59, 59, 59, 56,
+    55, 59, 52, 58, 52, 69, 57, 60, 54, 58, 56, 51, 69, 55, 61, 52,
+    58, 54, 53, 56, 51, 57, 51, 50, 58, 57, 52, 53, 52, 48, 63, 53,
+    58, 49, 59, 49, 56, 57, 58, 56, 56, 51, 56, 54, 61, 50, 57, 60,
+    52, 59, 66, 57, 50, 55, 61, 50, 47, 68, 50, 56, 59, 53, 50, 62,
+    53, 53, 61, 59, 52, 59, 63, 69, 54, 48, 61, 51, 51, 54, 60, 58,
+    53, 60, 58, 49, 54, 64, 55, 64, 54, 61, 54, 62, 55, 62, 57, 55,
+    52, 54, 52, 61, 60, 55, 61, 59, 55, 58, 50, 67, 52, 51, 60, 56,
+    56, 58, 56, 64, 60, 61, 57, 58, 63, 58, 51, 62, 63, 61, 55, 63,
+    59, 60, 62, 59, 48, 47, 52, 55, 57, 55, 58, 61, 52, 52, 58, 66,
+    51, 58, 54, 57, 62, 57, 63, 55, 52, 63, 56, 52, 63, 56, 65, 52,
+    65, 52, 67, 56, 59, 51, 46, 56, 51, 61, 61, 54, 58, 51, 57, 57,
+    58, 64, 50, 65, 53, 55, 59, 52, 54, 54, 51, 61, 50, 48, 65, 54,
+    60, 51, 56, 53, 63, 66, 63, 55, 50, 62, 49, 52, 52, 58, 61, 64,
+    57, 65, 62, 57, 58, 55, 61, 55, 57, 59, 54, 56, 59, 55, 55, 64,
+    62, 56, 58, 61, 59, 58, 58, 58, 65, 61, 56, 54, 58, 61, 50, 57,
+    57, 51, 62, 55, 60, 62, 54, 54, 63, 51, 50, 60, 58, 60, 69, 54,
+    65, 51, 57, 55, 51, 54, 46, 62, 66, 55, 57, 56, 67, 56, 58, 49,
+    56, 52, 55, 69, 59, 57, 56, 51, 60, 65, 62, 61, 60, 47, 56, 64,
+    66, 60, 45, 56, 44, 59, 53, 61, 57, 53, 51, 54, 57, 64, 60, 68,
+    59, 58, 62, 57, 45, 57, 54, 59, 56, 61, 54, 60, 51, 54, 60, 63,
+    57, 54, 59, 66, 58, 67, 62, 52, 54, 59, 60, 53, 58, 58, 55, 58,
+    47, 62, 60, 55, 62, 47, 51, 51, 55, 49, 56, 56, 55, 64, 66, 57,
+    47, 51, 64, 66, 61, 65, 51, 59, 57, 62, 63, 56, 54, 46, 53, 53,
+    54, 57, 59, 63, 62, 54, 52, 55, 56, 54, 53, 56, 62, 60, 61, 57,
+    48, 61, 51, 54, 59, 52, 58, 48, 52, 57, 54, 57, 62, 64, 47, 63,
+    59, 54, 61, 52, 58, 60, 61, 60, 47, 59, 53, 60, 49, 57, 61, 47,
+    57, 58, 55, 56, 54, 63, 73, 52, 56, 57, 60, 48, 60, 67, 52, 58,
+    58, 52, 51, 57, 51, 65, 55, 57, 56, 50, 56, 53, 62, 58, 58, 62,
+    65, 54, 56, 59, 56, 53, 53, 51, 51, 70, 61, 59, 54, 64, 62, 58,
+    46, 58, 59, 64, 65, 59, 54, 60, 51, 61, 69, 52, 59, 63, 58, 46,
+    52, 60, 71, 50, 53, 52, 58, 51, 51, 63, 61, 58, 51, 58, 60, 59,
+    61, 53, 48, 51, 58, 55, 59, 51, 57, 59, 49, 63, 54, 57, 65, 59,
+    57, 46, 57, 60, 53, 59, 54, 59, 67, 51, 59, 60, 62, 52, 62, 51,
+    54, 45, 57, 59, 54, 55, 58, 53, 51, 72, 59, 61, 51, 53, 47, 57,
+    62, 61, 55, 62, 53, 53, 52, 58, 52, 61, 52, 47, 59, 54, 61, 51,
+    62, 56, 54, 58, 52, 58, 65, 65, 59, 50, 59, 61, 63, 65, 53, 64,
+    50, 56, 60, 48, 69, 58, 59, 64, 52, 56, 60, 61, 56, 58, 54, 55,
+    69, 54, 64, 59, 53, 58, 66, 61, 52, 52, 53, 51, 51, 63, 58, 56,
+    59, 55, 53, 46, 53, 58, 58, 55, 58, 54, 61, 57, 58, 56, 64, 53,
+    59, 59, 62, 49, 53, 60, 61, 62, 58, 52, 60, 55, 59, 59, 59, 58,
+    62, 59, 47, 51, 72, 51, 56, 56, 49, 51, 56, 53, 59, 62, 58, 64,
+    53, 61, 49, 58, 58, 49, 55, 55, 57, 54, 60, 53, 54, 56, 64, 58,
+    56, 57, 47, 59, 65, 59, 66, 58, 65, 56, 63, 58, 50, 52, 62, 55,
+    67, 60, 55, 60, 58, 61, 56, 53, 60, 51, 57, 55, 51, 57, 57, 52,
+    50, 48, 47, 53, 57, 56, 60, 59, 54, 62, 52, 57, 53, 51, 65, 59,
+    56, 58, 43, 49, 60, 58, 61, 59, 57, 56, 56, 48, 55, 51, 58, 71,
+    59, 61, 56, 53, 50, 51, 56, 56, 56, 56, 49, 52, 64, 50, 50, 49,
+    58, 62, 59, 62, 60, 56, 58, 55, 57, 50, 65, 54, 55, 48, 51, 62,
+    46, 64, 54, 52, 60, 64, 51, 62, 44, 60, 56, 53, 58, 65, 52, 54,
+    61, 62, 50, 51, 58, 66, 64, 62, 44, 65, 69, 56, 55, 58, 54, 54,
+    55, 56, 55, 67, 59, 50, 63, 57, 58, 56, 61, 60, 52, 55, 58, 60,
+    57, 56, 57, 52, 51, 63, 52, 51, 65, 66, 64, 59, 53, 53, 61, 52,
+    61, 63, 55, 60, 70, 54, 52, 58, 60, 58, 59, 51, 59, 58, 52, 55,
+    51, 59, 54, 58, 57, 62, 54, 60, 53, 54, 54, 59, 57, 57, 61, 57,
+    60, 53, 59, 55, 58, 55, 58, 55, 49, 52, 54, 56, 76, 53, 53, 54,
+    57, 66, 56, 57, 68, 50, 55, 54, 54, 62, 55, 55, 64, 53, 63, 55,
+    56, 56, 50, 63, 61, 56, 57, 64, 60, 61, 52, 58, 54, 67, 48, 62,
+    53, 60, 53, 61, 52, 61, 59, 57, 46, 51, 55, 60, 55, 55, 66, 64,
+    55, 58, 69, 61, 60, 55, 52, 51, 53, 59, 63, 59, 58, 60, 53, 54,
+    62, 54, 53, 54, 66, 62, 62, 47, 56, 58, 58, 55, 63, 61, 61, 49,
+    59, 60, 60, 58, 55, 61, 57, 61, 60, 68, 59, 55, 62, 48, 66, 58,
+    52, 58, 60, 65, 53, 55, 54, 59, 57, 60, 59, 46, 59, 60, 59, 59,
+    58, 61, 49, 53, 56, 56, 61, 58, 53, 58, 55, 58, 48, 48, 55, 47,
+    63, 59, 60, 59, 54, 60, 65, 52, 59, 64, 49, 48, 58, 65, 47, 56,
+    55, 62, 59, 54, 62, 60, 59, 49, 60, 60, 65, 53, 54, 55, 55, 61,
+    59, 66, 51, 55, 54, 58, 48, 51, 56, 60, 60, 50, 60, 49, 59, 55,
+    62, 44, 58, 46, 67, 60, 46, 56, 49, 57, 67, 55, 59, 59, 55, 48,
+    44, 62, 54, 52, 52, 60, 54, 63, 61, 54, 45, 76, 55, 54, 61, 59,
+    56, 64, 57, 46, 58, 62, 64, 50, 44, 68, 64, 56, 60, 56, 49, 53,
+    57, 50, 56, 60, 48, 53, 59, 57, 54, 60, 49, 54, 58, 54, 54, 54,
+    62, 66, 51, 50, 49, 64, 57, 46, 61, 62, 50, 46, 58, 61, 69, 56,
+    55, 55, 54, 53, 60, 58, 48, 60, 57, 56, 62, 62, 55, 58, 59, 61,
+    58, 60, 45, 69, 60, 51, 55, 64, 60, 45, 48, 48, 53, 53, 60, 64,
+    56, 56, 70, 49, 60, 51, 57, 58, 53, 60, 52, 67, 64, 57, 46, 61,
+    66, 53, 58, 59, 56, 50, 59, 53, 53, 57, 51, 61, 66, 56, 51, 55,
+    51, 53, 48, 58, 67, 57, 59, 65, 51, 56, 60, 50, 52, 61, 51, 71,
+    63, 43, 57, 57, 68, 65, 49, 52, 66, 56, 51, 67, 65, 55, 58, 50,
+    54, 56, 63, 53, 67, 58, 60, 55, 61, 55, 54, 48, 57, 66, 47, 58,
+    46, 60, 59, 62, 62, 61, 47, 49, 52, 57, 53, 55, 63, 61, 47, 59,
+    55, 58, 57, 57, 59, 61, 63, 67, 53, 60, 56, 55, 62, 59, 58, 54,
+    58, 58, 66, 53, 62, 60, 61, 63, 56, 52, 62, 55, 55, 62, 59, 57,
+    52, 55, 54, 53, 60, 52, 61, 60, 59, 58, 55, 56, 60, 60, 59, 48,
+    55, 61, 57, 58, 62, 62, 66, 51, 51, 50, 62, 55, 58, 48, 55, 49,
+    56, 64, 56, 50, 70, 53, 57, 55, 56, 61, 65, 69, 50, 52, 62, 60,
+    71, 56, 54, 52, 49, 54, 60, 66, 55, 59, 57, 54, 54, 55, 53, 63,
+    60, 46, 67, 55, 53, 64, 51, 53, 56, 52, 58, 59, 51, 55, 56, 57,
+    70, 55, 64, 65, 64, 55, 59, 67, 58, 64, 58, 58, 51, 48, 60, 46,
+    56, 46, 66, 60, 58, 61, 57, 60, 50, 60, 59, 57, 57, 61, 63, 55,
+    58, 63, 63, 53, 57, 56, 53, 55, 60, 58, 46, 60, 66, 54, 49, 66,
+    61, 63, 63, 59, 59, 55, 49, 58, 56, 75, 57, 67, 63, 53, 61, 65,
+    54, 49, 60, 48, 66, 59, 68, 59, 48, 54, 62, 56, 68, 57, 50, 53,
+    58, 53, 47, 53, 48, 59, 46, 62, 59, 66, 51, 66, 60, 47, 47, 61,
+    65, 57, 53, 60, 58, 65, 47, 53, 59, 43, 61, 53, 57, 63, 53, 68,
+    53, 53, 57, 54, 67, 58, 54, 58, 54, 61, 53, 62, 49, 57, 64, 55,
+    62, 55, 58, 57, 64, 58, 60, 70, 54, 56, 57, 54, 51, 59, 60, 64,
+    51, 61, 56, 48, 54, 59, 54, 47, 53, 61, 57, 50, 59, 62, 56, 56,
+    51, 64, 47, 57, 44, 56, 51, 63, 63, 65, 57, 58, 58, 51, 55, 54,
+    59, 50, 66, 54, 48, 53, 55, 58, 64, 48, 66, 58, 56, 58, 56, 48,
+    59, 61, 59, 60, 61, 52, 61, 38, 61, 59, 56, 56, 61, 60, 57, 65,
+    57, 55, 60, 56, 60, 54, 40, 62, 55, 61, 55, 62, 66, 50, 58, 51,
+    45, 64, 58, 64, 61, 59, 66, 60, 51, 57, 59, 52, 55, 61, 69, 57,
+    63, 60, 60, 51, 55, 60, 58, 50, 65, 59, 56, 55, 50, 67, 56, 52,
+    65, 53, 50, 68, 60, 52, 51, 65, 47, 52, 58, 63, 53, 54, 72, 62,
+    58, 56, 57, 57, 51, 56, 54, 59, 55, 58, 56, 55, 66, 49, 61, 62,
+    49, 55, 60, 55, 59, 56, 55, 53, 45, 49, 64, 58, 54, 56, 54, 60,
+    62, 50, 55, 56, 50, 65, 56, 64, 62, 66, 61, 53, 61, 47, 60, 49,
+    51, 63, 56, 58, 49, 66, 50, 61, 57, 52, 52, 55, 48, 59, 57, 63,
+    55, 60, 49, 60, 56, 60, 47, 55, 52, 59, 54, 56, 60, 49, 56, 56,
+    63, 60, 59, 56, 57, 57, 57, 53, 62, 57, 54, 55, 57, 53, 63, 56,
+    60, 62, 63, 55, 47, 55, 60, 58, 47, 69, 55, 59, 55, 64, 61, 54,
+    63, 45, 52, 59, 54, 52, 54, 58, 54, 50, 64, 59, 59, 55, 63, 56,
+    54, 62, 45, 57, 65, 58, 51, 55, 57, 61, 73, 56, 60, 67, 57, 64,
+    68, 60, 52, 56, 44, 54, 62, 62, 49, 58, 58, 60, 56, 52, 57, 54,
+    57, 57, 48, 58, 67, 44, 61, 58, 67, 58, 41, 61, 50, 49, 57, 61,
+    63, 60, 56, 48, 59, 61, 42, 65, 60, 59, 58, 62, 56, 49, 60, 67,
+    53, 69, 60, 47, 65, 60, 47, 53, 60, 63, 56, 57, 53, 47, 57, 53,
+    53, 62, 61, 63, 59, 45, 49, 64, 49, 46, 60, 52, 60, 62, 57, 48,
+    73, 63, 50, 53, 63, 64, 58, 48, 58, 57, 55, 52, 63, 57, 56, 61,
+    49, 53, 54, 59, 58, 48, 57, 65, 56, 62, 60, 59, 51, 67, 49, 60,
+    58, 55, 51, 58, 58, 49, 51, 53, 60, 69, 57, 56, 56, 62, 62, 65,
+    45, 58, 65, 53, 60, 53, 58, 52, 58, 56, 53, 58, 62, 61, 60, 63,
+    55, 55, 60, 58, 61, 61, 61, 59, 67, 58, 56, 49, 50, 57, 61, 59,
+    62, 54, 61, 48, 63, 47, 54, 55, 48, 56, 51, 56, 60, 50, 62, 57,
+    67, 56, 64, 59, 44, 46, 59, 54, 56, 60, 53, 53, 68, 53, 63, 57,
+    59, 62, 59, 59, 49, 63, 57, 57, 60, 56, 54, 57, 55, 57, 60, 54,
+    53, 54, 53, 54, 50, 51, 48, 49, 53, 62, 63, 57, 58, 58, 65, 58,
+    59, 47, 59, 54, 53, 53, 60, 62, 52, 51, 51, 52, 62, 48, 57, 59,
+    52, 56, 62, 49, 52, 60, 52, 59, 53, 65, 59, 47, 56, 54, 57, 53,
+    62, 57, 58, 49, 54, 60, 59, 55, 57, 52, 67, 53, 57, 61, 64, 55,
+    55, 49, 70, 52, 55, 51, 60, 67, 62, 53, 66, 63, 47, 63, 50, 64,
+    61, 57, 54, 51, 55, 59, 61, 51, 51, 52, 54, 54, 49, 59, 61, 58,
+    55, 54, 69, 42, 58, 59, 59, 55, 51, 49, 52, 62, 62, 51, 56, 51,
+    58, 66, 51, 54, 51, 65, 58, 61, 53, 53, 56, 56, 61, 57, 60, 61,
+    56, 65, 55, 49, 59, 62, 52, 60, 54, 60, 56, 56, 56, 49, 58, 47,
+    59, 52, 55, 53, 56, 67, 44, 62, 55, 42, 66, 61, 55, 60, 51, 62,
+    63, 50, 45, 60, 52, 59, 63, 63, 53, 59, 71, 56, 50, 54, 59, 55,
+    60, 64, 52, 53, 55, 64, 48, 54, 51, 47, 67, 49, 59, 61, 56, 48,
+    62, 50, 55, 53, 72, 62, 52, 55, 67, 53, 52, 52, 64, 54, 62, 58,
+    53, 55, 50, 56, 63, 61, 64, 65, 58, 54, 72, 56, 62, 46, 67, 59,
+    59, 60, 55, 61, 62, 56, 55, 59, 60, 51, 54, 59, 65, 55, 57, 56,
+    38, 65, 63, 55, 66, 55, 52, 59, 51, 57, 59, 62, 52, 58, 46, 48,
+    61, 57, 52, 61, 65, 54, 60, 60, 54, 58, 55, 55, 65, 61, 64, 46,
+    52, 58, 59, 52, 56, 59, 46, 49, 63, 57, 67, 65, 51, 60, 49, 50,
+    47, 47, 64, 58, 58, 66, 70, 64, 52, 53, 68, 69, 51, 69, 60, 56,
+    57, 59, 51, 55, 55, 57, 58, 46, 51, 55, 63, 62, 56, 57, 61, 58,
+    63, 52, 65, 55, 49, 56, 49, 50, 62, 53, 59, 53, 53, 61, 54, 54,
+    64, 52, 62, 60, 54, 70, 53, 62, 48, 60, 58, 63, 62, 53, 59, 56,
+    46, 54, 50, 53, 62, 66, 51, 67, 48, 59, 47, 67, 57, 54, 55, 49,
+    60, 58, 62, 61, 52, 51, 61, 52, 65, 58, 49, 62, 51, 58, 61, 62,
+    45, 62, 57, 49, 63, 44, 56, 58, 57, 64, 48, 61, 57, 55, 55, 53,
+    46, 63, 57, 58, 53, 55, 56, 51, 59, 56, 64, 59, 60, 56, 47, 56,
+    57, 64, 47, 52, 51, 67, 59, 61, 59, 61, 62, 43, 61, 56, 58, 55,
+    49, 52, 62, 59, 59, 66, 54, 50, 64, 61, 57, 67, 57, 59, 40, 62,
+    56, 59, 50, 55, 58, 63, 61, 55, 64, 48, 53, 50, 49, 54, 58, 66,
+    52, 58, 68, 53, 48, 54, 57, 63, 62, 50, 58, 61, 58, 63, 60, 51,
+    62, 58, 60, 50, 67, 66, 59, 54, 62, 56, 61, 57, 57, 62, 66, 58,
+    57, 44, 48, 49, 55, 47, 67, 56, 50, 57, 61, 53, 50, 63, 65, 54,
+    57, 61, 67, 53, 59, 58, 68, 46, 53, 63, 57, 53, 45, 67, 55, 52,
+    61, 62, 56, 53, 57, 59, 52, 59, 61, 50, 65, 52, 58, 52, 56, 59,
+    56, 54, 51, 48, 65, 64, 58, 63, 51, 64, 56, 58, 60, 62, 47, 58,
+    67, 58, 54, 47, 50, 55, 50, 58, 55, 53, 62, 55, 61, 62, 57, 56,
+    58, 66, 60, 65, 59, 58, 61, 63, 61, 52, 58, 53, 56, 55, 51, 57,
+    65, 60, 52, 54, 54, 55, 56, 61, 57, 51, 55, 59, 57, 50, 60, 60,
+    60, 48, 57, 57, 49, 61, 48, 59, 59, 70, 49, 57, 57, 67, 55, 57,
+    60, 58, 64, 56, 52, 65, 56, 57, 55, 55, 62, 59, 63, 62, 56, 55,
+    60, 54, 61, 65, 61, 56, 52, 62, 47, 48, 61, 52, 59, 48, 52, 62,
+    57, 57, 60, 59, 51, 59, 60, 56, 58, 57, 53, 69, 52, 60, 59, 56,
+    56, 51, 61, 65, 49, 61, 53, 55, 67, 60, 55, 61, 57, 59, 63, 57,
+    52, 48, 60, 63, 58, 59, 61, 53, 60, 61, 58, 61, 50, 61, 62, 51,
+    62, 58, 59, 61, 60, 55, 57, 53, 58, 58, 53, 51, 52, 62, 64, 63,
+    51, 55, 54, 56, 54, 47, 61, 46, 58, 56, 55, 58, 51, 63, 57, 58,
+    61, 52, 53, 61, 62, 51, 49, 53, 48, 54, 55, 64, 59, 44, 59, 56,
+    52, 66, 50, 66, 48, 59, 58, 52, 56, 59, 59, 66, 58, 54, 60, 47,
+    67, 49, 56, 53, 52, 48, 56, 57, 58, 59, 55, 61, 57, 53, 54, 53,
+    57, 62, 64, 54, 54, 59, 58, 54, 54, 55, 54, 50, 41, 64, 46, 62,
+    61, 49, 48, 61, 51, 65, 57, 54, 51, 60, 62, 58, 58, 56, 55, 61,
+    50, 67, 52, 60, 62, 65, 44, 57, 53, 55, 58, 49, 65, 52, 60, 55,
+    49, 54, 58, 52, 54, 60, 50, 51, 61, 54, 61, 59, 60, 72, 56, 52,
+    52, 65, 62, 50, 49, 54, 65, 61, 52, 60, 51, 55, 59, 56, 51, 63,
+    51, 64, 56, 57, 55, 64, 58, 56, 52, 58, 70, 57, 49, 58, 51, 54,
+    64, 58, 46, 48, 54, 51, 51, 63, 60, 61, 53, 61, 52, 61, 53, 67,
+    62, 59, 60, 56, 59, 55, 54, 50, 48, 64, 68, 56, 59, 61, 57, 54,
+    45, 66, 60, 44, 58, 51, 68, 51, 55, 56, 57, 56, 72, 67, 49, 53,
+    54, 57, 54, 59, 55, 58, 55, 51, 52, 47, 56, 63, 55, 55, 58, 58,
+    59, 47, 60, 54, 50, 57, 66, 61, 56, 53, 49, 56, 53, 62, 58, 57,
+    59, 64, 59, 62, 54, 58, 67, 51, 52, 60, 63, 59, 57, 53, 62, 60,
+    53, 60, 52, 55, 60, 59, 55, 41, 58, 68, 57, 44, 47, 61, 62, 54,
+    49, 61, 62, 70, 58, 58, 61, 66, 60, 57, 56, 59, 54, 59, 56, 49,
+    49, 52, 46, 56, 51, 70, 60, 56, 55, 50, 59, 65, 59, 52, 55, 56,
+    55, 59, 59, 37, 56, 61, 59, 50, 56, 57, 55, 63, 51, 43, 52, 68,
+    47, 64, 56, 57, 57, 63, 54, 50, 54, 53, 55, 68, 71, 51, 59, 50,
+    50, 57, 59, 54, 52, 56, 46, 63, 54, 59, 57, 62, 52, 59, 57, 63,
+    61, 53, 66, 55, 63, 59, 63, 59, 53, 61, 54, 55, 62, 57, 63, 62,
+    69, 51, 60, 58, 51, 63, 56, 66, 58, 61, 59, 73, 66, 55, 49, 51,
+    58, 55, 54, 62, 57, 68, 54, 49, 63, 55, 57, 58, 62, 59, 54, 61,
+    57, 56, 63, 63, 56, 57, 52, 49, 61, 55, 61, 58, 58, 53, 57, 44,
+    57, 48, 54, 64, 60, 56, 54, 55, 66, 61, 48, 54, 51, 55, 68, 56,
+    51, 51, 65, 55, 58, 58, 52, 52, 58, 55, 48, 57, 47, 59, 61, 50,
+    63, 54, 66, 59, 64, 54, 54, 63, 63, 56, 68, 55, 53, 52, 59, 52,
+    63, 62, 55, 61, 57, 55, 45, 59, 54, 57, 59, 63, 57, 56, 62, 62,
+    62, 51, 48, 53, 48, 68, 56, 54, 59, 59, 60, 61, 61, 57, 44, 62,
+    58, 60, 53, 52, 51, 63, 54, 59, 56, 43, 58, 51, 52, 61, 46, 66,
+    53, 54, 58, 55, 57, 56, 57, 57, 64, 57, 52, 52, 60, 52, 51, 57,
+    57, 59, 48, 72, 51, 51, 61, 64, 49, 60, 54, 47, 56, 52, 55, 55,
+    57, 55, 56, 65, 52, 54, 59, 60, 54, 63, 59, 57, 44, 61, 60, 55,
+    57, 55, 58, 51, 58, 52, 61, 54, 54, 65, 56, 57, 62, 56, 57, 59,
+    57, 55, 61, 67, 57, 52, 55, 53, 51, 52, 61, 53, 54, 58, 58, 58,
+    61, 58, 57, 51, 66, 59, 58, 57, 55, 59, 59, 46, 64, 60, 44, 53,
+    61, 56, 67, 51, 59, 66, 58, 53, 54, 66, 56, 64, 55, 50, 65, 59,
+    48, 66, 55, 62, 63, 59, 59, 55, 44, 55, 56, 54, 57, 52, 53, 55,
+    56, 62, 54, 46, 63, 50, 59, 62, 58, 62, 53, 55, 47, 59, 63, 55,
+    57, 59, 55, 55, 53, 58, 51, 50, 54, 63, 55, 51, 65, 58, 61, 67,
+    50, 55, 63, 50, 49, 52, 52, 66, 55, 64, 65, 54, 58, 61, 62, 65,
+    58, 62, 49, 57, 61, 53, 64, 65, 55, 63, 57, 59, 60, 64, 60, 60,
+    52, 59, 68, 46, 51, 59, 67, 53, 49, 62, 52, 63, 57, 49, 55, 59,
+    61, 52, 64, 62, 45, 61, 55, 52, 58, 51, 52, 48, 64, 57, 53, 53,
+    61, 47, 62, 56, 50, 54, 58, 52, 60, 68, 53, 52, 66, 45, 67, 56,
+    61, 53, 61, 57, 55, 54, 50, 62, 49, 53, 55, 64, 49, 49, 65, 61,
+    55, 56, 55, 54, 63, 60, 60, 62, 56, 51, 62, 58, 56, 65, 44, 56,
+    51, 61, 60, 56, 55, 46, 58, 57, 54, 59, 64, 54, 60, 52, 51, 57,
+    52, 48, 60, 55, 62, 59, 57, 57, 52, 54, 61, 49, 55, 60, 65, 57,
+    55, 57, 55, 52, 57, 61, 63, 50, 62, 52, 55, 63, 57, 59, 60, 61,
+    75, 58, 57, 59, 58, 52, 58, 47, 61, 55, 59, 55, 51, 55, 57, 52,
+    60, 47, 54, 61, 60, 60, 60, 51, 51, 58, 51, 65, 62, 57, 61, 59,
+    53, 55, 62, 56, 58, 51, 51, 62, 56, 64, 59, 58, 60, 54, 62, 44,
+    52, 64, 59, 60, 56, 49, 57, 65, 60, 46, 63, 61, 57, 57, 49, 67,
+    49, 59, 55, 66, 45, 55, 49, 60, 66, 46, 56, 44, 53, 49, 67, 52,
+    54, 63, 54, 50, 66, 59, 65, 54, 47, 62, 61, 57, 61, 56, 45, 64,
+    49, 49, 53, 65, 60, 54, 58, 62, 72, 55, 54, 50, 59, 55, 61, 63,
+    56, 48, 52, 56, 55, 64, 66, 57, 49, 65, 60, 63, 51, 51, 55, 49,
+    52, 67, 50, 48, 60, 63, 56, 67, 48, 61, 52, 60, 56, 48, 58, 57,
+    63, 49, 60, 58, 55, 66, 62, 57, 61, 59, 50, 50, 59, 62, 61, 60,
+    57, 61, 59, 57, 59, 51, 61, 58, 55, 49, 63, 56, 69, 55, 64, 58,
+    52, 59, 60, 55, 62, 53, 53, 59, 61, 53, 67, 61, 56, 62, 54, 59,
+    50, 58, 61, 57, 57, 53, 69, 56, 62, 60, 65, 61, 49, 46, 54, 46,
+    65, 58, 59, 53, 50, 55, 48, 52, 57, 53, 53, 58, 54, 65, 64, 54,
+    64, 49, 56, 63, 63, 57, 57, 46, 56, 62, 61, 54, 61, 63, 54, 59,
+    54, 68, 56, 59, 56, 48, 56, 49, 48, 49, 60, 50, 56, 52, 54, 55,
+    55, 57, 59, 54, 71, 49, 59, 56, 64, 59, 62, 54, 63, 51, 64, 58,
+    55, 52, 56, 57, 58, 65, 64, 65, 56, 62, 52, 62, 58, 51, 53, 60,
+    48, 56, 65, 59, 60, 67, 58, 54, 58, 50, 60, 52, 56, 51, 54, 51,
+    53, 69, 63, 53, 49, 52, 63, 59, 60, 63, 47, 60, 69, 52, 61, 50,
+    64, 50, 61, 54, 66, 52, 52, 59, 51, 66, 53, 56, 50, 58, 52, 61,
+    73, 65, 59, 50, 50, 59, 61, 57, 61, 65, 55, 62, 68, 53, 54, 61,
+    55, 56, 54, 55, 51, 50, 61, 58, 59, 62, 51, 54, 51, 52, 59, 57,
+    52, 70, 58, 58, 56, 61, 49, 54, 57, 56, 60, 57, 57, 57, 57, 53,
+    54, 60, 45, 54, 58, 63, 57, 50, 57, 56, 55, 50, 57, 56, 57, 55,
+    57, 54, 63, 66, 55, 61, 57, 56, 54, 54, 49, 49, 61, 59, 63, 53,
+    45, 54, 50, 47, 57, 60, 60, 53, 62, 55, 56, 64, 56, 59, 53, 52,
+    48, 60, 58, 58, 53, 50, 59, 63, 63, 55, 69, 53, 61, 60, 56, 65,
+    52, 52, 59, 49, 58, 62, 52, 64, 58, 67, 57, 60, 51, 52, 54, 65,
+    45, 64, 55, 52, 52, 54, 53, 57, 56, 60, 59, 55, 51, 56, 53, 58,
+    63, 63, 53, 56, 66, 43, 58, 59, 71, 55, 49, 60, 54, 55, 56, 54,
+    62, 57, 56, 51, 60, 63, 55, 51, 53, 56, 55, 58, 55, 55, 56, 57,
+    57, 61, 65, 54, 62, 53, 46, 63, 55, 64, 51, 49, 55, 58, 56, 57,
+    57, 59, 58, 59, 57, 62, 54, 62, 58, 64, 53, 58, 64, 52, 58, 60,
+    66, 48, 59, 57, 55, 56, 60, 63, 47, 53, 60, 56, 55, 51, 61, 56,
+    57, 54, 58, 57, 51, 65, 53, 42, 56, 54, 64, 61, 56, 59, 65, 51,
+    61, 59, 58, 52, 44, 56, 57, 52, 60, 68, 65, 58, 52, 60, 53, 50,
+    52, 55, 60, 53, 54, 58, 65, 59, 62, 61, 52, 53, 56, 59, 52, 62,
+    58, 55, 41, 66, 50, 59, 47, 58, 62, 54, 53, 51, 50, 66, 58, 58,
+    62, 63, 59, 59, 58, 56, 53, 55, 61, 60, 58, 51, 56, 56, 68, 68,
+    58, 63, 74, 59, 48, 64, 63, 57, 55, 61, 60, 59, 53, 46, 56, 59,
+    61, 68, 57, 50, 65, 64, 59, 53, 57, 61, 59, 51, 58, 61, 48, 49,
+    45, 56, 57, 55, 53, 59, 53, 52, 69, 49, 58, 56, 52, 53, 52, 67,
+    54, 53, 54, 57, 63, 52, 62, 60, 55, 48, 62, 50, 71, 62, 54, 57,
+    53, 56, 63, 47, 60, 58, 56, 58, 68, 58, 61, 63, 47, 53, 46, 58,
+    56, 58, 52, 53, 53, 63, 55, 58, 55, 61, 56, 56, 56, 57, 53, 60,
+    62, 52, 53, 53, 45, 56, 50, 58, 56, 56, 58, 55, 54, 54, 52, 47,
+    66, 51, 62, 56, 59, 54, 55, 57, 61, 57, 55, 58, 59, 58, 60, 49,
+    60, 57, 61, 66, 59, 52, 54, 50, 60, 46, 55, 52, 56, 62, 52, 57,
+    57, 50, 63, 58, 53, 58, 60, 56, 57, 53, 64, 49, 51, 62, 59, 56,
+    63, 57, 54, 62, 61, 58, 64, 58, 56, 61, 58, 51, 70, 51, 57, 58,
+    61, 66, 56, 63, 60, 48, 47, 61, 61, 61, 61, 61, 51, 55, 63, 58,
+    54, 49, 69, 55, 51, 61, 54, 64, 50, 61, 55, 62, 59, 55, 54, 51,
+    50, 59, 58, 53, 61, 51, 58, 59, 61, 68, 53, 56, 56, 55, 59, 59,
+    54, 67, 55, 64, 51, 58, 63, 66, 52, 56, 59, 54, 60, 56, 60, 59,
+    58, 42, 55, 60, 55, 49, 59, 64, 59, 54, 56, 61, 58, 55, 54, 67,
+    61, 70, 53, 66, 55, 56, 54, 51, 58, 68, 58, 58, 58, 65, 62, 57,
+    59, 59, 60, 52, 48, 49, 52, 52, 52, 53, 62, 57, 51, 58, 67, 57,
+    51, 65, 71, 63, 52, 54, 64, 60, 64, 56, 56, 63, 52, 62, 59, 60,
+    49, 51, 53, 63, 64, 57, 57, 60, 57, 54, 60, 48, 52, 62, 48, 57,
+    77, 50, 52, 57, 54, 61, 44, 54, 58, 52, 60, 53, 51, 62, 51, 61,
+    57, 57, 51, 59, 52, 69, 50, 65, 62, 51, 68, 52, 50, 54, 63, 51,
+    55, 52, 50, 47, 52, 60, 65, 58, 54, 56, 56, 54, 47, 62, 55, 59,
+    61, 49, 45, 62, 68, 68, 52, 54, 55, 72, 56, 57, 57, 64, 61, 56,
+    52, 67, 49, 59, 59, 62, 65, 61, 48, 61, 61, 53, 65, 54, 58, 58,
+    62, 61, 56, 63, 46, 60, 54, 54, 50, 71, 70, 49, 63, 58, 60, 56,
+    68, 49, 54, 69, 57, 47, 54, 53, 57, 52, 56, 57, 54, 61, 51, 49,
+    54, 47, 51, 65, 54, 60, 55, 49, 62, 48, 54, 72, 47, 60, 60, 65,
+    52, 54, 58, 63, 51, 56, 55, 52, 58, 69, 48, 55, 60, 59, 55, 60,
+    61, 57, 60, 55, 58, 46, 57, 51, 63, 66, 66, 65, 56, 48, 62, 47,
+    65, 62, 54, 64, 73, 48, 59, 56, 59, 48, 49, 57, 46, 52, 55, 61,
+    53, 57, 49, 53, 63, 52, 57, 60, 50, 61, 62, 53, 66, 61, 52, 52,
+    47, 52, 56, 62, 59, 45, 61, 58, 58, 60, 62, 57, 64, 47, 70, 55,
+    66, 59, 52, 57, 67, 57, 55, 69, 46, 60, 62, 60, 52, 54, 55, 53,
+    55, 64, 44, 58, 55, 60, 60, 58, 61, 58, 50, 69, 48, 54, 64, 64,
+    63, 50, 67, 54, 55, 48, 53, 62, 60, 55, 52, 49, 54, 59, 64, 65,
+    53, 60, 51, 66, 42, 59, 55, 63, 53, 53, 57, 52, 64, 56, 54, 60,
+    50, 55, 53, 59, 60, 56, 58, 54, 64, 56, 63, 49, 53, 47, 53, 66,
+    48, 60, 68, 56, 56, 54, 51, 63, 62, 55, 66, 55, 63, 56, 49, 47,
+    62, 51, 57, 60, 59, 55, 57, 56, 66, 51, 62, 46, 60, 56, 51, 55,
+    53, 65, 68, 51, 50, 61, 54, 48, 58, 56, 57, 62, 58, 62, 53, 62,
+    54, 57, 61, 56, 50, 53, 60, 58, 50, 59, 53, 65, 57, 48, 49, 53,
+    62, 53, 63, 58, 48, 53, 51, 56, 62, 60, 60, 61, 59, 58, 60, 53,
+    62, 61, 55, 68, 55, 58, 64, 61, 51, 59, 59, 67, 53, 52, 59, 57,
+    61, 55, 62, 49, 67, 59, 54, 51, 52, 67, 65, 51, 56, 57, 56, 50,
+    57, 63, 58, 54, 60, 55, 49, 54, 52, 53, 55, 53, 59, 52, 55, 63,
+    53, 49, 63, 49, 51, 50, 43, 51, 54, 55, 50, 55, 58, 66, 63, 58,
+    56, 55, 57, 58, 53, 57, 59, 63, 59, 59, 61, 51, 52, 54, 44, 49,
+    56, 67, 58, 61, 50, 51, 54, 51, 57, 53, 60, 57, 60, 54, 56, 57,
+    55, 61, 58, 65, 66, 58, 54, 56, 57, 53, 63, 48, 66, 54, 55, 55,
+    57, 51, 60, 63, 66, 51, 59, 61, 57, 53, 63, 49, 55, 62, 53, 59,
+    59, 65, 56, 57, 57, 54, 58, 43, 63, 56, 58, 54, 55, 59, 66, 56,
+    59, 50, 57, 57, 60, 56, 61, 66, 63, 64, 58, 58, 55, 56, 55, 59,
+    59, 50, 59, 59, 60, 53, 55, 62, 57, 62, 54, 57, 57, 55, 59, 54,
+    57, 64, 60, 59, 55, 62, 61, 61, 60, 44, 56, 49, 56, 58, 52, 59,
+    65, 57, 57, 49, 63, 59, 55, 57, 63, 60, 54, 50, 53, 50, 57, 63,
+    56, 56, 60, 50, 59, 57, 67, 54, 53, 56, 57, 49, 54, 50, 54, 60,
+    47, 52, 54, 52, 59, 61, 57, 51, 48, 60, 54, 50, 59, 47, 68, 55,
+    50, 47, 53, 73, 67, 62, 52, 57, 54, 63, 55, 60, 61, 55, 60, 49,
+    64, 61, 54, 57, 55, 65, 50, 51, 54, 54, 65, 57, 61, 54, 61, 60,
+    59, 59, 57, 58, 49, 54, 55, 58, 53, 60, 48, 63, 55, 56, 56, 57,
+    57, 50, 48, 56, 55, 56, 62, 51, 56, 56, 54, 74, 54, 52, 65, 52,
+    66, 65, 48, 64, 61, 49, 65, 54, 52, 50, 62, 50, 59, 60, 59, 65,
+    65, 54, 52, 57, 45, 62, 54, 56, 62, 56, 55, 55, 62, 60, 49, 56,
+    64, 62, 55, 47, 58, 56, 59, 58, 55, 46, 58, 58, 56, 57, 61, 55,
+    56, 64, 53, 53, 45, 58, 59, 50, 56, 58, 58, 55, 53, 58, 61, 59,
+    48, 64, 46, 51, 49, 61, 64, 58, 63, 50, 58, 55, 54, 56, 51, 46,
+    61, 55, 58, 56, 53, 56, 52, 58, 60, 49, 50, 66, 58, 63, 43, 64,
+    58, 59, 63, 58, 57, 54, 64, 46, 49, 57, 53, 53, 59, 59, 59, 57,
+    53, 56, 56, 60, 48, 54, 64, 61, 57, 58, 57, 57, 59, 60, 58, 60,
+    46, 59, 59, 70, 56, 60, 55, 54, 57, 51, 56, 47, 58, 57, 51, 54,
+    49, 56, 61, 65, 54, 69, 64, 47, 62, 66, 61, 53, 68, 58, 59, 62,
+    48, 54, 56, 61, 50, 60, 59, 51, 50, 56, 55, 52, 63, 48, 68, 58,
+    58, 53, 52, 62, 60, 58, 51, 52, 57, 53, 62, 59, 58, 53, 56, 53,
+    65, 50, 60, 49, 51, 51, 58, 58, 54, 63, 59, 67, 45, 55, 54, 62,
+    57, 53, 51, 66, 55, 51, 58, 62, 50, 57, 52, 63, 62, 59, 50, 58,
+    58, 55, 49, 53, 50, 53, 61, 52, 61, 51, 47, 55, 52, 54, 58, 58,
+    58, 57, 54, 50, 57, 56, 52, 55, 67, 56, 54, 56, 66, 53, 59, 58,
+    64, 49, 49, 58, 58, 69, 65, 50, 58, 56, 61, 57, 52, 49, 52, 55,
+    65, 53, 56, 67, 59, 51, 63, 59, 54, 59, 64, 55, 52, 62, 51, 61,
+    57, 62, 60, 50, 59, 58, 51, 53, 52, 56, 50, 56, 63, 67, 48, 72,
+    61, 52, 57, 54, 49, 57, 52, 58, 37, 65, 50, 65, 57, 58, 54, 57,
+    57, 56, 59, 62, 70, 55, 49, 58, 63, 55, 53, 60, 53, 60, 61, 49,
+    50, 60, 56, 56, 61, 53, 59, 56, 57, 54, 63, 49, 54, 57, 49, 58,
+    60, 58, 55, 62, 62, 51, 58, 48, 64, 57, 56, 53, 55, 59, 58, 59,
+    57, 61, 57, 63, 58, 51, 57, 65, 54, 55, 52, 56, 56, 67, 55, 59,
+    53, 52, 48, 59, 51, 55, 57, 62, 57, 61, 60, 51, 57, 55, 52, 58,
+    55, 50, 49, 58, 48, 61, 61, 55, 59, 52, 51, 62, 55, 60, 57, 53,
+    59, 58, 47, 60, 52, 61, 64, 60, 58, 55, 64, 56, 59, 60, 55, 53,
+    54, 57, 52, 56, 62, 61, 57, 57, 58, 60, 53, 59, 58, 59, 58, 46,
+    60, 57, 53, 62, 55, 60, 53, 57, 57, 65, 56, 64, 66, 66, 59, 54,
+    58, 62, 55, 59, 52, 46, 68, 55, 57, 54, 55, 50, 51, 49, 54, 62,
+    45, 62, 55, 61, 63, 60, 53, 56, 64, 56, 54, 52, 62, 53, 61, 51,
+    58, 64, 61, 48, 48, 53, 56, 48, 57, 58, 50, 51, 56, 54, 67, 52,
+    48, 69, 55, 65, 54, 59, 55, 60, 53, 51, 53, 58, 62, 57, 53, 49,
+    51, 65, 58, 62, 60, 52, 53, 64, 58, 66, 54, 43, 66, 50, 54, 49,
+    58, 51, 63, 65, 57, 50, 53, 61, 58, 66, 61, 66, 65, 60, 47, 65,
+    60, 53, 58, 47, 53, 59, 71, 51, 47, 60, 63, 62, 60, 58, 52, 61,
+    66, 47, 55, 57, 67, 57, 51, 50, 63, 48, 65, 54, 62, 49, 62, 60,
+    55, 64, 54, 59, 58, 51, 54, 58, 59, 49, 54, 53, 57, 47, 56, 57,
+    60, 64, 54, 67, 51, 52, 62, 58, 58, 60, 68, 50, 58, 61, 49, 50,
+    62, 53, 54, 63, 61, 63, 59, 60, 50, 53, 48, 62, 64, 44, 64, 51,
+    62, 48, 59, 56, 56, 62, 62, 58, 59, 52, 60, 54, 59, 57, 55, 60,
+    63, 60, 58, 52, 55, 47, 68, 62, 51, 43, 59, 53, 65, 57, 55, 46,
+    47, 51, 59, 60, 52, 56, 49, 56, 57, 52, 64, 59, 51, 56, 55, 62,
+    54, 52, 56, 60, 63, 55, 55, 55, 51, 63, 55, 62, 63, 65, 48, 50,
+    55, 62, 57, 58, 52, 68, 55, 53, 46, 69, 63, 49, 54, 45, 59, 56,
+    53, 55, 63, 64, 59, 55, 61, 56, 55, 58, 63, 71, 57, 51, 53, 55,
+    60, 47, 64, 52, 52, 61, 56, 55, 54, 61, 57, 57, 56, 64, 62, 51,
+    58, 57, 61, 53, 70, 56, 47, 60, 52, 60, 61, 50, 53, 61, 55, 49,
+    57, 63, 52, 58, 51, 63, 65, 50, 54, 58, 64, 57, 64, 53, 52, 61,
+    51, 50, 61, 56, 59, 53, 62, 59, 51, 53, 64, 46, 49, 60, 56, 50,
+    56, 62, 53, 61, 54, 63, 55, 59, 48, 60, 58, 52, 53, 51, 64, 54,
+    57, 55, 56, 56, 63, 52, 52, 61, 61, 63, 55, 54, 66, 54, 60, 63,
+    45, 50, 64, 48, 55, 53, 56, 55, 69, 63, 49, 58, 64, 67, 56, 60,
+    66, 50, 65, 56, 56, 52, 61, 70, 54, 53, 66, 51, 58, 51, 56, 53,
+    58, 51, 52, 62, 57, 54, 51, 46, 58, 57, 62, 54, 52, 58, 46, 62,
+    59, 58, 53, 56, 57, 58, 62, 52, 66, 58, 56, 52, 68, 54, 56, 59,
+    49, 55, 53, 59, 52, 59, 52, 70, 61, 47, 60, 56, 51, 55, 51, 60,
+    56, 56, 54, 52, 65, 59, 54, 44, 55, 49, 61, 56, 56, 63, 61, 57,
+    61, 63, 51, 58, 58, 46, 61, 55, 57, 58, 65, 53, 64, 47, 55, 55,
+    53, 61, 57, 53, 66, 59, 63, 61, 67, 58, 58, 53, 52, 58, 50, 59,
+    49, 60, 59, 52, 55, 50, 52, 62, 59, 59, 59, 47, 63, 57, 58, 50,
+    54, 67, 58, 58, 50, 52, 62, 57, 53, 62, 50, 58, 63, 53, 62, 56,
+    64, 56, 57, 50, 44, 52, 49, 61, 50, 54, 51, 53, 62, 64, 55, 46,
+    56, 52, 56, 63, 60, 58, 51, 52, 53, 47, 52, 62, 54, 49, 58, 56,
+    53, 53, 51, 50, 64, 60, 56, 51, 60, 52, 57, 65, 53, 54, 51, 55,
+    58, 59, 60, 69, 56, 51, 55, 50, 60, 54, 52, 61, 50, 62, 55, 58,
+    66, 54, 70, 58, 64, 56, 57, 52, 57, 58, 58, 58, 56, 51, 47, 54,
+    57, 52, 59, 59, 60, 57, 68, 56, 60, 58, 58, 64, 54, 56, 55, 56,
+    57, 68, 50, 60, 57, 57, 50, 56, 66, 62, 56, 46, 54, 67, 59, 62,
+    52, 52, 59, 60, 58, 58, 50, 54, 58, 57, 46, 52, 57, 54, 65, 56,
+    57, 53, 73, 61, 41, 58, 64, 51, 57, 53, 48, 73, 53, 63, 52, 66,
+    65, 51, 59, 52, 54, 59, 47, 59, 62, 64, 68, 53, 52, 64, 56, 51,
+    61, 65, 55, 54, 52, 63, 59, 54, 61, 54, 63, 47, 63, 55, 47, 55,
+    61, 45, 56, 51, 52, 54, 69, 48, 63, 55, 49, 63, 49, 54, 53, 55,
+    55, 53, 58, 62, 61, 51, 54, 57, 59, 61, 59, 51, 58, 57, 49, 57,
+    58, 52, 57, 57, 56, 58, 48, 62, 50, 54, 59, 60, 55, 64, 54, 42,
+    61, 51, 62, 59, 67, 68, 56, 63, 55, 63, 58, 65, 53, 59, 57, 51,
+    54, 55, 49, 59, 61, 54, 59, 60, 48, 56, 65, 49, 51, 59, 54, 55,
+    54, 63, 46, 75, 59, 49, 58, 60, 63, 53, 52, 59, 61, 51, 59, 66,
+    58, 57, 66, 48, 59, 52, 54, 61, 54, 56, 55, 64, 57, 59, 48, 63,
+    65, 55, 59, 66, 49, 41, 54, 56, 56, 60, 57, 54, 55, 56, 55, 48,
+    57, 61, 56, 60, 47, 51, 51, 60, 60, 57, 59, 44, 50, 54, 54, 58,
+    56, 66, 60, 51, 58, 52, 56, 57, 55, 64, 62, 57, 60, 62, 65, 51,
+    54, 61, 58, 54, 52, 54, 55, 57, 67, 52, 68, 55, 59, 64, 46, 73,
+    56, 47, 49, 51, 59, 58, 42, 71, 58, 57, 58, 54, 60, 49, 42, 63,
+    59, 50, 62, 59, 59, 63, 53, 53, 55, 45, 56, 52, 67, 60, 62, 55,
+    56, 55, 60, 50, 56, 60, 63, 50, 50, 55, 51, 54, 60, 55, 51, 53,
+    73, 54, 62, 53, 55, 52, 44, 54, 50, 58, 58, 59, 59, 55, 61, 52,
+    65, 51, 52, 51, 54, 56, 63, 62, 56, 42, 55, 62, 54, 56, 52, 56,
+    63, 69, 62, 60, 53, 62, 58, 67, 48, 54, 58, 49, 55, 63, 66, 57,
+    60, 54, 53, 57, 67, 54, 60, 60, 61, 60, 49, 66, 55, 61, 54, 53,
+    54, 58, 52, 61, 58, 54, 58, 53, 53, 63, 60, 46, 62, 52, 64, 53,
+    57, 53, 49, 54, 55, 59, 49, 55, 63, 64, 66, 55, 57, 66, 64, 56,
+    51, 60, 46, 56, 58, 65, 53, 63, 46, 53, 55, 61, 45, 56, 57, 66,
+    54, 57, 57, 51, 56, 53, 63, 56, 61, 58, 56, 55, 54, 58, 57, 55,
+    49, 59, 55, 51, 58, 60, 59, 61, 52, 59, 48, 59, 55, 60, 51, 64,
+    53, 49, 56, 55, 51, 64, 58, 59, 49, 65, 61, 53, 58, 54, 52, 58,
+    52, 60, 54, 55, 58, 63, 59, 59, 52, 66, 47, 47, 55, 57, 59, 66,
+    61, 51, 54, 51, 50, 57, 53, 61, 51, 55, 62, 61, 59, 67, 56, 49,
+    56, 57, 63, 50, 59, 39, 69, 56, 54, 52, 68, 46, 48, 50, 60, 57,
+    61, 51, 61, 58, 45, 57, 61, 56, 50, 41, 57, 51, 62, 59, 56, 49,
+    57, 63, 48, 56, 54, 62, 55, 64, 53, 48, 48, 61, 64, 52, 57, 58,
+    62, 58, 54, 69, 47, 63, 61, 53, 56, 59, 51, 51, 69, 60, 55, 52,
+    59, 62, 56, 48, 53, 55, 59, 59, 56, 59, 63, 52, 55, 42, 51, 45,
+    68, 53, 55, 55, 62, 68, 60, 51, 54, 52, 67, 54, 58, 61, 67, 57,
+    50, 58, 61, 57, 48, 57, 54, 52, 68, 49, 60, 51, 61, 56, 56, 46,
+    49, 52, 62, 56, 57, 54, 59, 50, 65, 61, 46, 65, 54, 55, 54, 51,
+    61, 56, 57, 52, 58, 63, 59, 64, 63, 57, 54, 49, 47, 57, 55, 54,
+    51, 70, 66, 64, 53, 56, 47, 67, 53, 50, 48, 53, 55, 60, 57, 46,
+    63, 63, 64, 48, 54, 58, 45, 55, 62, 55, 54, 69, 62, 62, 59, 55,
+    54, 53, 59, 62, 54, 54, 53, 57, 59, 55, 60, 52, 58, 67, 56, 57,
+    65, 50, 61, 58, 53, 48, 51, 57, 48, 54, 63, 60, 59, 56, 56, 63,
+    53, 75, 54, 54, 51, 54, 56, 54, 58, 54, 67, 58, 50, 63, 65, 59,
+    53, 67, 59, 48, 59, 56, 56, 56, 51, 61, 55, 58, 62, 61, 54, 69,
+    51, 58, 62, 57, 61, 64, 60, 68, 59, 46, 54, 53, 48, 53, 60, 56,
+    56, 59, 59, 56, 55, 68, 48, 49, 49, 65, 54, 53, 48, 61, 57, 60,
+    45, 58, 66, 62, 60, 49, 64, 47, 55, 50, 55, 51, 59, 60, 52, 62,
+    55, 62, 59, 53, 55, 47, 53, 60, 62, 52, 61, 55, 48, 53, 52, 61,
+    57, 62, 60, 53, 48, 63, 58, 48, 61, 50, 62, 56, 50, 56, 56, 58,
+    54, 53, 58, 56, 60, 67, 55, 57, 46, 57, 58, 62, 57, 53, 56, 58,
+    56, 58, 56, 64, 58, 47, 53, 59, 52, 54, 59, 49, 56, 57, 52, 46,
+    54, 58, 46, 54, 55, 63, 60, 56, 57, 58, 61, 64, 60, 60, 52, 51,
+    52, 58, 47, 56, 56, 54, 58, 60, 53, 58, 66, 57, 63, 47, 50, 55,
+    60, 62, 52, 61, 57, 60, 67, 51, 54, 59, 60, 46, 61, 67, 62, 55,
+    55, 54, 55, 52, 54, 55, 55, 57, 52, 56, 47, 64, 42, 61, 60, 63,
+    44, 45, 61, 62, 59, 51, 64, 48, 56, 46, 54, 51, 60, 49, 55, 59,
+    54, 50, 58, 61, 66, 51, 50, 70, 40, 54, 56, 54, 56, 62, 51, 56,
+    60, 54, 51, 60, 61, 64, 52, 57, 62, 57, 60, 62, 49, 54, 66, 57,
+    60, 62, 59, 53, 54, 49, 69, 63, 56, 60, 56, 56, 58, 57, 44, 62,
+    59, 62, 53, 51, 53, 53, 64, 50, 59, 60, 53, 64, 57, 59, 56, 54,
+    50, 60, 57, 63, 62, 56, 58, 52, 55, 51, 56, 60, 54, 68, 52, 59,
+    59, 51, 44, 59, 56, 62, 52, 58, 49, 58, 61, 57, 49, 53, 48, 61,
+    56, 56, 53, 63, 50, 68, 55, 58, 66, 64, 52, 48, 52, 54, 64, 58,
+    61, 68, 57, 49, 53, 44, 49, 52, 54, 64, 60, 48, 55, 63, 53, 56,
+    49, 56, 60, 63, 52, 63, 66, 52, 61, 59, 47, 61, 65, 51, 54, 55,
+    58, 43, 57, 61, 56, 65, 59, 55, 63, 58, 43, 54, 54, 50, 47, 51,
+    54, 51, 58, 47, 54, 55, 61, 46, 63, 55, 62, 49, 62, 54, 56, 63,
+    51, 56, 63, 63, 50, 56, 60, 56, 59, 52, 49, 49, 58, 57, 58, 67,
+    62, 64, 49, 51, 53, 55, 55, 56, 58, 58, 60, 60, 57, 64, 59, 64,
+    50, 58, 49, 65, 59, 50, 50, 55, 67, 64, 59, 56, 50, 59, 53, 60,
+    58, 53, 55, 52, 58, 55, 52, 64, 54, 63, 52, 51, 62, 63, 55, 57,
+    55, 54, 61, 50, 59, 55, 58, 49, 63, 63, 56, 63, 65, 54, 58, 58,
+    60, 48, 57, 63, 58, 46, 55, 59, 50, 55, 58, 57, 61, 62, 62, 53,
+    52, 61, 53, 54, 60, 60, 58, 54, 61, 51, 70, 53, 63, 65, 55, 41,
+    54, 65, 55, 61, 51, 61, 52, 51, 51, 56, 57, 55, 42, 59, 55, 56,
+    54, 53, 69, 48, 51, 60, 57, 66, 54, 56, 58, 59, 61, 48, 58, 63,
+    54, 58, 54, 64, 67, 55, 58, 55, 50, 63, 50, 59, 52, 57, 64, 60,
+    55, 59, 63, 58, 56, 53, 58, 55, 51, 47, 63, 54, 51, 56, 59, 54,
+    54, 59, 57, 59, 60, 61, 55, 49, 46, 61, 52, 57, 52, 60, 49, 53,
+    55, 46, 61, 53, 59, 51, 60, 53, 51, 55, 59, 65, 55, 56, 53, 54,
+    53, 59, 58, 55, 64, 51, 57, 52, 48, 49, 56, 62, 62, 62, 63, 58,
+    64, 58, 47, 63, 56, 60, 54, 55, 56, 58, 57, 54, 58, 58, 54, 49,
+    59, 52, 56, 53, 54, 61, 65, 61, 62, 58, 56, 61, 52, 74, 59, 47,
+    58, 48, 48, 68, 61, 58, 61, 52, 61, 52, 66, 68, 53, 51, 56, 56,
+    52, 63, 55, 64, 47, 66, 61, 58, 62, 61, 62, 58, 65, 53, 61, 46,
+    51, 42, 57, 58, 56, 50, 58, 52, 61, 57, 53, 60, 56, 57, 58, 53,
+    53, 60, 55, 63, 56, 57, 54, 48, 49, 53, 46, 45, 55, 66, 56, 52,
+    54, 59, 55, 56, 52, 64, 49, 51, 55, 56, 63, 50, 53, 59, 56, 63,
+    59, 63, 54, 58, 55, 67, 58, 45, 54, 63, 52, 68, 54, 59, 60, 62,
+    57, 61, 66, 48, 49, 51, 53, 52, 73, 54, 67, 53, 62, 51, 62, 58,
+    53, 44, 66, 57, 59, 53, 55, 58, 56, 56, 54, 60, 57, 61, 52, 52,
+    58, 56, 57, 62, 55, 58, 49, 53, 51, 48, 55, 60, 59, 49, 56, 55,
+    50, 53, 56, 52, 63, 55, 43, 59, 53, 58, 52, 67, 52, 55, 61, 55,
+    56, 71, 66, 61, 58, 62, 52, 65, 53, 62, 54, 54, 49, 64, 50, 55,
+    59, 49, 63, 50, 49, 51, 60, 67, 60, 49, 63, 57, 56, 50, 58, 58,
+    55, 56, 50, 64, 60, 52, 56, 50, 62, 61, 59, 55, 56, 60, 54, 55,
+    53, 48, 49, 64, 55, 57, 52, 66, 61, 52, 56, 49, 62, 53, 53, 51,
+    58, 59, 45, 63, 54, 65, 49, 55, 54, 55, 63, 54, 51, 54, 58, 60,
+    56, 57, 67, 55, 56, 53, 44, 61, 51, 52, 59, 52, 49, 63, 55, 61,
+    45, 42, 55, 59, 57, 62, 62, 54, 53, 51, 54, 53, 56, 58, 52, 60,
+    56, 51, 48, 60, 54, 56, 61, 58, 67, 45, 56, 64, 56, 57, 58, 51,
+    59, 60, 54, 63, 59, 69, 52, 57, 46, 58, 56, 55, 64, 59, 57, 49,
+    50, 60, 54, 60, 56, 61, 62, 50, 67, 61, 53, 69, 50, 64, 59, 64,
+    60, 60, 63, 59, 55, 60, 66, 55, 55, 49, 60, 61, 66, 44, 56, 59,
+    60, 58, 47, 58, 54, 55, 59, 58, 58, 56, 47, 54, 48, 56, 60, 52,
+    58, 53, 63, 55, 51, 64, 52, 52, 60, 49, 58, 51, 63, 54, 55, 49,
+    67, 62, 60, 52, 58, 60, 53, 61, 51, 66, 55, 43, 65, 63, 56, 58,
+    56, 62, 51, 64, 60, 50, 60, 65, 57, 50, 45, 54, 67, 60, 55, 44,
+    57, 66, 48, 52, 60, 54, 57, 58, 48, 58, 52, 47, 62, 56, 57, 63,
+    53, 69, 55, 54, 56, 51, 60, 43, 59, 56, 58, 61, 51, 54, 54, 51,
+    63, 62, 55, 62, 64, 54, 50, 71, 53, 60, 57, 56, 54, 53, 59, 59,
+    63, 62, 61, 54, 60, 47, 54, 54, 52, 49, 53, 56, 66, 54, 59, 62,
+    61, 70, 53, 57, 53, 51, 57, 51, 65, 50, 56, 52, 54, 53, 58, 58,
+    58, 52, 53, 49, 61, 62, 53, 64, 58, 58, 53, 57, 59, 55, 53, 57,
+    59, 53, 63, 57, 54, 50, 53, 50, 53, 57, 59, 56, 53, 53, 56, 62,
+    62, 62, 45, 58, 59, 52, 48, 57, 55, 64, 66, 56, 56, 56, 53, 45,
+    60, 49, 46, 57, 58, 51, 54, 57, 62, 61, 59, 62, 64, 57, 56, 51,
+    48, 57, 60, 65, 56, 58, 57, 57, 56, 57, 57, 51, 67, 58, 61, 57,
+    55, 55, 61, 59, 51, 62, 58, 55, 53, 58, 48, 62, 53, 53, 58, 54,
+    48, 63, 48, 64, 48, 60, 47, 58, 56, 44, 65, 61, 61, 62, 70, 52,
+    54, 60, 46, 57, 67, 54, 56, 58, 52, 62, 56, 64, 52, 61, 58, 59,
+    50, 54, 63, 46, 59, 54, 59, 55, 50, 58, 63, 50, 51, 60, 61, 63,
+    53, 53, 53, 59, 50, 59, 50, 60, 58, 54, 55, 47, 60, 51, 71, 50,
+    65, 54, 52, 54, 59, 55, 56, 54, 60, 56, 55, 55, 57, 61, 52, 58,
+    55, 51, 65, 61, 58, 56, 58, 53, 61, 41, 67, 56, 65, 57, 54, 50,
+    59, 51, 50, 51, 62, 45, 56, 64, 60, 57, 51, 65, 57, 53, 56, 54,
+    60, 57, 53, 66, 56, 62, 61, 59, 62, 52, 58, 62, 58, 53, 60, 56,
+    55, 60, 61, 69, 63, 55, 54, 51, 61, 72, 57, 65, 55, 53, 49, 55,
+    62, 61, 39, 57, 59, 52, 67, 57, 58, 57, 51, 59, 56, 52, 66, 53,
+    54, 53, 55, 71, 56, 57, 52, 52, 44, 53, 50, 49, 59, 54, 71, 65,
+    56, 59, 59, 53, 50, 64, 52, 52, 51, 61, 57, 50, 61, 52, 62, 68,
+    59, 52, 55, 47, 51, 55, 62, 63, 61, 50, 61, 51, 56, 58, 60, 52,
+    53, 56, 54, 56, 56, 65, 48, 59, 51, 65, 52, 59, 54, 63, 55, 60,
+    55, 55, 46, 59, 54, 57, 47, 55, 56, 50, 60, 49, 62, 63, 51, 51,
+    58, 66, 56, 54, 59, 55, 51, 58, 52, 63, 59, 58, 63, 60, 63, 61,
+    51, 45, 65, 56, 48, 51, 60, 58, 59, 58, 61, 56, 47, 56, 51, 58,
+    55, 64, 52, 58, 64, 61, 61, 51, 60, 55, 65, 61, 59, 49, 63, 47,
+    61, 54, 46, 59, 51, 67, 64, 61, 60, 53, 53, 56, 58, 56, 43, 71,
+    49, 61, 48, 64, 61, 58, 54, 55, 58, 65, 50, 56, 66, 49, 66, 44,
+    53, 58, 64, 50, 64, 55, 66, 72, 53, 58, 42, 51, 48, 58, 59, 53,
+    57, 64, 51, 63, 59, 62, 60, 57, 47, 57, 55, 67, 63, 49, 56, 60,
+    57, 57, 55, 62, 59, 53, 54, 60, 56, 52, 47, 71, 54, 58, 48, 59,
+    51, 64, 68, 41, 42, 52, 62, 64, 63, 57, 53, 67, 47, 58, 50, 46,
+    55, 60, 56, 58, 63, 58, 55, 53, 62, 52, 64, 46, 56, 48, 57, 53,
+    57, 58, 59, 65, 65, 67, 56, 59, 64, 54, 57, 58, 56, 55, 68, 54,
+    55, 60, 62, 55, 57, 59, 57, 63, 51, 58, 59, 56, 55, 55, 54, 58,
+    52, 58, 58, 63, 52, 58, 63, 58, 59, 63, 51, 58, 46, 66, 55, 56,
+    60, 57, 56, 60, 60, 43, 54, 60, 57, 54, 51, 61, 48, 62, 54, 56,
+    49, 52, 61, 63, 50, 62, 56, 60, 55, 56, 57, 57, 50, 60, 62, 49,
+    64, 54, 51, 52, 51, 63, 57, 63, 53, 56, 64, 63, 55, 59, 56, 54,
+    58, 65, 49, 54, 59, 61, 59, 50, 58, 62, 63, 61, 55, 56, 59, 59,
+    66, 56, 62, 52, 50, 53, 57, 65, 61, 56, 53, 57, 55, 66, 58, 54,
+    54, 55, 59, 52, 47, 59, 72, 53, 52, 58, 55, 62, 64, 59, 47, 54,
+    56, 60, 62, 54, 60, 56, 59, 63, 45, 60, 53, 52, 61, 58, 54, 55,
+    59, 66, 51, 50, 52, 49, 63, 50, 52, 70, 50, 57, 56, 53, 50, 50,
+    66, 54, 49, 56, 56, 61, 62, 64, 55, 58, 55, 62, 55, 52, 59, 56,
+    59, 61, 53, 51, 62, 45, 53, 51, 50, 58, 61, 63, 53, 48, 65, 55,
+    61, 60, 64, 44, 62, 64, 44, 54, 56, 63, 50, 52, 58, 60, 54, 63,
+    56, 54, 63, 51, 59, 45, 54, 61, 51, 57, 52, 60, 56, 54, 50, 55,
+    56, 64, 63, 61, 49, 59, 59, 58, 48, 53, 55, 71, 51, 42, 64, 58,
+    48, 55, 64, 48, 60, 56, 58, 56, 66, 60, 47, 49, 58, 63, 58, 51,
+    47, 69, 67, 59, 58, 59, 55, 60, 60, 67, 55, 61, 52, 53, 53, 52,
+    59, 50, 54, 61, 56, 56, 51, 58, 59, 59, 53, 59, 53, 53, 60, 50,
+    58, 55, 57, 60, 60, 59, 48, 58, 56, 54, 59, 56, 60, 62, 56, 53,
+    61, 56, 58, 59, 49, 50, 64, 52, 56, 55, 56, 60, 48, 59, 54, 65,
+    64, 60, 65, 50, 57, 50, 53, 60, 56, 58, 53, 47, 57, 47, 48, 47,
+    52, 60, 54, 63, 56, 59, 60, 62, 57, 51, 59, 53, 64, 42, 55, 58,
+    61, 52, 60, 55, 70, 64, 55, 62, 59, 55, 62, 48, 66, 59, 63, 52,
+    49, 67, 55, 57, 47, 54, 52, 57, 55, 57, 47, 63, 68, 56, 54, 51,
+    56, 56, 51, 62, 58, 65, 59, 50, 48, 57, 67, 51, 62, 53, 58, 58,
+    64, 73, 47, 49, 63, 61, 61, 70, 61, 52, 63, 47, 51, 57, 55, 54,
+    50, 59, 60, 54, 56, 57, 56, 68, 51, 44, 60, 61, 64, 58, 57, 49,
+    56, 53, 58, 44, 55, 57, 54, 55, 56, 66, 51, 61, 64, 53, 56, 59,
+    66, 55, 52, 51, 60, 54, 54, 51, 53, 57, 61, 47, 50, 60, 61, 49,
+    57, 55, 60, 57, 51, 56, 57, 51, 64, 58, 57, 51, 58, 60, 56, 55,
+    62, 60, 61, 54, 62, 56, 57, 61, 53, 62, 65, 53, 59, 54, 56, 58,
+    63, 53, 64, 58, 52, 46, 49, 52, 60, 52, 53, 55, 54, 50, 66, 62,
+    60, 47, 52, 54, 65, 48, 49, 50, 56, 53, 64, 52, 56, 55, 50, 57,
+    66, 60, 49, 54, 62, 53, 59, 64, 54, 64, 56, 52, 61, 52, 63, 60,
+    50, 48, 62, 46, 53, 57, 55, 48, 47, 62, 58, 56, 49, 60, 60, 66,
+    50, 68, 56, 61, 52, 66, 56, 52, 48, 47, 60, 53, 54, 52, 46, 50,
+    62, 64, 58, 62, 49, 63, 46, 63, 62, 59, 62, 65, 51, 51, 58, 51,
+    57, 60, 55, 62, 63, 54, 50, 41, 53, 58, 55, 59, 51, 65, 59, 67,
+    64, 46, 50, 53, 64, 56, 59, 62, 54, 61, 58, 59, 56, 55, 54, 53,
+    53, 68, 55, 58, 60, 52, 56, 56, 58, 55, 54, 57, 66, 59, 52, 65,
+    61, 67, 48, 57, 61, 61, 55, 55, 57, 55, 49, 59, 55, 60, 50, 58,
+    57, 46, 49, 56, 49, 65, 61, 62, 54, 52, 52, 64, 56, 67, 50, 55,
+    55, 48, 63, 50, 55, 53, 51, 54, 59, 55, 65, 42, 63, 52, 63, 60,
+    61, 62, 51, 44, 54, 55, 53, 57, 49, 59, 49, 63, 53, 49, 57, 60,
+    57, 58, 56, 59, 49, 59, 58, 56, 54, 44, 73, 61, 57, 55, 63, 60,
+    55, 53, 63, 49, 54, 53, 60, 50, 56, 57, 59, 66, 49, 59, 61, 57,
+    54, 58, 62, 55, 56, 52, 57, 50, 64, 63, 58, 61, 58, 59, 49, 49,
+    63, 52, 60, 54, 67, 55, 48, 53, 46, 56, 51, 55, 53, 53, 49, 53,
+    59, 54, 64, 56, 54, 53, 64, 55, 58, 57, 59, 55, 47, 56, 54, 58,
+    56, 61, 68, 54, 61, 58, 59, 55, 56, 53, 57, 58, 62, 53, 52, 52,
+    52, 57, 58, 60, 64, 55, 57, 56, 48, 60, 63, 63, 64, 53, 54, 57,
+    56, 55, 58, 53, 65, 55, 57, 62, 59, 55, 53, 59, 58, 50, 56, 59,
+    64, 60, 58, 57, 48, 56, 60, 50, 56, 57, 59, 60, 63, 61, 54, 63,
+    53, 62, 53, 49, 63, 57, 56, 54, 50, 61, 60, 60, 53, 60, 55, 54,
+    55, 56, 43, 52, 68, 53, 52, 63, 51, 49, 48, 56, 64, 59, 54, 60,
+    59, 58, 61, 54, 49, 56, 58, 49, 54, 62, 63, 50, 55, 58, 54, 62,
+    43, 59, 57, 51, 60, 55, 55, 59, 56, 58, 54, 60, 53, 62, 49, 56,
+    56, 50, 47, 53, 64, 51, 57, 58, 52, 54, 56, 49, 65, 49, 59, 60,
+    57, 53, 49, 64, 55, 54, 55, 54, 65, 62, 56, 52, 55, 64, 50, 56,
+    62, 70, 56, 59, 53, 57, 54, 53, 66, 55, 53, 54, 55, 60, 56, 62,
+    52, 50, 65, 51, 55, 61, 55, 58, 53, 56, 60, 55, 54, 55, 57, 66,
+    46, 63, 56, 61, 58, 65, 48, 53, 58, 52, 61, 60, 57, 56, 55, 56,
+    55, 47, 56, 55, 71, 56, 44, 56, 58, 60, 60, 60, 66, 54, 48, 54,
+    63, 58, 53, 59, 55, 56, 51, 49, 57, 61, 53, 58, 59, 57, 58, 55,
+    60, 63, 55, 52, 57, 61, 54, 62, 57, 51, 58, 65, 64, 57, 62, 57,
+    53, 57, 50, 57, 54, 58, 57, 52, 57, 53, 54, 58, 52, 51, 53, 68,
+    57, 51, 59, 55, 57, 57, 54, 60, 67, 57, 61, 72, 57, 51, 62, 64,
+    47, 57, 48, 60, 64, 53, 55, 58, 52, 57, 59, 48, 59, 56, 55, 61,
+    52, 60, 58, 54, 51, 57, 65, 56, 50, 61, 64, 54, 59, 50, 56, 69,
+    50, 56, 57, 47, 57, 62, 47, 67, 53, 56, 51, 56, 59, 52, 54, 54,
+    53, 53, 66, 60, 58, 55, 52, 60, 58, 57, 62, 55, 62, 54, 56, 59,
+    51, 52, 51, 52, 60, 60, 57, 49, 55, 55, 54, 54, 54, 64, 64, 59,
+    58, 53, 59, 47, 59, 58, 60, 57, 53, 54, 54, 61, 58, 47, 51, 57,
+    56, 57, 52, 57, 51, 62, 55, 55, 61, 60, 52, 53, 47, 55, 61, 62,
+    63, 59, 58, 52, 59, 50, 64, 63, 57, 58, 44, 52, 49, 59, 59, 55,
+    55, 58, 67, 52, 57, 64, 60, 55, 49, 59, 61, 54, 56, 56, 60, 58,
+    54, 61, 52, 50, 49, 57, 51, 50, 62, 58, 56, 55, 53, 51, 43, 48,
+    62, 62, 54, 65, 57, 56, 64, 62, 52, 56, 58, 58, 65, 52, 66, 48,
+    58, 55, 56, 57, 61, 57, 67, 53, 60, 58, 61, 60, 63, 62, 53, 53,
+    64, 51, 57, 60, 53, 63, 58, 48, 65, 59, 49, 58, 61, 55, 50, 61,
+    61, 45, 66, 47, 66, 47, 59, 58, 43, 63, 49, 55, 64, 58, 59, 52,
+    66, 51, 62, 58, 55, 54, 58, 56, 56, 56, 46, 65, 55, 59, 48, 48,
+    52, 54, 46, 55, 58, 57, 61, 62, 52, 73, 54, 56, 51, 52, 61, 51,
+    62, 54, 53, 66, 63, 59, 62, 56, 55, 62, 61, 46, 53, 62, 58, 55,
+    66, 63, 59, 57, 64, 49, 47, 54, 57, 57, 55, 66, 52, 63, 53, 57,
+    62, 51, 56, 55, 52, 54, 67, 52, 62, 63, 59, 44, 63, 48, 52, 63,
+    61, 58, 76, 49, 54, 53, 57, 53, 47, 57, 62, 43, 55, 54, 54, 64,
+    57, 63, 57, 41, 57, 61, 54, 57, 53, 60, 66, 41, 50, 50, 53, 57,
+    57, 49, 53, 57, 63, 60, 54, 48, 54, 61, 63, 66, 53, 51, 71, 58,
+    61, 53, 56, 55, 50, 63, 52, 47, 55, 59, 48, 55, 65, 63, 46, 49,
+    53, 53, 59, 56, 48, 60, 63, 67, 55, 52, 52, 51, 45, 58, 50, 64,
+    55, 56, 52, 58, 60, 59, 41, 61, 56, 52, 59, 57, 62, 47, 58, 55,
+    61, 57, 58, 63, 53, 55, 59, 60, 42, 58, 50, 57, 53, 59, 56, 55,
+    49, 53, 53, 54, 59, 60, 64, 63, 48, 54, 52, 55, 52, 67, 57, 58,
+    61, 62, 63, 59, 65, 53, 52, 57, 53, 45, 63, 59, 66, 48, 58, 56,
+    62, 57, 53, 57, 61, 48, 54, 50, 50, 55, 55, 52, 55, 55, 63, 54,
+    44, 56, 56, 57, 58, 57, 54, 64, 53, 61, 54, 51, 63, 56, 59, 51,
+    47, 57, 55, 58, 65, 52, 57, 45, 43, 56, 64, 57, 63, 55, 50, 52,
+    55, 62, 56, 53, 53, 59, 50, 44, 68, 56, 59, 68, 52, 49, 68, 50,
+    54, 62, 60, 61, 56, 54, 61, 49, 63, 58, 51, 41, 53, 64, 51, 53,
+    63, 55, 58, 54, 62, 63, 56, 61, 54, 51, 61, 58, 54, 53, 56, 54,
+    65, 53, 64, 55, 70, 62, 54, 52, 50, 68, 54, 58, 62, 56, 59, 62,
+    53, 59, 57, 57, 61, 49, 56, 58, 50, 53, 62, 51, 65, 48, 51, 61,
+    52, 55, 55, 46, 55, 64, 49, 62, 47, 54, 50, 60, 55, 64, 49, 61,
+    60, 54, 58, 56, 53, 59, 52, 52, 61, 61, 57, 47, 58, 58, 63, 52,
+    57, 41, 56, 47, 55, 57, 57, 55, 65, 61, 52, 62, 55, 49, 65, 55,
+    57, 60, 60, 59, 56, 57, 42, 57, 57, 53, 71, 50, 55, 64, 55, 57,
+    57, 55, 59, 59, 57, 55, 46, 57, 59, 45, 56, 63, 63, 52, 60, 61,
+    55, 59, 51, 51, 56, 58, 45, 52, 52, 51, 46, 62, 63, 75, 52, 61,
+    62, 57, 58, 60, 53, 49, 71, 60, 45, 68, 54, 57, 51, 60, 56, 53,
+    51, 65, 54, 51, 59, 54, 66, 55, 64, 56, 55, 54, 60, 55, 58, 49,
+    51, 68, 55, 56, 47, 62, 57, 54, 59, 56, 59, 58, 60, 46, 54, 59,
+    62, 57, 53, 59, 44, 51, 52, 54, 53, 55, 62, 52, 65, 59, 60, 46,
+    60, 51, 61, 59, 54, 43, 57, 49, 55, 56, 60, 58, 52, 67, 52, 60,
+    57, 60, 52, 52, 58, 56, 63, 56, 65, 56, 54, 57, 62, 63, 57, 49,
+    56, 53, 54, 55, 47, 64, 52, 52, 45, 60, 73, 47, 59, 63, 55, 49,
+    62, 51, 60, 54, 57, 69, 64, 51, 54, 58, 49, 55, 59, 55, 65, 52,
+    67, 62, 60, 53, 56, 56, 51, 61, 62, 50, 49, 61, 56, 62, 55, 60,
+    56, 71, 56, 65, 50, 53, 62, 64, 64, 67, 60, 52, 53, 57, 54, 56,
+    57, 63, 58, 52, 62, 55, 65, 50, 56, 63, 48, 53, 55, 52, 55, 62,
+    61, 54, 51, 55, 55, 59, 55, 58, 52, 54, 59, 56, 63, 66, 52, 53,
+    59, 52, 61, 62, 58, 58, 62, 50, 51, 56, 44, 55, 51, 47, 66, 51,
+    57, 56, 53, 49, 47, 53, 58, 62, 71, 49, 58, 54, 55, 54, 58, 62,
+    57, 52, 53, 35, 48, 54, 58, 53, 53, 62, 59, 46, 58, 47, 50, 67,
+    52, 59, 61, 61, 57, 61, 54, 51, 68, 55, 45, 57, 62, 54, 53, 56,
+    56, 57, 57, 54, 56, 61, 64, 65, 54, 54, 57, 53, 55, 60, 57, 61,
+    53, 55, 63, 63, 55, 63, 57, 54, 52, 51, 63, 64, 58, 56, 54, 59,
+    50, 58, 59, 54, 64, 55, 55, 60, 61, 59, 58, 50, 63, 58, 55, 48,
+    55, 57, 48, 50, 49, 53, 57, 63, 55, 70, 50, 53, 59, 52, 58, 61,
+    51, 54, 59, 58, 60, 49, 64, 51, 49, 69, 51, 62, 71, 60, 54, 57,
+    68, 63, 70, 49, 54, 60, 53, 47, 56, 64, 63, 57, 61, 48, 58, 54,
+    52, 57, 60, 55, 52, 52, 50, 54, 57, 58, 56, 61, 49, 62, 64, 62,
+    60, 55, 61, 57, 56, 52, 57, 52, 53, 60, 53, 61, 56, 58, 62, 56,
+    46, 61, 60, 54, 53, 56, 60, 62, 49, 52, 55, 60, 49, 54, 51, 48,
+    54, 57, 44, 54, 58, 60, 60, 60, 55, 60, 58, 52, 47, 66, 50, 59,
+    64, 51, 48, 58, 61, 58, 52, 51, 52, 57, 55, 62, 59, 51, 52, 58,
+    54, 52, 61, 62, 45, 64, 51, 48, 53, 59, 63, 61, 58, 47, 56, 58,
+    54, 54, 53, 55, 46, 56, 49, 58, 51, 68, 55, 56, 54, 58, 67, 53,
+    60, 62, 54, 58, 45, 58, 52, 63, 56, 64, 54, 53, 60, 54, 60, 55,
+    53, 55, 53, 51, 56, 45, 58, 62, 51, 60, 60, 59, 56, 59, 50, 57,
+    57, 56, 60, 48, 64, 53, 58, 58, 65, 58, 49, 68, 66, 46, 60, 57,
+    57, 62, 59, 60, 61, 52, 55, 58, 56, 51, 63, 59, 49, 60, 48, 60,
+    61, 60, 53, 54, 52, 67, 48, 44, 57, 60, 63, 61, 52, 60, 61, 56,
+    60, 53, 52, 54, 58, 61, 57, 58, 50, 53, 65, 57, 57, 59, 56, 54,
+    58, 56, 56, 62, 58, 61, 56, 63, 63, 50, 67, 46, 60, 59, 55, 55,
+    55, 59, 64, 54, 60, 57, 52, 53, 62, 62, 53, 66, 60, 55, 59, 61,
+    52, 53, 61, 66, 58, 57, 58, 49, 50, 58, 52, 56, 66, 65, 58, 64,
+    68, 59, 50, 50, 52, 52, 65, 52, 56, 60, 48, 52, 61, 44, 52, 62,
+    58, 63, 51, 52, 66, 44, 54, 51, 57, 50, 54, 63, 50, 60, 46, 56,
+    63, 68, 54, 55, 54, 67, 62, 47, 63, 59, 59, 53, 61, 50, 60, 45,
+    56, 55, 59, 52, 52, 56, 52, 61, 56, 57, 50, 56, 58, 56, 54, 58,
+    57, 58, 49, 57, 45, 58, 61, 59, 52, 64, 56, 54, 60, 58, 58, 56,
+    54, 62, 58, 62, 53, 67, 46, 59, 47, 58, 54, 60, 51, 58, 55, 57,
+    54, 61, 66, 50, 56, 56, 54, 53, 47, 55, 62, 57, 56, 60, 59, 56,
+    56, 67, 56, 53, 62, 63, 55, 48, 47, 64, 58, 48, 55, 59, 50, 62,
+    57, 55, 57, 60, 56, 56, 64, 53, 57, 50, 58, 52, 60, 48, 64, 55,
+    47, 57, 63, 49, 61, 53, 53, 54, 62, 61, 60, 66, 57, 54, 43, 57,
+    58, 56, 61, 47, 46, 55, 49, 51, 64, 65, 58, 53, 46, 70, 61, 59,
+    48, 53, 55, 66, 54, 53, 51, 61, 52, 58, 55, 52, 63, 55, 48, 54,
+    66, 62, 54, 49, 66, 49, 57, 59, 51, 56, 60, 51, 54, 69, 66, 56,
+    61, 56, 63, 42, 59, 53, 58, 55, 56, 50, 64, 57, 57, 64, 60, 63,
+    60, 62, 53, 55, 54, 62, 59, 57, 62, 59, 53, 51, 61, 60, 48, 47,
+    58, 57, 56, 54, 51, 58, 51, 60, 54, 55, 61, 59, 55, 66, 61, 53,
+    51, 66, 62, 52, 59, 52, 48, 51, 54, 47, 48, 69, 48, 54, 54, 59,
+    54, 56, 54, 56, 60, 56, 48, 64, 51, 64, 56, 63, 46, 58, 63, 63,
+    52, 53, 61, 51, 41, 64, 55, 50, 52, 61, 56, 66, 53, 61, 49, 52,
+    65, 51, 64, 51, 57, 58, 57, 63, 49, 54, 48, 60, 62, 49, 54, 45,
+    51, 52, 56, 54, 45, 61, 59, 55, 63, 51, 60, 52, 59, 62, 56, 63,
+    57, 73, 47, 62, 56, 57, 54, 62, 56, 61, 51, 57, 51, 61, 56, 52,
+    69, 51, 54, 55, 59, 48, 53, 60, 57, 51, 45, 55, 52, 70, 61, 54,
+    61, 54, 58, 46, 56, 54, 54, 57, 59, 51, 55, 65, 58, 54, 61, 57,
+    63, 62, 61, 45, 55, 57, 54, 48, 67, 50, 62, 55, 60, 51, 64, 49,
+    51, 50, 56, 54, 49, 54, 60, 58, 58, 62, 57, 55, 53, 52, 51, 58,
+    59, 54, 52, 62, 59, 64, 55, 54, 58, 67, 52, 53, 50, 64, 58, 59,
+    42, 58, 56, 53, 58, 56, 52, 57, 56, 45, 51, 50, 62, 52, 54, 51,
+    64, 52, 63, 55, 62, 57, 45, 47, 58, 53, 51, 55, 57, 52, 55, 54,
+    58, 56, 55, 63, 57, 57, 56, 54, 60, 58, 57, 63, 51, 49, 57, 69,
+    59, 58, 49, 65, 51, 60, 62, 61, 45, 61, 60, 50, 47, 49, 51, 53,
+    67, 48, 63, 55, 52, 60, 57, 62, 60, 60, 58, 62, 60, 56, 56, 51,
+    54, 54, 66, 56, 50, 57, 60, 66, 61, 59, 61, 62, 46, 55, 64, 56,
+    59, 61, 47, 48, 64, 52, 62, 47, 49, 59, 57, 54, 61, 60, 61, 51,
+    62, 60, 58, 60, 58, 50, 66, 55, 46, 57, 56, 58, 59, 50, 61, 56,
+    54, 50, 51, 61, 68, 51, 53, 60, 52, 55, 51, 59, 58, 60, 64, 57,
+    64, 51, 60, 56, 53, 54, 48, 43, 52, 55, 53, 45, 58, 56, 55, 56,
+    55, 61, 61, 46, 71, 59, 57, 58, 57, 58, 55, 63, 62, 59, 39, 63,
+    56, 48, 56, 59, 64, 60, 58, 52, 45, 62, 59, 56, 60, 49, 54, 58,
+    50, 53, 60, 54, 56, 52, 60, 63, 58, 50, 53, 61, 54, 45, 53, 57,
+    66, 56, 50, 63, 47, 50, 55, 61, 64, 59, 51, 59, 65, 58, 62, 62,
+    54, 54, 53, 52, 55, 51, 53, 64, 55, 56, 61, 58, 47, 54, 59, 55,
+    51, 68, 51, 49, 54, 55, 53, 58, 53, 54, 59, 54, 53, 55, 60, 63,
+    56, 56, 53, 55, 44, 64, 59, 55, 60, 55, 62, 56, 56, 54, 51, 49,
+    51, 68, 59, 52, 61, 57, 66, 61, 55, 54, 62, 52, 62, 56, 62, 53,
+    55, 52, 56, 57, 54, 41, 57, 54, 55, 58, 52, 68, 58, 58, 51, 47,
+    48, 60, 53, 53, 56, 60, 54, 56, 66, 67, 52, 60, 45, 58, 58, 56,
+    53, 49, 61, 56, 61, 58, 61, 46, 62, 58, 62, 45, 50, 55, 60, 57,
+    57, 57, 63, 61, 64, 60, 59, 59, 48, 49, 52, 65, 60, 59, 50, 48,
+    62, 58, 58, 59, 61, 58, 69, 48, 67, 58, 56, 52, 61, 67, 61, 57,
+    54, 62, 61, 55, 61, 49, 62, 55, 47, 54, 53, 49, 51, 51, 54, 61,
+    63, 59, 52, 53, 59, 57, 59, 53, 60, 47, 51, 54, 55, 61, 58, 53,
+    51, 56, 53, 53, 68, 56, 56, 51, 58, 55, 48, 56, 64, 57, 63, 58,
+    49, 55, 48, 54, 56, 49, 60, 64, 59, 60, 51, 57, 57, 62, 46, 55,
+    58, 52, 55, 59, 53, 54, 67, 57, 58, 53, 61, 61, 64, 59, 58, 52,
+    60, 48, 49, 50, 59, 56, 51, 58, 61, 58, 52, 56, 56, 62, 53, 56,
+    46, 58, 58, 60, 57, 55, 59, 59, 56, 53, 53, 51, 49, 66, 55, 66,
+    52, 54, 49, 52, 64, 53, 51, 56, 46, 62, 60, 53, 60, 66, 62, 62,
+    62, 55, 49, 67, 54, 47, 58, 52, 60, 53, 70, 70, 63, 52, 56, 58,
+    50, 60, 46, 45, 55, 53, 63, 62, 52, 63, 60, 54, 57, 51, 52, 52,
+    62, 52, 57, 55, 57, 54, 58, 58, 62, 58, 54, 58, 58, 55, 49, 58,
+    60, 54, 60, 53, 62, 63, 56, 61, 58, 54, 48, 57, 56, 60, 56, 56,
+    58, 59, 51, 52, 58, 54, 50, 52, 58, 49, 58, 56, 54, 56, 52, 58,
+    57, 63, 54, 60, 57, 48, 53, 63, 47, 56, 53, 60, 58, 58, 68, 66,
+    59, 53, 59, 59, 56, 54, 59, 54, 60, 63, 50, 50, 56, 61, 55, 53,
+    59, 55, 55, 61, 50, 63, 62, 49, 60, 46, 56, 50, 59, 51, 55, 59,
+    63, 49, 58, 54, 51, 58, 69, 51, 62, 59, 48, 46, 63, 69, 54, 56,
+    64, 53, 60, 48, 54, 57, 51, 60, 51, 66, 63, 49, 55, 54, 51, 60,
+    62, 52, 62, 46, 65, 59, 60, 61, 53, 57, 55, 45, 50, 56, 50, 56,
+    54, 56, 45, 56, 63, 66, 58, 58, 50, 54, 47, 48, 60, 66, 47, 57,
+    67, 52, 55, 67, 57, 50, 61, 49, 47, 59, 48, 53, 64, 62, 63, 57,
+    58, 52, 54, 56, 47, 67, 49, 65, 61, 61, 60, 59, 53, 59, 67, 62,
+    59, 49, 53, 46, 55, 56, 54, 52, 53, 63, 62, 50, 48, 55, 66, 40,
+    56, 57, 48, 60, 63, 57, 62, 62, 54, 56, 52, 53, 62, 45, 57, 53,
+    48, 56, 59, 69, 49, 68, 52, 51, 56, 54, 60, 59, 55, 58, 60, 54,
+    54, 63, 69, 52, 61, 57, 50, 45, 60, 54, 66, 54, 53, 60, 57, 59,
+    61, 49, 52, 50, 57, 65, 49, 55, 50, 58, 49, 61, 51, 46, 64, 63,
+    56, 62, 57, 65, 57, 59, 58, 59, 52, 57, 58, 59, 50, 51, 57, 60,
+    58, 58, 54, 62, 56, 61, 56, 52, 61, 57, 53, 62, 59, 58, 53, 49,
+    51, 55, 61, 47, 54, 49, 62, 50, 62, 53, 55, 58, 62, 53, 60, 54,
+    46, 55, 56, 52, 52, 66, 52, 53, 58, 57, 63, 59, 58, 50, 60, 62,
+    61, 63, 51, 44, 58, 53, 56, 52, 66, 57, 61, 56, 53, 67, 60, 63,
+    54, 52, 59, 65, 59, 59, 55, 54, 59, 55, 52, 61, 54, 66, 50, 51,
+    55, 58, 59, 60, 59, 62, 55, 55, 55, 63, 60, 50, 45, 53, 60, 51,
+    50, 56, 63, 54, 60, 57, 48, 50, 50, 45, 54, 50, 64, 46, 50, 55,
+    66, 50, 53, 64, 55, 58, 65, 54, 53, 52, 63, 53, 57, 56, 53, 57,
+    62, 55, 58, 59, 64, 61, 60, 68, 65, 64, 56, 50, 59, 50, 48, 46,
+    52, 44, 61, 58, 58, 52, 56, 46, 59, 49, 60, 61, 59, 46, 55, 69,
+    62, 59, 52, 59, 54, 60, 61, 70, 52, 54, 62, 50, 51, 58, 57, 57,
+    55, 57, 61, 54, 57, 60, 56, 63, 48, 55, 63, 58, 51, 51, 53, 57,
+    59, 52, 54, 50, 56, 69, 62, 56, 62, 57, 52, 68, 48, 56, 62, 56,
+    59, 57, 56, 62, 59, 65, 51, 61, 55, 55, 59, 60, 56, 51, 62, 57,
+    55, 50, 52, 61, 54, 61, 58, 59, 61, 52, 57, 59, 59, 51, 54, 55,
+    39, 54, 52, 57, 51, 56, 60, 65, 60, 58, 59, 56, 55, 62, 53, 61,
+    63, 57, 53, 52, 58, 63, 55, 54, 50, 61, 58, 51, 58, 50, 61, 56,
+    66, 51, 54, 51, 54, 57, 55, 52, 59, 47, 54, 50, 57, 44, 56, 49,
+    50, 59, 55, 56, 62, 48, 61, 49, 48, 60, 54, 56, 58, 63, 56, 57,
+    60, 51, 55, 55, 56, 61, 56, 61, 52, 61, 53, 69, 56, 53, 59, 46,
+    51, 55, 62, 62, 44, 63, 50, 53, 59, 60, 59, 55, 58, 56, 52, 57,
+    61, 63, 59, 58, 58, 49, 69, 47, 57, 54, 56, 52, 54, 53, 51, 65,
+    48, 56, 52, 52, 65, 57, 51, 60, 54, 61, 55, 62, 58, 53, 56, 49,
+    48, 57, 60, 59, 46, 60, 60, 38, 57, 58, 55, 56, 54, 53, 61, 58,
+    59, 54, 65, 51, 51, 55, 47, 55, 53, 50, 59, 60, 53, 49, 55, 54,
+    65, 56, 61, 53, 50, 58, 62, 55, 58, 58, 50, 47, 56, 62, 62, 47,
+    48, 62, 60, 63, 57, 62, 52, 52, 59, 48, 56, 63, 58, 59, 53, 61,
+    50, 51, 51, 60, 63, 53, 49, 61, 48, 61, 53, 57, 52, 64, 50, 64,
+    51, 42, 56, 52, 67, 57, 63, 63, 55, 61, 50, 56, 52, 56, 53, 55,
+    62, 47, 66, 46, 58, 57, 52, 58, 51, 54, 62, 48, 63, 59, 52, 58,
+    48, 57, 55, 52, 55, 50, 56, 59, 51, 60, 55, 54, 56, 55, 55, 54,
+    59, 52, 57, 55, 57, 55, 61, 51, 59, 65, 54, 57, 56, 53, 55, 67,
+    50, 50, 54, 53, 55, 58, 52, 66, 63, 51, 48, 55, 53, 54, 65, 53,
+    54, 50, 55, 53, 51, 54, 61, 56, 54, 54, 54, 52, 55, 57, 61, 52,
+    56, 50, 53, 55, 62, 67, 51, 63, 62, 51, 62, 53, 56, 60, 55, 64,
+    60, 68, 44, 59, 54, 49, 63, 55, 57, 66, 61, 62, 59, 53, 52, 62,
+    57, 52, 67, 52, 69, 51, 62, 64, 63, 55, 55, 52, 63, 51, 53, 57,
+    60, 45, 49, 58, 49, 57, 53, 57, 54, 54, 55, 50, 56, 59, 61, 54,
+    55, 56, 49, 53, 59, 53, 63, 59, 58, 51, 58, 53, 48, 60, 48, 59,
+    64, 48, 48, 67, 60, 60, 49, 70, 52, 55, 63, 61, 60, 57, 62, 53,
+    52, 62, 53, 56, 62, 57, 46, 57, 51, 56, 66, 60, 56, 61, 55, 53,
+    57, 60, 61, 64, 43, 49, 52, 53, 56, 51, 53, 65, 59, 58, 55, 54,
+    57, 54, 51, 58, 63, 55, 50, 52, 59, 56, 67, 56, 53, 47, 58, 58,
+    51, 51, 50, 56, 63, 52, 61, 63, 66, 55, 56, 54, 59, 57, 57, 48,
+    51, 59, 58, 51, 56, 56, 56, 60, 56, 41, 64, 51, 57, 57, 53, 69,
+    73, 58, 55, 60, 46, 63, 52, 53, 55, 47, 59, 51, 53, 58, 53, 53,
+    54, 61, 56, 54, 50, 50, 55, 58, 45, 55, 55, 54, 54, 62, 57, 52,
+    61, 52, 50, 54, 52, 54, 58, 56, 51, 56, 66, 64, 58, 56, 58, 55,
+    54, 52, 69, 54, 51, 54, 59, 54, 50, 52, 56, 55, 56, 56, 63, 57,
+    48, 59, 58, 59, 62, 56, 60, 51, 61, 42, 51, 62, 69, 64, 67, 66,
+    50, 51, 57, 58, 51, 65, 58, 57, 55, 56, 67, 66, 63, 53, 49, 60,
+    54, 52, 59, 50, 54, 54, 60, 59, 59, 61, 64, 52, 58, 60, 55, 65,
+    52, 46, 57, 47, 50, 61, 50, 51, 47, 51, 59, 61, 68, 54, 61, 52,
+    60, 45, 41, 60, 62, 53, 61, 58, 61, 44, 59, 58, 63, 50, 59, 60,
+    62, 58, 52, 58, 66, 60, 39, 57, 70, 63, 60, 58, 50, 57, 53, 55,
+    54, 61, 46, 63, 56, 53, 58, 62, 57, 56, 66, 63, 57, 58, 50, 51,
+    60, 58, 57, 57, 54, 58, 67, 48, 48, 47, 60, 56, 56, 52, 62, 56,
+    53, 51, 63, 54, 50, 63, 54, 55, 55, 53, 53, 49, 54, 68, 51, 58,
+    54, 57, 60, 57, 65, 52, 60, 54, 49, 50, 55, 57, 50, 54, 47, 55,
+    56, 63, 62, 52, 56, 74, 58, 62, 55, 52, 48, 56, 54, 60, 58, 48,
+    52, 64, 58, 58, 58, 60, 50, 52, 53, 55, 63, 53, 50, 53, 58, 60,
+    50, 54, 60, 62, 62, 50, 51, 60, 58, 52, 56, 62, 46, 52, 61, 61,
+    57, 54, 61, 57, 63, 50, 58, 66, 59, 65, 57, 65, 41, 56, 68, 51,
+    59, 63, 48, 56, 59, 42, 58, 59, 46, 55, 63, 52, 59, 51, 50, 55,
+    54, 59, 59, 65, 47, 56, 59, 57, 62, 62, 43, 56, 68, 54, 57, 51,
+    57, 53, 63, 67, 60, 49, 54, 51, 59, 60, 48, 57, 53, 54, 60, 54,
+    58, 66, 58, 60, 52, 49, 58, 53, 58, 61, 60, 55, 62, 49, 58, 46,
+    55, 57, 60, 60, 44, 59, 48, 48, 60, 48, 59, 47, 59, 49, 58, 52,
+    61, 50, 56, 59, 54, 56, 62, 65, 59, 47, 43, 54, 56, 62, 54, 60,
+    61, 57, 63, 46, 61, 60, 59, 55, 55, 46, 52, 49, 48, 52, 61, 51,
+    55, 56, 61, 59, 59, 58, 47, 45, 57, 52, 55, 61, 50, 52, 64, 64,
+    48, 56, 56, 52, 56, 54, 59, 53, 60, 57, 52, 62, 60, 47, 60, 60,
+    45, 56, 58, 63, 62, 51, 49, 58, 47, 56, 54, 60, 56, 55, 52, 50,
+    64, 58, 50, 59, 55, 74, 56, 59, 52, 50, 64, 64, 57, 62, 53, 49,
+    57, 59, 45, 55, 66, 49, 57, 46, 61, 66, 54, 51, 59, 56, 60, 59,
+    58, 58, 49, 54, 66, 58, 53, 62, 60, 43, 62, 51, 61, 54, 52, 57,
+    46, 44, 59, 48, 58, 57, 51, 60, 61, 60, 56, 60, 60, 57, 66, 61,
+    48, 54, 59, 58, 58, 61, 55, 55, 57, 56, 55, 57, 59, 67, 59, 52,
+    61, 65, 59, 47, 54, 58, 49, 50, 54, 55, 56, 60, 56, 55, 52, 56,
+    43, 55, 50, 62, 65, 57, 58, 54, 52, 54, 60, 57, 56, 53, 61, 53,
+    47, 60, 66, 53, 56, 53, 57, 56, 52, 52, 54, 58, 44, 52, 58, 45,
+    54, 62, 50, 57, 55, 56, 52, 53, 56, 54, 66, 57, 56, 61, 58, 68,
+    50, 52, 48, 50, 55, 54, 60, 51, 62, 57, 54, 55, 60, 40, 61, 49,
+    61, 60, 49, 60, 52, 50, 55, 59, 56, 53, 63, 58, 58, 59, 53, 65,
+    57, 64, 59, 49, 60, 51, 66, 56, 56, 54, 59, 54, 44, 59, 52, 61,
+    57, 53, 53, 56, 47, 53, 57, 53, 60, 50, 60, 54, 56, 59, 59, 54,
+    57, 64, 61, 51, 50, 62, 45, 50, 60, 55, 59, 59, 62, 51, 58, 64,
+    49, 64, 57, 56, 53, 43, 54, 59, 55, 63, 50, 53, 55, 60, 58, 49,
+    57, 54, 52, 55, 54, 54, 59, 50, 57, 62, 58, 52, 61, 58, 55, 61,
+    62, 59, 49, 54, 64, 59, 57, 61, 58, 59, 62, 56, 48, 46, 61, 59,
+    66, 60, 57, 71, 56, 49, 61, 54, 60, 57, 55, 51, 55, 48, 53, 60,
+    61, 48, 50, 59, 64, 58, 59, 67, 49, 50, 52, 60, 61, 54, 55, 57,
+    58, 54, 51, 58, 46, 53, 51, 54, 60, 58, 59, 55, 48, 50, 55, 53,
+    65, 51, 60, 60, 52, 58, 60, 58, 57, 59, 60, 52, 60, 60, 61, 63,
+    57, 51, 64, 57, 70, 60, 49, 53, 54, 55, 49, 52, 55, 63, 60, 50,
+    52, 63, 55, 45, 56, 61, 62, 59, 61, 58, 52, 69, 56, 54, 48, 49,
+    53, 66, 60, 66, 60, 54, 61, 57, 52, 60, 52, 64, 62, 57, 60, 56,
+    64, 47, 49, 57, 61, 54, 54, 58, 66, 49, 46, 52, 57, 70, 53, 64,
+    60, 63, 58, 57, 55, 43, 49, 54, 59, 65, 65, 52, 50, 53, 64, 53,
+    42, 50, 53, 56, 69, 64, 56, 54, 62, 58, 49, 51, 64, 52, 64, 42,
+    56, 47, 50, 71, 47, 53, 52, 54, 51, 68, 47, 56, 56, 53, 61, 46,
+    57, 66, 54, 49, 56, 56, 57, 54, 54, 63, 54, 63, 43, 53, 56, 53,
+    51, 55, 59, 66, 55, 59, 52, 50, 50, 50, 53, 69, 58, 67, 61, 50,
+    58, 61, 58, 54, 52, 46, 55, 64, 42, 56, 60, 57, 57, 53, 58, 47,
+    57, 51, 60, 57, 54, 57, 50, 65, 50, 57, 49, 57, 49, 51, 57, 62,
+    51, 67, 66, 56, 66, 58, 61, 55, 58, 57, 67, 51, 53, 55, 61, 52,
+    58, 46, 60, 55, 58, 53, 52, 56, 49, 56, 54, 63, 56, 58, 52, 58,
+    51, 66, 59, 59, 48, 52, 59, 62, 60, 52, 58, 54, 49, 63, 59, 56,
+    57, 58, 54, 53, 48, 59, 58, 61, 46, 47, 59, 56, 52, 59, 56, 58,
+    60, 55, 57, 53, 57, 57, 53, 58, 56, 60, 52, 43, 57, 60, 51, 61,
+    49, 44, 52, 51, 56, 62, 54, 58, 66, 64, 47, 65, 63, 53, 57, 57,
+    60, 63, 45, 55, 55, 52, 43, 54, 54, 58, 49, 56, 55, 59, 57, 52,
+    61, 50, 40, 48, 50, 67, 60, 53, 53, 53, 48, 58, 61, 43, 60, 54,
+    57, 59, 51, 53, 65, 60, 46, 59, 56, 54, 48, 63, 61, 59, 62, 49,
+    64, 55, 57, 56, 47, 60, 52, 60, 65, 50, 48, 52, 47, 56, 53, 50,
+    55, 52, 65, 44, 43, 61, 58, 68, 57, 65, 59, 53, 61, 73, 56, 58,
+    56, 57, 65, 48, 66, 61, 65, 56, 61, 56, 55, 58, 60, 64, 59, 52,
+    59, 47, 57, 57, 54, 53, 57, 59, 57, 56, 50, 59, 48, 57, 55, 55,
+    44, 60, 69, 57, 68, 54, 58, 57, 56, 51, 59, 55, 58, 53, 57, 49,
+    58, 54, 64, 64, 53, 63, 49, 61, 46, 53, 53, 58, 59, 59, 55, 62,
+    49, 61, 55, 53, 50, 66, 56, 57, 60, 49, 61, 63, 55, 61, 63, 56,
+    53, 48, 60, 52, 51, 63, 57, 57, 56, 63, 57, 60, 57, 56, 55, 56,
+    49, 56, 48, 58, 60, 53, 55, 65, 59, 55, 54, 52, 62, 61, 56, 55,
+    59, 60, 53, 54, 60, 68, 58, 51, 62, 55, 64, 55, 54, 58, 60, 64,
+    46, 64, 65, 57, 55, 43, 63, 57, 55, 64, 62, 59, 54, 47, 51, 59,
+    55, 62, 67, 59, 51, 60, 54, 50, 53, 52, 63, 58, 66, 64, 55, 48,
+    56, 47, 58, 61, 53, 60, 51, 63, 58, 51, 44, 66, 48, 48, 56, 52,
+    44, 57, 53, 60, 54, 59, 52, 57, 63, 57, 58, 53, 53, 67, 54, 59,
+    56, 58, 56, 48, 64, 58, 51, 55, 58, 43, 52, 52, 60, 58, 60, 57,
+    60, 55, 65, 56, 48, 65, 52, 57, 50, 52, 58, 50, 63, 51, 52, 57,
+    54, 59, 45, 56, 54, 69, 51, 59, 66, 52, 51, 54, 52, 58, 47, 58,
+    49, 65, 55, 67, 54, 61, 51, 54, 53, 50, 56, 54, 60, 62, 56, 56,
+    48, 58, 60, 57, 63, 62, 51, 55, 61, 50, 57, 55, 51, 60, 60, 50,
+    54, 57, 59, 54, 50, 68, 54, 59, 64, 63, 51, 60, 58, 62, 58, 54,
+    61, 54, 53, 52, 62, 60, 47, 50, 59, 53, 67, 57, 56, 57, 52, 65,
+    49, 57, 54, 47, 53, 56, 48, 59, 66, 59, 45, 58, 45, 56, 54, 51,
+    60, 54, 56, 49, 64, 59, 63, 46, 68, 57, 54, 47, 62, 48, 49, 60,
+    54, 53, 64, 53, 53, 49, 65, 54, 64, 48, 48, 49, 53, 64, 54, 57,
+    59, 50, 47, 54, 58, 54, 55, 65, 53, 59, 66, 57, 56, 57, 58, 67,
+    63, 54, 51, 60, 52, 54, 55, 60, 51, 60, 56, 60, 65, 59, 52, 57,
+    63, 59, 54, 51, 52, 55, 42, 58, 49, 61, 53, 53, 60, 57, 50, 56,
+    60, 52, 54, 52, 61, 64, 61, 65, 49, 54, 57, 57, 49, 57, 57, 54,
+    65, 50, 53, 52, 55, 51, 59, 62, 62, 44, 55, 51, 56, 48, 61, 64,
+    58, 66, 52, 57, 48, 57, 63, 56, 64, 63, 56, 60, 52, 52, 59, 52,
+    49, 54, 51, 62, 60, 66, 50, 51, 54, 53, 54, 68, 56, 48, 53, 53,
+    59, 57, 54, 59, 61, 54, 53, 61, 64, 59, 51, 57, 49, 63, 60, 50,
+    52, 55, 57, 58, 52, 61, 67, 60, 51, 54, 53, 70, 60, 46, 56, 56,
+    50, 55, 67, 55, 49, 62, 56, 59, 55, 59, 54, 50, 61, 53, 56, 56,
+    58, 55, 62, 51, 62, 51, 50, 51, 53, 57, 49, 63, 55, 64, 62, 46,
+    56, 56, 59, 47, 51, 67, 53, 54, 60, 62, 55, 54, 57, 55, 58, 61,
+    49, 64, 50, 54, 54, 62, 53, 56, 61, 52, 54, 50, 58, 57, 53, 53,
+    57, 45, 49, 53, 53, 67, 55, 71, 48, 56, 54, 58, 58, 52, 52, 60,
+    52, 50, 51, 62, 48, 55, 50, 45, 58, 57, 60, 56, 60, 53, 56, 55,
+    68, 48, 61, 55, 64, 58, 66, 44, 50, 54, 60, 47, 46, 53, 52, 63,
+    59, 57, 53, 54, 53, 53, 52, 52, 60, 57, 49, 59, 56, 65, 59, 52,
+    56, 68, 59, 66, 56, 57, 50, 55, 65, 58, 65, 47, 59, 47, 52, 50,
+    62, 48, 61, 47, 61, 55, 52, 56, 55, 54, 65, 49, 60, 53, 50, 59,
+    65, 51, 53, 55, 51, 61, 62, 62, 55, 57, 59, 69, 54, 55, 51, 57,
+    55, 52, 54, 63, 55, 54, 61, 50, 61, 64, 59, 51, 59, 56, 47, 64,
+    65, 57, 51, 53, 66, 47, 61, 45, 60, 60, 54, 52, 63, 64, 61, 46,
+    62, 55, 46, 56, 58, 56, 46, 58, 53, 62, 51, 57, 61, 57, 50, 54,
+    60, 55, 56, 59, 61, 61, 61, 49, 60, 53, 62, 59, 60, 55, 61, 52,
+    57, 55, 68, 55, 58, 52, 54, 53, 56, 61, 59, 55, 52, 49, 63, 58,
+    58, 47, 61, 52, 60, 55, 74, 56, 55, 54, 56, 56, 55, 59, 55, 52,
+    61, 62, 53, 54, 57, 52, 56, 62, 50, 60, 49, 58, 48, 58, 63, 58,
+    65, 60, 58, 56, 53, 59, 51, 63, 50, 51, 64, 58, 60, 57, 53, 57,
+    57, 64, 56, 55, 51, 62, 48, 62, 52, 56, 67, 59, 55, 58, 53, 67,
+    57, 54, 67, 47, 49, 63, 63, 49, 57, 66, 58, 53, 56, 58, 60, 65,
+    60, 57, 49, 57, 70, 53, 54, 57, 54, 44, 43, 47, 54, 49, 60, 49,
+    49, 57, 61, 59, 52, 54, 56, 44, 56, 55, 58, 62, 63, 65, 49, 57,
+    54, 51, 57, 61, 52, 57, 56, 55, 61, 74, 39, 56, 60, 62, 62, 53,
+    56, 68, 50, 53, 55, 55, 49, 47, 62, 54, 51, 57, 59, 61, 55, 60,
+    65, 62, 54, 55, 48, 62, 57, 54, 55, 50, 60, 55, 57, 57, 58, 55,
+    60, 53, 63, 55, 44, 57, 55, 49, 54, 58, 65, 49, 52, 57, 49, 54,
+    50, 53, 63, 70, 54, 57, 57, 60, 46, 53, 56, 55, 58, 53, 49, 54,
+    57, 58, 57, 61, 53, 52, 65, 58, 52, 56, 51, 67, 56, 51, 51, 54,
+    62, 51, 51, 59, 48, 60, 54, 48, 57, 52, 69, 54, 61, 64, 59, 53,
+    43, 51, 59, 51, 60, 60, 55, 64, 59, 55, 47, 48, 57, 56, 53, 51,
+    60, 53, 57, 57, 47, 51, 61, 58, 61, 59, 52, 56, 54, 63, 62, 45,
+    50, 54, 49, 52, 63, 55, 61, 43, 56, 59, 53, 63, 56, 61, 55, 51,
+    64, 48, 65, 61, 61, 49, 60, 62, 56, 62, 50, 54, 57, 53, 54, 61,
+    55, 58, 63, 53, 65, 51, 68, 60, 53, 57, 57, 56, 62, 56, 55, 53,
+    60, 49, 52, 59, 58, 50, 51, 55, 54, 58, 66, 52, 55, 59, 50, 49,
+    60, 58, 63, 61, 52, 55, 49, 65, 57, 62, 62, 67, 50, 49, 47, 47,
+    54, 47, 58, 64, 55, 57, 49, 55, 57, 53, 53, 61, 46, 67, 49, 56,
+    56, 62, 57, 52, 56, 54, 61, 55, 49, 62, 65, 48, 60, 59, 48, 67,
+    55, 59, 57, 64, 61, 52, 45, 56, 59, 70, 62, 64, 57, 54, 52, 60,
+    58, 55, 57, 59, 48, 60, 62, 50, 63, 57, 56, 50, 53, 60, 53, 52,
+    55, 62, 54, 64, 66, 48, 56, 62, 59, 59, 53, 56, 57, 62, 53, 54,
+    56, 60, 57, 61, 54, 56, 58, 49, 57, 71, 52, 48, 55, 54, 61, 55,
+    68, 52, 55, 64, 49, 53, 59, 69, 61, 58, 50, 54, 58, 66, 48, 57,
+    52, 50, 53, 52, 53, 55, 55, 58, 63, 53, 60, 56, 60, 59, 59, 57,
+    61, 50, 54, 64, 52, 50, 57, 63, 57, 58, 64, 59, 69, 51, 57, 63,
+    67, 54, 44, 57, 49, 63, 63, 56, 58, 60, 58, 63, 55, 53, 49, 57,
+    52, 58, 58, 65, 59, 53, 48, 70, 46, 50, 48, 58, 60, 48, 55, 49,
+    56, 59, 52, 59, 56, 53, 56, 58, 57, 55, 48, 63, 56, 59, 55, 58,
+    61, 61, 50, 57, 60, 55, 53, 63, 53, 56, 52, 51, 56, 57, 62, 59,
+    58, 45, 57, 61, 52, 43, 53, 42, 52, 48, 65, 56, 60, 47, 64, 42,
+    56, 54, 59, 52, 60, 65, 55, 61, 64, 56, 62, 58, 57, 62, 53, 56,
+    57, 56, 49, 47, 60, 53, 62, 59, 58, 55, 50, 54, 66, 52, 64, 54,
+    54, 65, 57, 52, 47, 48, 53, 65, 54, 60, 53, 58, 65, 49, 55, 52,
+    53, 55, 75, 48, 53, 63, 48, 57, 49, 60, 53, 54, 57, 59, 46, 52,
+    59, 58, 59, 51, 40, 69, 56, 49, 57, 52, 54, 61, 59, 56, 62, 54,
+    55, 48, 59, 60, 54, 57, 63, 60, 54, 50, 61, 61, 60, 53, 61, 52,
+    60, 44, 58, 57, 56, 53, 56, 59, 63, 53, 52, 51, 58, 53, 62, 53,
+    55, 46, 61, 58, 59, 51, 54, 59, 55, 58, 56, 41, 54, 56, 58, 62,
+    55, 65, 47, 57, 53, 56, 47, 47, 62, 54, 58, 60, 55, 62, 46, 62,
+    55, 58, 60, 51, 58, 56, 53, 49, 49, 56, 59, 57, 61, 61, 42, 58,
+    59, 46, 49, 57, 60, 56, 59, 47, 59, 62, 45, 52, 57, 52, 53, 52,
+    59, 56, 63, 58, 56, 49, 52, 57, 63, 51, 51, 57, 56, 57, 55, 55,
+    51, 50, 50, 52, 67, 53, 54, 56, 54, 62, 45, 53, 56, 49, 52, 50,
+    53, 68, 71, 63, 55, 62, 56, 59, 49, 42, 60, 57, 53, 57, 54, 60,
+    49, 66, 56, 55, 71, 57, 65, 48, 63, 50, 57, 49, 64, 54, 51, 50,
+    63, 51, 63, 59, 60, 44, 54, 50, 55, 57, 58, 57, 58, 50, 62, 48,
+    55, 54, 54, 65, 56, 53, 50, 46, 68, 69, 55, 60, 56, 57, 46, 54,
+    59, 56, 49, 50, 60, 67, 62, 61, 47, 57, 51, 58, 56, 46, 56, 54,
+    57, 59, 58, 57, 58, 61, 54, 58, 51, 62, 45, 55, 63, 61, 57, 62,
+    56, 55, 63, 59, 60, 46, 59, 57, 57, 55, 48, 55, 56, 53, 50, 56,
+    57, 49, 71, 56, 57, 55, 59, 53, 52, 53, 58, 64, 48, 52, 55, 56,
+    60, 48, 61, 52, 65, 65, 63, 61, 58, 59, 61, 49, 70, 56, 58, 47,
+    61, 50, 66, 59, 53, 51, 60, 58, 42, 51, 61, 54, 52, 57, 54, 50,
+    58, 54, 58, 48, 53, 50, 60, 59, 58, 48, 58, 62, 55, 49, 69, 57,
+    58, 47, 60, 59, 60, 56, 63, 51, 56, 64, 55, 54, 57, 60, 59, 51,
+    56, 59, 62, 56, 56, 63, 52, 50, 57, 58, 54, 55, 62, 56, 58, 61,
+    49, 63, 57, 54, 47, 68, 54, 57, 66, 52, 59, 66, 55, 56, 53, 58,
+    58, 59, 61, 69, 61, 51, 64, 63, 49, 53, 50, 64, 57, 68, 54, 60,
+    57, 63, 55, 45, 51, 56, 61, 63, 57, 55, 60, 64, 64, 49, 50, 62,
+    51, 59, 46, 56, 61, 52, 54, 54, 56, 66, 53, 57, 51, 53, 63, 65,
+    57, 78, 53, 54, 51, 51, 52, 55, 59, 47, 47, 60, 55, 56, 44, 54,
+    59, 57, 51, 59, 60, 65, 53, 59, 53, 51, 58, 60, 58, 57, 63, 53,
+    60, 64, 60, 51, 53, 61, 51, 64, 54, 56, 60, 59, 55, 46, 60, 59,
+    47, 58, 61, 62, 62, 51, 58, 57, 46, 58, 59, 52, 62, 55, 53, 57,
+    57, 54, 56, 59, 59, 62, 62, 52, 55, 47, 51, 57, 73, 57, 45, 54,
+    64, 62, 52, 55, 53, 71, 54, 52, 51, 54, 59, 56, 55, 64, 48, 51,
+    56, 64, 54, 54, 55, 57, 53, 55, 66, 51, 48, 59, 48, 61, 48, 54,
+    56, 51, 53, 56, 55, 55, 51, 54, 63, 59, 54, 44, 54, 64, 62, 58,
+    48, 41, 53, 57, 59, 48, 52, 57, 59, 53, 59, 52, 62, 52, 56, 50,
+    55, 53, 55, 57, 46, 60, 58, 63, 65, 60, 50, 55, 65, 57, 55, 58,
+    61, 56, 68, 52, 55, 54, 64, 47, 55, 60, 56, 56, 48, 67, 50, 56,
+    61, 51, 59, 51, 55, 61, 55, 66, 58, 53, 51, 56, 52, 55, 57, 51,
+    49, 63, 62, 45, 57, 59, 59, 61, 62, 58, 47, 75, 60, 62, 51, 63,
+    56, 55, 57, 55, 57, 56, 46, 60, 47, 58, 59, 51, 39, 59, 50, 57,
+    51, 57, 71, 56, 53, 55, 53, 60, 52, 42, 51, 58, 52, 61, 45, 66,
+    41, 59, 54, 55, 51, 58, 45, 59, 55, 62, 63, 55, 56, 49, 57, 68,
+    60, 57, 61, 61, 49, 57, 50, 61, 67, 52, 51, 66, 55, 60, 52, 60,
+    54, 56, 55, 53, 53, 55, 56, 53, 57, 52, 65, 49, 54, 52, 53, 62,
+    57, 53, 56, 69, 51, 52, 54, 54, 60, 51, 53, 53, 62, 55, 59, 50,
+    57, 52, 55, 57, 52, 58, 53, 55, 54, 54, 59, 56, 57, 49, 62, 57,
+    57, 52, 59, 52, 46, 65, 58, 57, 51, 61, 56, 69, 56, 69, 47, 57,
+    52, 56, 54, 59, 59, 56, 66, 58, 57, 64, 51, 56, 61, 53, 52, 57,
+    63, 53, 66, 52, 58, 48, 54, 55, 42, 64, 54, 53, 58, 51, 55, 44,
+    55, 46, 68, 60, 56, 66, 64, 54, 59, 59, 67, 55, 56, 50, 62, 61,
+    54, 48, 58, 59, 66, 46, 53, 53, 61, 56, 45, 55, 68, 66, 53, 49,
+    63, 49, 44, 58, 55, 54, 62, 58, 54, 61, 52, 56, 61, 60, 46, 55,
+    54, 55, 57, 63, 44, 57, 58, 52, 56, 59, 42, 65, 56, 59, 57, 65,
+    51, 61, 51, 56, 49, 59, 63, 56, 57, 50, 57, 48, 69, 49, 55, 48,
+    60, 47, 54, 61, 55, 59, 60, 60, 59, 53, 50, 59, 58, 42, 58, 54,
+    50, 71, 58, 57, 54, 55, 54, 61, 53, 54, 53, 53, 55, 53, 52, 68,
+    58, 48, 56, 68, 55, 45, 51, 51, 66, 62, 61, 57, 60, 51, 57, 60,
+    48, 58, 53, 54, 48, 58, 56, 57, 55, 60, 46, 55, 64, 59, 56, 51,
+    63, 65, 68, 65, 62, 57, 52, 57, 47, 46, 66, 46, 62, 55, 56, 53,
+    60, 55, 53, 53, 58, 59, 56, 52, 56, 55, 55, 51, 54, 61, 54, 61,
+    54, 49, 59, 63, 53, 66, 61, 59, 53, 57, 58, 62, 64, 64, 55, 52,
+    62, 60, 65, 51, 53, 61, 62, 62, 50, 46, 53, 51, 60, 63, 52, 48,
+    62, 58, 58, 44, 71, 51, 65, 59, 49, 58, 53, 62, 56, 61, 55, 60,
+    51, 61, 45, 60, 49, 54, 65, 57, 50, 65, 59, 57, 63, 57, 53, 56,
+    61, 52, 60, 69, 64, 59, 49, 58, 52, 56, 52, 59, 63, 52, 54, 54,
+    45, 49, 57, 49, 58, 53, 61, 62, 56, 54, 60, 58, 60, 55, 52, 53,
+    54, 53, 60, 54, 58, 46, 56, 45, 67, 59, 61, 62, 60, 57, 58, 51,
+    57, 65, 59, 49, 50, 49, 58, 55, 63, 51, 57, 62, 50, 57, 67, 57,
+    44, 52, 58, 56, 49, 50, 56, 51, 64, 49, 63, 48, 60, 55, 50, 60,
+    55, 51, 51, 68, 55, 50, 56, 49, 64, 55, 60, 63, 53, 59, 44, 74,
+    56, 49, 56, 54, 58, 42, 49, 54, 50, 56, 48, 58, 64, 58, 66, 58,
+    54, 53, 54, 53, 54, 43, 56, 53, 54, 55, 64, 56, 47, 59, 60, 54,
+    54, 51, 54, 55, 48, 55, 64, 54, 60, 55, 52, 55, 62, 54, 61, 55,
+    62, 57, 58, 40, 68, 54, 65, 56, 48, 63, 56, 60, 51, 53, 54, 51,
+    47, 65, 56, 67, 63, 51, 62, 56, 53, 60, 72, 58, 42, 51, 57, 52,
+    51, 56, 53, 56, 59, 50, 70, 52, 56, 56, 50, 62, 60, 58, 57, 61,
+    56, 54, 58, 61, 55, 48, 65, 53, 49, 52, 57, 58, 57, 56, 51, 58,
+    57, 58, 58, 54, 57, 54, 58, 46, 60, 67, 43, 66, 65, 51, 54, 53,
+    52, 56, 61, 51, 65, 51, 52, 67, 62, 51, 54, 46, 53, 64, 63, 66,
+    58, 48, 53, 41, 63, 56, 56, 60, 55, 51, 58, 51, 59, 59, 49, 54,
+    57, 46, 57, 58, 58, 55, 55, 47, 60, 46, 62, 56, 49, 60, 58, 55,
+    48, 63, 50, 53, 45, 56, 66, 58, 63, 58, 57, 55, 63, 49, 52, 57,
+    49, 61, 56, 56, 54, 55, 54, 52, 56, 50, 52, 56, 62, 64, 57, 58,
+    59, 46, 51, 67, 55, 50, 56, 53, 63, 58, 51, 63, 61, 66, 58, 51,
+    55, 51, 60, 53, 51, 59, 64, 59, 54, 62, 52, 54, 52, 50, 47, 52,
+    61, 63, 61, 50, 49, 48, 59, 54, 52, 44, 63, 58, 47, 64, 52, 59,
+    53, 59, 53, 58, 55, 54, 53, 54, 58, 54, 55, 63, 66, 57, 57, 54,
+    43, 60, 47, 61, 60, 61, 50, 57, 54, 63, 48, 51, 53, 62, 51, 56,
+    54, 52, 54, 59, 57, 60, 61, 55, 57, 58, 52, 56, 59, 60, 43, 51,
+    44, 56, 67, 52, 63, 62, 53, 47, 63, 60, 53, 53, 59, 51, 49, 57,
+    49, 60, 54, 54, 62, 57, 52, 53, 63, 52, 57, 52, 60, 56, 56, 58,
+    48, 53, 57, 61, 54, 59, 56, 53, 67, 68, 58, 61, 53, 45, 57, 51,
+    43, 65, 54, 67, 52, 60, 62, 56, 63, 42, 54, 59, 49, 59, 51, 57,
+    43, 56, 54, 62, 59, 52, 63, 58, 55, 57, 46, 55, 57, 53, 64, 51,
+    61, 57, 59, 61, 50, 54, 58, 44, 55, 58, 53, 56, 54, 42, 57, 57,
+    71, 63, 46, 51, 57, 48, 57, 57, 52, 54, 53, 50, 53, 54, 57, 58,
+    56, 62, 53, 60, 58, 57, 61, 58, 53, 64, 61, 53, 53, 56, 57, 58,
+    56, 56, 47, 52, 60, 57, 59, 50, 66, 69, 61, 45, 57, 63, 61, 54,
+    56, 59, 48, 58, 47, 55, 61, 60, 51, 55, 62, 49, 55, 57, 51, 61,
+    55, 52, 53, 50, 60, 53, 57, 56, 55, 58, 61, 53, 54, 54, 54, 58,
+    56, 60, 59, 49, 53, 60, 59, 62, 50, 53, 52, 66, 49, 54, 55, 51,
+    65, 53, 57, 53, 58, 62, 59, 59, 53, 56, 53, 57, 51, 59, 52, 50,
+    53, 57, 59, 50, 67, 60, 57, 55, 66, 57, 61, 57, 48, 47, 56, 55,
+    54, 65, 52, 54, 54, 67, 46, 54, 62, 40, 50, 53, 59, 57, 61, 40,
+    60, 62, 55, 48, 46, 60, 55, 46, 53, 59, 65, 54, 55, 47, 55, 61,
+    49, 51, 59, 63, 46, 59, 64, 61, 68, 53, 47, 59, 53, 54, 66, 46,
+    58, 39, 57, 66, 48, 59, 61, 44, 63, 55, 58, 53, 62, 58, 62, 56,
+    66, 46, 58, 64, 55, 49, 54, 55, 53, 54, 58, 61, 59, 53, 57, 59,
+    65, 53, 54, 63, 57, 50, 62, 56, 60, 63, 48, 48, 56, 60, 57, 63,
+    60, 57, 56, 52, 50, 66, 64, 53, 53, 54, 60, 64, 53, 51, 61, 48,
+    65, 46, 55, 55, 64, 55, 52, 59, 59, 54, 54, 54, 54, 50, 61, 54,
+    58, 64, 50, 56, 63, 61, 53, 63, 57, 45, 49, 49, 57, 52, 58, 48,
+    58, 54, 55, 57, 51, 55, 54, 50, 58, 64, 51, 57, 56, 59, 61, 56,
+    62, 46, 47, 63, 55, 62, 59, 53, 67, 68, 56, 52, 55, 48, 52, 56,
+    51, 58, 51, 57, 63, 57, 60, 63, 54, 64, 53, 60, 68, 50, 53, 50,
+    54, 58, 49, 48, 52, 54, 52, 51, 60, 62, 49, 58, 51, 49, 50, 59,
+    62, 62, 54, 53, 52, 46, 63, 68, 55, 55, 50, 61, 61, 53, 51, 46,
+    58, 54, 50, 60, 57, 59, 50, 72, 56, 60, 60, 66, 56, 48, 54, 54,
+    54, 58, 56, 53, 52, 59, 58, 54, 65, 52, 53, 50, 58, 53, 53, 53,
+    51, 70, 48, 51, 54, 47, 58, 64, 64, 54, 48, 57, 57, 51, 59, 54,
+    53, 62, 63, 57, 51, 53, 65, 56, 60, 56, 59, 59, 50, 55, 64, 57,
+    58, 55, 57, 59, 60, 52, 50, 56, 66, 62, 57, 45, 51, 56, 65, 51,
+    54, 56, 64, 54, 61, 65, 53, 68, 51, 57, 40, 55, 54, 59, 48, 54,
+    59, 57, 58, 51, 57, 53, 59, 56, 56, 52, 49, 50, 53, 54, 53, 50,
+    42, 55, 59, 60, 58, 51, 57, 52, 64, 62, 53, 58, 48, 64, 58, 45,
+    59, 65, 62, 59, 45, 64, 52, 55, 58, 58, 45, 51, 68, 61, 62, 54,
+    50, 60, 48, 57, 59, 53, 67, 49, 46, 46, 64, 59, 57, 55, 63, 52,
+    63, 52, 60, 54, 60, 68, 66, 56, 54, 57, 63, 68, 62, 48, 45, 62,
+    51, 60, 43, 56, 51, 58, 55, 55, 56, 60, 55, 58, 62, 47, 57, 57,
+    51, 50, 53, 60, 53, 62, 54, 66, 60, 60, 53, 61, 54, 61, 54, 52,
+    56, 49, 60, 42, 52, 64, 57, 53, 49, 54, 55, 62, 57, 58, 54, 55,
+    62, 59, 51, 57, 51, 54, 54, 59, 48, 51, 53, 63, 59, 59, 51, 49,
+    61, 50, 58, 56, 55, 55, 62, 54, 44, 61, 57, 53, 50, 56, 50, 59,
+    59, 55, 54, 52, 54, 68, 64, 55, 61, 48, 57, 49, 59, 57, 49, 55,
+    58, 57, 57, 54, 50, 69, 53, 47, 55, 56, 50, 58, 53, 53, 54, 50,
+    56, 67, 58, 56, 60, 54, 53, 60, 55, 49, 64, 51, 53, 64, 61, 60,
+    51, 47, 54, 67, 65, 52, 62, 52, 56, 60, 53, 49, 60, 60, 69, 58,
+    61, 54, 51, 70, 55, 65, 64, 51, 48, 53, 61, 54, 47, 59, 58, 50,
+    56, 48, 56, 52, 56, 52, 55, 51, 64, 53, 49, 57, 50, 48, 57, 61,
+    58, 64, 56, 61, 53, 61, 58, 57, 58, 57, 55, 55, 71, 44, 63, 63,
+    57, 54, 49, 55, 59, 61, 61, 53, 66, 57, 49, 57, 58, 45, 54, 54,
+    50, 58, 64, 53, 46, 64, 60, 48, 51, 59, 59, 61, 55, 53, 66, 56,
+    68, 52, 50, 53, 63, 59, 55, 53, 51, 58, 58, 55, 55, 58, 49, 53,
+    53, 62, 51, 60, 58, 57, 56, 63, 55, 55, 52, 70, 61, 48, 59, 61,
+    57, 48, 60, 50, 57, 60, 54, 52, 65, 55, 52, 59, 61, 55, 59, 74,
+    61, 60, 58, 50, 52, 48, 49, 56, 58, 45, 51, 61, 65, 55, 53, 51,
+    53, 52, 55, 56, 49, 57, 63, 54, 47, 49, 61, 52, 61, 41, 52, 57,
+    57, 51, 59, 53, 48, 58, 59, 62, 50, 54, 64, 63, 52, 60, 58, 66,
+    52, 61, 56, 57, 51, 55, 53, 52, 54, 50, 58, 57, 57, 57, 49, 51,
+    55, 51, 54, 54, 58, 50, 66, 62, 57, 53, 50, 68, 60, 64, 54, 45,
+    62, 57, 52, 54, 62, 59, 62, 55, 55, 54, 61, 49, 58, 55, 58, 48,
+    49, 61, 60, 52, 67, 55, 61, 54, 56, 55, 57, 53, 63, 57, 57, 64,
+    57, 58, 58, 53, 58, 60, 43, 66, 52, 50, 51, 50, 60, 55, 56, 50,
+    51, 58, 61, 60, 56, 51, 51, 63, 66, 53, 61, 68, 59, 59, 49, 54,
+    53, 52, 48, 45, 71, 59, 45, 57, 60, 59, 66, 61, 56, 55, 63, 54,
+    45, 59, 56, 60, 59, 56, 62, 61, 66, 52, 58, 55, 58, 51, 61, 56,
+    61, 63, 66, 60, 59, 51, 50, 52, 59, 61, 54, 66, 60, 50, 59, 50,
+    65, 56, 60, 46, 57, 49, 55, 55, 56, 39, 56, 62, 48, 51, 62, 55,
+    56, 58, 58, 50, 58, 53, 65, 58, 55, 50, 56, 46, 61, 67, 43, 63,
+    70, 53, 52, 63, 51, 60, 55, 60, 60, 55, 50, 54, 57, 52, 55, 53,
+    60, 51, 55, 49, 59, 60, 58, 56, 52, 54, 59, 56, 63, 58, 58, 65,
+    47, 51, 58, 60, 62, 51, 47, 58, 57, 58, 58, 47, 47, 54, 59, 58,
+    55, 50, 50, 55, 48, 72, 61, 59, 65, 57, 61, 54, 56, 55, 54, 54,
+    60, 50, 54, 61, 56, 60, 58, 45, 65, 56, 55, 61, 58, 52, 54, 50,
+    58, 53, 45, 56, 52, 47, 54, 57, 43, 54, 58, 60, 52, 54, 52, 59,
+    50, 52, 54, 61, 52, 45, 59, 56, 59, 46, 52, 63, 58, 53, 61, 57,
+    62, 62, 51, 60, 47, 64, 60, 54, 53, 50, 43, 56, 54, 57, 56, 63,
+    58, 54, 40, 69, 59, 57, 52, 49, 59, 54, 57, 54, 52, 54, 58, 51,
+    59, 53, 59, 59, 56, 57, 48, 65, 54, 56, 55, 58, 52, 65, 56, 50,
+    57, 58, 58, 53, 69, 60, 53, 60, 53, 54, 54, 60, 64, 63, 62, 57,
+    51, 59, 64, 53, 62, 54, 58, 53, 47, 54, 53, 49, 50, 64, 56, 57,
+    56, 46, 56, 45, 54, 55, 53, 63, 51, 56, 44, 58, 63, 47, 51, 63,
+    58, 47, 60, 56, 56, 55, 63, 56, 50, 56, 63, 56, 58, 66, 55, 53,
+    54, 52, 52, 63, 55, 54, 53, 67, 49, 50, 65, 64, 51, 63, 53, 59,
+    59, 54, 50, 51, 54, 53, 48, 59, 51, 47, 54, 56, 50, 57, 64, 52,
+    73, 49, 67, 54, 54, 60, 47, 61, 64, 48, 57, 48, 47, 48, 66, 50,
+    50, 55, 53, 49, 51, 59, 56, 63, 65, 49, 51, 54, 53, 67, 56, 47,
+    55, 62, 58, 59, 49, 48, 55, 52, 56, 60, 59, 63, 54, 61, 60, 51,
+    58, 58, 48, 58, 60, 68, 62, 54, 52, 49, 60, 60, 68, 43, 59, 59,
+    57, 53, 51, 62, 49, 66, 57, 62, 55, 46, 48, 49, 56, 49, 58, 55,
+    56, 60, 53, 55, 49, 50, 48, 63, 55, 52, 50, 66, 56, 63, 54, 57,
+    56, 59, 56, 54, 58, 53, 56, 49, 60, 53, 57, 55, 57, 52, 40, 55,
+    58, 52, 58, 51, 65, 52, 63, 59, 46, 48, 61, 54, 51, 65, 58, 53,
+    51, 60, 55, 47, 55, 53, 50, 66, 53, 53, 54, 56, 45, 59, 55, 53,
+    54, 52, 59, 55, 51, 59, 57, 55, 70, 54, 59, 63, 54, 60, 48, 58,
+    54, 57, 51, 61, 66, 61, 58, 56, 55, 59, 51, 57, 57, 51, 55, 59,
+    60, 61, 56, 58, 55, 55, 59, 51, 50, 58, 49, 54, 54, 59, 49, 46,
+    57, 58, 60, 63, 61, 53, 58, 59, 49, 51, 63, 54, 46, 60, 55, 51,
+    63, 54, 63, 56, 57, 63, 60, 55, 63, 57, 57, 63, 53, 56, 57, 53,
+    54, 54, 48, 63, 47, 53, 52, 57, 57, 49, 53, 63, 56, 55, 51, 54,
+    62, 57, 59, 43, 54, 59, 67, 49, 51, 58, 55, 56, 49, 57, 59, 45,
+    53, 59, 61, 55, 43, 58, 57, 58, 51, 54, 51, 59, 56, 58, 50, 51,
+    60, 58, 53, 50, 58, 45, 57, 44, 51, 53, 57, 55, 59, 59, 50, 66,
+    56, 53, 60, 57, 56, 56, 64, 62, 53, 66, 64, 59, 63, 55, 61, 53,
+    49, 45, 67, 44, 62, 60, 54, 52, 61, 56, 61, 54, 60, 53, 60, 47,
+    44, 57, 64, 57, 55, 51, 58, 53, 55, 63, 54, 62, 62, 56, 47, 60,
+    54, 51, 60, 53, 50, 57, 44, 52, 52, 62, 55, 59, 56, 60, 47, 63,
+    57, 50, 51, 64, 48, 64, 48, 58, 62, 62, 57, 56, 63, 53, 59, 48,
+    53, 58, 53, 57, 61, 61, 60, 52, 54, 53, 59, 53, 60, 57, 49, 50,
+    56, 62, 52, 55, 65, 60, 56, 53, 65, 57, 51, 52, 61, 60, 58, 51,
+    54, 51, 64, 54, 52, 59, 58, 57, 60, 52, 62, 52, 52, 71, 56, 59,
+    56, 56, 50, 54, 50, 60, 51, 55, 52, 60, 60, 60, 57, 59, 57, 51,
+    61, 53, 56, 45, 57, 55, 61, 54, 51, 61, 54, 55, 47, 49, 63, 52,
+    57, 60, 45, 56, 55, 47, 54, 66, 58, 53, 56, 61, 55, 51, 47, 55,
+    53, 66, 56, 54, 58, 60, 55, 62, 45, 60, 45, 61, 65, 54, 58, 57,
+    62, 56, 48, 65, 51, 54, 63, 55, 58, 58, 61, 64, 62, 52, 56, 58,
+    61, 50, 63, 50, 62, 57, 58, 60, 57, 50, 55, 60, 59, 57, 50, 53,
+    55, 62, 57, 53, 60, 46, 47, 46, 53, 54, 63, 56, 54, 51, 56, 61,
+    60, 55, 53, 55, 51, 55, 48, 55, 55, 68, 55, 50, 65, 60, 52, 50,
+    50, 57, 51, 59, 57, 58, 52, 53, 61, 59, 54, 55, 59, 60, 54, 63,
+    44, 69, 55, 55, 61, 50, 57, 51, 57, 48, 58, 60, 51, 53, 47, 57,
+    54, 63, 51, 45, 68, 59, 58, 57, 56, 62, 55, 57, 49, 52, 56, 55,
+    68, 52, 55, 53, 62, 50, 47, 60, 62, 57, 58, 59, 50, 58, 56, 58,
+    62, 51, 59, 42, 46, 54, 59, 60, 45, 52, 51, 49, 59, 51, 57, 62,
+    49, 56, 59, 53, 57, 66, 61, 63, 52, 59, 53, 54, 54, 56, 45, 56,
+    56, 57, 60, 53, 74, 49, 59, 58, 61, 61, 57, 56, 54, 51, 55, 56,
+    57, 57, 59, 59, 61, 55, 57, 60, 58, 53, 57, 62, 56, 51, 52, 58,
+    56, 59, 54, 59, 54, 52, 56, 64, 52, 60, 45, 51, 51, 66, 60, 57,
+    53, 52, 60, 50, 61, 64, 55, 56, 52, 51, 52, 63, 64, 58, 54, 49,
+    58, 54, 52, 59, 55, 66, 59, 50, 51, 58, 61, 55, 51, 65, 57, 61,
+    52, 64, 57, 53, 56, 71, 57, 52, 51, 55, 61, 62, 53, 53, 58, 66,
+    56, 55, 49, 58, 39, 65, 55, 51, 54, 60, 56, 50, 57, 50, 65, 46,
+    62, 52, 47, 52, 59, 60, 62, 48, 56, 50, 61, 62, 60, 52, 52, 63,
+    55, 48, 54, 55, 53, 57, 63, 54, 62, 52, 54, 55, 51, 56, 58, 60,
+    54, 50, 55, 57, 62, 57, 58, 53, 59, 49, 52, 61, 58, 56, 41, 62,
+    55, 57, 51, 55, 59, 57, 51, 55, 54, 63, 56, 52, 44, 49, 57, 58,
+    52, 68, 55, 57, 60, 54, 63, 61, 43, 53, 61, 47, 56, 50, 49, 62,
+    54, 54, 59, 56, 56, 59, 51, 64, 48, 63, 61, 54, 56, 60, 48, 50,
+    60, 54, 49, 41, 58, 60, 54, 53, 50, 53, 58, 57, 56, 49, 54, 67,
+    56, 58, 56, 54, 55, 48, 52, 58, 62, 51, 67, 57, 61, 65, 60, 66,
+    54, 53, 57, 51, 54, 62, 59, 52, 67, 53, 51, 48, 61, 54, 55, 66,
+    46, 65, 57, 58, 49, 56, 54, 54, 44, 66, 60, 56, 54, 54, 53, 49,
+    54, 57, 58, 48, 57, 52, 60, 59, 51, 56, 60, 54, 55, 58, 54, 60,
+    56, 60, 55, 44, 59, 48, 61, 56, 55, 51, 64, 58, 53, 55, 60, 60,
+    57, 59, 60, 49, 55, 54, 57, 62, 60, 48, 57, 59, 49, 52, 56, 59,
+    57, 47, 62, 55, 45, 49, 56, 66, 55, 58, 57, 61, 49, 56, 54, 51,
+    50, 63, 60, 58, 60, 54, 51, 58, 57, 55, 47, 58, 54, 47, 64, 54,
+    45, 57, 52, 50, 56, 53, 50, 44, 73, 61, 59, 64, 50, 55, 66, 49,
+    47, 64, 53, 59, 52, 51, 61, 67, 51, 50, 52, 49, 56, 65, 55, 45,
+    58, 53, 62, 59, 61, 54, 55, 54, 55, 65, 52, 54, 61, 62, 54, 51,
+    57, 66, 57, 53, 54, 62, 57, 58, 50, 66, 62, 56, 42, 53, 57, 59,
+    58, 52, 63, 55, 49, 58, 50, 51, 51, 59, 57, 46, 55, 60, 51, 56,
+    60, 62, 52, 56, 55, 58, 53, 54, 49, 52, 53, 59, 48, 52, 64, 60,
+    57, 50, 56, 73, 64, 50, 58, 54, 58, 63, 55, 54, 58, 59, 61, 58,
+    59, 54, 59, 61, 52, 59, 54, 51, 64, 55, 53, 62, 60, 57, 52, 58,
+    64, 60, 57, 57, 55, 46, 58, 57, 62, 52, 50, 56, 60, 50, 64, 45,
+    66, 50, 57, 52, 58, 56, 45, 55, 55, 59, 53, 45, 60, 53, 49, 47,
+    61, 62, 55, 54, 48, 57, 51, 63, 48, 66, 48, 65, 60, 50, 53, 50,
+    50, 50, 61, 55, 57, 59, 57, 52, 57, 62, 58, 59, 54, 58, 57, 55,
+    53, 59, 49, 56, 67, 58, 61, 50, 61, 58, 65, 50, 59, 63, 53, 57,
+    57, 50, 59, 55, 56, 56, 53, 52, 60, 63, 63, 62, 65, 50, 53, 59,
+    49, 56, 57, 55, 57, 48, 58, 54, 55, 58, 53, 43, 54, 64, 48, 56,
+    54, 53, 58, 50, 58, 57, 67, 59, 52, 59, 59, 63, 50, 59, 64, 54,
+    64, 55, 60, 61, 48, 58, 54, 57, 57, 48, 48, 53, 50, 52, 55, 61,
+    56, 55, 56, 51, 66, 61, 60, 55, 51, 53, 65, 54, 46, 57, 57, 59,
+    66, 56, 64, 58, 63, 57, 68, 49, 55, 52, 55, 51, 54, 62, 49, 53,
+    55, 50, 60, 53, 57, 56, 63, 60, 67, 60, 56, 51, 52, 65, 58, 52,
+    61, 51, 54, 56, 54, 49, 48, 61, 57, 45, 50, 48, 61, 54, 50, 53,
+    47, 55, 52, 52, 54, 63, 60, 50, 58, 60, 49, 59, 57, 51, 60, 60,
+    60, 55, 63, 53, 49, 51, 61, 56, 54, 60, 52, 64, 53, 53, 49, 55,
+    63, 69, 57, 62, 52, 68, 51, 51, 52, 54, 60, 62, 56, 54, 56, 52,
+    61, 51, 58, 58, 53, 57, 54, 49, 48, 67, 49, 56, 45, 48, 66, 53,
+    57, 51, 62, 46, 59, 55, 51, 53, 55, 54, 56, 52, 54, 56, 59, 55,
+    57, 55, 69, 47, 61, 59, 59, 52, 43, 46, 55, 69, 58, 60, 58, 56,
+    56, 56, 49, 53, 53, 66, 55, 63, 53, 59, 47, 50, 46, 56, 63, 59,
+    59, 49, 63, 52, 57, 51, 50, 57, 49, 57, 58, 56, 60, 54, 54, 56,
+    64, 50, 59, 60, 55, 51, 51, 60, 55, 54, 62, 56, 57, 59, 68, 50,
+    49, 58, 53, 51, 55, 54, 44, 59, 51, 56, 58, 49, 59, 55, 66, 63,
+    54, 59, 59, 65, 58, 48, 59, 60, 49, 55, 58, 61, 63, 59, 69, 57,
+    52, 71, 56, 61, 58, 49, 60, 52, 66, 56, 53, 52, 48, 58, 62, 55,
+    57, 61, 55, 58, 58, 54, 51, 63, 59, 54, 48, 54, 58, 59, 45, 53,
+    60, 57, 55, 49, 56, 50, 64, 50, 55, 62, 60, 54, 55, 60, 54, 53,
+    56, 57, 50, 64, 53, 57, 55, 59, 58, 55, 50, 63, 52, 67, 52, 53,
+    56, 49, 58, 57, 61, 50, 56, 47, 52, 49, 63, 47, 64, 55, 54, 52,
+    46, 55, 47, 60, 44, 62, 67, 67, 57, 54, 64, 60, 56, 48, 45, 55,
+    49, 57, 57, 52, 57, 52, 67, 57, 66, 50, 51, 60, 57, 56, 58, 56,
+    49, 58, 54, 55, 53, 56, 64, 64, 62, 64, 63, 47, 58, 57, 52, 54,
+    58, 64, 57, 67, 56, 56, 56, 60, 48, 56, 53, 55, 60, 61, 61, 59,
+    46, 55, 51, 50, 53, 52, 64, 58, 60, 51, 59, 56, 57, 51, 60, 55,
+    62, 47, 56, 55, 55, 54, 59, 49, 54, 56, 46, 57, 65, 50, 59, 55,
+    55, 57, 58, 52, 56, 56, 66, 61, 52, 60, 45, 53, 63, 56, 54, 59,
+    51, 58, 59, 60, 64, 62, 60, 61, 52, 60, 56, 49, 47, 58, 61, 56,
+    65, 55, 60, 42, 61, 61, 62, 58, 63, 61, 56, 59, 49, 63, 48, 60,
+    60, 57, 59, 50, 54, 54, 65, 67, 59, 58, 52, 55, 49, 62, 58, 50,
+    52, 52, 39, 61, 55, 61, 50, 52, 62, 44, 50, 57, 54, 74, 52, 56,
+    54, 56, 55, 54, 49, 53, 62, 56, 51, 59, 50, 56, 61, 46, 61, 46,
+    51, 65, 66, 66, 56, 59, 44, 62, 50, 50, 64, 53, 45, 58, 69, 57,
+    54, 50, 59, 47, 57, 57, 55, 57, 53, 63, 64, 51, 61, 52, 57, 50,
+    59, 56, 52, 58, 63, 53, 52, 58, 57, 55, 53, 57, 46, 65, 50, 51,
+    49, 55, 63, 57, 39, 53, 60, 64, 50, 51, 57, 57, 67, 61, 58, 56,
+    60, 57, 55, 50, 62, 52, 53, 61, 52, 61, 58, 53, 58, 51, 57, 61,
+    49, 56, 59, 53, 54, 46, 66, 53, 57, 49, 60, 54, 65, 58, 60, 52,
+    53, 48, 60, 61, 57, 64, 70, 55, 42, 55, 67, 67, 47, 50, 53, 54,
+    61, 53, 60, 51, 51, 61, 50, 52, 62, 54, 59, 59, 58, 56, 59, 67,
+    52, 51, 54, 65, 56, 61, 58, 59, 48, 53, 57, 59, 49, 48, 58, 44,
+    53, 55, 57, 54, 52, 59, 60, 59, 55, 59, 54, 53, 59, 55, 56, 53,
+    57, 55, 51, 52, 53, 62, 51, 59, 53, 53, 66, 62, 61, 46, 47, 53,
+    55, 57, 61, 63, 45, 64, 55, 45, 51, 62, 63, 49, 56, 55, 55, 57,
+    49, 65, 55, 51, 60, 55, 56, 57, 54, 38, 51, 46, 49, 62, 55, 49,
+    54, 53, 62, 59, 56, 59, 56, 59, 53, 59, 64, 64, 53, 51, 57, 58,
+    58, 43, 53, 64, 58, 50, 63, 51, 59, 58, 52, 47, 48, 53, 61, 58,
+    59, 58, 51, 56, 49, 57, 59, 54, 60, 55, 60, 57, 53, 60, 55, 54,
+    50, 54, 53, 48, 44, 52, 62, 49, 53, 62, 56, 47, 47, 53, 55, 58,
+    51, 54, 57, 62, 61, 51, 49, 54, 61, 59, 56, 52, 50, 55, 53, 50,
+    58, 67, 54, 63, 57, 56, 49, 62, 50, 53, 55, 57, 54, 54, 51, 52,
+    58, 65, 55, 62, 58, 56, 47, 54, 58, 56, 57, 57, 58, 53, 59, 58,
+    52, 60, 57, 65, 54, 51, 56, 58, 53, 63, 54, 47, 57, 52, 52, 61,
+    57, 58, 52, 60, 55, 69, 51, 43, 61, 61, 56, 47, 44, 65, 47, 60,
+    53, 58, 56, 67, 55, 45, 64, 56, 55, 62, 58, 48, 57, 66, 43, 56,
+    49, 53, 60, 53, 59, 61, 59, 62, 55, 53, 52, 66, 64, 61, 43, 45,
+    49, 62, 51, 54, 52, 58, 61, 59, 49, 56, 49, 56, 64, 57, 47, 49,
+    58, 41, 52, 56, 50, 57, 56, 54, 50, 58, 56, 51, 61, 58, 62, 55,
+    51, 54, 55, 65, 51, 53, 58, 54, 52, 56, 50, 54, 53, 54, 62, 53,
+    62, 56, 45, 45, 51, 47, 55, 53, 68, 58, 58, 59, 55, 50, 52, 61,
+    49, 61, 63, 60, 46, 49, 66, 63, 55, 53, 54, 49, 59, 58, 43, 58,
+    51, 57, 67, 53, 59, 51, 57, 58, 52, 51, 59, 56, 56, 62, 53, 64,
+    54, 61, 61, 53, 61, 50, 58, 59, 54, 48, 50, 67, 51, 56, 58, 54,
+    49, 50, 58, 60, 57, 56, 62, 57, 52, 57, 52, 50, 48, 57, 58, 62,
+    58, 52, 57, 45, 51, 57, 64, 46, 51, 52, 53, 63, 58, 54, 52, 62,
+    46, 63, 61, 55, 59, 63, 52, 58, 54, 53, 43, 52, 56, 59, 56, 65,
+    48, 58, 66, 53, 70, 53, 53, 59, 58, 61, 48, 55, 66, 47, 50, 56,
+    61, 60, 61, 55, 62, 46, 59, 63, 49, 64, 59, 61, 49, 54, 56, 57,
+    49, 54, 57, 55, 57, 52, 55, 67, 66, 52, 55, 70, 52, 50, 60, 53,
+    58, 61, 44, 45, 59, 59, 57, 62, 56, 61, 51, 57, 55, 48, 53, 54,
+    56, 54, 49, 56, 51, 54, 48, 56, 53, 56, 46, 58, 60, 43, 67, 57,
+    63, 65, 50, 67, 64, 58, 56, 51, 56, 57, 50, 51, 54, 54, 47, 60,
+    50, 58, 53, 65, 56, 60, 51, 51, 57, 58, 56, 45, 63, 51, 58, 57,
+    51, 55, 54, 63, 52, 62, 57, 51, 40, 54, 60, 48, 57, 53, 59, 50,
+    60, 58, 66, 52, 60, 64, 45, 52, 54, 50, 52, 55, 61, 50, 63, 53,
+    65, 57, 41, 49, 51, 56, 62, 61, 67, 55, 59, 60, 47, 51, 47, 61,
+    51, 49, 50, 52, 65, 51, 62, 60, 66, 55, 53, 62, 49, 51, 60, 62,
+    55, 44, 62, 59, 51, 58, 55, 51, 69, 44, 64, 48, 56, 54, 49, 58,
+    57, 53, 46, 59, 71, 49, 50, 53, 58, 57, 56, 52, 51, 51, 60, 54,
+    68, 45, 58, 51, 54, 58, 53, 54, 68, 59, 47, 65, 53, 56, 59, 59,
+    54, 58, 55, 60, 54, 61, 55, 66, 59, 55, 55, 54, 53, 51, 62, 61,
+    49, 51, 50, 63, 52, 52, 49, 61, 52, 58, 46, 55, 64, 49, 59, 48,
+    57, 54, 57, 63, 63, 57, 52, 45, 61, 53, 67, 55, 51, 59, 43, 54,
+    53, 54, 54, 56, 55, 60, 46, 58, 51, 58, 58, 49, 62, 66, 51, 60,
+    53, 64, 66, 62, 59, 45, 61, 51, 53, 58, 54, 56, 63, 47, 56, 58,
+    63, 62, 48, 49, 57, 53, 63, 61, 59, 57, 58, 48, 63, 56, 53, 53,
+    54, 52, 58, 56, 55, 50, 53, 53, 54, 55, 54, 60, 48, 64, 53, 49,
+    55, 59, 52, 61, 52, 64, 41, 54, 51, 67, 52, 61, 53, 50, 46, 62,
+    53, 51, 48, 52, 57, 69, 55, 60, 57, 53, 51, 56, 55, 63, 60, 54,
+    52, 45, 59, 54, 60, 63, 58, 52, 61, 61, 54, 58, 65, 47, 58, 57,
+    53, 53, 63, 52, 61, 58, 48, 55, 59, 55, 61, 60, 53, 57, 53, 57,
+    51, 46, 53, 59, 53, 48, 61, 58, 67, 66, 56, 60, 53, 52, 54, 61,
+    49, 51, 67, 57, 56, 61, 57, 52, 53, 54, 57, 56, 66, 44, 61, 55,
+    50, 54, 51, 64, 60, 54, 63, 54, 66, 53, 43, 60, 54, 61, 55, 56,
+    61, 47, 53, 61, 51, 54, 53, 59, 52, 55, 47, 52, 47, 62, 58, 46,
+    63, 56, 52, 60, 57, 57, 50, 53, 54, 45, 62, 47, 59, 62, 61, 56,
+    60, 55, 57, 57, 53, 52, 62, 62, 53, 60, 63, 60, 49, 57, 57, 52,
+    58, 55, 62, 59, 61, 47, 63, 53, 61, 57, 48, 59, 49, 61, 53, 57,
+    55, 57, 46, 55, 47, 69, 53, 61, 50, 53, 60, 53, 63, 52, 56, 58,
+    60, 52, 60, 62, 49, 67, 51, 46, 49, 47, 53, 56, 51, 64, 53, 54,
+    55, 52, 60, 63, 54, 56, 57, 55, 67, 61, 50, 52, 59, 53, 52, 57,
+    69, 63, 55, 55, 51, 48, 61, 64, 60, 52, 50, 53, 40, 61, 51, 60,
+    54, 63, 47, 58, 58, 53, 57, 62, 61, 57, 64, 48, 59, 66, 57, 58,
+    51, 55, 42, 61, 55, 54, 47, 55, 55, 52, 63, 55, 42, 57, 48, 47,
+    55, 59, 58, 55, 65, 59, 61, 47, 61, 51, 53, 61, 50, 58, 59, 62,
+    57, 61, 56, 62, 54, 61, 53, 52, 55, 58, 64, 47, 48, 57, 64, 50,
+    56, 68, 52, 51, 59, 57, 60, 61, 63, 53, 51, 52, 59, 57, 53, 63,
+    47, 58, 66, 54, 50, 57, 61, 62, 48, 55, 54, 61, 61, 66, 59, 49,
+    51, 60, 56, 60, 52, 57, 56, 46, 59, 61, 56, 66, 52, 48, 57, 54,
+    62, 60, 60, 55, 65, 62, 56, 51, 63, 65, 48, 55, 62, 58, 63, 58,
+    57, 49, 53, 46, 51, 52, 50, 64, 52, 60, 44, 56, 53, 53, 54, 52,
+    51, 54, 62, 66, 49, 55, 53, 55, 58, 52, 53, 57, 51, 58, 58, 53,
+    50, 51, 63, 53, 54, 61, 53, 57, 45, 53, 58, 57, 55, 55, 49, 57,
+    67, 67, 64, 54, 60, 51, 45, 53, 58, 55, 52, 56, 50, 52, 57, 64,
+    42, 59, 49, 53, 56, 47, 59, 56, 56, 55, 54, 62, 59, 51, 47, 60,
+    63, 62, 56, 49, 62, 54, 53, 63, 69, 53, 50, 41, 52, 66, 57, 58,
+    47, 55, 62, 50, 56, 54, 55, 48, 60, 56, 64, 51, 48, 50, 61, 48,
+    52, 57, 60, 60, 53, 49, 52, 54, 45, 63, 60, 66, 46, 54, 57, 57,
+    62, 52, 55, 53, 57, 53, 68, 51, 53, 65, 57, 52, 55, 48, 55, 68,
+    51, 53, 63, 60, 59, 58, 44, 57, 48, 49, 59, 58, 62, 57, 64, 53,
+    59, 61, 58, 54, 60, 59, 57, 59, 59, 66, 48, 54, 57, 59, 49, 66,
+    46, 66, 54, 64, 51, 51, 56, 49, 62, 63, 53, 57, 48, 60, 50, 66,
+    56, 68, 54, 60, 52, 61, 61, 57, 58, 67, 51, 58, 41, 55, 52, 61,
+    53, 56, 63, 60, 56, 57, 55, 60, 52, 55, 61, 58, 55, 53, 44, 40,
+    60, 56, 50, 58, 54, 47, 53, 54, 51, 60, 63, 67, 64, 44, 48, 57,
+    52, 52, 59, 51, 55, 62, 50, 45, 53, 52, 50, 63, 57, 49, 60, 56,
+    59, 63, 63, 52, 48, 58, 66, 39, 55, 65, 57, 65, 56, 60, 58, 46,
+    65, 58, 55, 55, 45, 62, 54, 51, 52, 52, 58, 68, 57, 54, 52, 48,
+    55, 63, 62, 50, 55, 55, 59, 62, 55, 50, 57, 56, 63, 54, 51, 56,
+    49, 56, 62, 59, 46, 46, 69, 46, 57, 64, 64, 54, 59, 48, 55, 62,
+    57, 47, 56, 51, 48, 63, 55, 55, 52, 56, 58, 60, 63, 60, 54, 51,
+    57, 51, 52, 54, 39, 50, 61, 66, 59, 54, 56, 58, 50, 50, 55, 56,
+    54, 55, 60, 53, 58, 63, 59, 61, 50, 58, 50, 55, 57, 55, 60, 57,
+    57, 58, 56, 53, 54, 54, 53, 58, 54, 65, 50, 59, 65, 47, 61, 54,
+    62, 60, 50, 53, 53, 52, 46, 53, 61, 59, 61, 49, 57, 40, 53, 55,
+    54, 59, 51, 50, 57, 63, 54, 60, 55, 58, 46, 52, 62, 60, 53, 46,
+    51, 53, 49, 51, 58, 52, 46, 54, 60, 54, 56, 45, 59, 59, 51, 51,
+    55, 55, 55, 57, 57, 58, 61, 53, 55, 56, 45, 59, 55, 46, 59, 63,
+    59, 61, 53, 48, 69, 58, 56, 61, 51, 54, 60, 55, 60, 59, 45, 57,
+    59, 68, 60, 48, 58, 51, 57, 52, 47, 62, 56, 54, 55, 49, 57, 58,
+    50, 59, 62, 42, 56, 53, 53, 47, 64, 60, 52, 55, 52, 61, 52, 57,
+    55, 59, 55, 52, 51, 61, 53, 59, 53, 53, 59, 49, 55, 52, 55, 57,
+    44, 59, 71, 55, 63, 56, 44, 55, 54, 55, 66, 60, 63, 51, 52, 54,
+    54, 53, 60, 59, 56, 54, 58, 56, 55, 47, 61, 61, 52, 60, 48, 50,
+    56, 55, 58, 54, 55, 56, 54, 64, 66, 51, 63, 58, 52, 51, 55, 56,
+    60, 47, 62, 54, 63, 46, 70, 68, 56, 41, 50, 58, 59, 67, 48, 56,
+    48, 54, 60, 53, 54, 62, 56, 63, 60, 55, 63, 50, 47, 53, 59, 59,
+    46, 61, 56, 61, 61, 45, 46, 52, 60, 57, 68, 62, 52, 58, 55, 55,
+    51, 50, 59, 53, 48, 59, 56, 55, 69, 56, 52, 54, 54, 70, 55, 60,
+    57, 59, 61, 58, 64, 43, 49, 60, 57, 55, 63, 52, 62, 59, 53, 55,
+    53, 64, 52, 55, 59, 59, 49, 66, 57, 50, 54, 59, 63, 56, 56, 60,
+    52, 58, 53, 49, 49, 46, 56, 51, 51, 63, 52, 55, 59, 54, 60, 63,
+    59, 57, 65, 57, 56, 45, 51, 48, 70, 55, 53, 58, 52, 53, 55, 53,
+    59, 53, 54, 56, 66, 58, 44, 48, 52, 52, 50, 62, 63, 59, 57, 58,
+    51, 56, 59, 53, 50, 55, 61, 50, 55, 54, 54, 52, 61, 54, 58, 60,
+    59, 63, 62, 52, 49, 45, 48, 51, 55, 62, 61, 54, 57, 56, 57, 51,
+    55, 64, 51, 57, 58, 51, 53, 59, 52, 51, 53, 54, 54, 58, 64, 58,
+    60, 55, 50, 63, 55, 45, 68, 66, 57, 70, 54, 62, 49, 55, 52, 59,
+    58, 61, 55, 58, 48, 62, 51, 58, 56, 56, 54, 47, 56, 55, 58, 61,
+    48, 54, 57, 55, 67, 54, 46, 55, 54, 54, 52, 52, 63, 52, 51, 62,
+    61, 59, 61, 54, 56, 60, 58, 54, 60, 58, 47, 55, 57, 57, 59, 54,
+    47, 62, 61, 46, 47, 53, 59, 58, 52, 60, 53, 59, 55, 54, 57, 55,
+    53, 55, 53, 54, 61, 58, 54, 52, 67, 56, 51, 60, 52, 51, 61, 48,
+    51, 57, 58, 54, 54, 45, 54, 57, 50, 58, 57, 57, 55, 59, 53, 57,
+    64, 46, 61, 66, 58, 53, 49, 55, 59, 59, 49, 54, 54, 52, 64, 58,
+    52, 60, 52, 59, 65, 55, 55, 58, 40, 54, 57, 51, 53, 56, 46, 55,
+    50, 53, 66, 58, 54, 60, 48, 55, 46, 49, 45, 50, 61, 50, 55, 55,
+    60, 55, 62, 60, 58, 54, 64, 55, 53, 66, 51, 67, 64, 57, 62, 63,
+    66, 51, 53, 58, 53, 57, 55, 49, 54, 59, 51, 51, 64, 59, 52, 57,
+    63, 55, 55, 60, 62, 40, 55, 60, 52, 52, 59, 42, 55, 56, 59, 57,
+    55, 51, 63, 51, 55, 54, 53, 52, 55, 58, 49, 54, 65, 55, 58, 54,
+    53, 55, 59, 52, 55, 45, 57, 62, 56, 62, 56, 58, 47, 57, 57, 52,
+    56, 50, 62, 50, 66, 46, 58, 44, 53, 57, 55, 51, 57, 56, 60, 57,
+    54, 55, 53, 56, 47, 63, 51, 67, 52, 58, 52, 54, 55, 53, 59, 57,
+    59, 57, 48, 63, 65, 53, 62, 60, 49, 58, 50, 57, 55, 62, 46, 60,
+    62, 59, 55, 57, 54, 47, 56, 51, 62, 59, 54, 58, 55, 54, 64, 57,
+    53, 58, 56, 53, 61, 59, 52, 58, 57, 52, 51, 66, 49, 59, 61, 64,
+    55, 52, 62, 46, 46, 58, 54, 61, 56, 65, 53, 49, 55, 58, 62, 63,
+    51, 47, 52, 58, 54, 57, 54, 59, 52, 60, 53, 56, 63, 56, 58, 55,
+    61, 53, 56, 48, 61, 55, 60, 52, 57, 55, 56, 54, 53, 61, 52, 60,
+    55, 55, 62, 64, 56, 55, 51, 56, 51, 48, 49, 55, 55, 58, 58, 56,
+    51, 57, 50, 64, 60, 55, 67, 56, 58, 55, 64, 46, 57, 55, 54, 55,
+    48, 57, 48, 62, 58, 54, 51, 60, 62, 61, 65, 56, 45, 55, 53, 52,
+    47, 57, 56, 64, 46, 47, 57, 49, 46, 50, 50, 61, 55, 46, 65, 58,
+    62, 54, 62, 52, 51, 53, 52, 56, 61, 48, 52, 53, 58, 46, 55, 49,
+    62, 62, 48, 53, 67, 51, 58, 49, 63, 58, 47, 64, 64, 44, 60, 66,
+    55, 56, 56, 49, 55, 58, 59, 60, 48, 60, 52, 57, 51, 61, 65, 53,
+    59, 59, 56, 52, 55, 66, 54, 58, 58, 54, 59, 55, 61, 47, 62, 59,
+    49, 70, 51, 60, 59, 55, 50, 55, 57, 56, 58, 50, 50, 55, 54, 52,
+    60, 56, 56, 61, 65, 56, 42, 54, 61, 47, 51, 63, 52, 62, 53, 56,
+    54, 58, 53, 56, 59, 62, 71, 51, 51, 54, 56, 50, 55, 57, 67, 58,
+    64, 55, 59, 60, 55, 55, 54, 61, 59, 49, 52, 54, 59, 57, 57, 50,
+    54, 57, 57, 62, 55, 54, 51, 62, 50, 51, 56, 56, 57, 67, 61, 52,
+    59, 54, 58, 51, 53, 55, 62, 57, 52, 60, 55, 53, 51, 55, 60, 50,
+    60, 55, 55, 55, 60, 53, 48, 59, 61, 56, 53, 60, 58, 52, 48, 61,
+    49, 55, 50, 53, 51, 52, 54, 54, 53, 48, 56, 54, 53, 57, 51, 54,
+    52, 49, 55, 58, 66, 60, 62, 60, 55, 62, 52, 71, 57, 61, 48, 63,
+    57, 49, 53, 60, 61, 55, 57, 47, 60, 55, 57, 57, 54, 53, 61, 65,
+    55, 47, 57, 53, 53, 56, 57, 56, 61, 51, 57, 57, 51, 60, 50, 57,
+    58, 61, 61, 60, 59, 54, 53, 61, 66, 44, 58, 50, 45, 63, 58, 58,
+    54, 57, 50, 48, 58, 58, 51, 49, 52, 53, 63, 59, 67, 54, 56, 48,
+    49, 57, 63, 57, 59, 63, 58, 51, 52, 53, 57, 53, 52, 55, 59, 53,
+    53, 53, 56, 55, 46, 55, 53, 56, 57, 57, 46, 63, 56, 55, 48, 61,
+    63, 54, 58, 57, 56, 60, 53, 57, 50, 54, 57, 49, 71, 52, 52, 62,
+    53, 50, 54, 58, 52, 61, 45, 66, 59, 58, 46, 63, 51, 50, 59, 60,
+    53, 58, 46, 61, 46, 61, 55, 62, 61, 53, 48, 61, 70, 49, 61, 55,
+    58, 56, 59, 53, 63, 57, 49, 64, 45, 55, 54, 55, 53, 55, 51, 43,
+    52, 65, 56, 49, 58, 58, 53, 55, 52, 61, 50, 59, 53, 52, 48, 49,
+    56, 50, 59, 53, 70, 43, 59, 62, 65, 47, 57, 42, 65, 56, 61, 54,
+    58, 61, 62, 52, 53, 55, 51, 60, 53, 56, 55, 51, 58, 54, 66, 66,
+    58, 52, 59, 56, 59, 54, 53, 56, 54, 48, 59, 59, 60, 60, 47, 59,
+    54, 57, 57, 68, 51, 55, 50, 56, 55, 61, 64, 53, 56, 53, 57, 62,
+    55, 46, 50, 50, 55, 51, 61, 61, 69, 60, 56, 49, 59, 61, 62, 60,
+    54, 55, 65, 47, 56, 50, 66, 57, 64, 56, 63, 64, 56, 43, 53, 69,
+    62, 48, 58, 59, 47, 63, 58, 52, 55, 50, 61, 52, 55, 52, 57, 53,
+    52, 53, 58, 49, 48, 62, 62, 54, 62, 57, 56, 64, 59, 64, 55, 60,
+    44, 57, 45, 60, 63, 54, 58, 57, 52, 61, 50, 50, 52, 56, 51, 53,
+    59, 57, 51, 56, 48, 57, 66, 59, 46, 57, 59, 51, 63, 57, 56, 58,
+    58, 63, 52, 56, 55, 56, 74, 50, 58, 59, 57, 60, 51, 62, 64, 52,
+    51, 62, 43, 59, 64, 46, 51, 54, 58, 55, 57, 53, 52, 60, 50, 58,
+    62, 59, 52, 56, 67, 43, 62, 57, 56, 52, 57, 58, 51, 54, 54, 62,
+    64, 59, 58, 60, 53, 60, 58, 42, 54, 53, 53, 62, 61, 50, 60, 61,
+    52, 59, 45, 59, 58, 45, 55, 63, 45, 59, 60, 61, 41, 52, 62, 47,
+    58, 59, 61, 60, 49, 58, 57, 57, 56, 59, 54, 53, 60, 64, 50, 55,
+    61, 52, 55, 56, 52, 55, 59, 60, 57, 49, 45, 51, 56, 60, 52, 55,
+    62, 49, 56, 57, 47, 59, 47, 55, 55, 63, 56, 53, 56, 57, 66, 59,
+    55, 49, 55, 57, 58, 42, 52, 47, 59, 56, 54, 50, 61, 54, 61, 64,
+    53, 51, 54, 54, 63, 50, 52, 53, 58, 56, 50, 58, 62, 61, 54, 50,
+    60, 50, 46, 57, 67, 56, 60, 48, 47, 60, 56, 53, 59, 69, 55, 51,
+    58, 57, 59, 50, 53, 50, 55, 54, 58, 56, 51, 65, 54, 55, 56, 51,
+    62, 51, 53, 52, 56, 56, 52, 57, 74, 54, 57, 62, 56, 53, 58, 56,
+    61, 48, 61, 50, 57, 50, 64, 59, 55, 58, 58, 48, 55, 55, 61, 49,
+    50, 74, 53, 53, 55, 52, 61, 66, 58, 65, 61, 57, 53, 52, 45, 52,
+    49, 64, 53, 58, 47, 58, 57, 55, 39, 63, 54, 63, 55, 55, 55, 58,
+    54, 66, 53, 50, 58, 58, 47, 59, 67, 52, 58, 56, 53, 57, 61, 62,
+    53, 63, 59, 52, 55, 56, 51, 53, 60, 60, 49, 52, 54, 62, 52, 56,
+    53, 53, 57, 62, 47, 55, 45, 50, 58, 53, 47, 51, 53, 54, 58, 51,
+    45, 54, 53, 58, 56, 67, 54, 67, 51, 61, 62, 53, 48, 57, 51, 51,
+    58, 70, 57, 58, 59, 54, 66, 47, 55, 58, 57, 54, 64, 53, 53, 57,
+    60, 54, 55, 56, 53, 58, 61, 55, 59, 54, 51, 50, 59, 57, 60, 47,
+    58, 53, 55, 53, 49, 59, 58, 51, 58, 46, 52, 55, 40, 54, 57, 58,
+    58, 49, 67, 59, 49, 55, 62, 55, 44, 56, 50, 54, 59, 54, 55, 64,
+    58, 61, 63, 56, 45, 61, 58, 62, 45, 50, 52, 58, 52, 63, 63, 54,
+    55, 60, 56, 60, 54, 58, 56, 53, 60, 52, 70, 55, 60, 61, 62, 62,
+    64, 55, 58, 51, 53, 53, 59, 50, 55, 65, 52, 62, 54, 59, 59, 52,
+    48, 61, 45, 53, 61, 51, 53, 55, 55, 49, 50, 62, 48, 59, 53, 52,
+    57, 56, 59, 49, 60, 58, 49, 57, 53, 53, 67, 58, 58, 52, 52, 64,
+    51, 58, 56, 51, 59, 62, 53, 62, 48, 54, 61, 49, 59, 56, 56, 57,
+    54, 55, 61, 52, 49, 54, 53, 55, 52, 54, 55, 57, 59, 50, 61, 56,
+    54, 52, 61, 54, 65, 45, 55, 70, 59, 60, 43, 50, 51, 65, 54, 56,
+    58, 65, 59, 58, 51, 49, 57, 50, 62, 50, 60, 48, 60, 52, 59, 60,
+    61, 63, 57, 54, 52, 61, 60, 55, 51, 59, 55, 64, 46, 53, 66, 56,
+    56, 60, 55, 55, 52, 49, 51, 54, 65, 56, 54, 53, 53, 45, 52, 59,
+    72, 58, 58, 53, 51, 50, 57, 48, 66, 51, 54, 55, 62, 47, 50, 57,
+    51, 62, 53, 58, 57, 55, 67, 54, 50, 59, 57, 53, 44, 60, 53, 53,
+    63, 66, 47, 53, 63, 49, 54, 47, 62, 54, 57, 42, 52, 56, 57, 51,
+    55, 58, 56, 54, 56, 55, 51, 47, 73, 50, 58, 55, 54, 60, 58, 54,
+    60, 56, 54, 59, 51, 52, 55, 51, 45, 66, 51, 65, 57, 66, 55, 53,
+    59, 55, 62, 46, 62, 53, 49, 59, 59, 54, 60, 52, 56, 56, 66, 46,
+    57, 59, 54, 49, 59, 60, 55, 50, 58, 46, 54, 55, 60, 48, 57, 61,
+    49, 56, 53, 55, 55, 57, 63, 57, 53, 54, 49, 58, 59, 61, 55, 56,
+    47, 54, 57, 49, 47, 57, 60, 63, 50, 57, 43, 53, 55, 50, 52, 55,
+    55, 55, 53, 54, 55, 53, 56, 57, 58, 63, 41, 56, 59, 53, 45, 60,
+    63, 54, 51, 51, 58, 53, 56, 50, 61, 51, 62, 46, 53, 58, 59, 58,
+    53, 62, 48, 52, 51, 58, 54, 58, 53, 45, 53, 51, 49, 58, 52, 46,
+    60, 60, 66, 60, 51, 61, 57, 54, 62, 47, 53, 45, 51, 52, 69, 51,
+    59, 56, 49, 55, 65, 49, 62, 55, 65, 51, 53, 57, 51, 50, 45, 67,
+    59, 63, 54, 60, 55, 61, 51, 52, 52, 63, 56, 48, 64, 53, 60, 57,
+    65, 46, 62, 53, 53, 59, 59, 51, 49, 54, 57, 54, 59, 57, 65, 56,
+    55, 50, 61, 62, 48, 49, 56, 48, 54, 62, 61, 56, 55, 54, 60, 53,
+    60, 53, 49, 58, 51, 53, 52, 57, 59, 58, 56, 49, 62, 47, 54, 64,
+    61, 58, 57, 53, 58, 61, 52, 58, 55, 59, 54, 46, 50, 60, 44, 47,
+    50, 48, 57, 57, 42, 61, 57, 55, 54, 52, 63, 51, 47, 63, 59, 62,
+    57, 52, 63, 49, 57, 55, 58, 62, 52, 55, 48, 49, 49, 59, 46, 52,
+    50, 57, 60, 64, 52, 55, 53, 54, 55, 52, 55, 51, 49, 56, 55, 61,
+    60, 56, 54, 67, 49, 60, 63, 64, 59, 47, 56, 56, 55, 53, 48, 51,
+    54, 53, 58, 60, 56, 49, 55, 57, 52, 51, 49, 72, 58, 51, 60, 56,
+    52, 55, 54, 60, 54, 59, 59, 47, 58, 55, 63, 53, 50, 53, 61, 55,
+    61, 59, 58, 51, 58, 63, 42, 58, 70, 55, 56, 56, 60, 52, 58, 49,
+    49, 50, 45, 50, 56, 46, 50, 52, 58, 54, 55, 61, 61, 56, 55, 53,
+    53, 54, 57, 66, 55, 51, 44, 50, 55, 52, 60, 56, 66, 47, 53, 65,
+    53, 64, 49, 68, 53, 53, 61, 56, 62, 45, 60, 55, 59, 60, 57, 53,
+    58, 63, 66, 55, 60, 54, 49, 55, 55, 55, 54, 70, 62, 54, 52, 46,
+    49, 57, 50, 66, 57, 50, 46, 52, 61, 51, 58, 57, 55, 46, 61, 59,
+    50, 54, 58, 56, 59, 54, 62, 56, 57, 52, 57, 51, 61, 59, 52, 61,
+    50, 59, 51, 60, 60, 51, 46, 57, 55, 50, 59, 53, 53, 56, 72, 55,
+    57, 42, 50, 54, 52, 54, 55, 59, 58, 63, 55, 68, 58, 57, 61, 51,
+    54, 60, 55, 54, 54, 49, 52, 57, 56, 63, 52, 43, 66, 57, 58, 50,
+    54, 48, 58, 61, 57, 59, 53, 61, 51, 52, 61, 58, 48, 60, 54, 57,
+    49, 52, 63, 57, 57, 56, 65, 48, 54, 64, 60, 52, 66, 51, 52, 57,
+    57, 61, 54, 65, 52, 51, 69, 52, 60, 53, 61, 62, 68, 49, 62, 54,
+    48, 68, 53, 61, 62, 55, 44, 47, 49, 51, 54, 57, 46, 57, 49, 54,
+    61, 59, 58, 55, 55, 58, 54, 54, 63, 52, 57, 63, 58, 40, 61, 58,
+    55, 60, 50, 57, 59, 48, 52, 63, 57, 48, 48, 53, 52, 62, 61, 43,
+    55, 68, 58, 59, 55, 62, 56, 49, 50, 53, 53, 55, 56, 62, 49, 53,
+    56, 56, 64, 56, 42, 64, 51, 47, 51, 53, 50, 53, 63, 56, 53, 56,
+    50, 57, 48, 60, 52, 60, 66, 51, 62, 59, 49, 63, 56, 57, 42, 47,
+    55, 51, 48, 53, 70, 49, 52, 58, 53, 49, 53, 55, 48, 60, 64, 53,
+    64, 57, 48, 63, 57, 59, 56, 59, 52, 60, 50, 56, 56, 53, 53, 55,
+    60, 65, 47, 51, 54, 57, 50, 53, 55, 55, 48, 49, 63, 57, 55, 50,
+    64, 55, 58, 59, 47, 50, 65, 48, 52, 59, 59, 54, 51, 53, 59, 66,
+    58, 51, 49, 62, 54, 58, 49, 53, 58, 55, 46, 53, 47, 60, 47, 69,
+    55, 54, 51, 51, 54, 51, 58, 58, 60, 74, 54, 59, 63, 58, 48, 50,
+    62, 56, 62, 62, 56, 49, 61, 46, 60, 57, 55, 51, 48, 55, 63, 50,
+    53, 46, 54, 54, 55, 45, 55, 57, 60, 58, 53, 54, 49, 56, 55, 53,
+    52, 63, 51, 61, 56, 65, 58, 61, 59, 57, 47, 55, 54, 53, 60, 60,
+    61, 58, 70, 50, 55, 51, 62, 59, 54, 58, 65, 48, 52, 52, 56, 53,
+    59, 60, 54, 58, 51, 56, 63, 47, 64, 55, 58, 46, 50, 62, 51, 66,
+    58, 62, 51, 58, 52, 53, 56, 50, 54, 59, 56, 53, 49, 64, 46, 60,
+    50, 55, 65, 58, 61, 50, 54, 60, 54, 49, 60, 60, 59, 51, 60, 55,
+    54, 60, 55, 59, 59, 61, 58, 49, 56, 55, 52, 55, 58, 50, 45, 61,
+    42, 67, 58, 51, 56, 54, 47, 48, 44, 60, 46, 49, 50, 59, 60, 57,
+    60, 53, 60, 53, 51, 54, 64, 53, 55, 66, 49, 53, 49, 52, 53, 50,
+    57, 49, 49, 58, 46, 60, 60, 53, 53, 56, 55, 52, 56, 60, 64, 57,
+    70, 65, 57, 50, 55, 72, 56, 58, 63, 54, 59, 49, 55, 65, 56, 47,
+    54, 75, 50, 64, 60, 56, 56, 53, 50, 56, 53, 57, 60, 53, 58, 61,
+    55, 60, 52, 53, 61, 55, 53, 54, 60, 59, 55, 58, 55, 58, 52, 44,
+    57, 58, 51, 63, 59, 62, 61, 62, 57, 55, 59, 70, 68, 55, 57, 56,
+    59, 52, 53, 62, 53, 60, 52, 61, 61, 48, 56, 54, 56, 55, 65, 52,
+    53, 57, 52, 64, 54, 47, 64, 57, 49, 63, 55, 62, 59, 52, 56, 66,
+    45, 43, 56, 55, 39, 68, 45, 55, 59, 50, 58, 51, 61, 48, 61, 48,
+    67, 56, 51, 60, 49, 58, 49, 64, 50, 49, 62, 47, 55, 56, 50, 64,
+    52, 53, 66, 47, 56, 54, 49, 62, 52, 61, 55, 51, 56, 52, 54, 56,
+    60, 64, 53, 46, 60, 48, 53, 58, 51, 63, 65, 53, 49, 58, 59, 49,
+    45, 53, 69, 60, 55, 52, 58, 54, 58, 52, 51, 52, 46, 54, 67, 61,
+    61, 59, 44, 44, 57, 73, 56, 50, 49, 51, 52, 52, 52, 53, 49, 54,
+    53, 57, 57, 66, 52, 58, 54, 54, 69, 57, 58, 46, 46, 58, 57, 58,
+    50, 56, 57, 58, 57, 48, 57, 49, 49, 60, 48, 61, 65, 55, 45, 67,
+    57, 56, 68, 64, 49, 54, 57, 57, 45, 50, 54, 46, 49, 60, 55, 62,
+    61, 54, 55, 50, 52, 62, 50, 56, 50, 52, 53, 52, 61, 41, 49, 65,
+    53, 53, 48, 58, 50, 52, 64, 59, 57, 61, 56, 55, 57, 66, 53, 55,
+    58, 55, 56, 59, 59, 45, 59, 52, 63, 54, 52, 47, 52, 61, 59, 53,
+    53, 66, 62, 63, 55, 52, 59, 60, 63, 49, 57, 55, 54, 61, 53, 54,
+    48, 44, 58, 50, 54, 58, 58, 51, 52, 63, 52, 54, 56, 57, 59, 47,
+    57, 52, 56, 58, 55, 57, 62, 47, 55, 60, 61, 49, 61, 58, 49, 57,
+    58, 61, 59, 60, 52, 50, 58, 54, 60, 49, 53, 45, 59, 54, 45, 54,
+    57, 60, 51, 59, 55, 56, 55, 54, 65, 58, 53, 51, 54, 53, 51, 54,
+    59, 50, 58, 47, 58, 53, 65, 59, 60, 55, 47, 53, 54, 57, 53, 62,
+    54, 47, 62, 48, 57, 57, 57, 57, 59, 53, 55, 65, 59, 51, 56, 53,
+    54, 60, 61, 55, 65, 53, 46, 72, 56, 55, 56, 55, 53, 58, 50, 51,
+    63, 55, 52, 52, 57, 57, 66, 60, 55, 49, 46, 56, 56, 62, 52, 56,
+    59, 55, 52, 52, 51, 66, 62, 61, 53, 51, 63, 58, 51, 59, 54, 64,
+    57, 51, 54, 56, 56, 55, 48, 52, 63, 48, 61, 63, 60, 60, 56, 48,
+    59, 61, 61, 45, 52, 56, 58, 46, 46, 46, 53, 56, 51, 54, 53, 64,
+    60, 60, 63, 40, 59, 52, 52, 48, 57, 61, 49, 57, 66, 56, 56, 61,
+    57, 53, 51, 63, 64, 57, 49, 60, 53, 57, 49, 65, 62, 61, 55, 50,
+    52, 57, 55, 50, 61, 65, 60, 56, 54, 62, 47, 56, 53, 54, 52, 52,
+    56, 53, 59, 47, 53, 62, 53, 58, 61, 54, 50, 47, 50, 54, 58, 63,
+    55, 63, 58, 64, 54, 49, 60, 57, 54, 52, 49, 56, 54, 67, 62, 46,
+    59, 62, 59, 45, 57, 60, 52, 61, 59, 58, 56, 58, 64, 52, 52, 60,
+    59, 57, 56, 55, 62, 62, 49, 61, 50, 51, 60, 46, 51, 58, 65, 55,
+    62, 58, 61, 57, 54, 56, 58, 56, 60, 54, 68, 45, 44, 47, 61, 57,
+    64, 48, 42, 59, 59, 60, 54, 59, 48, 57, 53, 69, 50, 41, 53, 55,
+    74, 60, 58, 57, 50, 65, 55, 56, 52, 48, 57, 53, 61, 57, 56, 63,
+    55, 58, 59, 53, 62, 65, 47, 62, 50, 59, 59, 51, 58, 69, 57, 60,
+    53, 54, 52, 60, 47, 48, 47, 54, 58, 54, 62, 55, 54, 57, 58, 59,
+    52, 55, 57, 43, 56, 51, 60, 62, 58, 58, 52, 69, 61, 58, 54, 49,
+    54, 53, 53, 62, 45, 46, 66, 59, 58, 60, 55, 53, 54, 59, 43, 56,
+    49, 53, 64, 52, 63, 53, 58, 55, 57, 53, 55, 61, 54, 52, 49, 65,
+    52, 57, 56, 53, 52, 50, 57, 52, 56, 55, 65, 49, 47, 56, 51, 59,
+    59, 46, 51, 54, 53, 47, 47, 67, 54, 48, 60, 48, 57, 56, 67, 60,
+    55, 58, 50, 60, 57, 61, 70, 46, 56, 58, 64, 64, 60, 57, 63, 60,
+    51, 43, 50, 58, 64, 51, 69, 51, 59, 55, 59, 47, 52, 62, 58, 62,
+    63, 56, 52, 61, 55, 56, 63, 50, 66, 37, 52, 52, 62, 54, 53, 49,
+    55, 64, 60, 50, 58, 55, 59, 56, 59, 60, 61, 50, 50, 52, 51, 60,
+    51, 61, 58, 56, 48, 60, 56, 63, 49, 56, 68, 58, 54, 52, 56, 59,
+    59, 56, 62, 66, 48, 62, 53, 46, 51, 63, 48, 62, 52, 58, 48, 62,
+    59, 47, 55, 51, 49, 58, 49, 54, 43, 58, 55, 63, 53, 52, 55, 42,
+    66, 60, 44, 64, 52, 56, 57, 65, 59, 52, 55, 55, 56, 54, 53, 48,
+    58, 53, 53, 62, 53, 63, 50, 61, 51, 55, 54, 63, 62, 69, 51, 61,
+    63, 59, 57, 70, 51, 53, 66, 64, 63, 48, 51, 56, 61, 59, 48, 47,
+    58, 59, 61, 57, 53, 54, 62, 60, 54, 51, 52, 55, 64, 58, 50, 56,
+    61, 60, 47, 62, 54, 58, 52, 54, 53, 61, 52, 54, 53, 62, 47, 57,
+    38, 62, 57, 57, 57, 56, 62, 53, 56, 57, 54, 64, 57, 47, 51, 53,
+    52, 57, 58, 59, 58, 55, 53, 65, 64, 51, 57, 60, 47, 55, 64, 51,
+    63, 64, 66, 69, 48, 51, 65, 57, 53, 56, 51, 58, 53, 54, 49, 62,
+    57, 52, 55, 51, 50, 54, 52, 59, 58, 63, 51, 63, 59, 47, 47, 47,
+    64, 55, 57, 52, 57, 54, 48, 58, 50, 50, 52, 62, 55, 61, 61, 56,
+    53, 61, 48, 53, 55, 62, 55, 56, 56, 57, 57, 56, 51, 56, 55, 52,
+    50, 53, 50, 56, 53, 65, 62, 59, 54, 46, 57, 56, 55, 37, 49, 57,
+    62, 59, 54, 64, 65, 55, 51, 51, 61, 57, 48, 54, 56, 60, 48, 62,
+    55, 54, 62, 52, 54, 60, 52, 50, 54, 56, 48, 53, 58, 56, 49, 58,
+    66, 59, 52, 57, 59, 61, 62, 62, 52, 60, 59, 62, 51, 58, 55, 54,
+    51, 53, 59, 56, 52, 57, 58, 53, 52, 52, 54, 67, 50, 62, 50, 52,
+    69, 53, 55, 53, 46, 71, 53, 52, 46, 59, 47, 59, 64, 53, 55, 61,
+    44, 60, 60, 53, 51, 49, 50, 58, 57, 63, 48, 49, 60, 53, 53, 54,
+    65, 54, 57, 51, 47, 60, 56, 65, 51, 48, 57, 64, 52, 51, 58, 49,
+    50, 56, 66, 50, 49, 57, 57, 54, 55, 55, 63, 58, 55, 53, 53, 48,
+    53, 70, 56, 54, 61, 60, 59, 67, 51, 58, 58, 64, 53, 49, 55, 61,
+    58, 54, 56, 64, 55, 54, 53, 60, 54, 55, 56, 58, 50, 53, 62, 55,
+    51, 58, 55, 54, 50, 49, 56, 59, 62, 52, 54, 59, 58, 52, 60, 49,
+    54, 63, 52, 54, 58, 51, 58, 55, 55, 56, 45, 58, 55, 59, 61, 59,
+    56, 54, 58, 53, 57, 57, 51, 54, 66, 65, 63, 52, 46, 59, 49, 63,
+    49, 55, 47, 58, 53, 57, 55, 65, 59, 57, 60, 56, 58, 51, 60, 64,
+    64, 56, 48, 62, 52, 61, 47, 60, 51, 59, 51, 53, 52, 53, 50, 68,
+    50, 55, 55, 58, 60, 53, 53, 62, 58, 50, 57, 49, 53, 52, 56, 47,
+    46, 59, 65, 48, 55, 51, 57, 55, 55, 59, 56, 56, 53, 52, 57, 56,
+    45, 55, 64, 54, 65, 52, 55, 58, 58, 46, 58, 55, 56, 55, 56, 52,
+    58, 52, 59, 47, 51, 58, 69, 46, 53, 52, 53, 58, 59, 51, 61, 61,
+    46, 60, 63, 56, 52, 55, 54, 59, 62, 48, 54, 55, 60, 60, 50, 56,
+    52, 58, 57, 67, 45, 54, 56, 51, 54, 56, 65, 56, 47, 51, 64, 47,
+    54, 60, 65, 48, 49, 51, 56, 52, 50, 60, 60, 53, 55, 53, 62, 50,
+    63, 46, 58, 50, 54, 55, 63, 58, 60, 49, 48, 45, 52, 60, 63, 51,
+    47, 50, 61, 61, 45, 63, 52, 55, 58, 57, 46, 63, 54, 46, 56, 56,
+    61, 57, 59, 59, 66, 66, 49, 49, 52, 59, 57, 52, 63, 57, 56, 54,
+    54, 61, 61, 50, 60, 59, 60, 56, 55, 56, 64, 53, 58, 47, 53, 62,
+    52, 53, 65, 55, 45, 57, 60, 59, 56, 61, 57, 58, 60, 52, 64, 46,
+    53, 59, 59, 47, 51, 52, 49, 52, 54, 52, 60, 47, 45, 52, 50, 58,
+    57, 58, 57, 49, 53, 55, 58, 67, 54, 60, 50, 58, 52, 48, 62, 58,
+    57, 57, 52, 57, 59, 62, 49, 54, 53, 55, 59, 54, 53, 54, 60, 61,
+    51, 54, 54, 57, 57, 64, 44, 58, 53, 56, 49, 55, 54, 55, 52, 59,
+    57, 53, 57, 64, 48, 58, 53, 47, 48, 60, 51, 58, 59, 52, 58, 57,
+    53, 56, 54, 65, 57, 46, 56, 69, 62, 46, 49, 51, 57, 51, 56, 54,
+    65, 61, 78, 54, 50, 57, 51, 52, 53, 50, 60, 53, 55, 55, 56, 59,
+    51, 55, 57, 55, 56, 64, 48, 61, 54, 51, 53, 56, 50, 55, 63, 60,
+    55, 52, 52, 56, 50, 55, 52, 50, 51, 53, 56, 50, 66, 56, 52, 56,
+    61, 59, 61, 50, 53, 59, 58, 61, 51, 69, 59, 56, 53, 61, 46, 51,
+    50, 54, 52, 48, 59, 56, 57, 63, 56, 54, 58, 54, 59, 44, 57, 53,
+    52, 63, 45, 65, 51, 55, 55, 66, 52, 56, 50, 50, 60, 60, 53, 53,
+    56, 44, 63, 56, 55, 54, 59, 52, 56, 50, 63, 61, 63, 49, 61, 59,
+    63, 54, 49, 61, 61, 48, 64, 50, 61, 61, 52, 53, 55, 49, 49, 44,
+    49, 58, 54, 48, 58, 54, 61, 56, 53, 61, 58, 55, 53, 56, 58, 59,
+    48, 52, 57, 57, 52, 50, 45, 61, 55, 52, 54, 52, 48, 49, 50, 58,
+    63, 64, 48, 57, 56, 64, 54, 56, 57, 50, 55, 54, 63, 56, 43, 63,
+    57, 50, 60, 53, 64, 58, 62, 53, 52, 63, 57, 55, 57, 59, 57, 62,
+    56, 50, 60, 41, 60, 54, 56, 59, 57, 55, 52, 56, 53, 52, 55, 50,
+    58, 68, 53, 67, 59, 58, 56, 61, 63, 49, 61, 62, 55, 52, 51, 52,
+    49, 51, 44, 58, 61, 57, 50, 56, 52, 53, 59, 56, 55, 58, 56, 54,
+    59, 55, 52, 60, 46, 67, 61, 38, 52, 58, 53, 56, 59, 59, 52, 56,
+    58, 64, 61, 61, 57, 62, 52, 63, 49, 55, 55, 50, 60, 50, 50, 60,
+    54, 57, 53, 45, 64, 50, 62, 49, 59, 51, 56, 55, 59, 60, 56, 56,
+    71, 62, 55, 61, 62, 51, 63, 57, 56, 51, 51, 48, 56, 60, 59, 44,
+    50, 54, 61, 66, 55, 51, 57, 63, 50, 59, 57, 62, 57, 70, 59, 59,
+    53, 56, 60, 51, 60, 53, 45, 53, 64, 48, 67, 52, 52, 54, 54, 65,
+    51, 53, 60, 62, 65, 57, 55, 50, 48, 54, 48, 52, 56, 60, 56, 50,
+    48, 50, 51, 44, 63, 47, 65, 59, 54, 62, 52, 61, 64, 58, 51, 54,
+    56, 60, 57, 51, 53, 62, 48, 52, 52, 62, 51, 56, 47, 55, 57, 51,
+    57, 57, 62, 50, 52, 57, 62, 58, 58, 57, 47, 61, 55, 50, 60, 57,
+    61, 53, 64, 51, 46, 57, 64, 55, 57, 54, 55, 54, 61, 53, 65, 58,
+    59, 52, 53, 63, 56, 55, 60, 56, 46, 51, 52, 56, 58, 50, 50, 59,
+    58, 51, 60, 60, 54, 62, 55, 48, 63, 58, 46, 53, 69, 60, 55, 46,
+    61, 53, 49, 60, 52, 61, 52, 60, 48, 58, 59, 58, 60, 58, 66, 58,
+    57, 61, 43, 56, 63, 54, 64, 48, 54, 60, 45, 60, 62, 66, 54, 55,
+    38, 50, 60, 61, 54, 58, 57, 59, 58, 50, 57, 52, 52, 57, 59, 62,
+    48, 60, 49, 55, 51, 59, 62, 49, 60, 59, 55, 59, 47, 58, 54, 52,
+    47, 60, 59, 65, 63, 52, 55, 53, 53, 46, 56, 60, 51, 55, 57, 58,
+    52, 55, 52, 62, 62, 59, 55, 57, 57, 41, 49, 55, 49, 55, 57, 66,
+    55, 49, 66, 57, 69, 57, 51, 54, 60, 51, 51, 51, 50, 54, 56, 56,
+    60, 48, 61, 62, 49, 57, 53, 55, 52, 58, 51, 51, 68, 51, 44, 62,
+    51, 63, 58, 56, 62, 60, 65, 61, 60, 52, 55, 43, 65, 55, 55, 57,
+    53, 59, 49, 67, 52, 53, 58, 60, 63, 66, 61, 52, 59, 53, 39, 51,
+    49, 53, 44, 60, 55, 50, 53, 58, 53, 60, 70, 58, 51, 53, 57, 49,
+    62, 62, 53, 50, 49, 42, 49, 51, 51, 58, 60, 47, 51, 61, 60, 49,
+    50, 58, 61, 52, 64, 54, 55, 61, 58, 69, 52, 54, 60, 55, 50, 48,
+    53, 63, 47, 52, 54, 57, 58, 53, 57, 66, 48, 55, 58, 53, 55, 60,
+    59, 54, 60, 51, 52, 60, 66, 58, 53, 56, 56, 55, 59, 61, 58, 42,
+    52, 55, 62, 53, 46, 53, 56, 53, 53, 58, 65, 49, 58, 55, 54, 55,
+    53, 57, 57, 51, 52, 62, 53, 54, 58, 58, 52, 52, 54, 61, 59, 64,
+    58, 55, 51, 55, 53, 63, 54, 65, 53, 61, 54, 55, 46, 66, 49, 52,
+    67, 58, 54, 52, 58, 56, 55, 52, 58, 53, 62, 52, 69, 50, 64, 56,
+    63, 55, 54, 48, 62, 59, 53, 42, 50, 60, 53, 51, 58, 59, 55, 55,
+    58, 42, 59, 59, 58, 58, 52, 66, 62, 52, 46, 52, 47, 40, 57, 46,
+    46, 63, 50, 50, 59, 59, 67, 58, 49, 59, 48, 67, 53, 59, 51, 51,
+    53, 57, 48, 56, 64, 55, 57, 49, 58, 64, 41, 54, 58, 59, 59, 60,
+    53, 50, 55, 62, 56, 60, 57, 50, 57, 46, 50, 63, 61, 50, 56, 47,
+    64, 56, 54, 53, 60, 51, 47, 61, 58, 51, 64, 52, 50, 59, 58, 54,
+    45, 46, 60, 56, 66, 53, 61, 65, 44, 57, 60, 50, 59, 57, 61, 62,
+    55, 60, 57, 54, 62, 54, 58, 52, 53, 45, 55, 62, 58, 58, 52, 47,
+    51, 56, 56, 45, 56, 57, 59, 66, 49, 52, 48, 63, 58, 58, 64, 57,
+    53, 57, 52, 62, 50, 52, 48, 53, 65, 60, 45, 58, 57, 47, 65, 59,
+    53, 60, 59, 65, 45, 56, 58, 55, 61, 56, 56, 55, 62, 55, 64, 55,
+    53, 58, 52, 52, 44, 56, 66, 61, 55, 56, 52, 56, 52, 49, 55, 55,
+    55, 64, 57, 62, 59, 52, 53, 49, 64, 60, 52, 42, 52, 61, 57, 61,
+    65, 65, 56, 48, 65, 50, 55, 56, 42, 65, 57, 59, 58, 57, 54, 60,
+    62, 53, 50, 56, 49, 48, 52, 50, 50, 54, 58, 56, 53, 56, 52, 58,
+    66, 58, 50, 52, 60, 61, 53, 48, 61, 50, 55, 55, 53, 53, 59, 57,
+    57, 54, 53, 55, 52, 47, 61, 62, 63, 48, 55, 63, 54, 55, 54, 56,
+    48, 47, 63, 52, 56, 50, 53, 60, 58, 59, 49, 57, 62, 55, 54, 48,
+    60, 58, 50, 59, 46, 54, 58, 54, 52, 71, 52, 42, 60, 57, 63, 57,
+    65, 61, 53, 40, 55, 52, 48, 66, 53, 59, 59, 62, 56, 61, 62, 63,
+    53, 51, 49, 51, 63, 50, 36, 52, 55, 53, 57, 56, 58, 61, 63, 49,
+    61, 55, 54, 57, 45, 58, 69, 49, 55, 60, 54, 64, 60, 52, 46, 45,
+    41, 55, 48, 56, 61, 55, 58, 60, 52, 55, 52, 59, 52, 51, 50, 67,
+    48, 54, 62, 62, 60, 54, 57, 56, 47, 58, 61, 53, 59, 61, 57, 56,
+    52, 56, 54, 64, 54, 59, 51, 45, 61, 56, 56, 50, 55, 50, 66, 50,
+    47, 52, 59, 53, 60, 56, 56, 58, 48, 57, 52, 55, 57, 56, 58, 57,
+    51, 55, 54, 60, 53, 52, 55, 51, 57, 59, 60, 49, 63, 50, 50, 64,
+    56, 56, 49, 58, 43, 54, 62, 51, 45, 59, 55, 52, 54, 57, 62, 59,
+    71, 55, 57, 44, 54, 62, 50, 58, 56, 60, 48, 52, 66, 46, 68, 59,
+    51, 47, 64, 49, 57, 57, 58, 52, 58, 61, 62, 63, 46, 56, 57, 52,
+    55, 49, 61, 57, 50, 55, 65, 56, 54, 57, 63, 48, 56, 62, 47, 53,
+    61, 56, 53, 55, 53, 72, 53, 51, 57, 61, 47, 61, 57, 51, 49, 59,
+    55, 51, 59, 49, 63, 57, 61, 53, 61, 56, 55, 53, 58, 54, 52, 56,
+    52, 46, 47, 57, 56, 61, 52, 51, 63, 66, 52, 54, 52, 59, 48, 52,
+    64, 49, 59, 60, 47, 57, 58, 56, 58, 52, 62, 63, 54, 47, 55, 59,
+    55, 62, 54, 45, 59, 53, 56, 59, 50, 51, 61, 56, 41, 55, 52, 55,
+    50, 62, 61, 52, 51, 56, 51, 69, 61, 48, 51, 48, 57, 58, 55, 56,
+    59, 46, 53, 62, 56, 46, 59, 53, 60, 54, 55, 60, 56, 56, 55, 54,
+    63, 63, 41, 48, 53, 68, 49, 56, 55, 62, 50, 61, 47, 58, 57, 44,
+    47, 57, 46, 58, 53, 62, 57, 49, 47, 61, 55, 55, 61, 54, 60, 54,
+    48, 58, 49, 51, 50, 64, 67, 51, 57, 57, 53, 54, 66, 55, 62, 63,
+    52, 47, 60, 57, 51, 59, 57, 51, 46, 66, 61, 69, 46, 53, 62, 51,
+    62, 52, 59, 43, 62, 49, 55, 56, 53, 58, 57, 54, 56, 59, 55, 46,
+    58, 42, 63, 52, 53, 53, 58, 55, 48, 58, 62, 50, 55, 53, 47, 42,
+    58, 56, 50, 58, 57, 69, 54, 63, 62, 60, 52, 48, 61, 54, 64, 57,
+    56, 62, 58, 54, 54, 53, 62, 54, 51, 54, 60, 46, 56, 61, 63, 57,
+    54, 51, 55, 63, 56, 61, 61, 58, 60, 52, 49, 48, 67, 52, 64, 62,
+    50, 56, 53, 54, 51, 55, 57, 57, 55, 54, 60, 52, 57, 61, 62, 48,
+    46, 51, 51, 53, 56, 56, 54, 46, 61, 66, 45, 62, 61, 55, 51, 58,
+    47, 62, 54, 59, 42, 55, 55, 51, 38, 48, 61, 58, 58, 57, 54, 51,
+    52, 59, 56, 59, 58, 54, 48, 50, 64, 54, 56, 55, 45, 54, 62, 64,
+    49, 57, 58, 62, 51, 56, 57, 63, 65, 54, 47, 55, 55, 54, 58, 52,
+    60, 58, 59, 59, 50, 52, 58, 51, 61, 59, 61, 53, 51, 50, 54, 52,
+    61, 51, 61, 63, 60, 49, 55, 50, 52, 54, 54, 54, 58, 55, 60, 56,
+    48, 59, 61, 60, 52, 50, 42, 54, 54, 62, 55, 63, 50, 47, 53, 50,
+    55, 56, 66, 56, 46, 52, 60, 55, 55, 53, 64, 61, 53, 59, 48, 53,
+    64, 61, 53, 44, 52, 50, 55, 58, 51, 60, 51, 64, 55, 60, 53, 54,
+    60, 59, 58, 55, 55, 51, 60, 67, 52, 58, 60, 58, 56, 54, 54, 49,
+    60, 52, 46, 50, 52, 55, 58, 51, 62, 56, 52, 57, 59, 56, 57, 43,
+    45, 54, 51, 60, 64, 63, 56, 52, 48, 60, 63, 60, 44, 62, 50, 51,
+    57, 60, 46, 57, 65, 68, 61, 58, 57, 56, 56, 53, 61, 47, 54, 53,
+    54, 57, 51, 58, 48, 60, 53, 61, 56, 55, 54, 64, 54, 46, 48, 57,
+    64, 49, 57, 51, 56, 52, 46, 55, 57, 64, 55, 47, 49, 61, 52, 51,
+    52, 62, 54, 48, 51, 47, 62, 69, 52, 55, 60, 57, 63, 54, 58, 58,
+    51, 58, 57, 54, 62, 51, 59, 49, 66, 48, 50, 65, 47, 52, 57, 51,
+    56, 55, 58, 44, 55, 60, 55, 67, 53, 52, 67, 60, 64, 58, 50, 49,
+    41, 45, 61, 56, 44, 55, 64, 46, 51, 59, 51, 49, 49, 57, 59, 50,
+    46, 64, 59, 48, 48, 69, 44, 51, 67, 48, 41, 57, 57, 58, 59, 59,
+    45, 68, 54, 56, 61, 57, 64, 58, 55, 51, 61, 51, 60, 58, 49, 52,
+    56, 57, 54, 57, 52, 51, 58, 57, 55, 60, 51, 49, 60, 64, 54, 66,
+    57, 48, 61, 48, 55, 70, 55, 51, 58, 51, 59, 53, 59, 55, 53, 53,
+    59, 53, 57, 59, 59, 66, 51, 62, 59, 54, 50, 49, 56, 53, 64, 54,
+    59, 54, 58, 57, 60, 44, 52, 48, 55, 56, 56, 44, 53, 55, 54, 56,
+    61, 59, 54, 54, 50, 65, 44, 52, 57, 47, 60, 59, 55, 52, 60, 57,
+    62, 52, 53, 58, 55, 55, 49, 50, 49, 51, 58, 44, 51, 65, 57, 58,
+    53, 55, 57, 54, 61, 53, 56, 52, 60, 55, 54, 60, 53, 53, 62, 50,
+    58, 54, 51, 61, 59, 49, 45, 58, 55, 61, 50, 54, 60, 61, 75, 47,
+    55, 54, 54, 53, 58, 66, 57, 61, 50, 54, 58, 47, 54, 52, 62, 53,
+    62, 55, 65, 64, 54, 59, 53, 53, 57, 66, 52, 56, 51, 52, 63, 65,
+    56, 58, 57, 55, 70, 51, 47, 54, 66, 52, 57, 49, 48, 57, 55, 41,
+    56, 47, 52, 52, 57, 52, 57, 42, 60, 55, 51, 63, 53, 56, 50, 58,
+    59, 50, 56, 61, 53, 57, 56, 55, 48, 66, 62, 56, 58, 49, 57, 56,
+    61, 56, 52, 53, 51, 61, 57, 56, 53, 50, 51, 52, 56, 62, 61, 63,
+    48, 54, 51, 67, 53, 56, 53, 60, 50, 55, 54, 54, 56, 52, 60, 55,
+    53, 55, 56, 61, 51, 47, 46, 56, 58, 63, 55, 70, 52, 54, 48, 49,
+    59, 55, 38, 51, 58, 57, 60, 58, 54, 56, 60, 54, 52, 58, 62, 52,
+    53, 57, 59, 50, 59, 54, 57, 59, 62, 62, 57, 51, 56, 67, 56, 53,
+    57, 61, 46, 60, 53, 50, 53, 53, 54, 56, 55, 47, 54, 55, 48, 53,
+    57, 49, 57, 53, 56, 56, 46, 59, 55, 56, 58, 60, 45, 57, 51, 62,
+    55, 62, 60, 51, 58, 67, 53, 54, 51, 62, 57, 45, 47, 58, 58, 53,
+    53, 51, 58, 55, 53, 52, 56, 57, 55, 56, 51, 55, 62, 54, 47, 63,
+    58, 57, 51, 57, 52, 55, 64, 52, 57, 53, 57, 61, 59, 62, 44, 49,
+    51, 58, 55, 52, 57, 68, 54, 48, 54, 61, 58, 43, 50, 55, 49, 58,
+    47, 49, 53, 50, 60, 65, 46, 53, 56, 58, 57, 54, 45, 52, 45, 59,
+    50, 64, 55, 58, 49, 56, 62, 70, 43, 53, 61, 48, 52, 50, 62, 45,
+    55, 48, 46, 51, 57, 55, 67, 50, 60, 54, 58, 54, 57, 51, 62, 61,
+    67, 65, 41, 53, 64, 55, 47, 61, 50, 61, 57, 49, 57, 61, 53, 51,
+    57, 53, 57, 56, 58, 52, 61, 65, 56, 51, 49, 59, 53, 52, 61, 49,
+    58, 56, 55, 50, 63, 56, 53, 55, 61, 50, 54, 62, 47, 57, 49, 64,
+    61, 57, 58, 52, 65, 53, 62, 50, 58, 67, 47, 55, 55, 50, 54, 55,
+    50, 55, 59, 46, 64, 54, 64, 67, 59, 51, 63, 51, 55, 59, 59, 56,
+    65, 53, 44, 58, 65, 60, 48, 59, 57, 50, 49, 55, 57, 49, 59, 54,
+    64, 48, 56, 57, 54, 55, 56, 58, 59, 52, 61, 52, 56, 61, 57, 66,
+    66, 56, 55, 55, 56, 52, 57, 58, 65, 62, 51, 61, 56, 57, 58, 56,
+    48, 56, 52, 58, 59, 60, 57, 57, 54, 53, 51, 56, 48, 55, 55, 54,
+    47, 59, 53, 52, 45, 52, 56, 54, 60, 56, 58, 60, 61, 62, 54, 56,
+    60, 56, 63, 49, 65, 55, 56, 57, 58, 60, 50, 55, 49, 60, 58, 50,
+    61, 60, 63, 49, 52, 47, 54, 51, 59, 62, 66, 49, 62, 56, 57, 58,
+    48, 48, 63, 53, 61, 55, 56, 63, 52, 52, 37, 52, 59, 51, 61, 57,
+    65, 54, 56, 57, 53, 50, 52, 59, 44, 58, 60, 59, 62, 54, 53, 54,
+    61, 61, 52, 58, 60, 52, 50, 56, 52, 52, 53, 55, 49, 65, 53, 64,
+    47, 65, 54, 44, 61, 56, 52, 56, 58, 59, 54, 67, 50, 56, 60, 53,
+    50, 54, 67, 59, 59, 55, 49, 43, 69, 48, 49, 55, 64, 52, 49, 63,
+    58, 55, 57, 62, 64, 49, 64, 50, 51, 58, 57, 62, 61, 56, 60, 64,
+    51, 56, 57, 57, 56, 49, 58, 63, 49, 59, 53, 46, 70, 60, 55, 60,
+    53, 54, 57, 45, 45, 53, 49, 63, 50, 61, 51, 42, 53, 61, 52, 54,
+    57, 52, 60, 58, 42, 64, 64, 47, 64, 54, 45, 55, 57, 56, 48, 52,
+    52, 65, 61, 57, 43, 53, 59, 61, 58, 56, 56, 56, 54, 52, 52, 49,
+    53, 57, 60, 60, 56, 56, 57, 56, 56, 51, 53, 60, 58, 61, 53, 56,
+    60, 47, 52, 62, 60, 58, 54, 51, 56, 52, 59, 65, 43, 49, 69, 58,
+    62, 52, 60, 60, 56, 54, 53, 55, 61, 54, 46, 49, 50, 63, 63, 53,
+    66, 58, 56, 63, 57, 49, 56, 48, 50, 56, 52, 56, 52, 59, 59, 54,
+    56, 60, 57, 60, 54, 60, 70, 47, 51, 66, 58, 50, 54, 41, 58, 60,
+    56, 49, 58, 46, 49, 70, 56, 55, 64, 44, 63, 56, 51, 57, 48, 62,
+    51, 66, 53, 50, 55, 55, 52, 53, 53, 51, 51, 61, 57, 56, 52, 58,
+    59, 53, 58, 47, 60, 48, 65, 61, 62, 63, 69, 60, 53, 50, 53, 58,
+    57, 56, 53, 59, 62, 47, 52, 61, 50, 55, 65, 42, 59, 57, 58, 57,
+    49, 45, 61, 56, 64, 55, 57, 61, 46, 60, 46, 58, 48, 60, 62, 54,
+    57, 54, 56, 54, 56, 51, 47, 56, 56, 51, 60, 56, 50, 59, 57, 56,
+    51, 56, 47, 51, 45, 59, 54, 51, 57, 59, 50, 51, 63, 54, 63, 63,
+    49, 62, 63, 54, 60, 56, 51, 71, 53, 52, 51, 60, 61, 57, 55, 57,
+    46, 48, 55, 61, 61, 60, 55, 53, 60, 55, 48, 53, 56, 59, 43, 58,
+    56, 43, 54, 55, 47, 56, 53, 57, 54, 56, 55, 64, 51, 51, 54, 66,
+    66, 48, 54, 52, 55, 53, 55, 56, 55, 58, 50, 56, 46, 60, 54, 59,
+    55, 62, 57, 53, 50, 45, 57, 52, 59, 51, 58, 52, 43, 57, 55, 64,
+    58, 53, 58, 54, 50, 66, 63, 50, 57, 58, 55, 48, 56, 51, 57, 54,
+    52, 58, 50, 61, 48, 60, 55, 55, 60, 64, 51, 53, 45, 59, 56, 57,
+    50, 50, 57, 58, 63, 54, 56, 60, 63, 51, 57, 63, 61, 46, 51, 60,
+    48, 52, 43, 65, 49, 48, 48, 65, 64, 46, 56, 48, 58, 62, 42, 61,
+    44, 56, 54, 53, 64, 52, 51, 50, 60, 60, 55, 45, 43, 51, 56, 42,
+    70, 63, 49, 56, 54, 59, 47, 56, 45, 65, 60, 54, 60, 62, 56, 58,
+    50, 57, 52, 50, 61, 53, 50, 48, 45, 68, 56, 58, 47, 65, 64, 61,
+    59, 53, 47, 58, 63, 47, 52, 64, 53, 51, 61, 48, 63, 52, 56, 51,
+    59, 46, 52, 50, 58, 68, 57, 55, 53, 51, 53, 60, 61, 59, 49, 57,
+    56, 64, 55, 44, 51, 56, 59, 64, 53, 52, 50, 56, 55, 51, 53, 59,
+    61, 58, 54, 50, 70, 55, 53, 52, 43, 55, 48, 52, 60, 43, 58, 56,
+    51, 43, 60, 57, 52, 65, 65, 56, 58, 54, 50, 55, 57, 58, 58, 64,
+    57, 60, 58, 57, 52, 59, 52, 52, 55, 62, 56, 52, 50, 53, 57, 57,
+    53, 59, 51, 55, 50, 67, 63, 54, 43, 67, 50, 42, 56, 60, 50, 47,
+    54, 62, 57, 54, 56, 70, 58, 46, 37, 53, 68, 49, 58, 57, 59, 59,
+    59, 57, 47, 55, 52, 49, 63, 58, 51, 52, 56, 49, 51, 56, 55, 57,
+    56, 54, 53, 60, 59, 59, 54, 54, 54, 62, 59, 60, 52, 62, 59, 64,
+    55, 59, 56, 60, 51, 54, 48, 56, 54, 62, 59, 59, 52, 46, 58, 57,
+    53, 64, 64, 52, 52, 51, 62, 55, 56, 47, 52, 48, 53, 52, 65, 46,
+    49, 53, 46, 55, 51, 58, 55, 52, 40, 55, 61, 60, 57, 55, 72, 54,
+    48, 55, 60, 55, 53, 65, 61, 58, 57, 54, 57, 48, 50, 57, 57, 54,
+    54, 57, 58, 60, 63, 57, 55, 66, 63, 56, 52, 52, 57, 55, 51, 55,
+    56, 58, 57, 63, 55, 46, 51, 67, 54, 54, 56, 52, 53, 56, 49, 69,
+    62, 43, 49, 51, 46, 62, 49, 59, 52, 57, 67, 49, 53, 59, 58, 52,
+    54, 59, 66, 57, 51, 62, 53, 68, 48, 57, 59, 61, 49, 61, 54, 53,
+    55, 54, 56, 57, 60, 65, 50, 53, 61, 59, 51, 54, 54, 45, 60, 51,
+    46, 59, 65, 51, 57, 62, 48, 52, 55, 56, 59, 54, 59, 49, 58, 54,
+    51, 54, 55, 56, 50, 58, 50, 56, 58, 61, 61, 49, 56, 50, 50, 62,
+    61, 57, 55, 59, 61, 53, 54, 58, 60, 53, 43, 60, 55, 52, 58, 60,
+    50, 54, 59, 57, 56, 43, 57, 57, 55, 51, 65, 52, 55, 40, 53, 56,
+    60, 53, 53, 57, 59, 57, 65, 55, 47, 59, 47, 58, 54, 56, 63, 56,
+    55, 54, 59, 63, 56, 61, 56, 62, 59, 50, 52, 54, 59, 48, 52, 63,
+    55, 61, 64, 51, 57, 54, 58, 56, 56, 51, 63, 58, 51, 57, 51, 60,
+    62, 58, 64, 58, 53, 47, 58, 55, 54, 54, 61, 57, 56, 53, 60, 52,
+    52, 44, 57, 54, 51, 62, 58, 58, 48, 56, 44, 54, 51, 53, 52, 46,
+    55, 61, 67, 57, 58, 58, 66, 61, 50, 54, 53, 61, 54, 63, 49, 54,
+    57, 52, 61, 56, 57, 58, 50, 60, 64, 63, 57, 59, 61, 52, 53, 63,
+    63, 51, 57, 52, 65, 54, 49, 52, 53, 54, 55, 51, 66, 55, 54, 45,
+    47, 50, 51, 49, 53, 58, 61, 56, 60, 50, 52, 46, 55, 63, 58, 61,
+    62, 54, 56, 51, 54, 57, 46, 50, 58, 60, 54, 54, 60, 63, 51, 53,
+    61, 55, 67, 56, 54, 56, 53, 56, 58, 63, 56, 57, 53, 56, 53, 47,
+    50, 52, 71, 41, 53, 48, 54, 58, 54, 62, 58, 50, 58, 68, 55, 58,
+    60, 54, 59, 53, 55, 55, 51, 55, 51, 66, 44, 63, 57, 54, 44, 54,
+    52, 53, 53, 48, 68, 72, 60, 47, 60, 57, 67, 58, 58, 57, 56, 61,
+    58, 50, 47, 59, 50, 53, 51, 58, 64, 50, 53, 54, 48, 52, 60, 52,
+    50, 57, 48, 49, 60, 47, 55, 49, 54, 42, 47, 69, 55, 47, 56, 51,
+    48, 53, 42, 52, 54, 59, 52, 53, 58, 55, 56, 53, 55, 54, 63, 63,
+    54, 57, 62, 54, 55, 52, 57, 54, 51, 47, 55, 56, 62, 48, 52, 62,
+    50, 59, 66, 63, 53, 53, 60, 55, 54, 63, 49, 56, 56, 50, 54, 62,
+    52, 52, 51, 53, 51, 54, 55, 59, 45, 54, 52, 59, 56, 54, 60, 51,
+    42, 65, 53, 61, 54, 54, 59, 60, 49, 61, 55, 55, 52, 61, 58, 51,
+    56, 59, 57, 53, 52, 66, 57, 55, 62, 59, 60, 54, 58, 65, 45, 58,
+    58, 60, 46, 47, 54, 54, 65, 50, 47, 53, 54, 65, 56, 60, 58, 60,
+    64, 54, 51, 63, 52, 51, 57, 50, 62, 56, 41, 54, 42, 52, 52, 50,
+    52, 48, 60, 56, 54, 58, 51, 51, 52, 46, 51, 54, 66, 53, 56, 59,
+    45, 56, 61, 52, 56, 54, 55, 57, 48, 60, 50, 59, 51, 54, 52, 54,
+    54, 57, 62, 57, 51, 48, 62, 57, 49, 53, 56, 65, 56, 59, 48, 53,
+    54, 47, 60, 53, 61, 48, 55, 59, 69, 45, 54, 62, 50, 49, 51, 53,
+    68, 56, 60, 53, 58, 50, 55, 59, 48, 53, 57, 52, 47, 55, 49, 56,
+    59, 58, 55, 63, 60, 58, 54, 49, 56, 50, 66, 55, 54, 55, 57, 68,
+    59, 48, 52, 59, 52, 59, 57, 54, 61, 52, 49, 50, 65, 56, 59, 62,
+    48, 51, 49, 50, 50, 53, 57, 53, 72, 52, 58, 47, 48, 55, 55, 62,
+    70, 56, 60, 48, 56, 49, 58, 55, 40, 50, 65, 50, 55, 66, 52, 54,
+    43, 53, 63, 59, 56, 69, 51, 45, 57, 60, 47, 53, 66, 52, 54, 55,
+    49, 53, 61, 57, 59, 57, 61, 59, 56, 50, 62, 56, 56, 59, 51, 60,
+    55, 62, 51, 49, 56, 51, 61, 57, 60, 47, 58, 46, 49, 62, 52, 62,
+    61, 51, 57, 62, 58, 55, 49, 58, 63, 60, 46, 46, 57, 63, 66, 50,
+    50, 59, 46, 60, 54, 54, 52, 53, 56, 62, 48, 57, 59, 56, 56, 62,
+    55, 47, 53, 49, 56, 60, 46, 57, 57, 54, 46, 59, 60, 54, 50, 56,
+    54, 61, 59, 63, 54, 61, 50, 64, 56, 55, 57, 57, 55, 56, 57, 50,
+    57, 55, 58, 58, 44, 52, 61, 51, 58, 56, 45, 62, 48, 49, 45, 64,
+    59, 52, 41, 47, 53, 56, 57, 56, 52, 56, 61, 57, 50, 51, 60, 61,
+    54, 61, 55, 49, 59, 56, 58, 64, 48, 55, 53, 49, 52, 60, 62, 62,
+    50, 48, 59, 53, 63, 49, 55, 53, 63, 64, 64, 48, 57, 57, 54, 68,
+    52, 52, 57, 66, 45, 51, 50, 62, 53, 50, 71, 50, 57, 57, 54, 55,
+    56, 58, 56, 48, 49, 68, 59, 49, 51, 48, 50, 59, 48, 52, 55, 54,
+    57, 57, 57, 62, 59, 58, 60, 50, 60, 53, 54, 63, 62, 64, 46, 55,
+    54, 66, 55, 59, 55, 50, 57, 60, 66, 56, 53, 54, 65, 57, 42, 52,
+    66, 54, 46, 52, 48, 53, 55, 57, 48, 56, 51, 56, 51, 52, 51, 71,
+    50, 56, 51, 71, 49, 50, 51, 46, 55, 56, 43, 52, 51, 56, 51, 56,
+    57, 58, 57, 59, 45, 61, 60, 53, 64, 56, 59, 47, 53, 64, 57, 46,
+    62, 59, 55, 55, 59, 52, 51, 58, 47, 52, 61, 60, 51, 58, 54, 54,
+    63, 53, 49, 57, 60, 55, 63, 60, 48, 57, 59, 56, 59, 62, 51, 62,
+    49, 55, 57, 58, 60, 59, 55, 53, 64, 45, 53, 55, 56, 60, 47, 46,
+    53, 54, 58, 54, 55, 54, 64, 49, 56, 47, 62, 49, 59, 56, 61, 54,
+    50, 53, 62, 50, 61, 56, 62, 58, 58, 48, 57, 61, 57, 53, 57, 61,
+    57, 54, 49, 52, 59, 49, 51, 56, 44, 69, 52, 50, 58, 54, 55, 60,
+    55, 54, 54, 57, 56, 52, 63, 55, 49, 58, 52, 51, 59, 54, 63, 54,
+    50, 53, 68, 48, 55, 59, 59, 50, 57, 61, 47, 51, 55, 60, 55, 61,
+    48, 47, 55, 58, 50, 48, 50, 49, 55, 53, 52, 63, 53, 61, 58, 60,
+    54, 53, 55, 57, 59, 51, 60, 56, 63, 55, 58, 54, 51, 61, 53, 48,
+    51, 50, 51, 60, 54, 68, 48, 59, 58, 50, 69, 56, 50, 60, 58, 45,
+    52, 54, 60, 57, 57, 53, 59, 62, 52, 50, 59, 45, 61, 58, 49, 58,
+    52, 47, 59, 53, 50, 49, 51, 59, 66, 57, 58, 60, 59, 59, 62, 59,
+    49, 65, 46, 60, 51, 59, 53, 56, 71, 54, 54, 58, 61, 59, 51, 56,
+    50, 47, 64, 59, 64, 58, 51, 60, 57, 58, 65, 51, 59, 52, 48, 53,
+    64, 57, 55, 65, 59, 41, 65, 54, 56, 60, 57, 58, 65, 52, 61, 59,
+    56, 55, 62, 51, 51, 54, 55, 56, 56, 49, 52, 54, 64, 62, 52, 54,
+    52, 51, 60, 48, 61, 52, 57, 58, 59, 63, 52, 63, 50, 64, 55, 56,
+    52, 47, 45, 56, 49, 50, 60, 57, 44, 54, 57, 54, 54, 49, 49, 48,
+    68, 63, 53, 64, 56, 59, 51, 58, 65, 58, 51, 62, 57, 68, 43, 45,
+    55, 58, 55, 55, 50, 63, 64, 57, 60, 51, 54, 52, 54, 50, 67, 51,
+    53, 55, 48, 44, 51, 67, 51, 59, 52, 50, 57, 65, 51, 67, 55, 53,
+    59, 55, 58, 53, 53, 55, 56, 61, 52, 59, 54, 61, 48, 58, 45, 58,
+    58, 59, 52, 49, 61, 47, 55, 54, 55, 57, 55, 52, 67, 57, 46, 57,
+    51, 56, 62, 57, 59, 53, 54, 61, 59, 65, 50, 61, 56, 58, 50, 65,
+    53, 50, 60, 54, 57, 58, 55, 53, 58, 58, 52, 60, 65, 53, 51, 57,
+    52, 54, 56, 54, 57, 58, 62, 58, 56, 45, 54, 56, 50, 54, 61, 50,
+    59, 45, 50, 53, 54, 58, 50, 49, 51, 66, 61, 53, 59, 55, 52, 67,
+    58, 54, 45, 62, 52, 46, 53, 57, 63, 61, 64, 55, 47, 48, 59, 53,
+    60, 55, 57, 54, 54, 51, 44, 61, 54, 49, 54, 58, 54, 50, 66, 49,
+    62, 60, 57, 49, 68, 50, 57, 58, 59, 52, 55, 59, 44, 55, 66, 53,
+    49, 44, 58, 60, 60, 49, 49, 48, 53, 58, 56, 56, 52, 57, 39, 51,
+    51, 57, 55, 51, 51, 61, 61, 53, 51, 49, 53, 59, 54, 58, 54, 55,
+    60, 60, 53, 45, 61, 61, 50, 57, 52, 64, 54, 55, 52, 62, 55, 59,
+    51, 61, 56, 63, 56, 57, 60, 65, 51, 54, 50, 45, 42, 58, 58, 61,
+    46, 57, 52, 56, 49, 51, 59, 49, 51, 50, 50, 55, 43, 45, 49, 45,
+    58, 50, 54, 54, 59, 54, 52, 59, 52, 58, 50, 59, 53, 61, 51, 61,
+    54, 53, 49, 58, 45, 59, 60, 59, 68, 57, 56, 58, 48, 56, 48, 59,
+    57, 47, 57, 59, 59, 57, 53, 53, 61, 58, 48, 69, 53, 59, 54, 51,
+    66, 56, 62, 59, 47, 56, 45, 48, 57, 56, 48, 55, 50, 55, 58, 60,
+    58, 65, 49, 58, 62, 57, 51, 66, 58, 52, 55, 62, 51, 54, 57, 55,
+    58, 57, 61, 42, 48, 54, 56, 55, 61, 49, 57, 46, 59, 66, 55, 62,
+    57, 64, 55, 53, 49, 61, 59, 45, 51, 54, 56, 64, 52, 61, 47, 62,
+    52, 57, 45, 47, 69, 53, 59, 45, 43, 70, 59, 52, 58, 59, 56, 61,
+    55, 56, 51, 56, 60, 50, 54, 60, 54, 52, 54, 64, 51, 48, 64, 66,
+    57, 47, 47, 58, 57, 59, 62, 61, 55, 65, 44, 54, 63, 53, 50, 60,
+    55, 46, 50, 48, 56, 47, 53, 52, 64, 54, 54, 59, 57, 55, 58, 54,
+    48, 60, 58, 55, 57, 57, 49, 46, 57, 56, 51, 44, 50, 57, 59, 59,
+    55, 62, 62, 64, 54, 56, 52, 51, 62, 46, 56, 48, 64, 49, 56, 53,
+    51, 56, 59, 52, 51, 50, 54, 52, 49, 52, 60, 51, 60, 48, 71, 52,
+    52, 50, 66, 48, 65, 49, 57, 52, 50, 51, 62, 61, 61, 52, 61, 58,
+    55, 52, 50, 55, 61, 53, 50, 52, 43, 48, 64, 61, 54, 56, 64, 63,
+    49, 51, 61, 65, 48, 49, 49, 58, 62, 62, 55, 57, 68, 56, 54, 53,
+    58, 53, 60, 55, 62, 63, 53, 57, 48, 59, 49, 44, 56, 49, 54, 63,
+    52, 60, 50, 63, 65, 61, 62, 44, 59, 58, 50, 48, 48, 61, 54, 56,
+    70, 53, 57, 47, 55, 60, 55, 61, 58, 53, 66, 60, 51, 64, 59, 52,
+    51, 52, 57, 58, 45, 52, 56, 62, 64, 55, 51, 57, 48, 54, 54, 54,
+    64, 49, 58, 49, 59, 55, 54, 67, 55, 53, 48, 55, 62, 60, 59, 60,
+    53, 50, 59, 59, 54, 58, 51, 51, 59, 47, 46, 55, 61, 53, 63, 60,
+    53, 59, 51, 54, 58, 63, 58, 64, 49, 51, 55, 52, 55, 58, 59, 47,
+    45, 51, 57, 63, 57, 49, 59, 65, 52, 51, 44, 63, 62, 63, 55, 61,
+    66, 56, 45, 57, 53, 50, 64, 60, 60, 52, 57, 60, 54, 65, 56, 47,
+    51, 53, 47, 59, 64, 56, 61, 57, 69, 59, 56, 51, 58, 56, 51, 54,
+    67, 63, 54, 62, 45, 61, 58, 62, 54, 54, 53, 55, 58, 58, 70, 50,
+    54, 54, 54, 62, 50, 58, 54, 49, 57, 56, 45, 59, 51, 54, 63, 49,
+    48, 46, 60, 63, 52, 55, 53, 53, 62, 58, 58, 49, 51, 57, 55, 61,
+    49, 49, 62, 61, 51, 48, 66, 56, 65, 48, 56, 55, 56, 60, 46, 60,
+    54, 56, 52, 61, 56, 62, 54, 54, 53, 57, 57, 55, 53, 56, 62, 57,
+    49, 63, 58, 58, 54, 58, 56, 55, 62, 61, 50, 63, 63, 58, 50, 56,
+    44, 61, 58, 51, 47, 62, 53, 51, 47, 58, 53, 61, 60, 66, 59, 55,
+    56, 63, 55, 49, 45, 56, 55, 50, 54, 61, 57, 59, 52, 54, 63, 45,
+    60, 52, 55, 49, 61, 55, 50, 61, 61, 48, 60, 50, 52, 54, 55, 58,
+    49, 54, 50, 51, 65, 60, 59, 59, 61, 56, 51, 59, 52, 44, 57, 57,
+    50, 52, 47, 53, 55, 50, 59, 55, 61, 62, 61, 51, 49, 57, 59, 52,
+    59, 58, 54, 55, 51, 50, 55, 57, 63, 46, 54, 52, 61, 61, 58, 54,
+    57, 59, 53, 54, 48, 60, 59, 66, 58, 54, 48, 51, 51, 58, 57, 53,
+    68, 48, 67, 48, 54, 51, 46, 50, 52, 48, 58, 53, 59, 56, 56, 60,
+    53, 55, 57, 49, 62, 61, 53, 57, 49, 44, 59, 56, 69, 60, 50, 54,
+    59, 58, 47, 45, 60, 55, 50, 52, 51, 57, 44, 57, 54, 58, 46, 63,
+    58, 56, 55, 56, 68, 55, 51, 53, 56, 55, 47, 49, 53, 53, 55, 59,
+    59, 52, 63, 56, 48, 55, 62, 57, 55, 58, 54, 55, 56, 45, 60, 46,
+    58, 52, 46, 59, 57, 52, 58, 52, 63, 58, 54, 52, 47, 52, 56, 54,
+    53, 58, 57, 66, 48, 56, 59, 49, 56, 58, 50, 54, 55, 61, 54, 59,
+    58, 51, 63, 58, 63, 57, 63, 57, 62, 60, 48, 59, 59, 55, 49, 43,
+    63, 64, 45, 60, 54, 48, 51, 50, 53, 62, 57, 62, 71, 67, 61, 70,
+    51, 55, 55, 54, 51, 49, 45, 51, 51, 54, 55, 59, 60, 57, 44, 49,
+    68, 58, 56, 49, 55, 56, 55, 59, 49, 54, 64, 49, 50, 53, 45, 56,
+    57, 57, 55, 53, 57, 43, 51, 46, 57, 49, 52, 60, 60, 48, 59, 67,
+    50, 47, 64, 56, 54, 43, 65, 61, 56, 50, 46, 61, 56, 66, 58, 55,
+    51, 50, 55, 64, 52, 53, 59, 57, 46, 54, 54, 48, 60, 50, 51, 58,
+    47, 56, 48, 59, 62, 67, 45, 57, 51, 60, 52, 58, 51, 56, 48, 62,
+    52, 49, 60, 45, 59, 68, 55, 57, 49, 54, 54, 50, 60, 58, 56, 56,
+    39, 52, 62, 58, 48, 61, 56, 64, 51, 52, 53, 49, 53, 62, 57, 64,
+    55, 62, 65, 64, 51, 51, 52, 57, 59, 48, 51, 60, 51, 55, 48, 51,
+    70, 65, 54, 50, 57, 60, 58, 52, 64, 62, 63, 54, 55, 50, 51, 58,
+    49, 55, 56, 58, 63, 53, 53, 56, 48, 52, 50, 58, 57, 53, 61, 44,
+    49, 52, 61, 59, 60, 61, 44, 61, 55, 53, 55, 59, 70, 51, 53, 55,
+    65, 51, 56, 47, 43, 52, 55, 53, 50, 49, 45, 52, 54, 57, 48, 51,
+    52, 51, 58, 60, 50, 57, 62, 59, 61, 48, 49, 58, 53, 58, 43, 59,
+    57, 53, 52, 57, 52, 50, 57, 58, 55, 57, 59, 50, 58, 60, 64, 49,
+    58, 60, 56, 60, 59, 52, 60, 61, 63, 53, 52, 66, 54, 50, 64, 58,
+    55, 56, 62, 44, 58, 61, 58, 61, 52, 51, 56, 53, 52, 53, 55, 61,
+    48, 57, 57, 56, 50, 61, 61, 60, 56, 47, 55, 50, 60, 55, 66, 58,
+    62, 57, 55, 54, 56, 55, 58, 59, 54, 57, 49, 66, 41, 46, 58, 52,
+    50, 60, 62, 51, 60, 46, 58, 57, 53, 54, 46, 56, 52, 60, 57, 60,
+    58, 59, 55, 56, 61, 58, 60, 49, 58, 48, 58, 50, 48, 53, 52, 57,
+    58, 67, 53, 53, 62, 55, 56, 51, 53, 56, 59, 60, 56, 54, 55, 58,
+    48, 60, 57, 60, 51, 48, 57, 61, 50, 47, 59, 60, 56, 49, 50, 61,
+    59, 60, 48, 63, 51, 58, 56, 52, 56, 52, 59, 59, 58, 53, 58, 59,
+    51, 62, 51, 61, 50, 61, 52, 52, 63, 40, 52, 61, 50, 46, 62, 53,
+    59, 55, 61, 55, 59, 55, 54, 55, 58, 49, 51, 60, 50, 52, 60, 47,
+    62, 66, 59, 58, 53, 46, 56, 56, 57, 63, 54, 57, 52, 52, 58, 61,
+    49, 54, 58, 58, 59, 62, 56, 63, 57, 44, 50, 58, 56, 51, 62, 53,
+    51, 61, 50, 48, 58, 60, 49, 42, 59, 58, 69, 53, 55, 56, 69, 53,
+    48, 52, 53, 39, 64, 59, 49, 59, 57, 64, 50, 59, 62, 57, 55, 62,
+    66, 41, 54, 64, 56, 58, 52, 60, 48, 52, 55, 62, 53, 60, 55, 54,
+    51, 53, 58, 56, 62, 45, 55, 52, 49, 52, 55, 53, 55, 56, 52, 60,
+    53, 52, 60, 63, 57, 44, 57, 67, 52, 57, 52, 54, 55, 58, 57, 51,
+    51, 51, 52, 69, 57, 45, 56, 54, 50, 56, 53, 57, 54, 63, 60, 52,
+    56, 51, 58, 56, 55, 58, 48, 58, 63, 47, 56, 44, 50, 67, 50, 50,
+    50, 58, 57, 45, 54, 58, 55, 51, 63, 50, 58, 60, 53, 53, 60, 51,
+    56, 58, 55, 52, 44, 58, 58, 62, 58, 50, 54, 61, 53, 63, 57, 41,
+    47, 65, 60, 45, 56, 57, 53, 62, 52, 54, 52, 52, 54, 52, 52, 50,
+    51, 54, 49, 53, 52, 49, 59, 59, 53, 57, 58, 55, 48, 50, 47, 54,
+    64, 62, 48, 56, 55, 66, 52, 62, 55, 55, 56, 59, 54, 50, 53, 55,
+    49, 53, 57, 55, 59, 51, 54, 63, 44, 57, 60, 54, 53, 58, 57, 58,
+    49, 55, 56, 57, 54, 59, 55, 51, 52, 58, 61, 53, 52, 60, 55, 55,
+    55, 62, 51, 55, 56, 53, 62, 43, 59, 52, 54, 56, 53, 59, 49, 52,
+    52, 60, 66, 50, 63, 51, 50, 60, 64, 50, 52, 53, 59, 51, 55, 52,
+    53, 65, 55, 60, 63, 62, 50, 58, 52, 48, 52, 47, 62, 54, 50, 58,
+    49, 49, 73, 46, 55, 59, 46, 51, 57, 61, 64, 60, 57, 46, 47, 55,
+    55, 63, 56, 57, 63, 59, 53, 52, 54, 67, 55, 51, 55, 53, 58, 58,
+    51, 54, 57, 51, 62, 59, 58, 54, 54, 55, 58, 53, 53, 48, 55, 67,
+    46, 52, 57, 57, 55, 64, 56, 38, 57, 58, 65, 59, 54, 54, 58, 60,
+    59, 53, 51, 51, 59, 52, 51, 62, 52, 62, 55, 47, 52, 53, 51, 57,
+    53, 54, 62, 57, 54, 58, 61, 56, 58, 56, 51, 59, 49, 55, 51, 62,
+    56, 51, 49, 53, 52, 54, 68, 61, 56, 60, 54, 69, 50, 55, 56, 58,
+    48, 52, 49, 46, 52, 56, 55, 64, 55, 53, 54, 55, 51, 58, 50, 56,
+    53, 51, 51, 42, 57, 59, 56, 53, 55, 51, 49, 54, 53, 61, 55, 56,
+    52, 58, 45, 51, 64, 57, 55, 56, 57, 50, 63, 47, 52, 56, 57, 59,
+    52, 55, 62, 55, 57, 53, 50, 52, 60, 64, 59, 50, 49, 52, 55, 54,
+    48, 54, 48, 47, 52, 58, 58, 52, 62, 49, 56, 62, 53, 61, 61, 59,
+    52, 53, 53, 52, 55, 55, 62, 62, 47, 54, 59, 53, 49, 49, 57, 65,
+    53, 65, 51, 59, 50, 55, 50, 55, 57, 54, 53, 55, 62, 44, 51, 60,
+    51, 53, 53, 68, 59, 68, 56, 51, 53, 57, 47, 65, 49, 49, 53, 56,
+    59, 54, 48, 56, 68, 57, 63, 61, 51, 46, 61, 56, 58, 57, 63, 54,
+    55, 57, 45, 54, 65, 56, 53, 51, 56, 48, 56, 59, 54, 57, 58, 49,
+    59, 63, 58, 58, 55, 63, 62, 61, 55, 48, 58, 51, 55, 56, 49, 60,
+    57, 62, 55, 64, 60, 49, 60, 64, 47, 51, 48, 51, 63, 60, 51, 56,
+    58, 66, 60, 51, 59, 62, 48, 58, 56, 51, 55, 52, 57, 55, 52, 62,
+    52, 47, 49, 64, 50, 54, 54, 58, 61, 52, 55, 50, 52, 47, 57, 43,
+    50, 59, 58, 47, 61, 60, 52, 46, 61, 59, 52, 57, 61, 54, 60, 57,
+    55, 52, 53, 51, 58, 67, 68, 54, 44, 64, 51, 52, 55, 45, 53, 62,
+    62, 47, 50, 56, 55, 63, 51, 64, 57, 60, 52, 55, 55, 54, 63, 47,
+    58, 60, 49, 64, 61, 60, 54, 48, 56, 62, 47, 55, 62, 52, 61, 55,
+    52, 59, 52, 57, 54, 58, 43, 54, 59, 44, 61, 55, 60, 66, 61, 51,
+    59, 58, 49, 61, 58, 57, 56, 51, 56, 65, 61, 50, 53, 57, 54, 50,
+    56, 50, 57, 55, 63, 51, 60, 60, 54, 53, 62, 52, 51, 46, 51, 62,
+    55, 60, 53, 49, 55, 50, 51, 48, 61, 52, 58, 58, 51, 50, 52, 61,
+    55, 59, 57, 55, 58, 43, 49, 54, 62, 60, 54, 62, 53, 56, 54, 59,
+    50, 55, 63, 42, 49, 50, 56, 47, 68, 52, 55, 47, 64, 55, 48, 55,
+    57, 60, 51, 59, 65, 52, 60, 52, 52, 54, 55, 51, 63, 60, 50, 66,
+    54, 51, 54, 47, 49, 46, 58, 54, 66, 63, 55, 50, 56, 53, 49, 57,
+    54, 51, 58, 57, 56, 58, 54, 50, 63, 49, 52, 54, 57, 60, 60, 55,
+    56, 68, 49, 57, 45, 60, 54, 64, 54, 54, 52, 56, 47, 51, 61, 45,
+    58, 53, 52, 58, 52, 62, 45, 58, 52, 49, 55, 54, 63, 64, 60, 56,
+    57, 61, 53, 63, 53, 52, 50, 54, 65, 49, 53, 61, 56, 50, 58, 48,
+    55, 58, 45, 59, 54, 69, 46, 55, 57, 61, 49, 52, 54, 61, 59, 60,
+    54, 61, 61, 53, 57, 54, 51, 56, 58, 57, 59, 57, 59, 56, 49, 55,
+    48, 60, 57, 51, 56, 54, 57, 48, 53, 69, 55, 55, 62, 60, 58, 57,
+    51, 58, 47, 55, 52, 56, 59, 56, 58, 59, 51, 55, 57, 54, 44, 54,
+    45, 56, 47, 58, 57, 55, 50, 54, 51, 52, 62, 53, 50, 60, 59, 61,
+    54, 55, 57, 70, 56, 72, 55, 54, 60, 48, 54, 53, 52, 65, 57, 45,
+    57, 44, 53, 59, 54, 50, 49, 49, 66, 45, 52, 57, 48, 61, 58, 54,
+    53, 62, 52, 62, 64, 65, 45, 56, 63, 50, 47, 54, 50, 53, 55, 55,
+    57, 52, 54, 55, 60, 52, 54, 49, 60, 55, 61, 43, 57, 54, 54, 58,
+    55, 55, 63, 45, 66, 61, 50, 48, 50, 56, 51, 52, 57, 51, 61, 51,
+    46, 66, 49, 51, 62, 56, 54, 54, 62, 55, 57, 66, 49, 48, 47, 57,
+    46, 48, 59, 63, 57, 54, 51, 52, 49, 54, 63, 52, 52, 57, 48, 53,
+    58, 52, 49, 53, 47, 56, 52, 46, 58, 52, 56, 43, 52, 45, 62, 57,
+    53, 49, 54, 65, 58, 48, 44, 65, 46, 58, 54, 45, 57, 56, 63, 58,
+    51, 57, 60, 51, 55, 60, 59, 59, 58, 58, 57, 70, 43, 56, 62, 52,
+    59, 54, 60, 48, 57, 58, 62, 54, 49, 55, 54, 48, 53, 48, 51, 52,
+    60, 49, 64, 59, 58, 54, 52, 65, 61, 60, 60, 54, 53, 55, 51, 52,
+    53, 47, 59, 50, 50, 59, 58, 51, 60, 57, 60, 50, 59, 56, 60, 56,
+    45, 55, 50, 53, 61, 45, 43, 44, 52, 56, 63, 66, 71, 47, 59, 54,
+    41, 56, 56, 60, 48, 59, 56, 52, 59, 55, 63, 49, 67, 56, 45, 46,
+    59, 49, 51, 61, 57, 50, 55, 61, 58, 64, 62, 49, 56, 51, 59, 58,
+    62, 59, 63, 54, 62, 52, 64, 52, 57, 48, 49, 52, 60, 60, 57, 54,
+    57, 47, 56, 49, 53, 49, 48, 64, 47, 54, 61, 57, 57, 64, 57, 55,
+    51, 48, 46, 57, 56, 55, 51, 46, 55, 63, 53, 54, 58, 48, 55, 58,
+    54, 57, 59, 48, 53, 53, 57, 53, 49, 55, 46, 64, 61, 55, 55, 55,
+    59, 60, 57, 54, 52, 52, 61, 56, 49, 52, 44, 65, 53, 56, 57, 60,
+    55, 61, 58, 40, 48, 60, 46, 49, 58, 58, 60, 56, 54, 57, 54, 51,
+    61, 48, 59, 52, 58, 51, 60, 46, 58, 49, 54, 52, 55, 71, 62, 58,
+    54, 52, 50, 66, 53, 59, 48, 48, 64, 55, 58, 48, 52, 60, 59, 50,
+    48, 55, 65, 56, 58, 65, 42, 54, 49, 55, 60, 64, 46, 63, 54, 56,
+    53, 56, 58, 51, 59, 54, 56, 55, 49, 56, 52, 62, 55, 52, 53, 58,
+    62, 57, 64, 63, 52, 57, 55, 60, 56, 48, 47, 54, 56, 55, 62, 49,
+    63, 51, 57, 48, 54, 53, 60, 56, 63, 51, 62, 57, 61, 57, 52, 56,
+    48, 62, 56, 61, 59, 46, 58, 45, 52, 48, 46, 63, 65, 62, 48, 56,
+    46, 51, 54, 56, 54, 44, 65, 49, 61, 59, 53, 47, 55, 59, 56, 54,
+    51, 60, 47, 53, 55, 65, 64, 52, 60, 62, 52, 67, 59, 66, 55, 57,
+    51, 44, 61, 48, 57, 41, 56, 58, 63, 50, 60, 63, 51, 58, 50, 51,
+    55, 52, 40, 61, 60, 59, 59, 57, 51, 54, 50, 57, 54, 59, 57, 54,
+    59, 56, 56, 43, 45, 50, 54, 49, 52, 54, 47, 53, 50, 60, 59, 54,
+    50, 61, 56, 55, 57, 60, 57, 56, 58, 57, 62, 54, 51, 48, 57, 53,
+    63, 54, 52, 64, 53, 50, 57, 53, 53, 52, 64, 46, 54, 55, 53, 53,
+    50, 50, 57, 70, 57, 62, 55, 50, 50, 53, 60, 69, 57, 53, 49, 50,
+    49, 59, 49, 60, 57, 67, 51, 61, 54, 50, 44, 58, 49, 54, 53, 50,
+    51, 45, 51, 46, 56, 57, 53, 56, 61, 60, 57, 54, 50, 65, 59, 57,
+    54, 53, 64, 48, 49, 50, 58, 55, 59, 67, 59, 51, 55, 47, 63, 59,
+    58, 59, 61, 54, 52, 56, 59, 66, 58, 63, 49, 64, 47, 56, 61, 66,
+    52, 54, 55, 58, 57, 53, 57, 53, 57, 58, 51, 51, 53, 54, 51, 51,
+    54, 52, 52, 48, 56, 59, 52, 53, 52, 57, 48, 53, 57, 49, 56, 66,
+    53, 56, 47, 58, 57, 55, 51, 57, 56, 66, 61, 51, 55, 61, 58, 46,
+    60, 53, 54, 59, 52, 59, 58, 49, 51, 47, 54, 53, 66, 51, 58, 52,
+    48, 45, 54, 58, 45, 54, 46, 61, 57, 57, 60, 56, 58, 57, 55, 55,
+    68, 49, 47, 53, 62, 51, 54, 61, 53, 55, 59, 54, 60, 50, 56, 55,
+    62, 51, 58, 53, 50, 61, 46, 51, 53, 50, 62, 50, 59, 69, 58, 60,
+    52, 56, 55, 58, 49, 57, 51, 65, 60, 55, 49, 54, 57, 57, 61, 54,
+    55, 56, 53, 53, 53, 55, 46, 50, 59, 52, 54, 47, 59, 57, 53, 56,
+    60, 68, 49, 45, 58, 65, 63, 55, 53, 65, 67, 53, 63, 40, 58, 60,
+    48, 52, 52, 63, 50, 57, 47, 59, 61, 49, 62, 47, 54, 63, 49, 57,
+    55, 60, 60, 65, 60, 51, 49, 62, 50, 53, 63, 62, 46, 58, 52, 50,
+    49, 54, 57, 57, 57, 56, 59, 54, 63, 53, 52, 55, 61, 56, 53, 52,
+    44, 63, 58, 52, 57, 50, 58, 52, 56, 56, 60, 54, 51, 62, 60, 59,
+    60, 46, 55, 63, 46, 56, 46, 54, 62, 55, 55, 60, 56, 41, 47, 53,
+    54, 48, 62, 55, 50, 48, 72, 52, 51, 54, 49, 52, 50, 48, 53, 75,
+    48, 43, 55, 58, 51, 55, 48, 51, 72, 45, 62, 66, 56, 48, 52, 52,
+    58, 58, 60, 47, 50, 50, 57, 58, 65, 60, 60, 60, 61, 58, 60, 57,
+    64, 58, 65, 59, 57, 61, 46, 50, 63, 57, 47, 57, 52, 53, 51, 57,
+    60, 53, 46, 56, 59, 50, 51, 57, 51, 61, 64, 56, 60, 52, 60, 48,
+    63, 56, 49, 58, 65, 48, 55, 61, 51, 53, 53, 56, 63, 51, 57, 49,
+    57, 45, 51, 47, 57, 63, 61, 56, 58, 54, 58, 48, 53, 59, 54, 43,
+    49, 49, 61, 53, 56, 68, 51, 49, 54, 64, 58, 62, 51, 55, 57, 41,
+    54, 52, 56, 57, 53, 45, 62, 55, 49, 58, 62, 61, 60, 58, 58, 47,
+    52, 54, 51, 53, 54, 61, 55, 54, 60, 64, 55, 63, 49, 59, 51, 55,
+    51, 49, 49, 51, 55, 50, 47, 53, 57, 56, 48, 56, 54, 50, 51, 54,
+    48, 56, 50, 52, 56, 54, 51, 64, 56, 52, 64, 60, 53, 52, 48, 60,
+    55, 58, 54, 47, 46, 51, 58, 62, 69, 54, 53, 46, 58, 58, 62, 55,
+    59, 48, 63, 59, 50, 50, 58, 50, 43, 62, 59, 65, 52, 59, 56, 64,
+    49, 49, 49, 65, 58, 51, 60, 64, 55, 55, 56, 56, 51, 65, 55, 56,
+    58, 56, 44, 64, 54, 61, 61, 62, 48, 56, 47, 55, 56, 52, 56, 50,
+    58, 63, 66, 52, 55, 48, 50, 51, 55, 66, 52, 58, 57, 69, 53, 55,
+    46, 56, 57, 56, 50, 49, 54, 47, 63, 58, 56, 42, 47, 63, 53, 60,
+    55, 66, 43, 47, 56, 48, 54, 53, 45, 58, 65, 58, 54, 63, 51, 60,
+    54, 57, 64, 59, 53, 52, 53, 60, 52, 57, 56, 63, 55, 65, 53, 46,
+    58, 61, 53, 53, 57, 51, 51, 57, 58, 63, 42, 57, 58, 56, 72, 43,
+    47, 52, 59, 54, 53, 63, 53, 55, 61, 53, 61, 58, 56, 52, 59, 51,
+    63, 54, 56, 55, 52, 59, 50, 60, 51, 47, 62, 60, 66, 56, 61, 57,
+    58, 63, 63, 54, 56, 57, 49, 58, 47, 51, 52, 66, 44, 59, 58, 54,
+    48, 60, 54, 50, 59, 60, 55, 61, 55, 55, 51, 51, 53, 57, 60, 48,
+    58, 56, 54, 59, 52, 49, 68, 45, 62, 58, 54, 52, 55, 50, 59, 63,
+    55, 48, 59, 57, 51, 59, 51, 60, 57, 56, 64, 60, 47, 53, 59, 49,
+    54, 58, 49, 46, 44, 64, 55, 58, 57, 55, 58, 59, 44, 61, 60, 55,
+    52, 59, 52, 55, 55, 51, 57, 60, 56, 54, 61, 53, 57, 61, 64, 55,
+    51, 55, 57, 55, 52, 55, 51, 52, 58, 56, 51, 62, 52, 60, 53, 57,
+    67, 44, 56, 57, 53, 56, 56, 55, 52, 63, 42, 60, 61, 51, 48, 59,
+    55, 49, 56, 46, 64, 57, 49, 56, 52, 59, 53, 59, 56, 56, 61, 61,
+    51, 63, 43, 52, 60, 54, 57, 57, 53, 57, 54, 57, 55, 57, 47, 42,
+    56, 56, 51, 59, 54, 58, 51, 59, 62, 57, 53, 56, 58, 53, 66, 58,
+    61, 49, 59, 59, 51, 63, 51, 52, 66, 53, 63, 65, 50, 59, 51, 63,
+    48, 56, 50, 58, 52, 50, 57, 57, 52, 55, 46, 45, 57, 57, 65, 59,
+    61, 52, 61, 61, 51, 63, 54, 53, 62, 51, 60, 49, 50, 63, 56, 66,
+    51, 62, 55, 54, 52, 55, 51, 54, 52, 46, 53, 57, 61, 60, 54, 52,
+    52, 61, 58, 53, 59, 57, 52, 59, 56, 54, 52, 48, 62, 60, 40, 52,
+    58, 58, 56, 55, 50, 57, 61, 55, 50, 47, 60, 58, 49, 53, 59, 54,
+    54, 56, 52, 63, 51, 58, 52, 54, 49, 60, 62, 63, 56, 58, 55, 58,
+    61, 56, 62, 40, 57, 57, 47, 58, 53, 68, 52, 55, 58, 49, 57, 52,
+    60, 60, 61, 55, 50, 53, 57, 46, 51, 58, 45, 63, 51, 49, 57, 53,
+    50, 48, 42, 58, 66, 47, 52, 57, 57, 57, 53, 46, 57, 67, 49, 55,
+    62, 50, 58, 59, 50, 67, 61, 53, 50, 53, 55, 45, 50, 56, 50, 64,
+    51, 49, 57, 52, 53, 56, 63, 55, 59, 58, 54, 64, 46, 45, 55, 59,
+    68, 50, 47, 65, 62, 57, 44, 66, 58, 47, 51, 52, 42, 57, 48, 48,
+    60, 52, 52, 55, 62, 52, 60, 53, 55, 49, 59, 49, 49, 58, 62, 56,
+    54, 60, 60, 55, 56, 44, 57, 58, 52, 52, 66, 51, 57, 62, 63, 60,
+    46, 64, 54, 57, 54, 54, 52, 51, 53, 57, 55, 57, 58, 59, 54, 59,
+    57, 58, 55, 58, 52, 59, 52, 48, 54, 62, 56, 55, 61, 56, 43, 64,
+    53, 54, 67, 58, 57, 54, 42, 54, 59, 48, 50, 60, 53, 44, 51, 60,
+    52, 53, 58, 57, 56, 52, 59, 57, 61, 53, 51, 56, 55, 53, 63, 54,
+    56, 57, 57, 62, 52, 55, 49, 55, 59, 55, 52, 57, 58, 53, 55, 57,
+    61, 48, 68, 59, 43, 54, 54, 52, 57, 55, 58, 54, 54, 51, 52, 56,
+    54, 44, 59, 47, 53, 51, 59, 55, 52, 51, 63, 48, 54, 51, 61, 57,
+    51, 58, 64, 61, 65, 59, 66, 64, 56, 51, 53, 56, 55, 52, 47, 52,
+    65, 57, 52, 53, 49, 47, 63, 42, 45, 60, 63, 60, 60, 47, 63, 53,
+    58, 54, 63, 46, 50, 52, 61, 66, 46, 49, 62, 60, 58, 72, 59, 56,
+    43, 59, 58, 53, 54, 50, 50, 52, 62, 45, 64, 57, 65, 58, 53, 56,
+    61, 53, 59, 63, 49, 66, 40, 46, 61, 49, 56, 54, 58, 44, 52, 53,
+    61, 49, 53, 55, 64, 50, 60, 62, 60, 55, 55, 55, 59, 58, 62, 58,
+    64, 50, 57, 52, 54, 54, 61, 50, 56, 54, 50, 55, 55, 50, 54, 59,
+    44, 61, 60, 48, 61, 54, 46, 58, 55, 55, 69, 60, 56, 59, 54, 52,
+    62, 66, 57, 51, 55, 50, 57, 65, 55, 45, 56, 60, 46, 47, 57, 54,
+    57, 66, 45, 64, 54, 56, 56, 65, 50, 56, 54, 45, 51, 63, 54, 52,
+    55, 53, 65, 60, 53, 54, 52, 60, 58, 51, 46, 65, 67, 46, 59, 52,
+    55, 63, 49, 55, 50, 60, 60, 45, 50, 52, 46, 56, 54, 56, 44, 52,
+    56, 59, 51, 57, 50, 56, 63, 52, 51, 54, 59, 48, 55, 55, 59, 66,
+    66, 53, 49, 63, 57, 64, 63, 59, 46, 47, 59, 52, 59, 56, 52, 59,
+    56, 63, 61, 62, 53, 49, 56, 61, 44, 49, 62, 68, 55, 53, 60, 54,
+    59, 57, 52, 51, 54, 62, 52, 60, 52, 58, 59, 54, 57, 52, 54, 58,
+    57, 54, 52, 58, 63, 53, 52, 59, 55, 54, 46, 60, 50, 57, 66, 48,
+    62, 62, 47, 63, 51, 55, 59, 52, 53, 48, 56, 55, 46, 53, 55, 60,
+    64, 48, 53, 50, 55, 52, 48, 58, 56, 64, 53, 51, 62, 51, 54, 49,
+    62, 61, 61, 49, 56, 46, 59, 52, 48, 55, 58, 57, 56, 57, 64, 52,
+    53, 47, 52, 57, 52, 51, 53, 57, 63, 53, 52, 54, 62, 61, 55, 48,
+    52, 57, 53, 52, 57, 53, 56, 51, 60, 58, 52, 62, 50, 47, 58, 59,
+    55, 52, 48, 55, 59, 50, 60, 43, 55, 54, 54, 59, 62, 56, 67, 51,
+    55, 61, 44, 63, 51, 61, 44, 50, 55, 63, 52, 53, 56, 54, 61, 59,
+    49, 56, 52, 64, 54, 55, 48, 53, 61, 55, 58, 50, 55, 62, 58, 57,
+    57, 55, 55, 49, 48, 51, 56, 59, 60, 58, 55, 57, 50, 63, 48, 57,
+    52, 51, 58, 59, 54, 58, 53, 55, 55, 57, 62, 62, 60, 50, 53, 50,
+    51, 47, 57, 51, 55, 50, 60, 48, 65, 61, 62, 47, 56, 53, 53, 44,
+    64, 48, 54, 61, 63, 54, 55, 51, 53, 58, 51, 59, 48, 54, 66, 58,
+    49, 54, 58, 52, 54, 59, 56, 52, 56, 57, 64, 53, 56, 59, 45, 43,
+    62, 42, 55, 53, 51, 52, 54, 56, 50, 43, 60, 51, 56, 49, 59, 61,
+    60, 51, 42, 53, 64, 55, 61, 54, 52, 58, 58, 64, 50, 54, 48, 49,
+    56, 53, 61, 57, 68, 65, 50, 57, 58, 52, 55, 52, 42, 54, 57, 58,
+    45, 52, 60, 49, 58, 52, 56, 55, 55, 53, 54, 52, 55, 58, 50, 52,
+    49, 52, 59, 55, 57, 57, 59, 47, 52, 57, 54, 51, 65, 64, 52, 50,
+    49, 48, 51, 66, 70, 52, 56, 58, 51, 49, 47, 63, 61, 49, 60, 41,
+    63, 58, 54, 49, 51, 61, 55, 49, 49, 55, 53, 51, 58, 58, 45, 47,
+    59, 50, 58, 57, 63, 50, 60, 49, 60, 62, 47, 56, 52, 59, 52, 55,
+    56, 51, 61, 58, 60, 59, 52, 51, 67, 53, 54, 57, 49, 51, 66, 54,
+    59, 62, 58, 55, 59, 53, 59, 55, 56, 53, 66, 60, 49, 67, 61, 50,
+    60, 43, 52, 57, 55, 46, 55, 53, 51, 60, 52, 55, 51, 63, 49, 58,
+    48, 44, 48, 56, 59, 55, 56, 55, 64, 53, 46, 62, 57, 59, 55, 57,
+    56, 57, 59, 52, 52, 60, 58, 64, 50, 49, 51, 56, 59, 56, 58, 53,
+    56, 58, 57, 58, 54, 57, 51, 60, 49, 60, 55, 38, 58, 58, 48, 55,
+    51, 55, 60, 65, 57, 57, 53, 51, 46, 47, 51, 59, 53, 62, 51, 47,
+    56, 51, 56, 56, 63, 56, 51, 63, 52, 51, 60, 54, 53, 43, 55, 48,
+    61, 49, 51, 53, 53, 59, 53, 50, 62, 58, 57, 48, 64, 54, 57, 52,
+    48, 51, 52, 46, 47, 55, 48, 55, 55, 55, 48, 55, 53, 56, 59, 53,
+    65, 54, 54, 49, 60, 63, 58, 58, 53, 61, 55, 57, 51, 57, 49, 55,
+    50, 54, 53, 63, 54, 57, 64, 66, 50, 53, 60, 52, 46, 66, 62, 53,
+    57, 56, 62, 52, 48, 59, 57, 57, 52, 61, 64, 54, 48, 54, 49, 60,
+    60, 59, 56, 54, 58, 57, 58, 51, 66, 56, 51, 53, 53, 56, 49, 58,
+    46, 53, 55, 50, 51, 49, 53, 58, 41, 48, 55, 64, 48, 47, 54, 57,
+    56, 60, 72, 52, 46, 53, 40, 58, 63, 58, 57, 53, 60, 56, 52, 55,
+    57, 53, 56, 40, 49, 53, 61, 47, 61, 53, 61, 55, 53, 52, 62, 60,
+    55, 51, 61, 56, 60, 66, 55, 53, 61, 49, 55, 56, 56, 50, 52, 50,
+    51, 58, 53, 48, 57, 52, 52, 66, 57, 48, 62, 53, 59, 55, 58, 57,
+    53, 47, 58, 69, 45, 55, 50, 48, 48, 54, 52, 49, 50, 60, 49, 52,
+    59, 51, 47, 61, 47, 61, 51, 48, 46, 59, 63, 68, 56, 52, 54, 50,
+    52, 66, 56, 61, 54, 60, 52, 57, 47, 55, 58, 48, 60, 50, 59, 57,
+    57, 53, 62, 54, 56, 51, 61, 43, 53, 59, 53, 56, 54, 60, 51, 50,
+    48, 48, 60, 49, 64, 48, 63, 59, 59, 54, 57, 48, 43, 55, 51, 61,
+    49, 50, 49, 54, 55, 58, 62, 58, 59, 54, 49, 54, 51, 54, 48, 55,
+    54, 57, 50, 58, 56, 49, 62, 55, 57, 55, 51, 47, 54, 64, 52, 51,
+    50, 63, 51, 63, 48, 60, 55, 54, 60, 63, 57, 62, 54, 55, 64, 57,
+    49, 51, 61, 63, 59, 40, 51, 44, 57, 61, 57, 64, 47, 52, 55, 48,
+    50, 64, 56, 52, 50, 59, 52, 63, 50, 48, 56, 59, 63, 58, 57, 57,
+    62, 51, 58, 54, 50, 63, 68, 60, 54, 51, 56, 57, 55, 60, 58, 53,
+    58, 55, 49, 55, 56, 50, 52, 61, 57, 51, 46, 50, 50, 54, 62, 63,
+    56, 52, 49, 52, 58, 53, 49, 63, 60, 54, 59, 47, 49, 61, 51, 58,
+    47, 63, 55, 61, 52, 45, 60, 58, 55, 50, 63, 51, 53, 57, 51, 47,
+    60, 54, 58, 62, 60, 62, 51, 59, 56, 53, 57, 54, 52, 58, 53, 61,
+    54, 60, 46, 51, 63, 60, 54, 51, 60, 58, 51, 50, 52, 52, 55, 45,
+    67, 39, 60, 59, 65, 49, 65, 47, 60, 55, 50, 52, 51, 52, 54, 60,
+    44, 57, 59, 56, 51, 56, 56, 51, 51, 60, 56, 52, 64, 50, 70, 48,
+    63, 49, 51, 58, 61, 59, 56, 55, 62, 65, 51, 57, 58, 42, 57, 64,
+    53, 59, 61, 58, 43, 56, 55, 49, 50, 56, 61, 59, 55, 49, 59, 52,
+    58, 66, 49, 55, 51, 50, 59, 50, 51, 60, 58, 56, 50, 53, 61, 59,
+    59, 66, 51, 52, 58, 48, 64, 55, 67, 52, 47, 59, 60, 58, 65, 61,
+    63, 56, 52, 55, 54, 59, 51, 53, 52, 56, 63, 50, 60, 51, 62, 58,
+    51, 60, 51, 52, 41, 59, 55, 55, 56, 51, 55, 56, 50, 55, 62, 50,
+    45, 48, 52, 51, 55, 63, 55, 56, 54, 62, 56, 57, 64, 54, 53, 59,
+    51, 56, 45, 48, 62, 55, 56, 49, 51, 50, 55, 59, 51, 58, 52, 55,
+    55, 60, 60, 47, 56, 54, 50, 62, 54, 59, 47, 57, 63, 55, 47, 59,
+    56, 52, 63, 59, 53, 53, 59, 56, 47, 55, 56, 73, 57, 51, 53, 51,
+    50, 58, 56, 56, 55, 42, 58, 48, 61, 65, 44, 52, 52, 59, 54, 54,
+    56, 63, 58, 44, 50, 57, 59, 53, 59, 56, 62, 51, 64, 57, 54, 47,
+    57, 61, 56, 55, 54, 55, 53, 53, 58, 60, 49, 50, 53, 64, 52, 54,
+    61, 54, 54, 47, 62, 53, 56, 64, 53, 60, 65, 42, 59, 55, 55, 59,
+    67, 54, 47, 67, 54, 54, 57, 54, 56, 58, 59, 52, 51, 51, 40, 59,
+    55, 59, 51, 55, 57, 45, 64, 56, 60, 60, 50, 57, 44, 69, 48, 61,
+    58, 53, 46, 52, 51, 53, 50, 64, 59, 62, 67, 43, 54, 63, 61, 54,
+    54, 47, 54, 58, 49, 56, 64, 57, 58, 47, 55, 53, 56, 52, 52, 61,
+    60, 52, 57, 56, 55, 54, 53, 46, 67, 55, 63, 51, 52, 53, 59, 51,
+    50, 48, 49, 69, 49, 50, 53, 51, 49, 56, 60, 54, 57, 48, 51, 64,
+    48, 44, 51, 48, 60, 57, 57, 55, 67, 60, 51, 66, 58, 58, 51, 57,
+    58, 50, 48, 55, 51, 57, 53, 49, 56, 45, 58, 63, 53, 48, 60, 49,
+    54, 56, 50, 52, 63, 55, 58, 58, 61, 54, 65, 49, 58, 58, 52, 40,
+    57, 56, 53, 48, 55, 48, 58, 60, 52, 53, 58, 52, 66, 54, 56, 52,
+    54, 47, 57, 58, 52, 56, 53, 60, 57, 60, 52, 51, 50, 61, 68, 58,
+    53, 60, 57, 56, 59, 61, 64, 41, 55, 59, 67, 52, 48, 57, 55, 58,
+    52, 49, 55, 59, 51, 60, 64, 52, 50, 52, 60, 55, 47, 45, 54, 50,
+    58, 62, 50, 54, 65, 49, 53, 53, 48, 51, 66, 53, 50, 54, 62, 58,
+    54, 69, 50, 55, 63, 57, 51, 51, 60, 63, 50, 48, 49, 49, 53, 58,
+    68, 59, 49, 49, 50, 48, 51, 52, 56, 55, 56, 51, 50, 63, 63, 55,
+    61, 54, 46, 50, 59, 56, 56, 55, 52, 49, 62, 57, 61, 68, 47, 52,
+    42, 63, 53, 58, 63, 52, 55, 49, 52, 47, 64, 58, 59, 54, 62, 44,
+    51, 50, 48, 51, 49, 56, 48, 54, 61, 57, 58, 49, 55, 57, 50, 65,
+    50, 63, 55, 55, 52, 53, 56, 54, 55, 51, 53, 55, 58, 52, 56, 66,
+    63, 54, 45, 64, 60, 48, 43, 55, 55, 52, 64, 56, 52, 57, 49, 59,
+    62, 49, 60, 56, 54, 46, 64, 49, 53, 66, 44, 50, 63, 48, 57, 58,
+    59, 55, 53, 61, 48, 60, 59, 57, 51, 52, 52, 67, 58, 56, 55, 51,
+    51, 54, 53, 59, 55, 56, 54, 49, 63, 58, 55, 53, 51, 50, 57, 54,
+    53, 67, 55, 44, 52, 62, 52, 50, 56, 51, 52, 67, 63, 56, 53, 55,
+    51, 55, 51, 58, 54, 53, 56, 51, 47, 57, 51, 65, 66, 47, 50, 55,
+    56, 58, 53, 56, 63, 61, 59, 71, 48, 62, 52, 57, 48, 46, 51, 50,
+    52, 47, 57, 63, 56, 49, 50, 70, 54, 61, 43, 60, 49, 51, 56, 50,
+    61, 54, 66, 53, 57, 45, 42, 56, 61, 59, 55, 48, 46, 54, 53, 59,
+    60, 64, 52, 54, 56, 54, 53, 55, 50, 64, 57, 50, 55, 57, 48, 49,
+    58, 54, 52, 53, 47, 57, 47, 50, 53, 53, 56, 53, 57, 53, 63, 47,
+    59, 62, 54, 59, 62, 45, 50, 57, 56, 50, 57, 54, 53, 54, 50, 56,
+    54, 64, 62, 55, 66, 54, 51, 58, 54, 48, 53, 51, 57, 48, 63, 54,
+    51, 61, 49, 56, 52, 50, 55, 54, 58, 53, 53, 52, 54, 54, 58, 55,
+    49, 57, 58, 58, 63, 59, 56, 58, 57, 58, 56, 64, 60, 57, 62, 53,
+    51, 59, 58, 52, 55, 64, 55, 56, 56, 53, 58, 53, 51, 54, 53, 56,
+    45, 52, 55, 66, 57, 50, 61, 57, 51, 57, 42, 59, 52, 46, 54, 46,
+    69, 57, 61, 55, 46, 53, 64, 51, 46, 69, 59, 47, 61, 51, 48, 47,
+    64, 50, 56, 49, 59, 65, 59, 51, 45, 60, 64, 48, 57, 53, 54, 52,
+    52, 57, 54, 52, 56, 57, 60, 55, 61, 60, 55, 49, 57, 51, 63, 55,
+    49, 56, 57, 49, 60, 57, 68, 47, 49, 47, 55, 49, 59, 60, 57, 52,
+    60, 49, 46, 54, 49, 59, 52, 57, 55, 47, 53, 64, 51, 58, 70, 56,
+    53, 42, 44, 59, 48, 55, 58, 52, 48, 66, 54, 55, 61, 62, 61, 48,
+    57, 58, 51, 65, 66, 50, 51, 54, 56, 60, 58, 48, 66, 50, 56, 60,
+    43, 56, 45, 56, 64, 61, 50, 52, 58, 55, 49, 59, 49, 66, 48, 58,
+    56, 55, 52, 60, 66, 45, 61, 44, 64, 56, 61, 62, 51, 53, 59, 53,
+    57, 56, 54, 58, 62, 68, 61, 46, 50, 55, 52, 59, 57, 63, 49, 52,
+    49, 57, 55, 52, 58, 55, 57, 54, 63, 60, 65, 47, 54, 63, 45, 50,
+    54, 52, 45, 57, 54, 57, 49, 59, 51, 54, 56, 57, 55, 52, 53, 67,
+    59, 57, 56, 56, 56, 58, 47, 58, 59, 56, 55, 49, 54, 43, 56, 55,
+    59, 51, 59, 51, 54, 63, 53, 53, 62, 53, 45, 58, 53, 64, 54, 51,
+    50, 56, 56, 51, 54, 50, 61, 48, 53, 55, 54, 56, 54, 59, 61, 47,
+    65, 45, 48, 58, 53, 67, 55, 57, 56, 64, 52, 49, 58, 65, 58, 56,
+    53, 49, 54, 56, 51, 46, 47, 51, 61, 62, 48, 47, 66, 51, 50, 60,
+    60, 56, 62, 54, 59, 58, 58, 48, 57, 46, 61, 51, 60, 64, 62, 58,
+    54, 54, 49, 55, 52, 59, 57, 48, 61, 61, 59, 52, 53, 56, 53, 48,
+    54, 47, 57, 51, 57, 52, 56, 58, 49, 65, 48, 45, 54, 56, 67, 54,
+    50, 55, 55, 55, 61, 52, 58, 59, 49, 49, 50, 54, 55, 50, 55, 56,
+    59, 55, 46, 59, 59, 55, 60, 51, 64, 52, 70, 55, 57, 54, 55, 62,
+    49, 59, 52, 60, 49, 63, 46, 51, 63, 66, 58, 53, 54, 58, 59, 49,
+    56, 51, 61, 56, 60, 46, 52, 50, 64, 50, 55, 50, 54, 51, 55, 57,
+    58, 59, 60, 54, 55, 63, 43, 41, 55, 43, 61, 55, 55, 57, 58, 57,
+    47, 63, 56, 54, 53, 55, 59, 57, 59, 63, 59, 53, 59, 58, 52, 60,
+    58, 55, 60, 53, 53, 58, 57, 49, 54, 50, 56, 54, 57, 52, 54, 57,
+    47, 50, 57, 55, 60, 55, 50, 54, 55, 46, 50, 53, 66, 53, 52, 56,
+    50, 56, 51, 67, 60, 57, 47, 61, 47, 58, 53, 60, 59, 53, 57, 65,
+    59, 45, 56, 62, 53, 54, 47, 60, 59, 53, 58, 46, 56, 62, 59, 52,
+    45, 48, 48, 52, 54, 60, 46, 54, 60, 51, 60, 52, 61, 60, 48, 44,
+    61, 53, 45, 56, 54, 58, 48, 53, 54, 48, 59, 56, 62, 60, 56, 55,
+    47, 56, 51, 59, 47, 50, 63, 53, 53, 45, 50, 48, 52, 57, 58, 57,
+    63, 53, 54, 43, 64, 47, 63, 60, 53, 44, 54, 64, 52, 54, 62, 62,
+    55, 56, 49, 61, 57, 48, 60, 49, 54, 55, 50, 54, 53, 62, 44, 60,
+    59, 54, 56, 48, 53, 52, 48, 49, 51, 47, 52, 64, 48, 61, 54, 54,
+    55, 58, 54, 54, 50, 58, 59, 58, 51, 61, 49, 56, 47, 61, 58, 58,
+    56, 56, 60, 52, 61, 58, 51, 60, 55, 55, 53, 58, 46, 55, 59, 54,
+    53, 49, 62, 56, 57, 54, 63, 55, 48, 56, 53, 55, 60, 55, 55, 50,
+    63, 59, 52, 49, 64, 58, 52, 53, 62, 51, 59, 56, 52, 61, 49, 48,
+    52, 45, 54, 57, 57, 57, 53, 61, 53, 52, 55, 48, 51, 63, 52, 54,
+    53, 52, 43, 48, 52, 56, 52, 54, 60, 58, 47, 53, 51, 55, 54, 53,
+    56, 53, 55, 61, 59, 54, 52, 55, 48, 57, 62, 59, 57, 56, 50, 44,
+    51, 61, 57, 55, 46, 52, 62, 60, 53, 56, 60, 51, 52, 58, 60, 61,
+    41, 41, 56, 56, 56, 54, 58, 60, 50, 50, 57, 49, 50, 69, 55, 57,
+    56, 46, 53, 57, 57, 52, 49, 51, 59, 57, 63, 47, 48, 51, 50, 64,
+    54, 59, 47, 61, 62, 54, 54, 48, 54, 68, 68, 55, 53, 55, 60, 57,
+    59, 50, 48, 58, 52, 50, 61, 58, 54, 58, 53, 54, 53, 46, 62, 55,
+    58, 58, 59, 51, 50, 54, 64, 59, 54, 58, 56, 59, 49, 60, 57, 55,
+    57, 57, 57, 51, 58, 59, 50, 59, 58, 55, 55, 50, 55, 53, 55, 54,
+    57, 50, 58, 56, 55, 61, 56, 50, 53, 57, 55, 47, 67, 62, 67, 51,
+    70, 54, 54, 53, 46, 62, 55, 58, 53, 52, 51, 50, 58, 51, 54, 67,
+    53, 57, 55, 63, 58, 54, 54, 53, 54, 45, 45, 45, 51, 55, 57, 56,
+    56, 56, 64, 56, 55, 49, 53, 66, 52, 51, 61, 58, 54, 59, 45, 50,
+    55, 58, 55, 50, 51, 48, 52, 54, 60, 54, 61, 54, 56, 47, 50, 58,
+    49, 56, 52, 62, 49, 55, 52, 58, 59, 58, 60, 53, 55, 68, 58, 47,
+    54, 55, 58, 59, 57, 44, 55, 58, 59, 43, 60, 52, 52, 57, 66, 64,
+    57, 58, 55, 49, 56, 50, 53, 54, 43, 56, 54, 56, 58, 47, 67, 56,
+    56, 63, 40, 48, 54, 53, 54, 56, 55, 53, 57, 49, 65, 60, 56, 44,
+    55, 49, 65, 49, 59, 47, 59, 54, 60, 49, 52, 72, 55, 56, 57, 59,
+    54, 50, 51, 55, 53, 55, 56, 51, 60, 56, 50, 59, 70, 56, 63, 57,
+    55, 47, 57, 57, 58, 61, 53, 59, 61, 58, 58, 55, 62, 60, 56, 57,
+    41, 52, 45, 51, 59, 56, 64, 63, 55, 48, 52, 61, 55, 57, 47, 55,
+    53, 54, 42, 51, 53, 53, 58, 57, 60, 57, 47, 62, 57, 67, 52, 56,
+    53, 53, 59, 61, 63, 48, 63, 56, 52, 60, 55, 47, 63, 55, 53, 59,
+    62, 50, 57, 53, 50, 54, 54, 62, 52, 44, 51, 56, 55, 54, 55, 45,
+    55, 55, 55, 48, 56, 57, 60, 57, 58, 60, 52, 50, 50, 54, 51, 47,
+    56, 55, 61, 53, 60, 64, 46, 56, 61, 49, 63, 51, 55, 59, 51, 53,
+    44, 58, 51, 40, 58, 46, 52, 54, 47, 60, 46, 61, 51, 40, 56, 64,
+    59, 61, 63, 53, 47, 59, 47, 54, 55, 51, 62, 58, 66, 53, 51, 56,
+    59, 52, 55, 57, 54, 57, 59, 55, 59, 49, 61, 68, 46, 55, 48, 55,
+    53, 56, 54, 58, 51, 55, 57, 47, 56, 52, 57, 54, 50, 60, 58, 55,
+    45, 58, 56, 71, 54, 61, 53, 53, 47, 49, 55, 48, 55, 61, 53, 60,
+    52, 51, 54, 52, 47, 52, 60, 47, 61, 55, 54, 58, 55, 49, 46, 63,
+    45, 51, 61, 64, 63, 62, 52, 67, 44, 63, 66, 52, 59, 54, 51, 60,
+    54, 59, 64, 40, 60, 52, 59, 54, 49, 62, 56, 50, 52, 50, 56, 56,
+    59, 53, 45, 59, 51, 58, 64, 57, 52, 59, 51, 59, 52, 60, 56, 45,
+    57, 50, 50, 46, 53, 52, 60, 50, 51, 52, 53, 59, 57, 53, 53, 48,
+    58, 57, 50, 61, 61, 48, 54, 62, 61, 45, 68, 44, 53, 49, 50, 60,
+    69, 50, 58, 68, 52, 63, 57, 58, 47, 52, 56, 52, 54, 53, 55, 58,
+    60, 56, 62, 58, 43, 52, 43, 57, 59, 58, 58, 48, 57, 65, 59, 58,
+    52, 59, 49, 60, 54, 57, 47, 51, 53, 61, 55, 52, 59, 63, 61, 50,
+    54, 49, 66, 51, 62, 57, 56, 51, 51, 57, 61, 63, 58, 49, 55, 55,
+    54, 51, 57, 64, 53, 57, 55, 61, 46, 49, 56, 57, 55, 70, 58, 54,
+    61, 65, 60, 51, 49, 49, 55, 46, 54, 51, 51, 51, 56, 59, 57, 57,
+    42, 48, 57, 54, 47, 58, 62, 57, 49, 55, 50, 60, 53, 64, 55, 58,
+    46, 62, 60, 51, 56, 60, 53, 60, 53, 57, 49, 56, 54, 59, 61, 55,
+    46, 56, 51, 52, 51, 41, 51, 56, 53, 52, 52, 71, 57, 60, 58, 47,
+    54, 57, 54, 64, 55, 56, 60, 46, 62, 45, 57, 54, 51, 49, 58, 60,
+    61, 50, 66, 44, 49, 59, 57, 63, 61, 48, 65, 53, 52, 52, 56, 50,
+    51, 55, 59, 53, 60, 59, 53, 59, 50, 56, 57, 55, 56, 50, 48, 51,
+    65, 58, 65, 50, 46, 57, 51, 39, 60, 60, 49, 63, 62, 55, 54, 57,
+    57, 53, 58, 59, 52, 53, 53, 58, 55, 56, 55, 55, 59, 49, 63, 55,
+    59, 52, 52, 52, 55, 53, 40, 55, 50, 58, 49, 56, 50, 61, 63, 61,
+    58, 45, 49, 61, 59, 46, 57, 55, 57, 54, 58, 45, 46, 61, 45, 58,
+    52, 57, 55, 62, 56, 51, 49, 62, 53, 52, 57, 51, 52, 57, 48, 51,
+    48, 39, 62, 50, 56, 61, 66, 54, 51, 56, 64, 48, 49, 51, 62, 50,
+    64, 59, 57, 56, 60, 53, 59, 53, 46, 55, 43, 48, 51, 54, 57, 62,
+    49, 52, 59, 60, 55, 54, 63, 43, 60, 56, 54, 56, 59, 50, 53, 56,
+    50, 56, 59, 48, 52, 51, 51, 59, 55, 52, 60, 47, 57, 66, 59, 53,
+    59, 52, 59, 56, 51, 57, 50, 46, 68, 54, 52, 49, 54, 52, 56, 71,
+    52, 67, 47, 53, 60, 57, 53, 56, 58, 59, 57, 57, 51, 51, 59, 44,
+    60, 50, 64, 64, 48, 49, 57, 55, 50, 58, 65, 48, 58, 58, 65, 59,
+    53, 57, 55, 57, 55, 60, 48, 54, 63, 52, 53, 57, 55, 58, 54, 60,
+    58, 68, 59, 54, 60, 50, 56, 56, 57, 57, 47, 49, 49, 56, 62, 53,
+    46, 56, 44, 53, 55, 54, 58, 55, 61, 54, 57, 55, 50, 64, 49, 54,
+    53, 52, 59, 54, 53, 57, 59, 57, 57, 55, 56, 65, 55, 57, 56, 50,
+    53, 42, 65, 63, 40, 56, 54, 66, 55, 44, 56, 55, 54, 52, 56, 47,
+    50, 55, 56, 62, 56, 55, 49, 56, 55, 58, 48, 61, 50, 58, 65, 53,
+    64, 51, 64, 57, 60, 51, 58, 58, 55, 52, 48, 51, 51, 45, 56, 52,
+    57, 54, 57, 42, 58, 62, 51, 52, 58, 56, 50, 54, 54, 55, 59, 52,
+    58, 58, 63, 52, 56, 52, 59, 57, 53, 53, 55, 52, 57, 51, 58, 53,
+    56, 55, 49, 65, 49, 55, 49, 50, 61, 57, 53, 44, 59, 59, 48, 45,
+    67, 55, 58, 59, 66, 55, 61, 46, 56, 56, 67, 53, 53, 55, 52, 52,
+    44, 57, 52, 49, 57, 62, 54, 54, 58, 54, 57, 47, 54, 51, 43, 53,
+    46, 58, 55, 59, 59, 53, 61, 53, 62, 61, 61, 57, 43, 52, 59, 55,
+    49, 65, 50, 58, 58, 53, 49, 56, 61, 58, 62, 61, 57, 46, 64, 57,
+    64, 56, 62, 55, 50, 62, 45, 61, 55, 56, 58, 63, 51, 53, 50, 54,
+    62, 48, 59, 58, 55, 62, 57, 59, 61, 41, 62, 57, 47, 52, 48, 55,
+    47, 61, 46, 52, 59, 53, 57, 60, 54, 52, 61, 60, 48, 54, 48, 66,
+    52, 50, 52, 51, 56, 51, 64, 49, 52, 44, 52, 56, 51, 48, 53, 57,
+    56, 58, 58, 51, 61, 45, 64, 51, 56, 67, 54, 50, 59, 47, 57, 60,
+    60, 49, 51, 63, 55, 63, 51, 57, 56, 53, 69, 56, 60, 52, 59, 51,
+    62, 60, 51, 64, 45, 51, 58, 53, 46, 58, 58, 49, 51, 53, 66, 56,
+    55, 52, 50, 50, 53, 60, 60, 48, 48, 41, 59, 53, 46, 58, 44, 53,
+    54, 50, 54, 59, 45, 67, 57, 50, 60, 62, 53, 60, 47, 55, 52, 61,
+    56, 59, 46, 56, 58, 64, 54, 64, 51, 62, 53, 47, 47, 54, 50, 55,
+    55, 55, 57, 61, 62, 61, 53, 54, 55, 55, 51, 46, 52, 56, 56, 55,
+    65, 56, 51, 56, 55, 50, 48, 53, 55, 51, 61, 57, 47, 65, 51, 43,
+    56, 55, 51, 64, 51, 53, 61, 55, 51, 54, 58, 55, 56, 61, 70, 51,
+    52, 59, 50, 58, 53, 55, 52, 49, 51, 51, 50, 57, 50, 55, 56, 60,
+    59, 64, 69, 51, 43, 67, 55, 53, 64, 48, 54, 50, 49, 63, 70, 52,
+    56, 57, 44, 54, 50, 55, 56, 54, 59, 53, 56, 53, 60, 53, 62, 56,
+    74, 52, 51, 51, 59, 52, 56, 53, 48, 60, 52, 46, 59, 49, 48, 61,
+    53, 56, 46, 50, 56, 60, 60, 52, 50, 49, 58, 68, 48, 55, 52, 53,
+    61, 52, 45, 62, 55, 66, 52, 53, 54, 55, 39, 56, 51, 59, 49, 54,
+    57, 64, 50, 63, 64, 50, 48, 50, 58, 59, 54, 58, 50, 59, 58, 61,
+    62, 65, 50, 53, 57, 66, 52, 47, 57, 51, 56, 55, 58, 64, 56, 49,
+    57, 51, 43, 56, 53, 59, 56, 57, 54, 56, 57, 54, 51, 49, 61, 51,
+    53, 48, 58, 44, 52, 46, 52, 51, 46, 57, 60, 59, 59, 54, 53, 47,
+    51, 44, 53, 58, 53, 46, 45, 49, 54, 57, 63, 49, 49, 57, 51, 54,
+    62, 59, 54, 47, 53, 57, 56, 57, 54, 54, 56, 51, 54, 51, 59, 48,
+    56, 50, 51, 56, 60, 52, 65, 62, 57, 52, 56, 60, 58, 56, 53, 53,
+    46, 65, 60, 54, 52, 61, 44, 52, 51, 55, 49, 47, 57, 63, 61, 51,
+    59, 48, 47, 49, 64, 54, 59, 57, 50, 62, 48, 58, 54, 63, 58, 66,
+    49, 53, 65, 59, 54, 57, 59, 57, 56, 58, 58, 59, 53, 52, 53, 59,
+    55, 60, 61, 53, 46, 64, 49, 52, 58, 60, 52, 55, 49, 57, 55, 55,
+    48, 65, 44, 53, 61, 64, 60, 64, 61, 59, 53, 45, 48, 57, 54, 54,
+    55, 56, 42, 63, 54, 49, 51, 52, 60, 53, 68, 57, 51, 48, 49, 53,
+    63, 49, 61, 49, 57, 48, 58, 56, 62, 54, 56, 56, 56, 48, 55, 56,
+    59, 45, 51, 55, 50, 51, 51, 56, 59, 59, 61, 52, 51, 65, 46, 50,
+    55, 54, 52, 46, 55, 66, 49, 60, 49, 57, 52, 57, 53, 48, 54, 59,
+    50, 48, 46, 51, 62, 52, 63, 51, 64, 62, 58, 53, 52, 53, 62, 47,
+    51, 62, 57, 51, 53, 47, 50, 49, 58, 60, 56, 52, 57, 55, 48, 50,
+    57, 52, 61, 54, 56, 55, 57, 60, 52, 53, 54, 51, 55, 65, 57, 64,
+    67, 48, 57, 62, 50, 61, 57, 57, 61, 52, 62, 60, 53, 56, 55, 61,
+    56, 56, 46, 47, 61, 61, 61, 50, 44, 54, 56, 69, 53, 54, 50, 56,
+    55, 56, 61, 54, 63, 49, 57, 49, 60, 64, 57, 50, 56, 66, 46, 60,
+    49, 62, 49, 57, 59, 52, 50, 54, 69, 59, 58, 57, 50, 50, 67, 51,
+    51, 59, 51, 55, 54, 55, 62, 55, 54, 49, 60, 64, 48, 52, 57, 38,
+    52, 63, 58, 50, 62, 57, 62, 56, 49, 47, 58, 58, 53, 53, 58, 50,
+    58, 58, 52, 55, 50, 60, 55, 57, 54, 47, 55, 48, 53, 64, 47, 59,
+    53, 51, 66, 54, 59, 64, 45, 45, 49, 52, 54, 58, 58, 50, 48, 58,
+    42, 58, 60, 47, 53, 55, 55, 54, 55, 57, 53, 58, 68, 61, 55, 59,
+    57, 50, 50, 61, 57, 45, 60, 48, 64, 52, 57, 59, 56, 53, 55, 56,
+    57, 71, 53, 53, 60, 54, 55, 55, 51, 62, 53, 64, 58, 56, 50, 54,
+    55, 48, 70, 61, 54, 60, 52, 55, 44, 44, 50, 51, 63, 54, 51, 54,
+    56, 55, 52, 45, 59, 57, 46, 53, 57, 63, 54, 52, 61, 49, 62, 57,
+    56, 56, 54, 63, 64, 60, 57, 62, 59, 54, 53, 43, 56, 52, 59, 58,
+    46, 53, 58, 61, 48, 51, 55, 57, 59, 55, 57, 54, 55, 56, 50, 56,
+    57, 49, 55, 41, 58, 63, 56, 57, 54, 62, 56, 64, 44, 49, 60, 62,
+    59, 57, 51, 56, 60, 55, 59, 55, 46, 61, 59, 56, 58, 50, 58, 49,
+    56, 53, 59, 55, 53, 46, 58, 51, 59, 58, 69, 55, 54, 54, 51, 43,
+    46, 54, 62, 54, 50, 54, 50, 57, 51, 48, 57, 58, 49, 44, 55, 58,
+    51, 54, 52, 61, 53, 59, 46, 57, 58, 51, 61, 61, 60, 52, 59, 57,
+    53, 48, 49, 52, 54, 48, 59, 49, 55, 61, 60, 64, 52, 56, 60, 60,
+    67, 53, 52, 51, 45, 57, 54, 49, 53, 53, 50, 59, 54, 58, 55, 53,
+    62, 51, 60, 49, 52, 56, 54, 48, 53, 54, 57, 63, 51, 59, 48, 55,
+    47, 51, 57, 58, 45, 57, 56, 62, 43, 52, 68, 43, 56, 55, 60, 51,
+    61, 52, 52, 54, 59, 53, 55, 51, 55, 58, 57, 52, 67, 50, 56, 59,
+    63, 53, 54, 49, 53, 53, 53, 60, 55, 55, 58, 51, 60, 56, 55, 54,
+    45, 59, 69, 51, 62, 53, 44, 51, 59, 47, 58, 60, 59, 50, 56, 59,
+    45, 55, 58, 48, 50, 50, 53, 58, 53, 49, 53, 60, 59, 51, 58, 52,
+    55, 53, 63, 57, 52, 55, 58, 52, 62, 62, 55, 60, 59, 53, 41, 58,
+    43, 64, 57, 59, 54, 46, 56, 56, 53, 52, 49, 57, 51, 53, 50, 63,
+    58, 54, 60, 58, 55, 51, 49, 52, 50, 54, 60, 59, 59, 59, 56, 56,
+    55, 52, 55, 66, 53, 56, 57, 57, 54, 60, 49, 53, 54, 55, 60, 65,
+    52, 62, 59, 64, 49, 56, 58, 65, 54, 54, 51, 54, 49, 65, 45, 54,
+    55, 55, 58, 54, 56, 48, 53, 58, 59, 47, 61, 54, 58, 64, 59, 50,
+    53, 52, 61, 52, 57, 47, 49, 50, 65, 48, 55, 71, 45, 68, 64, 49,
+    48, 50, 51, 53, 55, 59, 44, 56, 58, 51, 68, 61, 54, 48, 51, 56,
+    59, 50, 55, 52, 57, 64, 52, 66, 54, 57, 58, 59, 56, 52, 51, 51,
+    54, 44, 48, 52, 59, 49, 59, 53, 49, 56, 54, 53, 50, 73, 63, 61,
+    57, 55, 57, 48, 58, 59, 51, 61, 61, 59, 57, 66, 53, 65, 50, 54,
+    51, 55, 62, 54, 53, 55, 59, 56, 67, 54, 51, 47, 54, 54, 48, 66,
+    58, 46, 55, 63, 56, 50, 59, 53, 49, 58, 54, 48, 61, 58, 53, 55,
+    51, 50, 56, 60, 56, 50, 56, 50, 53, 53, 57, 50, 60, 59, 55, 58,
+    59, 60, 45, 52, 55, 48, 59, 65, 60, 52, 58, 56, 59, 45, 47, 50,
+    49, 60, 55, 49, 62, 66, 53, 46, 58, 56, 54, 50, 51, 50, 54, 53,
+    64, 66, 53, 54, 59, 52, 50, 56, 58, 53, 57, 55, 57, 52, 57, 62,
+    62, 55, 47, 53, 60, 51, 52, 54, 53, 56, 49, 55, 49, 69, 53, 44,
+    69, 72, 58, 52, 56, 59, 49, 53, 47, 52, 63, 59, 58, 58, 55, 59,
+    55, 48, 57, 65, 47, 41, 59, 51, 61, 52, 59, 54, 57, 58, 60, 48,
+    60, 67, 70, 57, 57, 63, 54, 58, 54, 59, 57, 52, 56, 51, 50, 62,
+    61, 61, 50, 53, 72, 57, 53, 62, 48, 49, 52, 52, 49, 46, 54, 55,
+    59, 56, 50, 54, 58, 52, 52, 60, 50, 55, 52, 59, 56, 64, 59, 61,
+    47, 51, 61, 53, 56, 54, 53, 64, 53, 62, 51, 54, 55, 58, 54, 54,
+    58, 58, 60, 54, 66, 59, 52, 55, 58, 56, 55, 53, 49, 61, 49, 52,
+    52, 52, 56, 62, 63, 56, 58, 56, 57, 49, 56, 56, 55, 56, 55, 49,
+    60, 53, 54, 58, 59, 59, 50, 59, 55, 49, 60, 56, 58, 52, 69, 52,
+    59, 60, 48, 45, 66, 52, 61, 51, 51, 58, 58, 55, 53, 50, 63, 56,
+    58, 52, 49, 61, 46, 53, 58, 55, 53, 60, 58, 64, 50, 58, 54, 60,
+    58, 46, 55, 51, 50, 70, 50, 50, 57, 62, 57, 55, 58, 63, 57, 55,
+    46, 55, 57, 55, 45, 48, 54, 49, 54, 50, 58, 59, 60, 56, 53, 55,
+    53, 51, 50, 58, 53, 50, 51, 63, 51, 65, 52, 48, 60, 54, 61, 60,
+    51, 58, 51, 45, 66, 58, 51, 51, 63, 59, 47, 49, 59, 48, 55, 53,
+    55, 56, 45, 52, 59, 52, 54, 54, 56, 56, 58, 52, 50, 60, 55, 58,
+    46, 51, 62, 51, 47, 54, 55, 56, 61, 74, 54, 57, 60, 62, 58, 54,
+    58, 59, 52, 39, 60, 60, 53, 66, 53, 53, 64, 50, 53, 53, 51, 53,
+    59, 58, 67, 48, 51, 54, 56, 52, 53, 49, 54, 52, 55, 53, 53, 60,
+    51, 54, 57, 56, 55, 55, 55, 40, 53, 49, 64, 53, 56, 46, 62, 53,
+    51, 47, 68, 53, 51, 54, 52, 56, 50, 51, 52, 50, 50, 57, 60, 48,
+    57, 52, 56, 56, 55, 56, 59, 53, 67, 51, 52, 50, 48, 62, 57, 46,
+    60, 52, 51, 59, 53, 57, 58, 59, 61, 49, 60, 55, 58, 64, 50, 53,
+    54, 57, 42, 50, 56, 59, 46, 55, 53, 57, 51, 52, 62, 41, 52, 74,
+    57, 61, 59, 56, 64, 43, 47, 57, 52, 61, 50, 55, 51, 63, 57, 64,
+    50, 53, 64, 57, 52, 58, 52, 63, 64, 53, 52, 54, 53, 52, 52, 52,
+    47, 54, 54, 53, 56, 52, 58, 53, 47, 62, 53, 59, 52, 57, 54, 65,
+    59, 57, 55, 53, 70, 47, 61, 50, 62, 57, 54, 54, 57, 52, 50, 63,
+    57, 54, 60, 50, 58, 48, 58, 52, 54, 60, 52, 58, 51, 66, 52, 65,
+    58, 56, 52, 54, 57, 53, 53, 51, 55, 55, 60, 58, 52, 53, 68, 51,
+    58, 53, 53, 56, 58, 46, 65, 54, 48, 58, 60, 53, 59, 56, 54, 47,
+    56, 53, 52, 57, 62, 56, 54, 54, 57, 66, 58, 55, 52, 52, 53, 54,
+    54, 46, 57, 57, 63, 58, 61, 46, 52, 55, 57, 56, 50, 50, 53, 38,
+    55, 55, 47, 58, 59, 49, 66, 54, 51, 60, 51, 46, 54, 53, 55, 51,
+    62, 52, 55, 45, 56, 55, 51, 47, 58, 57, 53, 52, 54, 59, 50, 61,
+    48, 58, 55, 45, 56, 58, 53, 62, 54, 55, 53, 53, 52, 65, 51, 57,
+    56, 54, 51, 65, 50, 57, 58, 52, 52, 51, 53, 40, 54, 56, 53, 59,
+    55, 65, 52, 53, 58, 57, 49, 67, 48, 53, 59, 55, 54, 47, 61, 58,
+    62, 59, 52, 67, 58, 64, 45, 52, 53, 59, 55, 50, 51, 51, 58, 58,
+    46, 59, 46, 57, 50, 52, 57, 50, 51, 58, 56, 58, 61, 56, 60, 51,
+    56, 61, 53, 46, 53, 57, 63, 65, 51, 53, 60, 56, 55, 52, 60, 62,
+    58, 57, 53, 48, 57, 58, 67, 46, 51, 49, 55, 45, 49, 54, 55, 45,
+    60, 46, 53, 48, 59, 63, 62, 49, 59, 51, 64, 45, 63, 59, 48, 50,
+    50, 61, 57, 46, 53, 57, 52, 54, 54, 53, 66, 57, 58, 66, 54, 62,
+    58, 51, 57, 53, 59, 59, 60, 56, 49, 56, 61, 56, 48, 45, 60, 47,
+    54, 55, 43, 57, 47, 67, 42, 66, 60, 53, 68, 60, 46, 58, 56, 60,
+    46, 46, 49, 58, 46, 56, 58, 55, 49, 56, 47, 46, 61, 41, 56, 63,
+    60, 55, 59, 44, 53, 55, 58, 51, 61, 56, 47, 59, 68, 63, 56, 58,
+    48, 54, 57, 57, 53, 58, 58, 55, 49, 52, 53, 48, 61, 50, 55, 43,
+    58, 51, 61, 60, 45, 69, 56, 49, 44, 58, 48, 47, 65, 63, 48, 52,
+    59, 62, 55, 51, 56, 52, 59, 56, 58, 40, 57, 56, 50, 58, 50, 52,
+    49, 47, 55, 50, 62, 56, 56, 52, 41, 61, 63, 56, 63, 47, 52, 57,
+    56, 64, 61, 53, 59, 49, 54, 54, 62, 58, 46, 48, 58, 54, 44, 55,
+    68, 60, 51, 56, 52, 55, 57, 55, 61, 56, 51, 64, 44, 51, 54, 56,
+    68, 61, 57, 60, 50, 62, 46, 63, 53, 57, 65, 56, 53, 53, 39, 58,
+    46, 52, 57, 50, 57, 54, 55, 52, 58, 61, 58, 50, 48, 53, 55, 47,
+    62, 55, 53, 54, 47, 62, 60, 46, 52, 61, 52, 61, 51, 57, 62, 51,
+    62, 66, 56, 60, 48, 55, 55, 51, 57, 59, 54, 60, 52, 60, 54, 50,
+    56, 47, 51, 57, 55, 54, 56, 52, 52, 62, 49, 56, 49, 47, 56, 58,
+    55, 61, 51, 54, 57, 63, 48, 60, 51, 59, 57, 61, 58, 58, 60, 54,
+    46, 60, 53, 54, 53, 53, 52, 58, 57, 59, 47, 59, 47, 50, 59, 53,
+    51, 58, 57, 58, 60, 60, 53, 49, 48, 60, 64, 49, 53, 56, 49, 53,
+    59, 43, 53, 55, 64, 55, 54, 58, 48, 64, 49, 56, 60, 59, 55, 53,
+    50, 56, 50, 66, 49, 48, 59, 59, 56, 55, 56, 67, 54, 65, 59, 56,
+    53, 63, 50, 50, 54, 49, 58, 53, 65, 52, 63, 52, 51, 57, 55, 55,
+    65, 54, 61, 53, 53, 59, 62, 54, 60, 43, 47, 59, 59, 57, 47, 53,
+    60, 63, 53, 58, 51, 45, 58, 58, 53, 59, 56, 54, 61, 43, 69, 60,
+    48, 51, 51, 42, 57, 56, 53, 57, 61, 47, 63, 54, 50, 62, 61, 57,
+    47, 50, 56, 41, 57, 57, 62, 49, 54, 62, 58, 56, 56, 54, 60, 70,
+    55, 63, 55, 59, 57, 54, 61, 57, 53, 56, 54, 48, 47, 52, 61, 56,
+    46, 51, 52, 56, 57, 51, 60, 50, 61, 57, 61, 47, 59, 50, 50, 55,
+    52, 46, 45, 58, 51, 64, 48, 53, 57, 49, 55, 57, 55, 63, 67, 54,
+    51, 56, 64, 54, 60, 52, 58, 54, 55, 62, 55, 51, 65, 65, 49, 57,
+    62, 42, 49, 57, 49, 51, 55, 55, 59, 44, 48, 61, 49, 53, 54, 40,
+    57, 52, 51, 59, 44, 56, 64, 54, 54, 51, 63, 59, 59, 48, 51, 54,
+    53, 51, 55, 62, 63, 55, 54, 60, 50, 51, 50, 63, 58, 55, 66, 47,
+    55, 49, 46, 45, 43, 53, 52, 55, 57, 50, 59, 52, 57, 54, 50, 49,
+    60, 53, 50, 56, 61, 42, 60, 50, 50, 51, 60, 62, 57, 47, 46, 46,
+    60, 58, 63, 56, 61, 49, 66, 59, 60, 56, 62, 48, 59, 53, 57, 43,
+    44, 49, 55, 49, 57, 57, 43, 57, 57, 59, 53, 55, 61, 58, 51, 45,
+    53, 44, 55, 61, 58, 48, 51, 58, 50, 48, 58, 60, 60, 49, 66, 54,
+    55, 58, 46, 43, 54, 55, 54, 58, 48, 51, 59, 54, 49, 69, 54, 50,
+    57, 49, 51, 52, 62, 50, 52, 49, 58, 63, 59, 57, 64, 52, 48, 55,
+    50, 45, 57, 55, 57, 57, 63, 51, 50, 57, 60, 58, 50, 66, 58, 45,
+    50, 62, 53, 52, 57, 53, 56, 61, 58, 61, 50, 51, 51, 57, 56, 54,
+    59, 58, 49, 52, 69, 56, 48, 53, 52, 60, 59, 58, 64, 50, 53, 53,
+    58, 49, 59, 54, 58, 52, 55, 58, 48, 50, 58, 48, 53, 45, 62, 53,
+    54, 60, 53, 52, 56, 57, 59, 56, 49, 62, 48, 55, 54, 49, 56, 50,
+    60, 55, 58, 58, 54, 58, 59, 55, 54, 49, 48, 56, 46, 63, 62, 60,
+    52, 55, 51, 55, 57, 52, 42, 55, 55, 50, 61, 60, 54, 53, 60, 52,
+    57, 55, 59, 60, 48, 62, 54, 51, 56, 54, 54, 55, 48, 61, 56, 55,
+    52, 56, 50, 65, 54, 63, 49, 51, 53, 71, 68, 50, 54, 52, 54, 59,
+    54, 56, 62, 42, 58, 48, 52, 54, 47, 46, 50, 48, 61, 67, 53, 48,
+    59, 62, 57, 50, 60, 60, 57, 57, 54, 61, 59, 66, 49, 68, 59, 52,
+    46, 48, 42, 61, 42, 51, 61, 49, 53, 47, 58, 50, 58, 52, 48, 49,
+    55, 52, 43, 59, 60, 60, 57, 56, 54, 50, 55, 48, 57, 59, 69, 52,
+    59, 58, 61, 55, 51, 52, 56, 59, 48, 48, 51, 51, 49, 54, 60, 52,
+    51, 50, 61, 67, 59, 61, 59, 54, 51, 55, 59, 56, 51, 55, 61, 48,
+    52, 55, 57, 52, 61, 48, 62, 54, 52, 62, 67, 50, 51, 41, 60, 48,
+    53, 61, 57, 57, 53, 51, 65, 66, 55, 53, 60, 50, 53, 56, 55, 56,
+    55, 55, 53, 57, 55, 55, 58, 67, 54, 56, 55, 55, 52, 43, 50, 65,
+    49, 64, 62, 51, 53, 64, 48, 57, 54, 54, 42, 48, 55, 56, 59, 50,
+    55, 50, 61, 52, 42, 56, 51, 55, 51, 56, 45, 51, 58, 58, 58, 53,
+    57, 60, 51, 49, 63, 49, 62, 63, 56, 55, 56, 54, 54, 58, 51, 53,
+    50, 57, 62, 58, 58, 58, 57, 59, 46, 51, 56, 45, 56, 57, 57, 61,
+    55, 51, 62, 52, 54, 60, 52, 53, 65, 52, 53, 51, 56, 55, 52, 52,
+    51, 50, 65, 62, 52, 48, 56, 55, 58, 64, 52, 59, 61, 67, 49, 59,
+    61, 53, 44, 57, 62, 51, 60, 61, 62, 57, 53, 58, 53, 51, 57, 51,
+    52, 53, 58, 55, 57, 59, 57, 54, 59, 56, 54, 48, 59, 56, 57, 60,
+    52, 47, 63, 51, 52, 57, 50, 48, 49, 65, 49, 43, 60, 63, 57, 62,
+    51, 48, 52, 48, 51, 48, 56, 53, 56, 52, 49, 48, 58, 57, 52, 46,
+    59, 69, 55, 48, 54, 49, 55, 53, 57, 61, 56, 50, 52, 47, 58, 59,
+    53, 56, 52, 52, 46, 49, 57, 59, 61, 58, 59, 58, 57, 58, 58, 55,
+    54, 60, 60, 59, 47, 64, 58, 63, 60, 57, 63, 55, 57, 57, 47, 57,
+    54, 57, 58, 58, 56, 51, 52, 55, 49, 49, 56, 55, 57, 51, 58, 61,
+    58, 45, 58, 58, 57, 64, 61, 55, 58, 58, 55, 55, 50, 59, 54, 60,
+    62, 53, 55, 50, 44, 55, 45, 64, 61, 46, 55, 56, 59, 54, 66, 46,
+    55, 61, 61, 56, 50, 56, 66, 42, 63, 50, 60, 62, 57, 51, 58, 59,
+    56, 56, 58, 54, 57, 50, 49, 53, 59, 56, 61, 53, 61, 63, 53, 55,
+    51, 52, 53, 50, 46, 62, 54, 51, 56, 51, 56, 60, 51, 49, 57, 51,
+    55, 56, 56, 57, 56, 57, 49, 53, 66, 40, 58, 60, 59, 51, 57, 45,
+    56, 64, 53, 50, 47, 58, 56, 52, 60, 53, 52, 43, 65, 52, 56, 55,
+    56, 53, 60, 60, 45, 58, 55, 61, 63, 53, 54, 54, 52, 55, 50, 53,
+    56, 55, 57, 46, 64, 57, 55, 61, 51, 56, 57, 52, 47, 65, 59, 50,
+    59, 53, 57, 46, 59, 64, 59, 49, 49, 51, 51, 55, 50, 49, 53, 54,
+    49, 54, 60, 55, 55, 62, 55, 63, 48, 58, 49, 60, 52, 51, 57, 63,
+    58, 56, 59, 51, 51, 55, 60, 54, 58, 47, 55, 53, 58, 58, 53, 43,
+    57, 57, 61, 59, 50, 54, 57, 47, 60, 53, 51, 54, 63, 50, 61, 62,
+    59, 60, 58, 55, 58, 55, 67, 57, 53, 51, 55, 51, 52, 59, 44, 58,
+    54, 57, 55, 48, 48, 57, 52, 58, 51, 59, 54, 42, 51, 65, 54, 49,
+    45, 45, 60, 55, 49, 45, 62, 57, 56, 60, 58, 64, 53, 52, 61, 57,
+    50, 55, 52, 51, 48, 53, 53, 53, 66, 42, 53, 54, 49, 60, 58, 56,
+    61, 53, 55, 53, 47, 51, 51, 58, 52, 52, 48, 64, 59, 52, 55, 59,
+    55, 50, 52, 44, 59, 51, 51, 53, 53, 64, 59, 56, 61, 56, 51, 58,
+    43, 48, 57, 47, 52, 69, 50, 50, 60, 51, 54, 62, 51, 65, 61, 47,
+    40, 63, 60, 45, 57, 46, 52, 60, 63, 52, 58, 61, 54, 64, 52, 51,
+    44, 52, 48, 52, 62, 59, 49, 59, 47, 59, 60, 62, 49, 50, 55, 58,
+    57, 63, 54, 50, 41, 56, 59, 54, 55, 60, 42, 56, 61, 51, 50, 58,
+    50, 48, 63, 50, 52, 56, 61, 58, 58, 54, 50, 48, 49, 48, 57, 45,
+    47, 63, 60, 52, 53, 43, 59, 58, 59, 57, 52, 55, 56, 52, 50, 52,
+    60, 55, 61, 49, 55, 50, 58, 56, 52, 49, 55, 53, 48, 57, 60, 49,
+    64, 59, 55, 49, 68, 50, 56, 40, 62, 51, 50, 51, 50, 55, 50, 58,
+    58, 57, 59, 56, 63, 55, 58, 54, 48, 59, 48, 50, 55, 49, 53, 55,
+    62, 61, 55, 58, 54, 60, 61, 52, 55, 51, 55, 49, 51, 63, 52, 57,
+    52, 55, 55, 49, 57, 57, 59, 57, 61, 58, 59, 52, 60, 54, 44, 62,
+    65, 62, 54, 52, 51, 57, 48, 62, 38, 46, 58, 48, 55, 54, 62, 53,
+    51, 54, 47, 56, 54, 53, 55, 58, 55, 60, 51, 54, 53, 59, 55, 62,
+    55, 52, 63, 60, 58, 56, 58, 45, 64, 47, 49, 57, 55, 55, 52, 44,
+    56, 46, 63, 65, 51, 49, 47, 50, 48, 52, 56, 62, 66, 53, 51, 52,
+    54, 61, 48, 47, 51, 60, 66, 55, 52, 51, 54, 56, 58, 54, 65, 47,
+    54, 43, 51, 56, 58, 64, 53, 61, 55, 53, 52, 57, 52, 50, 55, 47,
+    51, 62, 58, 56, 53, 60, 47, 54, 54, 57, 55, 60, 54, 63, 56, 51,
+    52, 60, 58, 56, 44, 55, 57, 64, 46, 59, 60, 56, 68, 50, 45, 62,
+    50, 55, 49, 53, 54, 53, 55, 57, 52, 61, 55, 58, 56, 50, 52, 54,
+    52, 51, 53, 50, 59, 61, 53, 59, 55, 59, 53, 56, 57, 56, 59, 46,
+    57, 55, 50, 52, 57, 56, 54, 52, 52, 53, 60, 51, 56, 50, 62, 51,
+    66, 44, 48, 48, 59, 52, 64, 56, 53, 55, 47, 63, 49, 62, 59, 55,
+    68, 50, 57, 65, 56, 51, 53, 55, 56, 60, 48, 55, 58, 49, 52, 61,
+    56, 58, 56, 51, 51, 48, 53, 65, 53, 53, 52, 58, 58, 49, 58, 47,
+    59, 59, 58, 55, 58, 52, 42, 54, 52, 54, 51, 57, 56, 52, 51, 48,
+    59, 56, 50, 58, 62, 50, 56, 64, 52, 49, 58, 53, 61, 48, 50, 53,
+    62, 61, 57, 58, 58, 60, 50, 51, 60, 56, 54, 51, 44, 54, 60, 54,
+    61, 57, 59, 46, 50, 55, 63, 54, 54, 63, 49, 58, 52, 42, 53, 54,
+    58, 59, 56, 56, 47, 56, 62, 61, 55, 58, 62, 56, 55, 51, 50, 51,
+    49, 57, 62, 62, 49, 56, 48, 60, 56, 51, 56, 63, 51, 58, 60, 51,
+    50, 56, 54, 58, 61, 60, 51, 52, 50, 61, 49, 57, 59, 49, 49, 56,
+    53, 52, 54, 48, 58, 52, 46, 47, 47, 58, 50, 50, 43, 55, 57, 54,
+    51, 43, 62, 60, 50, 55, 44, 69, 59, 57, 52, 54, 48, 51, 54, 59,
+    60, 56, 54, 56, 56, 57, 63, 42, 53, 52, 51, 64, 61, 45, 56, 55,
+    63, 64, 42, 54, 46, 65, 59, 56, 50, 39, 56, 58, 68, 44, 56, 57,
+    51, 58, 42, 58, 59, 54, 55, 58, 50, 51, 51, 49, 53, 47, 59, 61,
+    62, 54, 53, 54, 55, 66, 56, 54, 51, 61, 56, 62, 53, 62, 59, 53,
+    57, 55, 61, 57, 59, 50, 58, 65, 51, 62, 54, 47, 51, 58, 47, 55,
+    57, 59, 57, 60, 71, 60, 51, 49, 51, 51, 56, 56, 60, 57, 53, 57,
+    59, 48, 59, 43, 59, 55, 57, 52, 61, 60, 51, 48, 62, 54, 52, 67,
+    52, 55, 46, 53, 48, 50, 57, 59, 50, 53, 61, 49, 56, 60, 54, 47,
+    40, 55, 53, 55, 52, 47, 46, 57, 63, 49, 64, 58, 66, 54, 55, 63,
+    56, 61, 64, 46, 62, 47, 49, 56, 62, 58, 51, 53, 56, 52, 56, 58,
+    50, 57, 56, 57, 56, 44, 62, 58, 61, 53, 69, 56, 59, 56, 55, 66,
+    48, 43, 52, 61, 57, 61, 57, 46, 55, 54, 55, 58, 56, 65, 50, 53,
+    52, 55, 51, 57, 55, 52, 63, 55, 49, 47, 52, 59, 49, 60, 53, 57,
+    56, 56, 55, 57, 55, 58, 53, 57, 55, 55, 60, 52, 57, 59, 57, 51,
+    54, 55, 54, 46, 58, 57, 64, 55, 58, 57, 43, 48, 56, 55, 52, 51,
+    59, 49, 58, 62, 65, 65, 55, 47, 57, 59, 52, 47, 59, 60, 59, 57,
+    51, 65, 56, 61, 53, 44, 57, 47, 64, 53, 66, 57, 46, 63, 51, 53,
+    60, 57, 56, 55, 56, 54, 71, 59, 58, 60, 59, 55, 59, 55, 56, 52,
+    50, 60, 54, 58, 58, 62, 56, 59, 58, 50, 71, 43, 59, 62, 48, 48,
+    53, 53, 54, 55, 55, 59, 49, 62, 49, 53, 55, 55, 58, 58, 44, 54,
+    49, 51, 57, 57, 61, 59, 60, 57, 49, 66, 49, 61, 46, 51, 55, 58,
+    55, 63, 59, 41, 57, 52, 47, 62, 58, 51, 57, 60, 51, 44, 54, 48,
+    57, 51, 53, 61, 60, 55, 63, 53, 60, 53, 58, 53, 57, 52, 62, 51,
+    50, 56, 61, 61, 50, 49, 49, 50, 59, 46, 49, 48, 60, 48, 47, 56,
+    54, 61, 51, 60, 59, 57, 51, 61, 57, 53, 56, 44, 63, 54, 54, 48,
+    40, 54, 62, 49, 51, 56, 46, 57, 56, 45, 45, 57, 51, 49, 53, 60,
+    52, 49, 52, 63, 57, 50, 54, 55, 61, 53, 51, 50, 51, 54, 48, 47,
+    54, 58, 60, 52, 51, 44, 48, 59, 62, 56, 60, 60, 56, 47, 63, 52,
+    55, 50, 63, 57, 61, 59, 45, 55, 48, 59, 55, 59, 56, 63, 59, 55,
+    56, 47, 57, 54, 63, 58, 56, 53, 58, 52, 53, 47, 53, 62, 50, 41,
+    57, 58, 56, 53, 57, 59, 65, 51, 55, 44, 50, 59, 52, 52, 53, 47,
+    53, 64, 49, 64, 49, 50, 48, 59, 51, 55, 53, 57, 53, 54, 62, 56,
+    53, 61, 42, 50, 54, 51, 55, 58, 58, 51, 49, 62, 49, 58, 56, 50,
+    50, 51, 58, 57, 52, 58, 63, 56, 54, 56, 53, 53, 55, 44, 50, 52,
+    50, 57, 50, 59, 53, 55, 61, 50, 58, 53, 54, 54, 55, 49, 53, 51,
+    54, 47, 50, 57, 58, 63, 58, 64, 64, 51, 45, 50, 53, 50, 60, 49,
+    51, 62, 57, 52, 57, 58, 53, 52, 56, 60, 55, 53, 57, 63, 55, 46,
+    66, 53, 60, 57, 59, 58, 54, 51, 58, 38, 52, 51, 56, 47, 52, 55,
+    51, 60, 56, 57, 59, 46, 58, 59, 49, 51, 53, 54, 63, 63, 63, 54,
+    57, 56, 46, 57, 50, 49, 63, 45, 52, 53, 55, 47, 66, 53, 57, 60,
+    58, 57, 54, 64, 54, 58, 50, 54, 60, 55, 49, 55, 56, 67, 46, 52,
+    60, 65, 52, 64, 48, 52, 58, 56, 43, 49, 60, 49, 61, 55, 59, 50,
+    64, 53, 51, 52, 61, 65, 47, 50, 54, 47, 52, 47, 56, 51, 58, 54,
+    51, 54, 58, 56, 55, 60, 66, 50, 52, 57, 52, 58, 66, 52, 53, 61,
+    50, 59, 62, 51, 49, 49, 54, 54, 53, 60, 57, 55, 54, 55, 61, 56,
+    55, 55, 49, 49, 62, 54, 44, 43, 59, 51, 57, 55, 52, 56, 57, 51,
+    55, 53, 46, 55, 55, 57, 43, 57, 59, 50, 64, 53, 62, 55, 56, 54,
+    56, 52, 63, 44, 44, 56, 56, 61, 62, 45, 62, 47, 58, 54, 50, 51,
+    52, 55, 55, 54, 62, 62, 58, 55, 46, 57, 55, 57, 61, 51, 55, 58,
+    56, 61, 65, 49, 56, 61, 66, 59, 56, 53, 48, 59, 60, 55, 48, 57,
+    48, 55, 45, 57, 53, 59, 63, 59, 55, 61, 55, 43, 58, 57, 56, 55,
+    59, 67, 59, 59, 54, 56, 52, 53, 58, 59, 51, 59, 63, 63, 57, 57,
+    55, 50, 52, 59, 57, 51, 58, 60, 44, 49, 51, 51, 53, 52, 66, 56,
+    46, 56, 48, 49, 52, 59, 52, 51, 57, 51, 53, 60, 47, 60, 54, 58,
+    59, 56, 47, 52, 57, 61, 56, 54, 46, 57, 55, 57, 50, 53, 58, 49,
+    52, 56, 52, 52, 52, 47, 60, 51, 57, 48, 58, 46, 58, 43, 65, 58,
+    58, 56, 56, 55, 61, 59, 56, 62, 48, 54, 54, 60, 52, 56, 60, 62,
+    51, 51, 46, 53, 50, 47, 60, 50, 51, 45, 59, 52, 53, 58, 57, 52,
+    61, 51, 51, 55, 48, 60, 58, 55, 58, 64, 65, 57, 55, 48, 49, 52,
+    54, 54, 63, 50, 49, 50, 53, 53, 54, 54, 48, 46, 47, 57, 58, 52,
+    54, 62, 55, 45, 51, 50, 55, 53, 61, 60, 61, 50, 58, 55, 49, 58,
+    55, 56, 58, 55, 53, 47, 58, 52, 60, 53, 57, 56, 53, 52, 52, 54,
+    57, 55, 55, 57, 58, 56, 53, 41, 53, 50, 55, 51, 54, 67, 59, 51,
+    60, 57, 60, 43, 59, 59, 51, 51, 56, 50, 51, 53, 52, 62, 50, 61,
+    54, 52, 50, 52, 61, 53, 53, 57, 51, 58, 54, 68, 63, 55, 58, 51,
+    57, 67, 49, 55, 54, 49, 56, 56, 42, 48, 53, 58, 53, 54, 56, 64,
+    58, 56, 50, 49, 54, 59, 51, 54, 62, 63, 47, 61, 56, 57, 56, 47,
+    55, 54, 57, 59, 59, 47, 50, 58, 57, 54, 49, 67, 54, 55, 49, 61,
+    60, 52, 67, 47, 54, 57, 54, 62, 57, 48, 51, 54, 51, 54, 47, 46,
+    65, 48, 58, 52, 58, 60, 54, 53, 52, 51, 57, 62, 59, 62, 58, 51,
+    59, 53, 55, 66, 50, 52, 59, 49, 53, 66, 58, 61, 50, 47, 43, 55,
+    52, 57, 48, 53, 48, 62, 49, 61, 53, 55, 56, 49, 48, 56, 51, 49,
+    54, 41, 63, 62, 48, 53, 59, 59, 64, 55, 53, 60, 49, 57, 53, 61,
+    56, 54, 53, 46, 50, 56, 48, 53, 60, 61, 53, 60, 51, 55, 60, 43,
+    68, 48, 62, 55, 66, 54, 57, 51, 50, 62, 47, 54, 57, 56, 54, 58,
+    61, 45, 50, 53, 57, 59, 58, 52, 51, 53, 54, 50, 53, 46, 58, 58,
+    57, 49, 58, 49, 60, 51, 50, 63, 51, 44, 55, 41, 58, 48, 55, 53,
+    62, 56, 48, 58, 65, 60, 50, 50, 53, 53, 50, 55, 56, 60, 50, 50,
+    48, 57, 64, 61, 54, 50, 57, 50, 60, 50, 53, 45, 64, 57, 48, 44,
+    59, 60, 59, 44, 44, 55, 50, 63, 61, 59, 59, 53, 63, 53, 53, 53,
+    55, 52, 58, 55, 64, 46, 60, 53, 63, 53, 53, 48, 51, 50, 60, 61,
+    59, 64, 57, 53, 57, 57, 57, 53, 61, 63, 49, 54, 48, 46, 57, 47,
+    55, 54, 52, 51, 56, 51, 53, 64, 48, 62, 49, 49, 65, 62, 53, 53,
+    56, 59, 50, 57, 60, 60, 51, 49, 63, 46, 59, 51, 46, 60, 62, 48,
+    54, 56, 53, 59, 54, 52, 50, 50, 43, 60, 53, 49, 47, 56, 50, 60,
+    46, 53, 56, 52, 50, 38, 50, 52, 65, 58, 52, 67, 62, 54, 60, 40,
+    44, 49, 59, 53, 60, 55, 46, 60, 51, 54, 44, 61, 55, 56, 51, 54,
+    49, 64, 57, 58, 53, 64, 61, 55, 57, 59, 55, 54, 59, 55, 53, 56,
+    53, 46, 50, 48, 58, 60, 53, 59, 55, 57, 52, 52, 63, 64, 57, 47,
+    49, 58, 60, 67, 66, 60, 51, 53, 57, 52, 57, 48, 55, 50, 53, 56,
+    44, 57, 57, 56, 52, 49, 55, 51, 50, 60, 52, 41, 60, 44, 54, 51,
+    52, 58, 60, 59, 54, 58, 60, 53, 53, 58, 52, 58, 58, 60, 54, 58,
+    55, 54, 48, 56, 53, 55, 61, 61, 59, 58, 55, 58, 48, 50, 46, 55,
+    51, 47, 71, 55, 61, 54, 59, 47, 45, 57, 56, 55, 45, 66, 62, 60,
+    59, 49, 60, 55, 42, 55, 52, 56, 54, 54, 45, 62, 53, 51, 52, 47,
+    57, 43, 61, 54, 59, 58, 54, 47, 55, 52, 62, 58, 48, 71, 54, 63,
+    51, 56, 50, 58, 59, 50, 53, 46, 46, 56, 58, 54, 50, 50, 57, 64,
+    58, 63, 56, 56, 48, 50, 50, 49, 49, 58, 51, 47, 54, 50, 55, 62,
+    59, 57, 52, 50, 52, 57, 49, 62, 62, 53, 42, 61, 58, 60, 57, 47,
+    61, 56, 61, 58, 60, 56, 52, 64, 49, 60, 61, 60, 55, 55, 60, 47,
+    48, 51, 58, 49, 64, 49, 48, 61, 53, 48, 62, 52, 51, 55, 53, 52,
+    39, 46, 61, 57, 55, 54, 59, 50, 55, 56, 57, 61, 49, 56, 57, 50,
+    52, 54, 54, 57, 60, 53, 51, 58, 50, 60, 53, 52, 59, 59, 59, 55,
+    53, 49, 52, 55, 47, 63, 60, 64, 60, 62, 59, 57, 57, 49, 61, 52,
+    53, 52, 53, 57, 51, 63, 65, 63, 67, 52, 57, 52, 51, 48, 60, 60,
+    50, 55, 64, 47, 59, 56, 59, 59, 49, 48, 43, 60, 52, 49, 42, 51,
+    47, 48, 55, 66, 58, 48, 55, 55, 53, 59, 60, 56, 47, 53, 53, 57,
+    57, 55, 67, 60, 48, 59, 48, 64, 49, 49, 55, 65, 52, 60, 57, 54,
+    51, 58, 48, 55, 48, 61, 55, 53, 56, 60, 61, 60, 54, 56, 56, 60,
+    52, 57, 55, 54, 58, 58, 61, 51, 53, 42, 52, 65, 59, 49, 61, 64,
+    55, 57, 60, 52, 52, 52, 52, 50, 63, 54, 56, 59, 60, 57, 66, 54,
+    64, 49, 55, 56, 58, 45, 60, 57, 54, 52, 55, 59, 53, 53, 54, 41,
+    43, 61, 51, 61, 57, 53, 48, 56, 62, 55, 50, 69, 54, 45, 49, 54,
+    59, 61, 62, 56, 51, 58, 53, 61, 53, 56, 51, 53, 47, 51, 49, 54,
+    56, 53, 51, 47, 50, 71, 51, 55, 47, 60, 56, 62, 53, 57, 46, 60,
+    63, 60, 53, 48, 52, 51, 57, 54, 68, 57, 59, 53, 62, 55, 55, 70,
+    51, 52, 54, 55, 64, 53, 54, 49, 63, 56, 55, 47, 61, 48, 58, 63,
+    57, 53, 51, 43, 51, 65, 49, 52, 58, 53, 57, 60, 55, 64, 49, 61,
+    44, 55, 54, 57, 55, 48, 44, 54, 57, 44, 49, 59, 56, 60, 61, 51,
+    50, 46, 48, 54, 54, 53, 49, 65, 52, 62, 47, 55, 54, 54, 58, 55,
+    50, 52, 58, 56, 57, 57, 54, 54, 60, 56, 47, 61, 45, 55, 49, 49,
+    57, 49, 66, 49, 50, 51, 57, 55, 49, 57, 61, 59, 44, 56, 57, 54,
+    57, 53, 55, 61, 61, 51, 58, 53, 57, 53, 56, 53, 59, 61, 62, 54,
+    53, 54, 46, 49, 53, 61, 45, 53, 59, 55, 66, 52, 55, 56, 58, 59,
+    50, 50, 56, 56, 53, 52, 57, 66, 57, 51, 51, 64, 61, 57, 53, 49,
+    52, 56, 54, 51, 51, 55, 59, 54, 57, 52, 52, 57, 51, 52, 57, 59,
+    40, 60, 57, 62, 55, 60, 50, 51, 53, 61, 50, 47, 49, 56, 53, 56,
+    58, 55, 52, 54, 61, 44, 54, 50, 57, 51, 51, 46, 54, 47, 57, 49,
+    49, 55, 63, 52, 61, 53, 49, 54, 67, 51, 56, 53, 51, 53, 67, 58,
+    59, 49, 54, 61, 57, 55, 58, 55, 61, 56, 58, 55, 49, 55, 52, 63,
+    55, 56, 57, 44, 48, 62, 51, 49, 54, 62, 61, 54, 52, 53, 66, 52,
+    62, 50, 54, 51, 50, 62, 53, 59, 52, 55, 60, 58, 46, 49, 64, 52,
+    66, 43, 54, 56, 45, 58, 57, 48, 44, 60, 57, 52, 57, 46, 64, 62,
+    52, 54, 61, 62, 54, 55, 59, 52, 61, 55, 63, 50, 53, 46, 62, 57,
+    47, 49, 55, 54, 53, 52, 53, 60, 50, 56, 45, 55, 52, 58, 57, 54,
+    56, 68, 59, 54, 41, 54, 54, 50, 69, 51, 54, 61, 56, 56, 61, 52,
+    57, 48, 57, 55, 53, 60, 43, 54, 52, 63, 56, 64, 47, 58, 44, 59,
+    50, 60, 52, 52, 53, 51, 56, 52, 60, 51, 52, 68, 46, 52, 47, 60,
+    55, 69, 49, 56, 60, 59, 55, 59, 65, 54, 49, 54, 46, 54, 49, 64,
+    60, 50, 61, 57, 56, 56, 51, 52, 56, 49, 58, 54, 62, 49, 51, 65,
+    52, 57, 60, 61, 53, 56, 53, 55, 47, 51, 58, 56, 49, 64, 47, 53,
+    58, 54, 58, 56, 51, 65, 45, 44, 62, 58, 46, 52, 52, 64, 57, 51,
+    65, 45, 48, 54, 57, 50, 59, 57, 53, 55, 51, 55, 44, 58, 42, 60,
+    56, 56, 56, 52, 65, 63, 58, 46, 62, 66, 53, 52, 54, 55, 50, 56,
+    52, 56, 48, 52, 56, 57, 48, 57, 52, 64, 58, 51, 57, 52, 58, 54,
+    61, 55, 52, 48, 60, 49, 67, 55, 55, 50, 55, 47, 52, 50, 54, 51,
+    56, 65, 52, 48, 54, 53, 50, 50, 47, 57, 52, 57, 63, 54, 57, 52,
+    54, 53, 55, 55, 51, 52, 61, 58, 62, 55, 50, 49, 50, 60, 65, 52,
+    53, 54, 49, 54, 59, 52, 49, 66, 65, 53, 54, 63, 57, 58, 61, 52,
+    49, 57, 59, 50, 59, 46, 51, 65, 47, 61, 53, 52, 52, 57, 47, 48,
+    58, 58, 53, 46, 58, 63, 55, 48, 60, 63, 65, 59, 58, 54, 56, 52,
+    61, 66, 59, 54, 65, 54, 53, 58, 62, 60, 46, 45, 56, 54, 56, 52,
+    53, 49, 48, 51, 49, 49, 53, 56, 51, 64, 60, 41, 66, 63, 52, 55,
+    52, 53, 58, 61, 55, 55, 55, 53, 57, 45, 58, 57, 54, 56, 46, 54,
+    50, 50, 58, 51, 50, 56, 58, 51, 61, 60, 50, 55, 55, 61, 50, 53,
+    54, 53, 43, 49, 56, 47, 63, 57, 41, 42, 68, 47, 61, 65, 55, 58,
+    54, 55, 52, 60, 58, 57, 44, 61, 51, 47, 49, 53, 53, 60, 42, 57,
+    52, 62, 58, 50, 49, 50, 59, 61, 58, 68, 54, 55, 52, 65, 50, 49,
+    53, 44, 51, 61, 49, 55, 65, 49, 53, 59, 50, 55, 60, 57, 56, 56,
+    58, 49, 61, 55, 59, 56, 47, 48, 53, 55, 48, 57, 46, 57, 59, 57,
+    53, 48, 55, 51, 55, 54, 45, 56, 46, 50, 59, 53, 52, 57, 55, 55,
+    54, 69, 59, 56, 52, 52, 57, 58, 58, 53, 54, 67, 46, 47, 69, 53,
+    49, 54, 49, 50, 56, 48, 59, 51, 49, 60, 37, 66, 56, 60, 52, 59,
+    49, 56, 53, 55, 64, 62, 57, 54, 50, 60, 51, 61, 54, 65, 51, 54,
+    57, 62, 48, 58, 54, 51, 52, 47, 53, 60, 45, 58, 55, 59, 61, 63,
+    53, 72, 55, 52, 55, 52, 45, 60, 50, 56, 52, 59, 42, 58, 55, 55,
+    52, 54, 60, 50, 49, 59, 56, 49, 60, 54, 51, 63, 50, 54, 44, 45,
+    43, 61, 55, 46, 59, 59, 58, 68, 55, 49, 49, 58, 62, 57, 44, 53,
+    55, 51, 56, 56, 57, 50, 63, 56, 61, 56, 46, 60, 57, 52, 60, 55,
+    54, 56, 55, 50, 54, 49, 59, 50, 46, 53, 62, 54, 61, 64, 54, 54,
+    64, 57, 54, 59, 48, 58, 48, 56, 53, 52, 48, 58, 57, 62, 51, 63,
+    49, 50, 56, 50, 60, 53, 51, 48, 56, 57, 53, 53, 56, 47, 54, 49,
+    52, 52, 54, 55, 62, 65, 60, 64, 54, 50, 60, 52, 61, 62, 50, 53,
+    53, 49, 51, 59, 59, 59, 57, 63, 61, 60, 43, 53, 50, 57, 55, 58,
+    51, 58, 47, 60, 58, 53, 64, 64, 50, 54, 45, 67, 57, 52, 53, 47,
+    57, 58, 62, 56, 48, 50, 56, 54, 51, 56, 51, 58, 57, 53, 61, 46,
+    55, 59, 50, 64, 51, 57, 62, 53, 53, 52, 52, 58, 57, 58, 49, 49,
+    59, 35, 57, 53, 57, 62, 53, 55, 59, 50, 58, 57, 60, 62, 54, 62,
+    62, 60, 52, 57, 57, 60, 57, 54, 48, 57, 56, 57, 65, 62, 43, 54,
+    55, 56, 61, 54, 55, 57, 45, 51, 56, 53, 52, 50, 53, 54, 54, 55,
+    60, 56, 52, 54, 48, 52, 50, 59, 53, 51, 61, 54, 59, 62, 63, 58,
+    54, 56, 49, 47, 56, 53, 56, 51, 50, 59, 58, 55, 53, 47, 58, 51,
+    57, 47, 53, 55, 62, 49, 48, 60, 53, 56, 53, 46, 56, 55, 58, 52,
+    50, 47, 67, 55, 53, 57, 55, 52, 61, 50, 47, 53, 52, 58, 51, 61,
+    52, 47, 48, 51, 56, 64, 56, 53, 52, 64, 62, 57, 55, 60, 57, 55,
+    63, 58, 57, 54, 63, 55, 52, 54, 58, 69, 60, 51, 61, 53, 51, 49,
+    54, 57, 54, 52, 58, 52, 52, 52, 46, 59, 59, 44, 45, 45, 61, 54,
+    47, 52, 57, 55, 58, 57, 54, 44, 62, 53, 51, 59, 47, 56, 48, 61,
+    65, 54, 63, 56, 57, 57, 50, 48, 57, 49, 46, 56, 50, 44, 67, 54,
+    55, 58, 52, 59, 61, 60, 58, 53, 50, 48, 53, 47, 57, 53, 52, 56,
+    62, 58, 54, 57, 53, 57, 53, 58, 49, 53, 50, 56, 57, 55, 63, 47,
+    59, 47, 54, 63, 57, 49, 61, 44, 57, 60, 56, 48, 51, 55, 56, 60,
+    60, 50, 53, 50, 53, 55, 47, 60, 52, 55, 59, 53, 62, 57, 52, 45,
+    62, 59, 53, 44, 55, 58, 50, 65, 64, 54, 61, 58, 56, 55, 48, 55,
+    49, 55, 48, 51, 54, 48, 56, 52, 53, 58, 61, 60, 62, 61, 54, 62,
+    57, 61, 49, 56, 48, 53, 56, 57, 56, 56, 55, 47, 50, 54, 49, 63,
+    54, 55, 62, 63, 58, 50, 46, 53, 62, 54, 58, 58, 52, 47, 53, 46,
+    56, 51, 74, 52, 58, 51, 49, 57, 52, 48, 59, 54, 51, 53, 51, 52,
+    51, 51, 60, 50, 70, 49, 56, 50, 55, 52, 55, 53, 55, 51, 47, 42,
+    57, 60, 53, 67, 58, 50, 51, 58, 59, 61, 48, 58, 52, 56, 51, 66,
+    49, 55, 59, 54, 64, 60, 59, 42, 65, 48, 61, 43, 60, 60, 56, 62,
+    60, 58, 55, 41, 55, 53, 68, 52, 54, 52, 47, 51, 60, 59, 50, 62,
+    61, 51, 63, 56, 57, 51, 55, 45, 62, 55, 57, 55, 58, 42, 55, 47,
+    57, 49, 51, 56, 59, 58, 58, 55, 55, 40, 56, 63, 45, 45, 56, 55,
+    60, 50, 57, 56, 60, 56, 55, 55, 60, 50, 61, 41, 51, 49, 59, 53,
+    61, 47, 55, 51, 51, 52, 61, 60, 49, 53, 55, 65, 42, 61, 50, 51,
+    51, 45, 59, 56, 53, 57, 59, 50, 55, 51, 59, 57, 58, 61, 54, 56,
+    49, 59, 58, 54, 60, 51, 51, 51, 54, 58, 54, 59, 48, 47, 62, 60,
+    52, 56, 47, 61, 54, 52, 56, 51, 55, 60, 49, 52, 60, 60, 53, 54,
+    53, 67, 53, 54, 62, 46, 56, 53, 70, 46, 60, 60, 59, 61, 50, 58,
+    55, 61, 59, 48, 50, 56, 61, 45, 58, 54, 49, 49, 60, 54, 58, 53,
+    49, 59, 51, 52, 52, 55, 58, 54, 59, 54, 49, 48, 58, 50, 69, 55,
+    52, 61, 55, 57, 52, 53, 52, 50, 54, 62, 49, 63, 53, 53, 68, 53,
+    60, 60, 57, 44, 57, 57, 52, 58, 54, 55, 58, 49, 58, 48, 54, 49,
+    61, 58, 53, 59, 52, 48, 55, 56, 49, 67, 57, 51, 55, 47, 55, 52,
+    50, 51, 49, 53, 52, 53, 62, 51, 47, 61, 46, 50, 53, 56, 55, 51,
+    53, 51, 44, 53, 62, 53, 49, 58, 52, 58, 55, 51, 55, 45, 62, 51,
+    55, 53, 65, 59, 49, 52, 56, 56, 51, 58, 60, 50, 54, 51, 59, 54,
+    65, 47, 59, 58, 59, 59, 47, 64, 53, 52, 50, 50, 52, 59, 54, 62,
+    59, 62, 60, 50, 53, 57, 47, 55, 53, 61, 61, 50, 49, 44, 52, 57,
+    49, 56, 55, 59, 53, 52, 57, 43, 62, 54, 62, 57, 56, 59, 46, 64,
+    57, 60, 59, 67, 60, 56, 52, 47, 61, 60, 55, 52, 50, 54, 47, 56,
+    56, 53, 49, 66, 41, 57, 58, 61, 61, 55, 60, 48, 61, 41, 67, 58,
+    50, 53, 47, 50, 54, 58, 57, 58, 49, 61, 60, 52, 65, 55, 55, 55,
+    49, 52, 46, 52, 48, 52, 53, 58, 61, 61, 47, 58, 62, 60, 55, 56,
+    49, 52, 58, 49, 61, 50, 44, 58, 46, 54, 54, 54, 55, 60, 50, 53,
+    67, 58, 56, 63, 57, 50, 57, 56, 49, 60, 60, 52, 61, 52, 56, 49,
+    45, 53, 58, 51, 52, 49, 67, 48, 53, 48, 58, 60, 59, 52, 51, 60,
+    49, 56, 51, 52, 55, 60, 61, 50, 58, 55, 62, 57, 55, 59, 47, 51,
+    62, 56, 56, 49, 44, 59, 51, 53, 58, 51, 55, 52, 49, 65, 50, 48,
+    53, 56, 56, 56, 48, 60, 58, 56, 58, 62, 53, 54, 61, 49, 52, 51,
+    48, 50, 54, 58, 61, 56, 46, 50, 57, 59, 54, 48, 61, 58, 53, 51,
+    45, 51, 52, 64, 48, 55, 55, 65, 54, 69, 44, 44, 56, 58, 45, 53,
+    58, 50, 52, 54, 53, 56, 55, 45, 53, 54, 49, 48, 55, 54, 44, 51,
+    54, 52, 51, 53, 55, 50, 40, 54, 62, 57, 47, 64, 53, 58, 53, 54,
+    57, 60, 55, 56, 51, 55, 42, 56, 68, 53, 54, 57, 62, 49, 60, 52,
+    50, 56, 57, 56, 49, 58, 53, 49, 56, 49, 58, 63, 49, 56, 60, 51,
+    57, 52, 57, 55, 51, 51, 57, 52, 64, 54, 54, 53, 58, 47, 67, 58,
+    58, 49, 57, 64, 58, 51, 50, 55, 51, 54, 51, 44, 59, 52, 54, 58,
+    54, 53, 56, 46, 53, 47, 54, 57, 53, 55, 68, 58, 62, 58, 59, 60,
+    44, 52, 48, 56, 52, 59, 63, 61, 54, 53, 58, 66, 57, 53, 54, 46,
+    65, 51, 50, 54, 47, 58, 56, 55, 53, 67, 54, 54, 53, 52, 55, 56,
+    63, 62, 56, 42, 54, 54, 54, 58, 52, 56, 60, 51, 54, 58, 62, 46,
+    53, 52, 57, 62, 49, 50, 51, 57, 54, 54, 54, 56, 52, 47, 60, 58,
+    49, 52, 59, 57, 60, 57, 51, 62, 50, 59, 56, 49, 64, 53, 55, 50,
+    51, 46, 52, 50, 63, 48, 46, 58, 58, 64, 48, 56, 61, 52, 50, 61,
+    54, 51, 60, 52, 60, 53, 57, 59, 47, 64, 60, 49, 58, 47, 61, 53,
+    60, 55, 54, 69, 49, 60, 56, 52, 50, 49, 53, 56, 60, 48, 54, 58,
+    56, 44, 57, 50, 61, 43, 47, 63, 59, 54, 55, 61, 45, 57, 58, 45,
+    61, 60, 58, 53, 56, 58, 58, 53, 53, 53, 44, 54, 57, 48, 51, 67,
+    57, 56, 55, 56, 55, 39, 50, 63, 49, 58, 55, 53, 56, 47, 44, 55,
+    53, 59, 61, 52, 56, 56, 57, 63, 55, 60, 53, 53, 46, 57, 46, 60,
+    53, 52, 60, 55, 57, 55, 50, 60, 61, 60, 51, 51, 55, 53, 59, 52,
+    52, 58, 54, 49, 45, 47, 51, 49, 56, 57, 57, 53, 44, 62, 49, 56,
+    59, 53, 58, 56, 56, 53, 49, 55, 57, 52, 45, 54, 66, 56, 52, 59,
+    62, 54, 52, 54, 54, 48, 53, 53, 60, 49, 68, 44, 50, 54, 54, 57,
+    55, 51, 57, 49, 58, 48, 51, 53, 58, 61, 50, 57, 60, 61, 59, 57,
+    45, 52, 63, 54, 58, 47, 53, 49, 50, 57, 60, 62, 58, 57, 54, 56,
+    46, 63, 51, 60, 50, 49, 52, 51, 55, 53, 60, 46, 57, 56, 59, 55,
+    52, 49, 72, 56, 46, 58, 55, 54, 59, 52, 55, 52, 56, 46, 50, 59,
+    57, 51, 51, 70, 49, 56, 66, 50, 51, 49, 59, 50, 46, 56, 64, 60,
+    60, 58, 61, 50, 54, 42, 61, 51, 48, 57, 57, 61, 62, 52, 49, 51,
+    55, 60, 52, 51, 53, 54, 52, 56, 49, 53, 50, 58, 51, 57, 61, 59,
+    64, 64, 57, 55, 54, 62, 59, 46, 54, 43, 55, 53, 61, 58, 53, 59,
+    56, 56, 50, 66, 60, 55, 50, 52, 62, 53, 55, 46, 55, 52, 47, 54,
+    60, 61, 55, 51, 48, 61, 53, 58, 68, 48, 53, 41, 53, 52, 60, 56,
+    54, 53, 53, 59, 55, 54, 57, 55, 59, 60, 49, 55, 55, 54, 55, 51,
+    62, 57, 45, 61, 52, 48, 55, 63, 57, 60, 50, 46, 54, 55, 54, 58,
+    61, 53, 47, 43, 53, 67, 50, 55, 63, 60, 55, 46, 58, 49, 53, 49,
+    65, 56, 53, 45, 57, 45, 55, 57, 56, 62, 62, 55, 56, 59, 65, 55,
+    52, 59, 60, 64, 68, 50, 57, 57, 51, 46, 54, 46, 48, 55, 55, 58,
+    50, 56, 61, 53, 58, 55, 53, 54, 60, 50, 50, 57, 53, 58, 59, 44,
+    49, 49, 51, 59, 54, 60, 54, 61, 64, 53, 56, 53, 60, 56, 67, 43,
+    45, 65, 66, 56, 59, 51, 54, 51, 48, 57, 50, 61, 50, 48, 58, 57,
+    60, 49, 58, 54, 54, 50, 64, 56, 53, 59, 54, 62, 63, 57, 53, 59,
+    56, 63, 52, 63, 61, 56, 50, 59, 61, 55, 54, 51, 49, 50, 49, 55,
+    59, 48, 54, 63, 56, 57, 62, 51, 58, 64, 46, 57, 59, 49, 53, 55,
+    43, 53, 56, 55, 52, 60, 52, 49, 56, 68, 53, 48, 51, 63, 60, 52,
+    55, 50, 57, 53, 55, 52, 63, 52, 49, 56, 48, 51, 51, 39, 55, 60,
+    55, 53, 60, 47, 61, 50, 53, 57, 57, 52, 54, 59, 48, 48, 40, 48,
+    60, 46, 54, 56, 58, 54, 49, 53, 63, 61, 58, 46, 58, 60, 52, 58,
+    65, 65, 58, 54, 52, 53, 58, 55, 66, 56, 59, 57, 54, 49, 46, 59,
+    50, 45, 50, 52, 64, 50, 61, 49, 61, 47, 49, 50, 54, 50, 57, 60,
+    56, 51, 54, 64, 50, 54, 59, 55, 71, 47, 56, 60, 51, 52, 45, 51,
+    58, 63, 56, 60, 51, 53, 55, 47, 54, 65, 52, 63, 62, 50, 56, 60,
+    58, 52, 61, 53, 61, 59, 58, 60, 63, 64, 59, 54, 57, 57, 47, 52,
+    47, 53, 61, 62, 59, 57, 60, 54, 60, 52, 55, 48, 57, 55, 61, 54,
+    61, 63, 55, 53, 62, 49, 48, 49, 52, 50, 55, 57, 60, 62, 45, 46,
+    51, 62, 49, 58, 55, 52, 58, 57, 58, 46, 62, 57, 48, 61, 56, 50,
+    59, 51, 63, 61, 57, 53, 68, 48, 49, 57, 54, 50, 60, 51, 58, 61,
+    49, 54, 54, 48, 46, 62, 49, 55, 51, 55, 58, 56, 53, 53, 59, 53,
+    66, 56, 57, 53, 46, 55, 50, 56, 58, 48, 51, 56, 64, 57, 53, 52,
+    60, 42, 52, 50, 58, 52, 58, 50, 53, 63, 49, 58, 52, 62, 64, 53,
+    53, 47, 52, 43, 62, 54, 52, 62, 60, 52, 56, 61, 46, 59, 53, 53,
+    56, 54, 55, 59, 50, 44, 61, 50, 51, 50, 48, 58, 46, 46, 61, 56,
+    52, 57, 55, 55, 57, 54, 54, 55, 63, 50, 58, 51, 55, 54, 55, 43,
+    55, 53, 54, 65, 57, 60, 48, 57, 56, 53, 53, 64, 56, 49, 67, 59,
+    63, 60, 46, 58, 58, 55, 58, 54, 60, 55, 60, 52, 46, 54, 46, 55,
+    58, 59, 61, 62, 43, 59, 55, 54, 50, 59, 50, 55, 52, 61, 48, 56,
+    48, 54, 60, 55, 51, 55, 55, 58, 51, 46, 52, 52, 53, 51, 57, 57,
+    58, 52, 57, 57, 47, 48, 54, 50, 45, 57, 56, 57, 46, 62, 68, 48,
+    62, 54, 47, 50, 50, 52, 56, 55, 58, 52, 47, 61, 43, 51, 61, 53,
+    52, 54, 57, 59, 61, 56, 57, 48, 45, 50, 54, 48, 49, 51, 58, 62,
+    54, 43, 55, 51, 54, 65, 50, 54, 50, 58, 53, 50, 50, 56, 53, 53,
+    56, 52, 50, 47, 59, 45, 57, 55, 62, 49, 50, 56, 55, 55, 52, 53,
+    57, 57, 51, 50, 50, 41, 47, 51, 54, 49, 58, 56, 57, 52, 58, 55,
+    49, 56, 55, 56, 67, 50, 55, 48, 57, 60, 51, 53, 41, 54, 51, 58,
+    56, 67, 59, 59, 60, 50, 53, 54, 51, 48, 52, 55, 45, 54, 49, 61,
+    54, 51, 50, 54, 57, 61, 59, 57, 55, 54, 57, 60, 61, 47, 58, 62,
+    57, 58, 53, 59, 53, 54, 54, 49, 53, 62, 57, 53, 64, 50, 53, 51,
+    54, 54, 59, 59, 61, 62, 63, 62, 52, 58, 50, 46, 62, 55, 59, 53,
+    52, 57, 53, 58, 49, 55, 58, 60, 58, 57, 56, 55, 48, 39, 60, 46,
+    61, 59, 56, 54, 44, 57, 59, 57, 48, 48, 59, 52, 58, 51, 46, 55,
+    55, 52, 49, 72, 61, 50, 64, 52, 52, 63, 53, 52, 57, 43, 52, 46,
+    51, 42, 56, 63, 54, 50, 46, 55, 48, 63, 57, 57, 41, 64, 46, 63,
+    56, 59, 50, 43, 57, 59, 63, 54, 60, 55, 52, 52, 57, 60, 61, 52,
+    60, 62, 56, 49, 67, 58, 49, 54, 56, 53, 45, 59, 52, 57, 49, 55,
+    54, 54, 51, 57, 58, 58, 49, 46, 47, 57, 51, 59, 57, 58, 49, 49,
+    57, 62, 51, 54, 53, 51, 61, 65, 59, 51, 49, 65, 51, 52, 56, 57,
+    41, 57, 52, 48, 56, 63, 46, 59, 61, 56, 55, 49, 51, 63, 53, 50,
+    60, 53, 49, 53, 62, 56, 47, 52, 61, 49, 65, 57, 54, 62, 55, 53,
+    60, 43, 63, 50, 52, 52, 58, 50, 59, 61, 58, 56, 54, 53, 54, 54,
+    64, 56, 62, 48, 55, 49, 62, 50, 68, 56, 52, 51, 49, 58, 60, 58,
+    57, 51, 49, 52, 55, 48, 61, 57, 63, 59, 54, 52, 49, 49, 61, 52,
+    60, 54, 57, 56, 59, 59, 58, 64, 52, 60, 55, 48, 46, 51, 63, 49,
+    52, 58, 51, 50, 59, 61, 55, 48, 51, 49, 56, 46, 52, 62, 59, 58,
+    57, 62, 62, 57, 62, 50, 54, 55, 51, 48, 55, 60, 50, 60, 59, 46,
+    56, 65, 66, 52, 48, 54, 53, 57, 56, 56, 40, 52, 52, 55, 60, 56,
+    61, 51, 61, 51, 52, 56, 63, 48, 52, 59, 55, 56, 53, 72, 53, 71,
+    65, 49, 60, 47, 56, 56, 46, 51, 51, 55, 57, 55, 47, 68, 52, 66,
+    61, 53, 56, 55, 52, 42, 55, 59, 57, 55, 49, 53, 49, 45, 67, 55,
+    55, 56, 47, 42, 59, 59, 49, 69, 55, 56, 51, 59, 57, 54, 50, 53,
+    48, 53, 58, 49, 49, 54, 58, 59, 56, 61, 59, 54, 54, 54, 52, 50,
+    44, 67, 51, 54, 63, 60, 49, 55, 51, 45, 56, 57, 64, 48, 46, 54,
+    47, 57, 46, 52, 63, 54, 55, 55, 51, 51, 51, 44, 51, 62, 50, 47,
+    51, 68, 51, 59, 54, 48, 53, 57, 46, 55, 70, 62, 47, 49, 65, 68,
+    50, 56, 55, 69, 51, 51, 48, 50, 45, 55, 64, 60, 51, 43, 51, 50,
+    58, 53, 54, 53, 61, 44, 61, 55, 58, 55, 50, 51, 61, 44, 54, 55,
+    65, 55, 65, 57, 53, 49, 58, 55, 62, 60, 50, 63, 56, 42, 53, 49,
+    54, 55, 53, 50, 61, 54, 51, 61, 51, 58, 53, 52, 66, 46, 52, 52,
+    53, 66, 50, 60, 60, 61, 56, 56, 61, 65, 52, 46, 64, 49, 53, 53,
+    50, 47, 57, 52, 58, 53, 51, 53, 58, 51, 50, 51, 49, 58, 54, 58,
+    50, 51, 60, 60, 48, 51, 62, 60, 45, 62, 52, 51, 61, 48, 62, 49,
+    61, 58, 55, 57, 63, 63, 51, 59, 55, 55, 50, 53, 72, 53, 50, 56,
+    56, 64, 53, 55, 53, 53, 47, 46, 61, 54, 62, 54, 45, 49, 61, 64,
+    52, 52, 56, 70, 58, 54, 46, 49, 51, 50, 54, 55, 62, 52, 62, 62,
+    52, 44, 53, 61, 48, 64, 48, 48, 60, 65, 59, 54, 53, 53, 48, 66,
+    57, 46, 53, 57, 51, 52, 51, 64, 53, 51, 47, 67, 58, 55, 54, 54,
+    56, 54, 62, 53, 55, 60, 48, 57, 54, 52, 57, 57, 58, 54, 54, 59,
+    63, 53, 54, 61, 51, 57, 55, 53, 52, 49, 56, 54, 57, 53, 54, 54,
+    60, 56, 56, 56, 53, 62, 55, 53, 56, 49, 53, 44, 52, 52, 56, 59,
+    51, 55, 55, 54, 59, 50, 59, 59, 53, 65, 55, 53, 54, 53, 59, 55,
+    53, 65, 63, 40, 51, 49, 54, 58, 54, 54, 58, 46, 60, 50, 51, 53,
+    58, 49, 56, 49, 56, 49, 47, 47, 57, 58, 52, 59, 64, 57, 57, 58,
+    58, 50, 57, 61, 66, 45, 43, 61, 61, 56, 46, 60, 55, 46, 55, 54,
+    55, 60, 57, 55, 52, 48, 44, 56, 54, 55, 56, 43, 70, 53, 48, 53,
+    56, 54, 55, 46, 55, 50, 54, 56, 49, 49, 50, 48, 61, 50, 59, 51,
+    49, 52, 65, 50, 60, 44, 63, 62, 52, 53, 58, 50, 45, 51, 57, 51,
+    58, 64, 47, 51, 53, 54, 60, 45, 54, 59, 58, 55, 53, 65, 53, 49,
+    56, 70, 58, 51, 55, 58, 57, 49, 54, 55, 51, 51, 62, 49, 56, 56,
+    44, 64, 45, 51, 57, 64, 55, 59, 64, 44, 63, 57, 46, 65, 58, 52,
+    54, 47, 50, 52, 48, 41, 52, 45, 65, 53, 51, 63, 57, 56, 48, 54,
+    50, 65, 65, 51, 63, 50, 57, 52, 47, 42, 58, 59, 56, 54, 58, 49,
+    43, 55, 53, 64, 49, 58, 51, 61, 54, 54, 68, 55, 46, 55, 50, 49,
+    53, 50, 55, 47, 56, 66, 49, 58, 48, 59, 57, 59, 53, 51, 59, 53,
+    52, 48, 51, 52, 54, 64, 49, 47, 61, 54, 53, 51, 62, 53, 59, 53,
+    51, 60, 64, 51, 54, 58, 60, 58, 50, 51, 50, 59, 50, 59, 56, 51,
+    47, 60, 56, 51, 54, 62, 55, 49, 56, 53, 40, 49, 52, 50, 50, 48,
+    48, 56, 60, 58, 57, 68, 49, 58, 54, 53, 54, 58, 66, 51, 49, 57,
+    55, 49, 49, 60, 54, 51, 48, 51, 55, 60, 60, 53, 50, 58, 55, 61,
+    49, 53, 58, 54, 47, 65, 50, 48, 55, 53, 58, 59, 41, 60, 53, 48,
+    64, 59, 60, 49, 54, 54, 71, 49, 51, 54, 43, 63, 54, 59, 53, 64,
+    44, 63, 59, 60, 54, 55, 53, 46, 49, 60, 68, 52, 48, 54, 54, 42,
+    52, 58, 57, 54, 50, 52, 63, 48, 56, 58, 51, 49, 41, 56, 53, 54,
+    55, 53, 54, 54, 54, 53, 46, 49, 51, 54, 59, 55, 50, 53, 52, 49,
+    57, 49, 54, 57, 54, 57, 58, 66, 55, 63, 51, 63, 52, 59, 49, 46,
+    52, 53, 59, 48, 48, 65, 52, 51, 55, 48, 54, 51, 58, 58, 60, 51,
+    52, 47, 55, 49, 54, 51, 59, 56, 54, 59, 43, 58, 57, 43, 57, 54,
+    54, 44, 54, 54, 62, 53, 50, 67, 55, 49, 64, 60, 48, 56, 56, 48,
+    57, 54, 45, 51, 62, 49, 54, 48, 49, 53, 61, 49, 49, 61, 55, 56,
+    53, 60, 54, 53, 54, 61, 44, 52, 56, 51, 56, 59, 52, 46, 55, 51,
+    55, 56, 57, 66, 56, 60, 51, 44, 57, 50, 39, 62, 52, 56, 57, 37,
+    51, 48, 63, 59, 47, 59, 52, 48, 53, 63, 46, 64, 48, 50, 53, 63,
+    49, 53, 56, 56, 56, 51, 50, 65, 52, 59, 58, 50, 54, 55, 44, 59,
+    62, 48, 47, 65, 49, 51, 44, 60, 56, 45, 50, 51, 55, 59, 47, 60,
+    61, 64, 57, 63, 58, 49, 56, 53, 49, 58, 60, 58, 51, 58, 46, 55,
+    62, 50, 65, 62, 51, 60, 50, 56, 58, 49, 52, 63, 61, 61, 54, 59,
+    53, 54, 54, 60, 55, 54, 53, 48, 51, 56, 53, 52, 50, 58, 62, 58,
+    50, 63, 44, 55, 54, 54, 45, 52, 48, 64, 58, 44, 53, 55, 49, 50,
+    60, 66, 56, 58, 54, 61, 59, 57, 50, 62, 43, 50, 61, 54, 54, 53,
+    53, 58, 54, 60, 54, 54, 57, 52, 58, 46, 61, 56, 61, 57, 56, 55,
+    47, 64, 47, 53, 44, 55, 53, 56, 49, 56, 55, 42, 51, 55, 44, 61,
+    59, 59, 50, 50, 47, 55, 55, 46, 60, 58, 53, 55, 58, 58, 59, 52,
+    58, 48, 49, 50, 57, 61, 56, 51, 58, 60, 52, 45, 52, 51, 51, 49,
+    56, 60, 57, 60, 60, 45, 53, 64, 54, 50, 62, 56, 55, 57, 47, 53,
+    56, 54, 61, 44, 63, 59, 54, 58, 56, 58, 50, 57, 43, 58, 53, 59,
+    52, 53, 59, 54, 61, 55, 58, 37, 62, 50, 60, 55, 64, 46, 53, 52,
+    65, 65, 54, 54, 62, 51, 63, 50, 61, 59, 53, 47, 66, 57, 47, 57,
+    52, 51, 56, 54, 60, 60, 46, 60, 46, 46, 53, 56, 52, 55, 51, 45,
+    56, 54, 56, 65, 44, 51, 63, 62, 46, 54, 50, 56, 59, 66, 67, 54,
+    57, 48, 54, 55, 62, 47, 66, 59, 61, 62, 55, 52, 54, 50, 48, 48,
+    54, 54, 44, 60, 54, 61, 63, 66, 56, 63, 58, 44, 49, 55, 52, 57,
+    42, 67, 61, 45, 53, 51, 49, 53, 54, 56, 54, 54, 48, 47, 60, 54,
+    62, 56, 60, 66, 59, 57, 55, 40, 47, 58, 56, 58, 65, 61, 55, 52,
+    57, 52, 60, 50, 48, 50, 52, 55, 58, 53, 52, 66, 51, 55, 58, 47,
+    50, 63, 59, 56, 52, 57, 62, 59, 52, 52, 61, 52, 59, 52, 57, 52,
+    51, 48, 54, 55, 64, 58, 56, 53, 55, 57, 59, 56, 54, 54, 65, 49,
+    56, 59, 57, 55, 54, 53, 66, 53, 59, 50, 53, 54, 63, 43, 59, 46,
+    66, 50, 56, 57, 55, 58, 51, 55, 59, 56, 47, 50, 49, 49, 51, 53,
+    57, 54, 48, 60, 60, 52, 62, 45, 52, 51, 57, 49, 51, 48, 55, 54,
+    58, 56, 52, 61, 48, 53, 54, 55, 46, 60, 55, 64, 54, 61, 52, 59,
+    64, 48, 63, 54, 58, 60, 55, 56, 51, 53, 53, 55, 40, 57, 56, 56,
+    54, 55, 58, 58, 51, 54, 48, 46, 58, 43, 54, 63, 49, 64, 62, 50,
+    62, 54, 56, 54, 57, 48, 48, 60, 51, 61, 46, 54, 57, 52, 60, 57,
+    56, 52, 58, 69, 54, 64, 61, 51, 56, 58, 51, 56, 59, 49, 50, 49,
+    62, 57, 56, 54, 54, 44, 59, 52, 60, 50, 61, 64, 60, 55, 56, 49,
+    51, 61, 50, 64, 54, 49, 58, 49, 63, 51, 57, 53, 57, 57, 58, 57,
+    62, 55, 51, 54, 58, 53, 57, 56, 52, 54, 54, 54, 52, 59, 58, 52,
+    62, 59, 47, 57, 56, 49, 63, 48, 60, 49, 51, 55, 57, 64, 54, 54,
+    50, 68, 50, 48, 58, 47, 47, 54, 52, 47, 59, 49, 49, 47, 60, 47,
+    54, 67, 58, 58, 56, 49, 50, 60, 43, 65, 43, 56, 56, 54, 54, 54,
+    60, 64, 65, 59, 66, 53, 46, 49, 46, 54, 55, 56, 49, 53, 59, 60,
+    60, 51, 52, 55, 47, 48, 58, 60, 53, 44, 55, 53, 54, 61, 56, 48,
+    51, 47, 60, 53, 55, 59, 38, 59, 57, 67, 49, 41, 60, 56, 52, 62,
+    65, 55, 54, 65, 58, 54, 51, 64, 59, 57, 46, 55, 59, 62, 51, 48,
+    64, 55, 52, 55, 61, 52, 48, 52, 57, 58, 54, 64, 57, 58, 52, 43,
+    58, 54, 51, 57, 52, 57, 62, 59, 52, 58, 55, 58, 48, 55, 54, 55,
+    53, 56, 45, 60, 48, 47, 52, 63, 50, 68, 56, 60, 62, 56, 55, 64,
+    48, 58, 51, 52, 56, 53, 57, 52, 47, 53, 57, 56, 54, 55, 53, 57,
+    52, 55, 55, 57, 47, 54, 56, 49, 49, 38, 59, 60, 51, 42, 60, 57,
+    41, 53, 56, 54, 53, 53, 51, 56, 53, 65, 54, 53, 59, 64, 55, 54,
+    59, 51, 58, 66, 56, 55, 53, 52, 52, 43, 59, 45, 58, 50, 54, 51,
+    53, 46, 58, 60, 53, 57, 54, 56, 52, 55, 55, 52, 52, 59, 53, 60,
+    47, 54, 53, 53, 51, 52, 61, 55, 51, 63, 53, 57, 46, 49, 54, 59,
+    47, 54, 44, 51, 53, 57, 58, 61, 63, 54, 59, 61, 68, 61, 48, 52,
+    59, 60, 52, 49, 54, 44, 60, 59, 54, 54, 53, 51, 56, 43, 65, 54,
+    50, 51, 55, 60, 45, 49, 58, 50, 60, 53, 60, 46, 48, 59, 57, 62,
+    53, 56, 57, 51, 47, 39, 45, 50, 47, 55, 63, 57, 56, 45, 59, 56,
+    52, 59, 55, 50, 58, 53, 57, 61, 54, 54, 53, 51, 61, 46, 61, 51,
+    70, 55, 59, 53, 60, 55, 54, 59, 58, 53, 52, 54, 46, 59, 58, 60,
+    53, 51, 53, 59, 58, 55, 66, 43, 60, 45, 53, 58, 60, 55, 53, 55,
+    58, 60, 52, 51, 57, 52, 53, 57, 46, 61, 49, 48, 44, 55, 59, 46,
+    59, 47, 52, 46, 61, 55, 52, 49, 59, 50, 57, 58, 59, 67, 58, 58,
+    57, 60, 53, 48, 56, 57, 60, 53, 51, 55, 48, 55, 56, 67, 56, 54,
+    57, 59, 52, 57, 52, 59, 47, 56, 55, 54, 54, 62, 49, 59, 52, 54,
+    50, 53, 58, 51, 53, 54, 69, 53, 53, 50, 55, 55, 60, 43, 60, 59,
+    52, 56, 62, 48, 50, 54, 54, 51, 56, 56, 58, 52, 46, 56, 53, 61,
+    47, 59, 59, 47, 65, 56, 55, 57, 60, 57, 53, 51, 66, 51, 49, 44,
+    56, 61, 55, 54, 59, 63, 56, 51, 61, 49, 53, 52, 56, 55, 54, 51,
+    46, 48, 52, 45, 54, 50, 48, 59, 48, 60, 53, 56, 49, 59, 57, 61,
+    59, 49, 60, 51, 51, 49, 61, 54, 62, 52, 57, 48, 60, 51, 49, 57,
+    56, 55, 53, 55, 53, 57, 58, 52, 61, 55, 55, 51, 55, 53, 57, 53,
+    63, 51, 51, 55, 59, 51, 52, 50, 54, 55, 60, 54, 40, 51, 56, 54,
+    50, 59, 61, 69, 52, 58, 64, 58, 57, 51, 54, 61, 53, 58, 60, 53,
+    63, 61, 56, 53, 59, 54, 60, 46, 52, 54, 63, 64, 59, 64, 49, 61,
+    57, 46, 58, 57, 56, 55, 52, 55, 59, 47, 64, 59, 52, 53, 62, 58,
+    57, 50, 48, 43, 45, 45, 62, 52, 55, 61, 53, 58, 54, 53, 52, 54,
+    53, 45, 51, 57, 54, 58, 58, 54, 42, 54, 50, 52, 45, 53, 60, 51,
+    49, 55, 61, 62, 54, 49, 50, 48, 51, 51, 50, 62, 58, 58, 66, 58,
+    58, 45, 48, 55, 44, 51, 52, 57, 62, 52, 57, 56, 54, 58, 54, 55,
+    57, 59, 51, 61, 46, 59, 49, 61, 58, 59, 48, 60, 59, 54, 54, 53,
+    67, 56, 52, 57, 45, 59, 52, 54, 48, 47, 57, 49, 54, 56, 54, 56,
+    60, 51, 42, 57, 57, 53, 47, 64, 51, 55, 60, 49, 54, 62, 51, 48,
+    57, 57, 54, 47, 52, 62, 49, 50, 60, 53, 57, 62, 59, 56, 57, 59,
+    51, 50, 46, 55, 50, 53, 51, 48, 55, 60, 52, 58, 52, 57, 62, 51,
+    57, 49, 47, 52, 47, 69, 52, 55, 60, 48, 55, 52, 59, 54, 49, 53,
+    51, 56, 55, 58, 58, 55, 53, 55, 57, 48, 64, 56, 57, 53, 64, 53,
+    52, 55, 58, 55, 54, 54, 48, 51, 49, 55, 66, 46, 56, 48, 58, 66,
+    51, 55, 59, 52, 40, 52, 56, 58, 54, 53, 59, 49, 51, 59, 49, 58,
+    51, 63, 52, 42, 69, 58, 55, 52, 68, 52, 50, 58, 56, 51, 55, 60,
+    62, 53, 54, 51, 55, 62, 45, 50, 55, 65, 66, 48, 57, 57, 53, 53,
+    57, 68, 59, 49, 53, 49, 52, 66, 49, 61, 52, 62, 56, 52, 52, 54,
+    54, 57, 54, 47, 55, 63, 56, 46, 69, 60, 46, 51, 60, 49, 56, 51,
+    51, 61, 57, 58, 62, 58, 49, 51, 61, 59, 53, 52, 61, 50, 55, 53,
+    61, 63, 45, 58, 46, 50, 58, 50, 65, 51, 56, 53, 48, 52, 55, 58,
+    51, 64, 56, 58, 52, 54, 53, 60, 60, 59, 56, 62, 60, 59, 49, 54,
+    53, 55, 56, 58, 54, 46, 58, 63, 49, 51, 50, 60, 59, 58, 60, 55,
+    53, 65, 51, 54, 50, 56, 63, 66, 55, 47, 57, 60, 56, 55, 42, 52,
+    66, 45, 55, 56, 46, 65, 50, 58, 43, 52, 56, 49, 45, 50, 50, 59,
+    44, 54, 59, 55, 62, 47, 64, 54, 47, 51, 59, 61, 54, 37, 58, 57,
+    63, 48, 54, 55, 50, 54, 58, 49, 51, 55, 63, 58, 60, 67, 50, 59,
+    56, 55, 50, 53, 63, 62, 60, 66, 40, 48, 51, 53, 47, 53, 48, 55,
+    56, 51, 53, 59, 47, 57, 59, 62, 51, 52, 50, 55, 58, 49, 58, 52,
+    53, 55, 59, 51, 51, 52, 62, 51, 60, 60, 50, 48, 51, 58, 56, 53,
+    57, 48, 46, 57, 55, 55, 56, 53, 53, 53, 62, 50, 49, 52, 52, 53,
+    58, 54, 58, 51, 45, 48, 64, 55, 59, 46, 49, 49, 53, 52, 59, 58,
+    60, 53, 58, 56, 56, 58, 53, 50, 49, 63, 53, 51, 52, 62, 55, 52,
+    49, 53, 54, 59, 57, 52, 52, 50, 61, 66, 49, 58, 39, 57, 55, 50,
+    57, 61, 53, 45, 65, 54, 54, 52, 52, 53, 60, 54, 55, 55, 58, 56,
+    65, 55, 56, 50, 53, 70, 60, 50, 50, 61, 58, 48, 51, 58, 55, 45,
+    54, 61, 57, 46, 50, 53, 59, 56, 39, 55, 53, 51, 53, 51, 58, 53,
+    51, 56, 58, 56, 54, 61, 48, 59, 56, 52, 60, 47, 66, 58, 61, 52,
+    63, 56, 57, 47, 57, 59, 52, 53, 62, 53, 39, 52, 59, 46, 52, 56,
+    52, 54, 62, 55, 54, 62, 58, 58, 53, 57, 40, 38, 54, 57, 48, 57,
+    58, 52, 53, 51, 49, 56, 48, 61, 57, 50, 49, 57, 57, 51, 55, 50,
+    67, 53, 46, 52, 60, 50, 56, 58, 50, 64, 61, 54, 48, 49, 60, 56,
+    59, 56, 56, 68, 51, 67, 49, 52, 62, 53, 49, 57, 62, 49, 52, 61,
+    58, 47, 55, 59, 44, 53, 58, 62, 48, 56, 62, 63, 45, 59, 55, 55,
+    55, 48, 53, 49, 45, 45, 58, 45, 61, 49, 66, 52, 55, 63, 56, 56,
+    62, 58, 48, 60, 53, 56, 66, 60, 49, 47, 52, 42, 52, 53, 57, 58,
+    56, 54, 48, 53, 60, 55, 59, 57, 50, 62, 54, 54, 64, 61, 50, 60,
+    52, 63, 59, 57, 66, 41, 55, 53, 56, 51, 66, 61, 51, 56, 48, 59,
+    55, 56, 59, 50, 47, 58, 56, 59, 53, 56, 46, 52, 60, 54, 52, 54,
+    50, 57, 69, 69, 62, 53, 58, 44, 50, 53, 68, 52, 62, 60, 48, 60,
+    47, 49, 62, 47, 61, 52, 59, 44, 59, 43, 54, 56, 56, 49, 51, 59,
+    55, 58, 54, 52, 50, 56, 49, 58, 57, 50, 49, 65, 54, 58, 52, 60,
+    56, 53, 56, 57, 48, 44, 50, 55, 59, 67, 48, 56, 53, 50, 52, 49,
+    49, 59, 64, 48, 53, 56, 60, 58, 53, 45, 47, 65, 48, 53, 48, 60,
+    66, 48, 48, 50, 51, 60, 59, 56, 54, 61, 48, 43, 58, 61, 61, 61,
+    49, 44, 58, 52, 43, 55, 55, 51, 50, 58, 47, 50, 50, 68, 48, 53,
+    46, 56, 45, 63, 50, 48, 42, 56, 49, 65, 55, 55, 49, 56, 50, 53,
+    61, 50, 52, 63, 49, 54, 48, 60, 61, 52, 59, 56, 51, 48, 62, 48,
+    62, 51, 60, 53, 50, 54, 47, 49, 44, 63, 63, 55, 59, 62, 48, 50,
+    53, 53, 59, 50, 53, 62, 48, 58, 52, 52, 54, 57, 57, 50, 55, 66,
+    52, 58, 48, 52, 49, 56, 51, 47, 47, 52, 58, 59, 56, 61, 63, 55,
+    55, 57, 50, 61, 51, 58, 47, 64, 45, 51, 63, 48, 49, 53, 48, 54,
+    40, 48, 56, 55, 53, 58, 52, 62, 54, 52, 47, 55, 52, 48, 61, 53,
+    53, 58, 52, 53, 65, 58, 64, 56, 62, 63, 52, 67, 58, 60, 54, 51,
+    50, 54, 64, 58, 49, 55, 53, 55, 56, 60, 56, 62, 50, 64, 56, 64,
+    54, 51, 52, 48, 58, 54, 57, 59, 52, 54, 59, 54, 58, 61, 43, 54,
+    48, 40, 56, 58, 63, 46, 44, 62, 52, 55, 72, 49, 54, 53, 57, 55,
+    48, 56, 59, 37, 59, 55, 57, 58, 51, 57, 57, 57, 47, 47, 54, 61,
+    56, 50, 46, 58, 45, 49, 56, 52, 52, 51, 54, 57, 50, 65, 53, 60,
+    61, 51, 61, 59, 63, 53, 63, 58, 44, 52, 44, 54, 62, 62, 53, 56,
+    58, 56, 51, 47, 50, 51, 51, 54, 58, 54, 54, 63, 37, 62, 52, 63,
+    54, 49, 57, 55, 59, 57, 54, 60, 57, 56, 57, 52, 61, 52, 63, 53,
+    49, 48, 54, 57, 56, 54, 66, 55, 55, 58, 53, 54, 61, 55, 47, 56,
+    65, 48, 47, 54, 46, 45, 55, 56, 53, 51, 54, 53, 53, 61, 53, 63,
+    48, 62, 57, 49, 60, 64, 61, 56, 42, 53, 50, 55, 62, 57, 48, 60,
+    52, 60, 57, 49, 59, 55, 56, 50, 55, 61, 46, 66, 57, 63, 45, 49,
+    52, 42, 56, 58, 54, 65, 44, 54, 48, 63, 56, 62, 55, 49, 59, 43,
+    51, 46, 53, 51, 57, 53, 52, 52, 49, 57, 57, 47, 58, 53, 54, 60,
+    60, 56, 58, 47, 58, 55, 56, 54, 52, 51, 59, 60, 51, 51, 66, 47,
+    53, 56, 55, 62, 63, 65, 57, 49, 59, 48, 56, 45, 47, 60, 53, 65,
+    54, 52, 61, 58, 51, 46, 54, 57, 58, 55, 50, 53, 52, 55, 54, 56,
+    58, 56, 43, 51, 59, 62, 58, 54, 55, 44, 52, 53, 58, 42, 50, 54,
+    47, 54, 60, 57, 59, 50, 53, 60, 58, 52, 55, 54, 51, 41, 71, 57,
+    62, 45, 59, 43, 57, 57, 59, 54, 52, 59, 54, 50, 52, 59, 54, 63,
+    54, 56, 43, 56, 49, 49, 49, 56, 61, 55, 51, 55, 69, 60, 48, 51,
+    57, 46, 60, 51, 59, 48, 53, 50, 60, 62, 51, 51, 55, 53, 55, 48,
+    56, 61, 65, 56, 49, 46, 49, 48, 53, 58, 56, 50, 48, 56, 59, 60,
+    47, 60, 55, 58, 55, 44, 54, 62, 46, 59, 56, 51, 60, 54, 59, 43,
+    45, 57, 53, 62, 55, 55, 44, 52, 55, 49, 57, 56, 53, 47, 58, 50,
+    58, 48, 54, 55, 60, 47, 58, 53, 45, 50, 60, 53, 58, 57, 61, 47,
+    62, 52, 61, 60, 49, 40, 63, 55, 53, 57, 54, 54, 53, 59, 57, 60,
+    56, 59, 47, 61, 59, 58, 59, 48, 51, 55, 61, 50, 56, 61, 59, 46,
+    56, 47, 56, 56, 52, 56, 64, 44, 60, 46, 52, 58, 45, 47, 53, 50,
+    56, 57, 46, 61, 52, 61, 54, 54, 59, 52, 52, 55, 60, 59, 51, 56,
+    65, 58, 51, 55, 49, 54, 43, 56, 60, 64, 59, 59, 55, 53, 48, 58,
+    65, 47, 61, 45, 52, 58, 58, 61, 50, 63, 51, 54, 52, 54, 57, 59,
+    54, 53, 50, 48, 49, 67, 58, 51, 57, 54, 52, 59, 55, 47, 52, 52,
+    54, 65, 53, 57, 50, 52, 55, 51, 56, 56, 59, 55, 49, 56, 58, 57,
+    58, 49, 51, 68, 47, 61, 48, 47, 55, 55, 65, 65, 53, 62, 43, 48,
+    50, 48, 55, 52, 57, 61, 48, 49, 59, 66, 41, 46, 54, 52, 64, 51,
+    51, 46, 50, 57, 55, 50, 59, 51, 50, 59, 62, 55, 63, 57, 52, 47,
+    57, 53, 58, 58, 63, 61, 53, 58, 50, 56, 52, 58, 48, 57, 52, 62,
+    58, 57, 54, 59, 52, 53, 57, 54, 61, 48, 57, 56, 52, 46, 53, 51,
+    55, 48, 49, 54, 63, 51, 58, 52, 54, 41, 49, 54, 52, 44, 57, 55,
+    52, 54, 44, 56, 61, 59, 52, 60, 57, 51, 59, 52, 59, 56, 46, 55,
+    56, 59, 57, 57, 55, 47, 61, 63, 53, 58, 54, 56, 62, 58, 55, 48,
+    63, 57, 57, 43, 51, 42, 57, 58, 58, 52, 60, 67, 54, 57, 62, 50,
+    57, 50, 59, 55, 62, 53, 61, 58, 46, 44, 56, 39, 55, 53, 58, 63,
+    52, 49, 50, 50, 60, 56, 56, 54, 55, 47, 52, 45, 53, 67, 48, 61,
+    53, 49, 55, 60, 59, 51, 60, 56, 52, 57, 51, 61, 57, 69, 43, 50,
+    62, 61, 58, 55, 60, 63, 51, 60, 48, 51, 50, 53, 57, 67, 48, 56,
+    56, 49, 52, 62, 63, 47, 50, 55, 53, 52, 53, 56, 62, 46, 66, 59,
+    48, 55, 55, 58, 53, 57, 51, 57, 54, 48, 52, 56, 55, 61, 64, 52,
+    40, 57, 50, 59, 57, 50, 55, 56, 62, 47, 66, 60, 55, 56, 58, 47,
+    51, 56, 54, 59, 57, 51, 53, 52, 57, 48, 51, 48, 52, 53, 60, 57,
+    58, 56, 46, 54, 47, 54, 55, 50, 57, 66, 60, 53, 52, 56, 60, 58,
+    49, 48, 55, 58, 55, 51, 52, 56, 53, 64, 56, 48, 50, 56, 58, 52,
+    58, 41, 54, 68, 44, 59, 55, 58, 49, 56, 61, 54, 59, 64, 63, 58,
+    51, 51, 59, 51, 62, 59, 58, 61, 50, 55, 52, 50, 50, 53, 53, 60,
+    55, 58, 49, 52, 52, 60, 47, 60, 50, 60, 57, 54, 56, 61, 54, 57,
+    56, 60, 54, 60, 52, 44, 56, 50, 57, 45, 52, 52, 58, 42, 51, 52,
+    47, 46, 63, 53, 51, 52, 59, 64, 51, 45, 52, 61, 62, 52, 55, 57,
+    48, 61, 57, 55, 60, 57, 58, 60, 45, 42, 55, 51, 69, 65, 55, 53,
+    60, 54, 53, 49, 57, 59, 55, 53, 53, 56, 53, 53, 57, 55, 47, 55,
+    62, 55, 55, 55, 52, 55, 69, 60, 54, 56, 49, 50, 47, 52, 53, 58,
+    57, 54, 53, 51, 52, 53, 58, 52, 54, 52, 48, 51, 59, 49, 49, 55,
+    60, 58, 53, 48, 61, 68, 46, 45, 53, 50, 51, 63, 53, 57, 54, 52,
+    55, 54, 56, 48, 54, 67, 53, 60, 53, 48, 47, 56, 58, 44, 51, 52,
+    57, 53, 49, 57, 53, 55, 46, 54, 54, 46, 56, 51, 46, 63, 46, 56,
+    50, 52, 53, 48, 54, 61, 53, 46, 55, 58, 55, 56, 54, 52, 59, 53,
+    53, 55, 56, 44, 52, 50, 51, 52, 56, 53, 61, 51, 55, 51, 62, 53,
+    52, 53, 44, 59, 49, 63, 49, 58, 52, 48, 52, 52, 54, 52, 48, 60,
+    51, 66, 52, 40, 48, 60, 54, 62, 49, 56, 62, 61, 53, 56, 51, 53,
+    53, 54, 61, 54, 48, 61, 57, 48, 55, 61, 46, 57, 54, 41, 51, 54,
+    65, 55, 42, 56, 63, 48, 45, 67, 50, 57, 56, 47, 54, 51, 66, 64,
+    49, 50, 58, 54, 49, 56, 63, 52, 55, 63, 52, 56, 52, 48, 63, 59,
+    52, 62, 55, 43, 58, 44, 60, 58, 54, 55, 58, 53, 65, 46, 59, 55,
+    69, 56, 48, 44, 56, 51, 53, 48, 46, 48, 61, 49, 60, 48, 53, 50,
+    50, 50, 52, 63, 56, 54, 69, 53, 55, 56, 64, 52, 51, 55, 51, 54,
+    60, 61, 55, 47, 55, 57, 52, 50, 63, 52, 62, 51, 55, 51, 54, 59,
+    49, 57, 52, 52, 50, 55, 55, 66, 62, 52, 53, 56, 64, 55, 59, 60,
+    62, 54, 52, 57, 50, 63, 53, 47, 60, 57, 61, 48, 53, 49, 54, 53,
+    58, 58, 48, 55, 47, 59, 59, 59, 39, 61, 53, 55, 53, 53, 63, 45,
+    51, 53, 48, 49, 47, 52, 60, 64, 49, 60, 48, 63, 51, 58, 55, 55,
+    57, 63, 55, 52, 46, 52, 51, 49, 57, 50, 51, 68, 57, 52, 57, 51,
+    37, 56, 52, 64, 60, 52, 61, 50, 48, 52, 63, 65, 57, 42, 62, 51,
+    54, 53, 60, 53, 53, 57, 57, 58, 47, 54, 50, 51, 45, 55, 48, 56,
+    61, 57, 56, 43, 45, 54, 46, 57, 53, 58, 52, 57, 64, 57, 51, 47,
+    62, 54, 68, 47, 65, 56, 61, 54, 45, 55, 54, 58, 42, 48, 53, 58,
+    50, 61, 52, 58, 51, 62, 67, 56, 52, 47, 46, 54, 56, 61, 59, 61,
+    57, 55, 64, 45, 55, 51, 52, 59, 52, 61, 56, 48, 55, 45, 60, 52,
+    64, 51, 54, 58, 54, 59, 59, 56, 58, 60, 54, 59, 51, 57, 56, 63,
+    55, 48, 51, 66, 59, 53, 60, 45, 54, 59, 62, 54, 53, 56, 63, 58,
+    56, 53, 44, 53, 58, 46, 57, 48, 52, 68, 47, 45, 56, 47, 60, 56,
+    55, 53, 53, 56, 55, 57, 58, 54, 48, 51, 52, 45, 56, 59, 50, 48,
+    53, 54, 63, 51, 55, 57, 54, 53, 63, 58, 59, 51, 60, 43, 66, 54,
+    51, 53, 57, 47, 48, 60, 46, 54, 57, 44, 52, 58, 58, 44, 58, 45,
+    49, 51, 56, 61, 61, 60, 53, 56, 44, 56, 68, 55, 48, 58, 56, 47,
+    67, 60, 57, 66, 52, 53, 53, 61, 47, 60, 59, 50, 54, 61, 56, 55,
+    60, 47, 59, 63, 50, 51, 58, 50, 56, 48, 62, 55, 60, 50, 51, 54,
+    44, 48, 37, 65, 50, 67, 53, 53, 46, 60, 60, 46, 58, 61, 47, 62,
+    49, 61, 62, 52, 60, 68, 49, 52, 62, 49, 58, 50, 50, 56, 56, 57,
+    62, 53, 52, 57, 55, 54, 58, 52, 52, 41, 53, 47, 57, 61, 47, 55,
+    52, 52, 53, 57, 49, 51, 48, 51, 61, 49, 60, 56, 58, 61, 58, 57,
+    51, 53, 51, 53, 53, 53, 55, 53, 60, 61, 52, 46, 52, 54, 45, 56,
+    68, 52, 54, 56, 54, 55, 54, 50, 54, 66, 52, 53, 44, 53, 47, 64,
+    50, 53, 59, 52, 55, 63, 47, 50, 50, 49, 55, 51, 53, 52, 53, 62,
+    52, 53, 51, 53, 54, 60, 57, 57, 47, 55, 51, 59, 52, 64, 47, 58,
+    51, 61, 63, 65, 54, 52, 55, 54, 46, 47, 54, 55, 56, 56, 61, 60,
+    48, 41, 52, 62, 46, 60, 57, 50, 60, 57, 59, 53, 52, 41, 57, 61,
+    55, 63, 59, 51, 53, 50, 40, 58, 61, 52, 63, 55, 54, 53, 49, 47,
+    57, 54, 52, 56, 51, 61, 56, 56, 53, 53, 58, 54, 57, 45, 52, 59,
+    45, 53, 63, 53, 56, 49, 63, 55, 52, 54, 53, 55, 56, 51, 48, 57,
+    49, 51, 43, 48, 53, 63, 49, 52, 57, 49, 60, 51, 50, 51, 60, 55,
+    43, 49, 58, 50, 55, 66, 62, 57, 54, 57, 49, 55, 50, 59, 54, 56,
+    62, 60, 52, 57, 46, 57, 58, 55, 43, 55, 63, 50, 54, 55, 55, 64,
+    53, 63, 47, 49, 57, 57, 54, 57, 55, 45, 60, 60, 51, 57, 59, 56,
+    48, 58, 51, 52, 58, 64, 55, 57, 57, 52, 48, 54, 42, 60, 47, 50,
+    51, 51, 51, 57, 50, 57, 57, 45, 54, 58, 63, 45, 58, 54, 51, 50,
+    47, 53, 57, 54, 44, 56, 53, 63, 53, 56, 57, 52, 53, 52, 51, 64,
+    58, 54, 63, 60, 58, 67, 54, 56, 54, 54, 60, 55, 56, 51, 49, 51,
+    56, 57, 54, 52, 58, 48, 65, 50, 54, 64, 50, 52, 48, 53, 51, 58,
+    58, 58, 54, 50, 54, 50, 52, 55, 48, 68, 41, 57, 66, 51, 51, 55,
+    53, 52, 53, 50, 58, 52, 62, 52, 56, 52, 60, 56, 54, 49, 61, 57,
+    59, 45, 57, 58, 58, 47, 60, 56, 52, 55, 55, 56, 58, 45, 53, 59,
+    58, 64, 59, 52, 59, 51, 51, 49, 64, 62, 58, 48, 62, 50, 57, 65,
+    52, 54, 53, 54, 56, 50, 58, 57, 48, 72, 51, 59, 52, 59, 53, 49,
+    52, 54, 57, 59, 54, 62, 47, 54, 56, 50, 54, 65, 53, 52, 57, 51,
+    56, 49, 59, 57, 59, 48, 42, 55, 61, 42, 51, 59, 48, 53, 48, 54,
+    51, 51, 58, 55, 64, 56, 59, 55, 55, 53, 65, 56, 49, 56, 53, 52,
+    49, 57, 59, 46, 52, 54, 51, 51, 51, 56, 58, 53, 54, 54, 51, 54,
+    54, 56, 61, 51, 54, 50, 56, 57, 59, 56, 46, 54, 48, 58, 56, 51,
+    61, 59, 56, 60, 58, 53, 52, 50, 53, 57, 43, 61, 52, 47, 64, 49,
+    56, 60, 53, 56, 56, 59, 58, 65, 62, 57, 59, 56, 60, 55, 54, 59,
+    51, 63, 53, 61, 50, 57, 50, 55, 48, 54, 58, 55, 49, 55, 59, 48,
+    61, 46, 50, 61, 55, 61, 48, 58, 55, 51, 62, 60, 67, 56, 56, 55,
+    51, 52, 50, 60, 59, 58, 50, 55, 50, 61, 57, 46, 60, 57, 52, 54,
+    62, 53, 51, 47, 50, 54, 59, 57, 73, 52, 55, 55, 55, 58, 45, 57,
+    56, 53, 54, 55, 55, 69, 53, 60, 49, 54, 44, 69, 52, 59, 49, 64,
+    50, 53, 51, 46, 54, 54, 47, 55, 38, 56, 54, 50, 55, 52, 60, 49,
+    57, 63, 46, 50, 52, 49, 49, 51, 56, 53, 51, 56, 56, 61, 66, 52,
+    43, 53, 52, 51, 65, 53, 57, 54, 58, 59, 58, 57, 64, 45, 59, 62,
+    54, 53, 56, 56, 53, 49, 54, 54, 53, 53, 52, 52, 59, 63, 46, 52,
+    57, 54, 48, 46, 54, 49, 49, 46, 52, 53, 56, 48, 52, 60, 54, 63,
+    57, 53, 58, 56, 42, 54, 63, 55, 59, 44, 64, 53, 60, 54, 59, 56,
+    57, 53, 60, 59, 49, 48, 56, 50, 50, 55, 54, 58, 62, 46, 64, 57,
+    56, 57, 52, 58, 55, 54, 46, 66, 41, 54, 51, 52, 62, 52, 58, 58,
+    60, 61, 53, 46, 57, 55, 51, 54, 53, 48, 56, 59, 46, 59, 57, 62,
+    53, 59, 59, 41, 58, 47, 50, 51, 51, 52, 49, 43, 60, 63, 47, 62,
+    50, 53, 57, 57, 55, 54, 58, 61, 55, 53, 47, 52, 63, 60, 57, 53,
+    56, 52, 59, 60, 62, 52, 55, 50, 58, 59, 54, 46, 41, 51, 43, 54,
+    58, 44, 64, 58, 56, 65, 52, 62, 59, 53, 56, 60, 61, 42, 45, 56,
+    52, 53, 48, 55, 50, 71, 50, 60, 48, 51, 39, 52, 51, 51, 46, 52,
+    59, 62, 51, 60, 53, 58, 56, 46, 58, 50, 53, 58, 54, 53, 54, 60,
+    57, 52, 53, 61, 51, 63, 58, 48, 49, 50, 57, 54, 59, 57, 50, 48,
+    43, 69, 44, 59, 53, 60, 51, 62, 57, 48, 54, 60, 58, 62, 55, 57,
+    47, 61, 48, 55, 56, 51, 56, 45, 66, 51, 44, 57, 48, 54, 58, 61,
+    52, 56, 46, 48, 63, 52, 53, 62, 58, 59, 56, 46, 51, 57, 48, 58,
+    51, 59, 44, 65, 58, 57, 48, 45, 63, 61, 56, 46, 51, 56, 45, 58,
+    57, 55, 55, 57, 56, 55, 57, 51, 60, 59, 52, 52, 51, 51, 55, 52,
+    43, 66, 42, 56, 53, 51, 48, 61, 57, 66, 51, 58, 57, 59, 62, 43,
+    62, 54, 54, 55, 62, 52, 56, 51, 57, 53, 61, 52, 54, 52, 49, 51,
+    61, 60, 56, 48, 53, 53, 49, 57, 58, 57, 60, 53, 56, 51, 56, 55,
+    47, 49, 53, 60, 54, 61, 61, 54, 57, 66, 53, 58, 60, 57, 57, 64,
+    48, 49, 61, 54, 52, 57, 45, 49, 54, 55, 55, 54, 51, 49, 50, 57,
+    59, 51, 58, 62, 52, 53, 51, 61, 55, 43, 67, 60, 45, 55, 53, 52,
+    63, 59, 44, 59, 43, 64, 48, 62, 51, 51, 54, 56, 57, 44, 56, 53,
+    56, 53, 49, 51, 51, 50, 47, 61, 55, 51, 54, 50, 51, 59, 49, 58,
+    51, 43, 67, 55, 50, 52, 55, 56, 45, 59, 60, 60, 61, 51, 51, 57,
+    52, 57, 66, 50, 60, 63, 57, 52, 57, 56, 56, 61, 49, 55, 52, 58,
+    54, 53, 59, 53, 52, 48, 59, 43, 54, 69, 52, 48, 58, 54, 58, 43,
+    54, 54, 58, 57, 58, 60, 57, 48, 53, 57, 52, 51, 53, 50, 60, 49,
+    64, 53, 54, 57, 55, 55, 54, 62, 54, 50, 54, 42, 49, 58, 54, 49,
+    59, 63, 52, 67, 49, 43, 63, 58, 47, 54, 45, 53, 55, 54, 56, 55,
+    49, 59, 51, 58, 54, 60, 56, 59, 54, 47, 52, 50, 59, 57, 55, 60,
+    59, 59, 50, 57, 54, 55, 55, 57, 53, 58, 57, 54, 51, 53, 49, 53,
+    55, 49, 53, 47, 51, 43, 61, 56, 52, 55, 45, 57, 45, 64, 52, 46,
+    57, 56, 68, 52, 53, 59, 53, 50, 53, 72, 42, 58, 54, 58, 50, 52,
+    61, 52, 60, 54, 55, 60, 53, 68, 57, 53, 50, 62, 45, 60, 52, 46,
+    58, 54, 54, 44, 58, 49, 55, 52, 52, 58, 63, 57, 63, 44, 56, 54,
+    55, 63, 44, 48, 61, 64, 57, 51, 54, 57, 51, 49, 63, 56, 50, 50,
+    50, 53, 43, 58, 65, 46, 54, 64, 56, 57, 52, 54, 54, 51, 63, 48,
+    67, 52, 55, 53, 59, 50, 58, 54, 57, 58, 54, 56, 58, 62, 59, 49,
+    54, 54, 54, 54, 59, 53, 59, 53, 70, 64, 56, 54, 48, 58, 56, 56,
+    65, 57, 59, 56, 48, 52, 63, 54, 55, 49, 50, 61, 58, 53, 51, 51,
+    53, 52, 62, 48, 71, 46, 56, 50, 51, 57, 55, 53, 59, 59, 69, 53,
+    56, 52, 47, 49, 61, 58, 57, 72, 47, 41, 49, 61, 57, 55, 55, 53,
+    45, 61, 53, 50, 64, 56, 49, 53, 52, 59, 65, 59, 48, 56, 48, 56,
+    54, 61, 51, 53, 56, 55, 59, 56, 60, 52, 55, 55, 57, 56, 52, 49,
+    59, 55, 50, 65, 57, 45, 54, 54, 59, 53, 57, 53, 59, 57, 51, 63,
+    63, 52, 62, 58, 57, 56, 65, 53, 55, 46, 47, 60, 57, 50, 52, 47,
+    62, 61, 51, 50, 55, 40, 54, 61, 68, 50, 69, 51, 54, 59, 62, 49,
+    49, 53, 59, 48, 51, 50, 56, 62, 61, 49, 53, 62, 55, 54, 55, 48,
+    58, 71, 47, 44, 60, 59, 56, 47, 57, 54, 54, 57, 52, 53, 57, 57,
+    60, 58, 51, 51, 54, 52, 52, 48, 58, 58, 47, 58, 47, 56, 62, 47,
+    65, 54, 53, 61, 54, 56, 59, 52, 43, 62, 60, 52, 53, 56, 47, 54,
+    52, 55, 54, 53, 61, 45, 40, 50, 47, 58, 49, 50, 42, 59, 55, 49,
+    61, 56, 51, 58, 59, 59, 56, 50, 65, 53, 63, 58, 48, 48, 53, 51,
+    42, 58, 58, 56, 60, 55, 53, 54, 48, 61, 60, 51, 55, 56, 53, 54,
+    60, 49, 46, 62, 54, 51, 62, 49, 55, 53, 56, 44, 57, 56, 58, 50,
+    53, 53, 53, 58, 41, 64, 51, 61, 45, 52, 52, 54, 49, 50, 63, 55,
+    61, 58, 56, 55, 55, 58, 59, 48, 58, 52, 55, 49, 56, 58, 53, 57,
+    56, 48, 51, 53, 50, 57, 50, 55, 48, 47, 52, 53, 59, 57, 52, 55,
+    54, 55, 50, 56, 58, 52, 53, 60, 56, 52, 52, 67, 51, 61, 57, 48,
+    53, 52, 59, 55, 54, 46, 48, 57, 55, 63, 53, 54, 49, 51, 52, 53,
+    57, 51, 64, 60, 44, 50, 54, 61, 51, 65, 50, 55, 60, 47, 51, 61,
+    65, 62, 47, 51, 60, 59, 60, 58, 53, 49, 46, 60, 48, 57, 57, 55,
+    51, 53, 54, 61, 46, 60, 54, 59, 52, 53, 63, 58, 46, 55, 61, 58,
+    61, 50, 54, 56, 53, 51, 55, 59, 48, 67, 63, 50, 58, 51, 59, 40,
+    44, 60, 58, 50, 56, 53, 54, 60, 55, 60, 59, 49, 53, 55, 48, 52,
+    50, 58, 54, 61, 44, 50, 57, 48, 48, 60, 52, 55, 50, 55, 54, 44,
+    66, 56, 46, 60, 51, 58, 47, 50, 64, 61, 53, 56, 58, 51, 60, 54,
+    51, 57, 56, 45, 63, 59, 56, 49, 51, 63, 52, 53, 54, 57, 51, 54,
+    59, 56, 51, 53, 57, 53, 62, 53, 49, 61, 54, 49, 56, 56, 51, 61,
+    56, 58, 55, 65, 51, 57, 47, 55, 45, 49, 50, 54, 57, 49, 64, 55,
+    64, 44, 53, 51, 46, 62, 43, 50, 50, 54, 56, 61, 43, 54, 64, 52,
+    57, 50, 64, 54, 55, 64, 55, 56, 48, 47, 58, 38, 64, 49, 51, 43,
+    52, 44, 45, 52, 61, 57, 48, 60, 57, 61, 56, 54, 56, 67, 56, 65,
+    53, 45, 54, 57, 50, 58, 57, 56, 62, 53, 48, 59, 51, 57, 56, 55,
+    56, 52, 58, 62, 58, 55, 50, 58, 50, 51, 54, 54, 55, 43, 57, 58,
+    54, 50, 65, 65, 50, 56, 57, 59, 58, 49, 51, 58, 67, 50, 61, 52,
+    48, 58, 60, 60, 51, 53, 46, 62, 57, 63, 56, 58, 57, 49, 54, 52,
+    64, 56, 51, 45, 57, 49, 52, 54, 55, 54, 47, 59, 56, 54, 59, 52,
+    53, 52, 60, 56, 62, 48, 59, 60, 45, 55, 50, 55, 53, 66, 51, 64,
+    63, 47, 62, 64, 60, 59, 47, 61, 54, 53, 56, 48, 57, 58, 50, 57,
+    52, 60, 45, 51, 56, 56, 50, 51, 52, 46, 60, 49, 59, 54, 62, 51,
+    61, 59, 66, 45, 59, 53, 40, 50, 61, 48, 65, 60, 56, 57, 51, 53,
+    55, 63, 51, 64, 52, 51, 54, 59, 59, 50, 54, 59, 54, 52, 48, 59,
+    55, 54, 54, 54, 41, 60, 53, 59, 52, 47, 60, 60, 57, 60, 52, 57,
+    58, 48, 61, 67, 50, 51, 58, 57, 49, 52, 52, 50, 52, 51, 52, 51,
+    53, 53, 52, 52, 52, 57, 49, 57, 51, 55, 60, 56, 54, 61, 63, 51,
+    54, 47, 52, 55, 49, 52, 51, 66, 48, 53, 50, 48, 60, 45, 60, 53,
+    54, 55, 63, 53, 59, 47, 50, 58, 54, 55, 49, 51, 58, 57, 51, 48,
+    48, 56, 54, 50, 53, 59, 53, 52, 60, 59, 52, 50, 54, 59, 50, 46,
+    56, 55, 55, 56, 45, 61, 56, 58, 48, 58, 53, 59, 55, 59, 46, 53,
+    58, 43, 53, 60, 57, 59, 48, 57, 56, 58, 56, 54, 53, 55, 55, 51,
+    58, 49, 46, 51, 51, 51, 59, 59, 53, 57, 44, 65, 62, 57, 55, 48,
+    57, 47, 54, 55, 61, 55, 64, 60, 54, 45, 55, 53, 50, 54, 53, 52,
+    57, 63, 49, 54, 58, 50, 52, 51, 46, 49, 49, 63, 55, 58, 57, 52,
+    48, 53, 51, 60, 52, 38, 63, 59, 51, 48, 55, 50, 57, 53, 54, 45,
+    59, 57, 57, 49, 57, 54, 62, 58, 54, 55, 50, 42, 47, 51, 52, 55,
+    56, 52, 62, 48, 53, 57, 62, 58, 41, 63, 69, 49, 61, 49, 51, 58,
+    53, 46, 50, 54, 52, 58, 48, 55, 60, 45, 54, 55, 47, 50, 58, 53,
+    63, 53, 59, 65, 52, 57, 60, 48, 61, 48, 50, 60, 53, 51, 58, 59,
+    45, 52, 59, 56, 59, 45, 62, 57, 54, 50, 51, 43, 60, 59, 46, 53,
+    52, 48, 70, 52, 61, 60, 61, 56, 48, 62, 62, 53, 60, 53, 49, 49,
+    57, 49, 47, 53, 61, 64, 55, 58, 50, 50, 50, 62, 59, 62, 49, 56,
+    61, 53, 50, 56, 56, 55, 51, 58, 63, 47, 49, 59, 56, 55, 51, 56,
+    47, 57, 59, 61, 48, 59, 63, 55, 61, 59, 57, 49, 60, 51, 56, 50,
+    50, 56, 42, 56, 49, 59, 57, 46, 64, 58, 58, 59, 41, 56, 58, 64,
+    68, 49, 57, 55, 58, 58, 51, 42, 53, 53, 58, 46, 56, 64, 58, 51,
+    63, 54, 58, 55, 57, 45, 51, 56, 57, 53, 48, 56, 56, 55, 54, 55,
+    59, 61, 48, 60, 46, 48, 52, 49, 51, 52, 57, 62, 56, 55, 59, 55,
+    46, 48, 57, 57, 59, 51, 47, 63, 55, 55, 47, 52, 59, 49, 57, 51,
+    56, 66, 57, 62, 46, 58, 57, 46, 65, 56, 50, 58, 55, 72, 61, 57,
+    58, 58, 52, 55, 56, 58, 58, 51, 40, 55, 43, 62, 61, 54, 56, 51,
+    59, 56, 61, 55, 56, 57, 60, 54, 52, 55, 44, 52, 58, 48, 56, 51,
+    52, 64, 63, 51, 47, 56, 52, 55, 48, 58, 43, 49, 52, 47, 54, 58,
+    56, 47, 58, 52, 55, 47, 64, 44, 52, 54, 55, 59, 56, 63, 57, 53,
+    51, 57, 58, 57, 49, 59, 47, 51, 58, 54, 55, 50, 59, 49, 52, 48,
+    49, 55, 60, 51, 59, 44, 50, 57, 54, 51, 58, 51, 53, 53, 59, 50,
+    48, 50, 68, 55, 62, 43, 50, 52, 53, 51, 54, 43, 62, 57, 55, 56,
+    59, 52, 56, 50, 59, 52, 50, 49, 63, 59, 56, 59, 60, 51, 46, 56,
+    54, 54, 50, 44, 62, 55, 68, 52, 57, 60, 55, 58, 49, 55, 55, 51,
+    66, 58, 46, 55, 54, 45, 60, 54, 57, 53, 56, 49, 59, 60, 45, 54,
+    49, 58, 47, 51, 53, 51, 64, 48, 60, 49, 51, 52, 59, 53, 56, 50,
+    48, 56, 51, 51, 54, 61, 56, 61, 53, 54, 55, 52, 66, 65, 51, 58,
+    61, 56, 63, 60, 56, 57, 53, 53, 50, 54, 51, 64, 50, 61, 49, 55,
+    59, 59, 57, 57, 47, 53, 55, 51, 45, 54, 47, 50, 61, 53, 54, 46,
+    53, 59, 53, 56, 46, 44, 42, 50, 50, 60, 58, 53, 56, 57, 50, 55,
+    50, 56, 53, 56, 49, 46, 54, 51, 40, 47, 52, 55, 56, 43, 51, 60,
+    57, 54, 56, 60, 55, 60, 56, 57, 57, 52, 51, 48, 58, 48, 55, 59,
+    42, 50, 58, 61, 48, 66, 51, 57, 56, 54, 53, 55, 56, 56, 61, 56,
+    51, 52, 63, 53, 52, 61, 51, 61, 60, 49, 52, 52, 54, 51, 57, 51,
+    63, 53, 66, 53, 46, 53, 49, 56, 60, 51, 64, 57, 45, 51, 52, 57,
+    62, 49, 50, 58, 55, 59, 53, 47, 56, 50, 57, 47, 54, 64, 51, 54,
+    53, 56, 48, 53, 50, 56, 57, 48, 54, 59, 69, 48, 62, 56, 49, 50,
+    55, 56, 56, 56, 59, 51, 57, 49, 59, 59, 41, 47, 63, 56, 54, 61,
+    53, 60, 56, 51, 55, 50, 57, 52, 60, 48, 54, 51, 50, 66, 55, 49,
+    53, 52, 53, 51, 63, 58, 44, 62, 40, 53, 57, 47, 60, 54, 50, 54,
+    57, 63, 53, 49, 55, 46, 60, 58, 60, 63, 51, 46, 67, 52, 54, 61,
+    53, 60, 57, 56, 59, 45, 59, 52, 56, 56, 54, 54, 42, 58, 60, 57,
+    57, 47, 65, 52, 61, 50, 55, 50, 62, 57, 49, 63, 61, 47, 54, 60,
+    59, 49, 59, 61, 51, 59, 47, 62, 45, 57, 60, 47, 50, 59, 48, 58,
+    53, 63, 61, 51, 49, 54, 55, 60, 48, 48, 62, 52, 52, 49, 50, 43,
+    56, 54, 54, 42, 50, 58, 59, 60, 49, 56, 59, 57, 53, 56, 50, 62,
+    63, 50, 52, 47, 56, 53, 46, 69, 50, 47, 52, 43, 55, 56, 55, 55,
+    52, 51, 53, 58, 48, 53, 57, 61, 54, 58, 61, 51, 63, 48, 56, 61,
+    55, 49, 61, 51, 54, 50, 47, 60, 50, 53, 56, 46, 50, 50, 56, 53,
+    49, 47, 56, 58, 52, 53, 50, 44, 50, 53, 54, 57, 55, 56, 52, 64,
+    53, 52, 53, 53, 52, 53, 55, 64, 53, 51, 50, 56, 56, 51, 66, 61,
+    60, 57, 50, 54, 50, 50, 59, 51, 58, 60, 54, 63, 55, 55, 50, 49,
+    57, 49, 54, 58, 58, 56, 56, 66, 61, 48, 44, 57, 52, 62, 49, 49,
+    58, 58, 55, 59, 55, 46, 57, 54, 42, 59, 57, 56, 55, 65, 59, 54,
+    62, 56, 54, 48, 43, 62, 48, 57, 52, 48, 58, 56, 59, 65, 57, 51,
+    50, 56, 51, 52, 62, 55, 63, 55, 59, 56, 61, 51, 53, 56, 60, 54,
+    64, 48, 64, 45, 59, 57, 54, 66, 44, 45, 62, 64, 55, 51, 58, 50,
+    49, 50, 45, 60, 60, 55, 54, 62, 53, 58, 43, 55, 54, 49, 55, 54,
+    58, 53, 69, 59, 51, 54, 56, 46, 60, 59, 60, 51, 52, 57, 47, 50,
+    44, 61, 54, 57, 65, 55, 47, 55, 51, 64, 57, 50, 53, 59, 63, 59,
+    58, 58, 56, 55, 51, 53, 59, 55, 54, 54, 45, 57, 51, 57, 60, 61,
+    50, 56, 55, 52, 61, 54, 57, 51, 49, 60, 50, 46, 61, 51, 47, 56,
+    61, 53, 43, 61, 54, 58, 47, 59, 55, 51, 57, 58, 56, 34, 53, 49,
+    48, 51, 53, 54, 47, 53, 53, 49, 64, 46, 53, 60, 59, 58, 62, 56,
+    62, 56, 50, 58, 61, 63, 58, 54, 51, 47, 59, 45, 50, 55, 51, 59,
+    54, 55, 56, 51, 57, 53, 53, 44, 59, 55, 54, 55, 53, 54, 60, 53,
+    52, 58, 51, 55, 53, 59, 52, 64, 58, 51, 57, 56, 55, 58, 46, 51,
+    55, 55, 65, 53, 50, 58, 56, 52, 61, 52, 69, 49, 50, 56, 53, 57,
+    56, 50, 62, 54, 57, 55, 51, 52, 55, 57, 55, 51, 51, 68, 56, 52,
+    58, 67, 45, 53, 53, 49, 57, 45, 43, 52, 48, 53, 54, 51, 52, 50,
+    53, 51, 52, 65, 47, 42, 62, 50, 51, 60, 58, 57, 66, 55, 59, 52,
+    52, 60, 50, 52, 51, 51, 56, 64, 51, 60, 53, 51, 48, 62, 58, 55,
+    47, 61, 60, 54, 40, 52, 62, 42, 58, 55, 55, 62, 50, 42, 44, 47,
+    56, 50, 54, 52, 62, 56, 57, 50, 50, 46, 64, 52, 49, 62, 51, 55,
+    65, 49, 59, 52, 56, 56, 56, 57, 54, 45, 59, 50, 53, 44, 48, 55,
+    49, 59, 64, 55, 54, 55, 57, 59, 41, 63, 56, 56, 66, 44, 65, 52,
+    40, 54, 59, 52, 55, 50, 53, 62, 67, 64, 57, 64, 50, 55, 54, 53,
+    61, 47, 57, 46, 54, 55, 54, 58, 54, 58, 61, 52, 56, 60, 65, 58,
+    63, 49, 51, 49, 50, 46, 57, 50, 55, 49, 53, 59, 49, 62, 54, 41,
+    72, 53, 54, 59, 61, 59, 55, 55, 66, 59, 58, 51, 51, 59, 62, 58,
+    52, 50, 43, 53, 43, 57, 57, 62, 60, 52, 49, 54, 50, 51, 52, 69,
+    44, 60, 52, 55, 49, 52, 56, 56, 48, 63, 51, 52, 47, 55, 54, 57,
+    57, 55, 58, 56, 59, 55, 52, 54, 60, 53, 56, 58, 54, 62, 53, 51,
+    53, 58, 52, 55, 58, 54, 50, 64, 39, 53, 45, 53, 57, 53, 54, 55,
+    53, 51, 56, 59, 56, 54, 61, 43, 50, 53, 57, 52, 57, 60, 53, 59,
+    45, 60, 62, 42, 51, 63, 55, 49, 64, 55, 50, 53, 43, 54, 54, 62,
+    54, 55, 51, 46, 64, 63, 60, 63, 56, 49, 56, 44, 53, 52, 53, 51,
+    52, 46, 53, 57, 54, 57, 56, 59, 50, 52, 54, 53, 58, 47, 47, 55,
+    45, 52, 54, 59, 50, 58, 56, 51, 62, 54, 46, 47, 51, 63, 55, 57,
+    52, 61, 55, 48, 57, 57, 57, 62, 45, 48, 59, 50, 55, 47, 69, 57,
+    45, 44, 51, 60, 44, 59, 49, 55, 50, 58, 62, 64, 54, 59, 52, 57,
+    46, 44, 57, 52, 44, 52, 58, 54, 53, 45, 50, 45, 55, 55, 55, 46,
+    62, 54, 55, 50, 51, 49, 61, 46, 42, 52, 51, 49, 60, 55, 56, 51,
+    49, 64, 51, 52, 62, 51, 47, 48, 54, 51, 60, 53, 53, 54, 55, 58,
+    51, 59, 58, 58, 51, 50, 56, 53, 64, 54, 55, 58, 64, 57, 57, 56,
+    52, 56, 54, 66, 58, 50, 61, 53, 58, 52, 55, 55, 55, 50, 56, 54,
+    58, 52, 55, 57, 48, 59, 56, 57, 53, 57, 49, 53, 52, 50, 56, 61,
+    58, 55, 52, 54, 54, 59, 49, 46, 46, 66, 49, 57, 53, 62, 62, 51,
+    50, 52, 52, 57, 58, 51, 52, 52, 59, 54, 49, 55, 56, 53, 53, 60,
+    53, 49, 57, 62, 55, 55, 57, 54, 53, 51, 57, 43, 61, 61, 51, 46,
+    47, 57, 61, 50, 61, 54, 50, 56, 47, 54, 53, 55, 55, 52, 59, 51,
+    56, 58, 58, 53, 50, 51, 60, 50, 48, 59, 48, 51, 52, 62, 43, 48,
+    58, 60, 56, 49, 56, 56, 56, 56, 55, 58, 52, 64, 62, 45, 53, 53,
+    50, 53, 57, 43, 65, 53, 48, 57, 54, 54, 54, 65, 44, 60, 65, 57,
+    55, 57, 56, 54, 45, 58, 56, 58, 50, 61, 49, 57, 58, 53, 51, 43,
+    55, 62, 57, 55, 53, 56, 59, 55, 52, 53, 59, 52, 65, 42, 60, 53,
+    55, 50, 55, 52, 54, 49, 57, 55, 61, 45, 59, 53, 48, 57, 57, 56,
+    49, 56, 51, 51, 54, 49, 59, 53, 57, 56, 52, 48, 56, 54, 72, 55,
+    55, 55, 58, 48, 59, 55, 58, 60, 58, 59, 57, 57, 60, 58, 49, 50,
+    51, 57, 59, 62, 52, 63, 58, 56, 54, 57, 62, 51, 59, 55, 51, 44,
+    55, 48, 50, 54, 48, 56, 57, 56, 68, 58, 59, 60, 58, 54, 69, 52,
+    52, 53, 55, 62, 55, 56, 58, 46, 51, 55, 60, 52, 61, 50, 57, 49,
+    48, 54, 66, 52, 51, 59, 51, 57, 56, 50, 55, 58, 57, 49, 51, 48,
+    61, 61, 61, 61, 53, 57, 55, 64, 55, 54, 57, 60, 49, 59, 56, 54,
+    54, 42, 54, 56, 56, 53, 60, 63, 46, 59, 62, 55, 54, 55, 52, 62,
+    52, 52, 56, 51, 60, 49, 59, 55, 60, 51, 56, 54, 58, 59, 57, 56,
+    54, 51, 60, 53, 59, 57, 47, 48, 48, 47, 67, 50, 46, 53, 51, 54,
+    57, 57, 58, 50, 60, 57, 48, 48, 65, 56, 49, 63, 53, 58, 48, 54,
+    54, 62, 46, 61, 54, 52, 57, 47, 56, 65, 50, 59, 55, 50, 54, 53,
+    53, 40, 57, 50, 50, 50, 61, 50, 51, 52, 54, 54, 53, 58, 60, 51,
+    56, 58, 57, 61, 48, 61, 54, 61, 58, 47, 53, 58, 50, 56, 52, 68,
+    50, 56, 53, 55, 61, 59, 59, 46, 56, 42, 42, 48, 47, 52, 47, 60,
+    56, 40, 57, 59, 60, 63, 57, 62, 56, 50, 54, 53, 54, 53, 53, 54,
+    53, 45, 53, 60, 49, 52, 53, 56, 56, 57, 48, 61, 50, 57, 57, 46,
+    54, 61, 58, 55, 48, 55, 52, 53, 52, 59, 60, 62, 51, 61, 58, 52,
+    47, 55, 58, 56, 59, 50, 62, 57, 56, 47, 55, 54, 58, 55, 52, 63,
+    62, 48, 57, 45, 59, 51, 43, 54, 55, 61, 53, 59, 51, 42, 55, 50,
+    54, 58, 57, 44, 54, 58, 61, 53, 58, 45, 53, 55, 50, 54, 43, 67,
+    57, 57, 57, 56, 53, 59, 56, 60, 63, 66, 54, 49, 44, 65, 55, 47,
+    52, 47, 48, 59, 57, 52, 61, 37, 48, 64, 46, 63, 51, 61, 50, 53,
+    65, 59, 47, 61, 51, 65, 50, 66, 60, 62, 47, 55, 60, 49, 53, 55,
+    59, 51, 53, 56, 61, 65, 55, 55, 51, 55, 50, 62, 51, 52, 53, 54,
+    56, 52, 64, 48, 49, 52, 49, 56, 58, 50, 38, 62, 53, 47, 49, 56,
+    51, 48, 54, 50, 55, 59, 56, 70, 54, 44, 62, 55, 53, 49, 53, 61,
+    49, 57, 55, 52, 58, 44, 50, 55, 55, 47, 56, 65, 54, 50, 54, 44,
+    58, 55, 55, 45, 47, 56, 47, 55, 59, 58, 58, 61, 59, 66, 59, 58,
+    47, 64, 61, 56, 52, 55, 58, 48, 58, 52, 61, 54, 68, 48, 57, 51,
+    65, 67, 49, 55, 52, 54, 57, 57, 55, 63, 73, 49, 61, 53, 50, 51,
+    61, 46, 43, 60, 58, 40, 48, 56, 54, 49, 60, 59, 48, 50, 54, 59,
+    59, 54, 55, 61, 55, 54, 48, 63, 55, 48, 49, 51, 56, 48, 56, 63,
+    53, 48, 61, 50, 59, 50, 50, 47, 55, 56, 59, 53, 50, 50, 49, 58,
+    62, 60, 54, 61, 41, 52, 61, 57, 53, 50, 53, 52, 46, 49, 48, 61,
+    50, 59, 53, 43, 60, 56, 49, 52, 55, 53, 59, 51, 47, 44, 61, 46,
+    52, 53, 49, 54, 50, 58, 55, 55, 58, 50, 63, 56, 58, 64, 55, 39,
+    62, 57, 42, 50, 44, 51, 58, 56, 50, 55, 45, 50, 60, 49, 65, 45,
+    48, 59, 63, 52, 55, 58, 58, 61, 58, 60, 52, 58, 52, 51, 52, 55,
+    55, 56, 51, 47, 62, 54, 55, 56, 42, 60, 44, 51, 58, 55, 53, 65,
+    55, 69, 43, 53, 55, 54, 46, 55, 63, 61, 48, 51, 60, 53, 43, 48,
+    49, 50, 50, 49, 53, 56, 60, 60, 50, 58, 58, 58, 50, 45, 53, 53,
+    57, 54, 47, 48, 60, 59, 45, 62, 51, 59, 42, 55, 64, 54, 62, 55,
+    46, 51, 61, 46, 44, 57, 50, 57, 51, 64, 56, 56, 49, 56, 54, 59,
+    58, 53, 60, 51, 50, 55, 53, 38, 58, 50, 53, 59, 49, 56, 45, 55,
+    54, 52, 50, 56, 48, 59, 62, 53, 49, 56, 54, 54, 58, 59, 57, 66,
+    54, 43, 55, 53, 53, 50, 64, 43, 53, 55, 56, 55, 64, 47, 60, 57,
+    54, 51, 52, 58, 57, 51, 62, 48, 55, 58, 59, 52, 50, 54, 51, 51,
+    55, 52, 59, 54, 62, 53, 62, 63, 56, 53, 49, 58, 54, 51, 58, 66,
+    61, 53, 51, 59, 49, 48, 51, 49, 55, 53, 54, 57, 59, 63, 53, 45,
+    51, 43, 45, 65, 61, 55, 57, 48, 51, 56, 54, 55, 58, 50, 59, 69,
+    50, 49, 58, 66, 50, 56, 49, 58, 52, 48, 60, 47, 48, 54, 61, 54,
+    56, 48, 61, 57, 54, 56, 66, 52, 52, 50, 56, 62, 63, 55, 54, 54,
+    56, 50, 53, 50, 43, 52, 56, 65, 60, 49, 42, 48, 65, 56, 60, 51,
+    47, 55, 52, 58, 51, 53, 46, 50, 63, 58, 48, 48, 51, 53, 58, 47,
+    66, 52, 52, 60, 48, 54, 52, 56, 60, 65, 56, 52, 52, 54, 56, 66,
+    59, 49, 59, 42, 45, 56, 59, 55, 50, 51, 52, 59, 60, 55, 56, 54,
+    53, 45, 62, 52, 52, 54, 57, 58, 52, 55, 55, 65, 50, 52, 49, 56,
+    55, 65, 61, 54, 57, 62, 55, 53, 51, 55, 53, 57, 49, 50, 52, 58,
+    61, 50, 54, 53, 57, 58, 49, 63, 63, 45, 50, 60, 49, 50, 59, 46,
+    52, 49, 50, 50, 54, 51, 52, 56, 51, 59, 59, 54, 50, 55, 50, 54,
+    61, 62, 52, 49, 48, 65, 57, 55, 60, 52, 53, 53, 49, 55, 52, 60,
+    50, 54, 60, 53, 53, 58, 51, 63, 51, 69, 53, 56, 61, 49, 59, 65,
+    58, 58, 59, 49, 52, 58, 49, 49, 54, 50, 56, 55, 60, 52, 59, 50,
+    53, 49, 63, 51, 59, 53, 60, 49, 44, 54, 53, 59, 47, 62, 52, 50,
+    54, 45, 44, 54, 64, 60, 54, 44, 54, 50, 48, 55, 58, 50, 46, 60,
+    48, 60, 50, 58, 63, 47, 57, 60, 59, 63, 58, 55, 59, 44, 56, 61,
+    58, 50, 48, 64, 53, 60, 57, 55, 60, 52, 56, 49, 65, 54, 55, 50,
+    63, 59, 50, 54, 51, 52, 61, 54, 58, 59, 54, 65, 56, 51, 50, 51,
+    53, 62, 55, 48, 55, 55, 53, 52, 48, 58, 65, 50, 62, 58, 42, 50,
+    55, 50, 54, 60, 55, 65, 54, 53, 54, 55, 49, 48, 57, 56, 52, 50,
+    60, 59, 48, 53, 55, 64, 53, 66, 56, 58, 53, 51, 50, 55, 49, 60,
+    64, 50, 49, 47, 48, 57, 58, 49, 58, 55, 56, 52, 48, 52, 56, 49,
+    47, 61, 56, 61, 55, 56, 55, 51, 61, 41, 56, 62, 55, 60, 63, 55,
+    56, 51, 51, 57, 50, 44, 60, 53, 55, 55, 49, 54, 62, 47, 54, 55,
+    48, 57, 50, 49, 56, 57, 48, 69, 60, 57, 58, 62, 58, 47, 64, 42,
+    58, 40, 52, 62, 55, 56, 62, 51, 53, 52, 55, 55, 52, 58, 53, 62,
+    46, 45, 60, 48, 55, 50, 52, 49, 58, 48, 49, 51, 50, 54, 52, 63,
+    57, 58, 50, 54, 53, 58, 51, 54, 53, 48, 65, 56, 43, 47, 56, 45,
+    61, 58, 55, 55, 54, 46, 55, 44, 59, 57, 58, 54, 58, 50, 58, 51,
+    63, 53, 45, 58, 44, 66, 48, 59, 47, 56, 55, 55, 58, 55, 53, 47,
+    56, 57, 57, 51, 47, 52, 53, 54, 58, 46, 60, 66, 55, 57, 60, 57,
+    54, 58, 42, 59, 49, 40, 56, 50, 53, 50, 51, 47, 49, 60, 49, 55,
+    53, 41, 52, 53, 55, 50, 51, 51, 50, 53, 54, 49, 47, 54, 54, 53,
+    55, 51, 64, 56, 49, 60, 54, 53, 63, 55, 52, 53, 58, 52, 50, 61,
+    50, 45, 48, 63, 67, 50, 62, 51, 54, 51, 56, 51, 58, 53, 45, 49,
+    54, 58, 64, 56, 51, 56, 58, 44, 58, 54, 55, 57, 56, 52, 63, 50,
+    62, 58, 57, 50, 60, 56, 58, 54, 55, 55, 67, 49, 54, 54, 50, 55,
+    50, 56, 47, 51, 55, 56, 52, 52, 61, 50, 61, 43, 52, 46, 58, 66,
+    62, 55, 53, 55, 54, 49, 43, 57, 53, 59, 48, 58, 50, 57, 53, 45,
+    52, 58, 58, 60, 59, 54, 53, 54, 53, 51, 59, 60, 46, 51, 49, 54,
+    58, 52, 60, 52, 40, 53, 59, 50, 49, 53, 55, 63, 48, 62, 50, 47,
+    50, 47, 57, 54, 44, 68, 52, 47, 56, 58, 53, 50, 64, 53, 47, 54,
+    56, 53, 51, 64, 47, 59, 51, 41, 52, 46, 60, 53, 61, 64, 54, 56,
+    50, 43, 58, 46, 50, 49, 58, 51, 57, 47, 58, 50, 49, 50, 50, 53,
+    61, 60, 44, 50, 52, 54, 55, 47, 49, 62, 59, 53, 49, 58, 53, 66,
+    54, 51, 54, 55, 61, 52, 40, 54, 55, 49, 51, 63, 55, 55, 63, 49,
+    54, 55, 51, 57, 49, 57, 60, 60, 54, 64, 48, 58, 49, 60, 45, 57,
+    60, 63, 59, 53, 58, 50, 58, 58, 58, 53, 59, 64, 55, 51, 49, 53,
+    52, 58, 64, 57, 56, 41, 55, 59, 58, 57, 52, 51, 62, 68, 55, 57,
+    63, 54, 61, 53, 58, 58, 55, 53, 52, 45, 49, 59, 58, 57, 51, 61,
+    52, 48, 51, 54, 51, 59, 49, 57, 69, 48, 48, 68, 60, 53, 56, 53,
+    54, 58, 41, 64, 54, 46, 50, 52, 59, 59, 61, 51, 60, 57, 57, 50,
+    51, 52, 52, 41, 49, 63, 58, 57, 48, 44, 54, 56, 51, 49, 53, 56,
+    60, 59, 56, 59, 56, 49, 52, 56, 49, 53, 57, 48, 47, 46, 60, 43,
+    52, 58, 53, 47, 56, 53, 54, 54, 53, 50, 57, 54, 64, 51, 49, 60,
+    69, 59, 54, 57, 60, 52, 52, 59, 59, 54, 54, 56, 52, 52, 54, 56,
+    53, 53, 51, 60, 48, 54, 56, 51, 64, 50, 53, 48, 49, 53, 52, 54,
+    50, 52, 52, 52, 57, 59, 59, 52, 60, 66, 56, 56, 53, 51, 50, 48,
+    51, 52, 46, 63, 46, 53, 54, 53, 56, 62, 48, 47, 46, 60, 53, 56,
+    63, 47, 65, 40, 42, 55, 58, 57, 48, 48, 51, 53, 53, 56, 47, 63,
+    60, 42, 48, 54, 51, 61, 65, 54, 43, 57, 47, 61, 65, 66, 42, 63,
+    52, 65, 42, 55, 55, 65, 57, 54, 50, 56, 52, 52, 49, 51, 54, 61,
+    52, 49, 54, 52, 55, 52, 42, 55, 57, 60, 56, 48, 57, 44, 46, 58,
+    55, 51, 49, 58, 66, 53, 55, 58, 44, 51, 56, 54, 53, 52, 41, 55,
+    51, 49, 43, 62, 56, 62, 54, 49, 59, 57, 54, 49, 56, 58, 59, 52,
+    50, 51, 58, 55, 50, 55, 51, 55, 59, 47, 52, 48, 50, 50, 51, 50,
+    56, 57, 61, 52, 52, 44, 48, 60, 55, 65, 56, 60, 52, 56, 55, 60,
+    60, 47, 51, 56, 54, 58, 57, 58, 58, 56, 64, 47, 61, 59, 58, 49,
+    50, 54, 56, 58, 58, 56, 55, 58, 55, 54, 47, 52, 62, 51, 65, 48,
+    53, 66, 57, 52, 52, 57, 53, 43, 52, 43, 49, 58, 50, 58, 52, 61,
+    53, 55, 66, 52, 58, 56, 53, 49, 71, 57, 59, 56, 49, 53, 49, 53,
+    45, 59, 59, 57, 48, 50, 52, 59, 53, 55, 50, 49, 55, 46, 51, 56,
+    51, 49, 61, 54, 50, 57, 58, 46, 54, 57, 58, 55, 58, 46, 60, 53,
+    53, 47, 64, 49, 50, 57, 55, 48, 52, 60, 46, 53, 48, 53, 47, 51,
+    63, 49, 62, 47, 51, 44, 50, 54, 61, 54, 57, 61, 62, 55, 52, 57,
+    50, 56, 56, 54, 57, 56, 59, 49, 48, 50, 64, 50, 63, 62, 56, 63,
+    65, 59, 50, 57, 52, 53, 58, 56, 61, 47, 64, 59, 51, 51, 64, 50,
+    46, 58, 57, 49, 52, 57, 48, 55, 57, 46, 62, 54, 59, 52, 55, 58,
+    56, 53, 49, 49, 48, 56, 58, 53, 63, 48, 44, 57, 53, 56, 52, 51,
+    52, 52, 57, 60, 46, 53, 63, 50, 55, 50, 48, 59, 50, 55, 58, 50,
+    47, 59, 51, 62, 54, 50, 52, 57, 58, 53, 43, 55, 56, 68, 55, 43,
+    58, 58, 61, 54, 54, 58, 56, 57, 56, 52, 59, 55, 44, 54, 54, 56,
+    55, 68, 63, 48, 47, 56, 53, 53, 60, 56, 58, 51, 59, 57, 54, 47,
+    48, 51, 59, 55, 44, 55, 58, 52, 61, 60, 58, 54, 58, 55, 55, 61,
+    57, 62, 56, 58, 58, 51, 53, 58, 70, 56, 64, 49, 59, 60, 47, 55,
+    61, 60, 70, 62, 55, 55, 55, 59, 64, 57, 45, 50, 50, 56, 60, 51,
+    52, 46, 54, 53, 52, 58, 56, 54, 57, 47, 59, 61, 53, 48, 58, 58,
+    54, 48, 53, 51, 57, 59, 57, 48, 50, 53, 56, 54, 49, 46, 49, 57,
+    54, 51, 47, 58, 70, 57, 47, 52, 49, 54, 54, 51, 58, 55, 49, 57,
+    47, 60, 56, 51, 47, 63, 59, 48, 55, 55, 58, 55, 54, 44, 58, 48,
+    45, 48, 59, 55, 56, 50, 60, 46, 57, 54, 52, 50, 50, 57, 57, 54,
+    61, 53, 52, 55, 62, 59, 58, 56, 54, 58, 55, 55, 54, 53, 51, 49,
+    66, 52, 52, 58, 56, 49, 55, 53, 50, 49, 46, 55, 51, 56, 54, 49,
+    48, 48, 60, 53, 46, 59, 46, 60, 55, 44, 55, 63, 60, 44, 54, 48,
+    58, 59, 58, 53, 53, 54, 57, 50, 52, 53, 50, 57, 56, 62, 52, 50,
+    54, 66, 56, 57, 54, 61, 55, 52, 53, 52, 46, 54, 55, 46, 50, 49,
+    52, 51, 52, 52, 57, 50, 51, 56, 56, 67, 56, 50, 54, 58, 56, 58,
+    49, 51, 58, 59, 54, 62, 57, 51, 44, 50, 54, 56, 53, 48, 61, 58,
+    55, 43, 55, 53, 51, 57, 48, 51, 65, 52, 58, 56, 57, 42, 64, 58,
+    58, 56, 51, 58, 52, 58, 52, 51, 48, 50, 53, 50, 51, 54, 56, 60,
+    55, 60, 46, 60, 53, 67, 54, 50, 56, 55, 56, 54, 49, 68, 54, 56,
+    54, 50, 54, 53, 51, 48, 64, 61, 56, 62, 51, 54, 53, 55, 56, 63,
+    51, 59, 60, 47, 54, 54, 52, 51, 57, 56, 48, 52, 52, 46, 49, 54,
+    59, 71, 56, 59, 45, 61, 53, 59, 52, 50, 46, 59, 61, 55, 50, 54,
+    54, 50, 50, 56, 54, 54, 48, 59, 51, 59, 61, 50, 53, 60, 54, 56,
+    55, 57, 58, 54, 46, 49, 55, 50, 61, 52, 59, 55, 58, 51, 56, 54,
+    51, 56, 60, 61, 45, 53, 59, 57, 51, 48, 61, 61, 57, 56, 58, 59,
+    58, 47, 57, 57, 43, 55, 56, 65, 57, 53, 54, 52, 41, 54, 54, 54,
+    60, 53, 60, 56, 48, 64, 51, 48, 57, 54, 54, 62, 56, 52, 47, 52,
+};
+
+std::uint32_t const primedist::pi_data::totals[] = {
+    0, 22525, 42445, 61582, 80265, 98610, 116684, 134505,
+    152252, 169789, 187134, 204471, 221603, 238769, 255659, 272645,
+    289511, 306211, 322968, 339603, 356244, 372805, 389247, 405659,
+    422062, 438410, 454714, 471045, 487304, 503479, 519628, 535763,
+    551814, 567846, 583965, 599970, 615911, 631850, 647786, 663602,
+    679461, 695358, 711235, 727008, 742813, 758496, 774276, 790009,
+    805680, 821394, 837099, 852666, 868221, 883741, 899394, 914920,
+    930477, 946062, 961582, 976995, 992489, 1007937, 1023404, 1038813,
+    1054172, 1069590, 1085007, 1100434, 1115821, 1131214, 1146489, 1161813,
+    1177129, 1192405, 1207706, 1222953, 1238254, 1253430, 1268706, 1283897,
+    1299069, 1314336, 1329478, 1344597, 1359844, 1374995, 1390209, 1405224,
+    1420307, 1435475, 1450624, 1465691, 1480792, 1495824, 1510907, 1526009,
+    1541064, 1556091, 1571124, 1586058, 1601049, 1616091, 1631062, 1646023,
+    1661069, 1676012, 1691027, 1705908, 1720911, 1735821, 1750773, 1765675,
+    1780641, 1795505, 1810325, 1825221, 1840123, 1855064, 1870000, 1884836,
+    1899787, 1914604, 1929351, 1944137, 1958959, 1973815, 1988592, 2003438,
+    2018258, 2033041, 2047823, 2062615, 2077422, 2092121, 2106773, 2121490,
+    2136155, 2150866, 2165632, 2180357, 2195099, 2209790, 2224543, 2239227,
+    2253870, 2268594, 2283246, 2297930, 2312564, 2327270, 2342005, 2356617,
+    2371383, 2386044, 2400758, 2415481, 2430045, 2444622, 2459273, 2473830,
+    2488465, 2503098, 2517658, 2532168, 2546712, 2561300, 2575964, 2590503,
+    2604971, 2619535, 2634133, 2648631, 2663168, 2677748, 2692230, 2706858,
+    2721368, 2735946, 2750543, 2765037, 2779600, 2794043, 2808518, 2823060,
+    2837496, 2852008, 2866505, 2880964, 2895354, 2909794, 2924231, 2938673,
+    2953100, 2967608, 2982164, 2996630, 3011033, 3025430, 3039902, 3054340,
+    3068712, 3083169, 3097559, 3112044, 3126431, 3140786, 3155197, 3169628,
+    3183996, 3198346, 3212708, 3227087, 3241407, 3255724, 3270122, 3284461,
+    3298812, 3313132, 3327576, 3341903, 3356321, 3370582, 3385075, 3399376,
+    3413779, 3428077, 3442296, 3456625, 3470971, 3485303, 3499666, 3513899,
+    3528122, 3542456, 3556775, 3571007, 3585365, 3599658, 3614003, 3628192,
+    3642407, 3656644, 3670935, 3685231, 3699511, 3713695, 3727990, 3742239,
+    3756511, 3770746, 3785086, 3799291, 3813565, 3827655, 3841898, 3856066,
+    3870366, 3884501, 3898814, 3913085, 3927340, 3941563, 3955741, 3970015,
+    3984263, 3998433, 4012651, 4026818, 4040992, 4055130, 4069300, 4083449,
+    4097704, 4111917, 4126017, 4140216, 4154395, 4168497, 4182679, 4196850,
+    4211061, 4225175, 4239367, 4253578, 4267659, 4281840, 4295941, 4310047,
+    4324264, 4338368, 4352423, 4366485, 4380595, 4394760, 4408910, 4423085,
+    4437167, 4451372, 4465398, 4479463, 4493463, 4507642, 4521711, 4535793,
+    4549848, 4563957, 4577965, 4592061, 4606139, 4620221, 4634212, 4648310,
+    4662399, 4676420, 4690490, 4704553, 4718690, 4732897, 4746914, 4760967,
+    4774995, 4789093, 4803059, 4817137, 4831236, 4845183, 4859195, 4873160,
+    4887387, 4901264, 4915330, 4929304, 4943289, 4957229, 4971327, 4985335,
+    4999337, 5013321, 5027413, 5041398, 5055401, 5069407, 5083340, 5097287,
+    5111373, 5125441, 5139277, 5153332, 5167333, 5181381, 5195242, 5209129,
+    5223098, 5237201, 5251150, 5265091, 5279076, 5293110, 5307042, 5320973,
+    5334963, 5348843, 5362819, 5376847, 5390700, 5404621, 5418556, 5432499,
+    5446491, 5460398, 5474317, 5488440, 5502355, 5516339, 5530170, 5544201,
+    5558024, 5571935, 5585926, 5599883, 5613714, 5627699, 5641676, 5655542,
+    5669447, 5683406, 5697197, 5711124, 5724887, 5738820, 5752724,
+};